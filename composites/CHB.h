@@ -4,11 +4,13 @@
 #include <algorithm>
 
 #include "AudioMath.h"
+#include "Divider.h"
 #include "IComposite.h"
 #include "LookupTableFactory.h"
 #include "MultiLag.h"
 #include "ObjectCache.h"
 #include "poly.h"
+#include "PolySimd.h"
 #include "SinOscillator.h"
 #include "SqPort.h"
 
@@ -47,6 +49,12 @@ public:
  *
  * Performance measure for 1.0 = 42.44
  * reduced polynomial order to what we actually use (10), perf = 39.5
+ *
+ * Polyphonic input (AUDIO_INPUT if patched, otherwise CV_INPUT) runs the
+ * waveshaper in PolySimd, four voices at a time. Each voice has its own pitch,
+ * gain (ENV and GAIN inputs) and harmonic CV (H0..H9 inputs).
+ * Everything else is shared by all the voices.
+ * perfTest percent CPU: mono 0.66, 4 voices 0.93, 16 voices 2.5, 16 mono instances 11
  */
 template <class TBase>
 class CHB : public TBase
@@ -148,6 +156,14 @@ public:
      */
     void step() override;
 
+    /**
+     * Block processing entry point.
+     * The pitch is only updated once per control rate run, so if the
+     * pitch CV changes inside a run the output will be a little different
+     * from step(). Otherwise it is the same.
+     */
+    void process(const typename TBase::ProcessArgs& args, int frames) override;
+
     void onSampleRateChange()
     {
         knobToFilterL = makeLPFDirectFilterLookup<float>(this->engineGetSampleTime());
@@ -155,8 +171,19 @@ public:
 
     float _freq = 0;
 
+    static const int maxChannels = 16;
+
+    /**
+     * Number of voices we are currently generating.
+     */
+    int getNumChannels() const
+    {
+        return numChannels;
+    }
+
 private:
-    int cycleCount = 1;
+    Divider divider;
+    static const int divRate = 4;
     int clipCount = 0;
     int signalCount = 0;
     const int clipDuration = 4000;
@@ -173,6 +200,28 @@ private:
 
     MultiLag<12> lag;
 
+    /**
+     * Poly input runs the SSE waveshapers, one for every four voices.
+     * Mono input uses the original double precision poly above.
+     */
+    static const int maxBanks = maxChannels / 4;
+    int numChannels = 1;
+    PolySimd polyShapers[maxBanks];
+
+    /**
+     * Sine oscillators for poly, one in each lane.
+     */
+    __m128 polyPhase[maxBanks];
+    __m128 polyPhaseInc[maxBanks];
+    __m128 polyGain[maxBanks];
+
+    /**
+     * The harmonic volumes for every voice. Voice v harmonic h
+     * is at index v * 12 + h.
+     */
+    MultiLag<12 * maxChannels> polyLag;
+    float _polyVolume[12 * maxChannels] = {0};
+
     /*
      * maps freq multiple to "octave".
      * In other words, log base 12.
@@ -216,8 +265,45 @@ private:
      */
     float getInput();
 
+    /**
+     * Sets the sine oscillator frequency from the pitch CV and knobs.
+     */
+    void updatePitch();
+
+    /**
+     * Gets the oscillator frequency for one voice, from the pitch CV and knobs.
+     */
+    float getFrequency(int channel);
+
+    void stepnPoly();
+    void stepPoly();
+
+    /**
+     * Like processInput, but four voices at once.
+     * Doesn't do the clip LEDs, so keeps track of the peak for us.
+     */
+    __m128 processInputPoly(__m128 input, int bank, __m128& peak);
+
+    /**
+     * Control rate processing: input gain and harmonic volumes.
+     */
+    void stepn();
+
+    /**
+     * gain, clip indicator, and fold/clip for one sample of
+     * the waveshaper input.
+     */
+    float processInput(float input);
+
     void calcVolumes(float *);
 
+    /**
+     * Everything in calcVolumes that is shared by all the voices,
+     * i.e. all but the harmonic CV.
+     */
+    void calcKnobVolumes(float *);
+    void applyHarmonicCV(float *, int channel);
+
     void checkClipping(float sample);
 
     void updateLagTC();
@@ -244,6 +330,16 @@ inline void  CHB<TBase>::init()
     onSampleRateChange();
     lag.setAttack(.1f);
     lag.setRelease(.0001f);
+    polyLag.setAttack(.1f);
+    polyLag.setRelease(.0001f);
+    for (int i = 0; i < maxBanks; ++i) {
+        polyPhase[i] = _mm_setzero_ps();
+        polyPhaseInc[i] = _mm_setzero_ps();
+        polyGain[i] = _mm_setzero_ps();
+    }
+    divider.setup(divRate, [this] {
+        this->stepn();
+        });
 }
 
 template <class TBase>
@@ -267,64 +363,163 @@ inline void CHB<TBase>::updateLagTC()
         1);
     if (combinedA < .1 && combinedR < .1) {
         lag.setEnable(false);
+        polyLag.setEnable(false);
     } else {
         lag.setEnable(true);
+        polyLag.setEnable(true);
 
         const float lA = LookupTable<float>::lookup(*knobToFilterL, combinedA);
         lag.setAttackL(lA);
+        polyLag.setAttackL(lA);
         const float lR = LookupTable<float>::lookup(*knobToFilterL, combinedR);
         lag.setReleaseL(lR);
+        polyLag.setReleaseL(lR);
     }
 }
 
 template <class TBase>
-inline float CHB<TBase>::getInput()
+inline float CHB<TBase>::getFrequency(int channel)
 {
-    assert(TBase::engineGetSampleTime() > 0);
-
     // Get the frequency from the inputs.
     float pitch = 1.0f + roundf(TBase::params[PARAM_OCTAVE].value) +
         TBase::params[PARAM_SEMIS].value / 12.0f +
         TBase::params[PARAM_TUNE].value / 12.0f;
-    pitch += TBase::inputs[CV_INPUT].getVoltage(0);
-    pitch += .25f * TBase::inputs[PITCH_MOD_INPUT].getVoltage(0) *
+    pitch += TBase::inputs[CV_INPUT].getPolyVoltage(channel);
+    pitch += .25f * TBase::inputs[PITCH_MOD_INPUT].getPolyVoltage(channel) *
         taper(TBase::params[PARAM_PITCH_MOD_TRIM].value);
 
     const float q = float(log2(261.626));       // move up to pitch range of EvenVCO
     pitch += q;
-    _freq = expLookup(pitch);
+    float freq = expLookup(pitch);
 
-    if (_freq < .01f) {
-        _freq = .01f;
+    if (freq < .01f) {
+        freq = .01f;
     }
 
     // Multiply in the Linear FM contribution
-    _freq *= 1.0f + TBase::inputs[LINEAR_FM_INPUT].getVoltage(0) * taper(TBase::params[PARAM_LINEAR_FM_TRIM].value);
+    freq *= 1.0f + TBase::inputs[LINEAR_FM_INPUT].getPolyVoltage(channel) * taper(TBase::params[PARAM_LINEAR_FM_TRIM].value);
+    return freq;
+}
+
+template <class TBase>
+inline void CHB<TBase>::updatePitch()
+{
+    assert(TBase::engineGetSampleTime() > 0);
+    _freq = getFrequency(0);
     float time = std::clamp(_freq * TBase::engineGetSampleTime(), -.5f, 0.5f);
 
     Osc::setFrequency(sinParams, time);
+}
+
+template <class TBase>
+inline void CHB<TBase>::stepn()
+{
+    // Get the gain from the envelope generator in
+    // eGain = {0 .. 10.0f }
+    isExternalAudio = SqPort::isConnected(TBase::inputs[AUDIO_INPUT]);
+    numChannels = std::max(1, TBase::inputs[isExternalAudio ? AUDIO_INPUT : CV_INPUT].getChannels());
+    TBase::outputs[MIX_OUTPUT].setChannels(numChannels);
+    if (numChannels > 1) {
+        stepnPoly();
+        return;
+    }
+
+    float eGain = SqPort::isConnected(TBase::inputs[ENV_INPUT]) ? TBase::inputs[ENV_INPUT].getVoltage(0) : 10.f;
+
+    const float gainKnobValue = TBase::params[PARAM_EXTGAIN].value;
+    const float gainCVValue = TBase::inputs[GAIN_INPUT].getVoltage(0);
+    const float gainTrimValue = TBase::params[PARAM_EXTGAIN_TRIM].value;
+    const float combinedGain = gainCombiner(gainCVValue, gainKnobValue, gainTrimValue);
 
-    if (cycleCount == 0) {
-        // Get the gain from the envelope generator in
-        // eGain = {0 .. 10.0f }
-        float eGain = SqPort::isConnected(TBase::inputs[ENV_INPUT]) ? TBase::inputs[ENV_INPUT].getVoltage(0) : 10.f;
-        isExternalAudio = SqPort::isConnected(TBase::inputs[AUDIO_INPUT]);
+    // tapered gain {0 .. 0.5}
+    const float taperedGain = .5f * taper(combinedGain);
 
-        const float gainKnobValue = TBase::params[PARAM_EXTGAIN].value;
-        const float gainCVValue = TBase::inputs[GAIN_INPUT].getVoltage(0);
-        const float gainTrimValue = TBase::params[PARAM_EXTGAIN_TRIM].value;
+    // final gain 0..5
+    finalGain = taperedGain * eGain;
+
+    updateLagTC();              // TODO: could do at reduced rate
+    calcVolumes(_volume);       // now _volume has all 10 harmonic volumes
+    lag.step(_volume);          // TODO: we could run lag at full rate.
+
+    for (int i = 0; i < polyOrder; ++i) {
+        //poly.setGain(i, _volume[i]);
+        poly.setGain(i, lag.get(i));
+    }
+}
+
+template <class TBase>
+inline void CHB<TBase>::stepnPoly()
+{
+    const bool envConnected = SqPort::isConnected(TBase::inputs[ENV_INPUT]);
+    const float gainKnobValue = TBase::params[PARAM_EXTGAIN].value;
+    const float gainTrimValue = TBase::params[PARAM_EXTGAIN_TRIM].value;
+    const float sampleTime = TBase::engineGetSampleTime();
+
+    updateLagTC();
+    float knobVolumes[12] = {0};
+    calcKnobVolumes(knobVolumes);
+
+    float gain[maxChannels];
+    float phaseInc[maxChannels];
+    for (int channel = 0; channel < numChannels; ++channel) {
+        const float eGain = envConnected ? TBase::inputs[ENV_INPUT].getPolyVoltage(channel) : 10.f;
+        const float gainCVValue = TBase::inputs[GAIN_INPUT].getPolyVoltage(channel);
         const float combinedGain = gainCombiner(gainCVValue, gainKnobValue, gainTrimValue);
+        gain[channel] = .5f * taper(combinedGain) * eGain;
 
-        // tapered gain {0 .. 0.5}
-        const float taperedGain = .5f * taper(combinedGain);
+        if (!isExternalAudio) {
+            phaseInc[channel] = std::clamp(getFrequency(channel) * sampleTime, -.5f, 0.5f);
+        }
 
-        // final gain 0..5
-        finalGain = taperedGain * eGain;
+        float* volumes = _polyVolume + channel * 12;
+        for (int i = 0; i < polyOrder; ++i) {
+            volumes[i] = knobVolumes[i];
+        }
+        applyHarmonicCV(volumes, channel);
     }
+    polyLag.step(_polyVolume);
+
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        // unused lanes just copy the last voice
+        int channels[4];
+        for (int i = 0; i < 4; ++i) {
+            channels[i] = std::min(bank * 4 + i, numChannels - 1);
+        }
+        auto gather = [&channels](const float* x) {
+            return _mm_setr_ps(x[channels[0]], x[channels[1]], x[channels[2]], x[channels[3]]);
+        };
+
+        polyGain[bank] = gather(gain);
+        if (!isExternalAudio) {
+            polyPhaseInc[bank] = gather(phaseInc);
+        }
 
-    float input = finalGain * (isExternalAudio ?
+        PolySimd& shaper = polyShapers[bank];
+        shaper.setInputGain(_mm_min_ps(polyGain[bank], _mm_set_ps1(1)));
+        for (int i = 0; i < polyOrder; ++i) {
+            shaper.setGain(i, _mm_setr_ps(
+                polyLag.get(channels[0] * 12 + i),
+                polyLag.get(channels[1] * 12 + i),
+                polyLag.get(channels[2] * 12 + i),
+                polyLag.get(channels[3] * 12 + i)));
+        }
+    }
+}
+
+template <class TBase>
+inline float CHB<TBase>::getInput()
+{
+    updatePitch();
+    return processInput(isExternalAudio ?
         TBase::inputs[AUDIO_INPUT].getVoltage(0) :
         Osc::run(sinState, sinParams));
+}
+
+template <class TBase>
+inline float CHB<TBase>::processInput(float x)
+{
+    float input = finalGain * x;
 
     checkClipping(input);
 
@@ -339,6 +534,22 @@ inline float CHB<TBase>::getInput()
     return input;
 }
 
+template <class TBase>
+inline __m128 CHB<TBase>::processInputPoly(__m128 x, int bank, __m128& peak)
+{
+    __m128 input = _mm_mul_ps(polyGain[bank], x);
+    peak = _mm_max_ps(peak, input);
+
+    // Now clip or fold to keep in -1...+1
+    if (TBase::params[PARAM_FOLD].value > .5) {
+        input = PolySimd::fold(input);
+    } else {
+        input = _mm_max_ps(input, _mm_set_ps1(-1));
+        input = _mm_min_ps(input, _mm_set_ps1(1));
+    }
+    return input;
+}
+
 /**
  * Desired behavior:
  *      If we clip, led goes red and stays red for clipDuration
@@ -375,17 +586,28 @@ inline void CHB<TBase>::checkClipping(float input)
 template <class TBase>
 inline void CHB<TBase>::calcVolumes(float * volumes)
 {
-    // first get the harmonics knobs, and scale them
-    for (int i = 0; i < numHarmonics; ++i) {
-        float val = taper(TBase::params[i + PARAM_H0].value);       // apply taper to the knobs
+    calcKnobVolumes(volumes);
+    applyHarmonicCV(volumes, 0);
+}
 
+template <class TBase>
+inline void CHB<TBase>::applyHarmonicCV(float * volumes, int channel)
+{
+    for (int i = 0; i < numHarmonics; ++i) {
         // If input connected, scale and multiply with knob value
         if (SqPort::isConnected(TBase::inputs[i + H0_INPUT])) {
-            const float inputCV = TBase::inputs[i + H0_INPUT].getVoltage(0) * .1f;
-            val *= std::max(inputCV, 0.f);
+            const float inputCV = TBase::inputs[i + H0_INPUT].getPolyVoltage(channel) * .1f;
+            volumes[i] *= std::max(inputCV, 0.f);
         }
+    }
+}
 
-        volumes[i] = val;
+template <class TBase>
+inline void CHB<TBase>::calcKnobVolumes(float * volumes)
+{
+    // first get the harmonics knobs, and scale them
+    for (int i = 0; i < numHarmonics; ++i) {
+        volumes[i] = taper(TBase::params[i + PARAM_H0].value);       // apply taper to the knobs
     }
 
     // Second: apply the even and odd knobs
@@ -426,31 +648,105 @@ inline void CHB<TBase>::calcVolumes(float * volumes)
 template <class TBase>
 inline void CHB<TBase>::step()
 {
-    if (--cycleCount < 0) {
-        cycleCount = 3;
+    // Does the pitch every cycle, vol every 4
+    divider.step();
+    if (numChannels > 1) {
+        stepPoly();
+        return;
     }
 
     // do all the processing to get the carrier signal
-    // Does the pitch every cycle, vol every 4
     const float input = getInput();
 
-    if (cycleCount == 0) {
-        updateLagTC();              // TODO: could do at reduced rate
-        calcVolumes(_volume);       // now _volume has all 10 harmonic volumes
-        lag.step(_volume);          // TODO: we could run lag at full rate.
+    float output = poly.run(input, std::min(finalGain, 1.f));
+    TBase::outputs[MIX_OUTPUT].setVoltage(5.0f * output, 0);
+}
+
+template <class TBase>
+inline void CHB<TBase>::stepPoly()
+{
+    auto& input = TBase::inputs[AUDIO_INPUT];
+    auto& output = TBase::outputs[MIX_OUTPUT];
+    const LookupTableParams<float>& sinLookup = *sinParams.lookupParams;
+
+    __m128 peak = _mm_setzero_ps();
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int first = bank * 4;
+        const int last = std::min(numChannels, first + 4);
+
+        float buffer[4] = {0, 0, 0, 0};
+        __m128 x;
+        if (isExternalAudio) {
+            for (int channel = first; channel < last; ++channel) {
+                buffer[channel - first] = input.getVoltage(channel);
+            }
+            x = _mm_loadu_ps(buffer);
+        } else {
+            // phase 0..1, wrapping in both directions, like the SawOscillator
+            x = LookupTable<float>::lookup4(sinLookup, polyPhase[bank]);
+            __m128 phase = _mm_add_ps(polyPhase[bank], polyPhaseInc[bank]);
+            phase = _mm_sub_ps(phase, _mm_and_ps(_mm_cmpge_ps(phase, _mm_set_ps1(1)), _mm_set_ps1(1)));
+            phase = _mm_add_ps(phase, _mm_and_ps(_mm_cmplt_ps(phase, _mm_setzero_ps()), _mm_set_ps1(1)));
+            polyPhase[bank] = phase;
+        }
 
-        for (int i = 0; i < polyOrder; ++i) {
-            //poly.setGain(i, _volume[i]);
-            poly.setGain(i, lag.get(i));
+        x = processInputPoly(x, bank, peak);
+        const __m128 y = _mm_mul_ps(_mm_set_ps1(5), polyShapers[bank].run(x));
+        _mm_storeu_ps(buffer, y);
+        for (int channel = first; channel < last; ++channel) {
+            output.setVoltage(buffer[channel - first], channel);
         }
     }
 
+    // the clip LEDs show the loudest voice
+    float peaks[4];
+    _mm_storeu_ps(peaks, peak);
+    checkClipping(std::max(std::max(peaks[0], peaks[1]), std::max(peaks[2], peaks[3])));
+}
 
-    float output = poly.run(input, std::min(finalGain, 1.f));
-    TBase::outputs[MIX_OUTPUT].setVoltage(5.0f * output, 0);
+template <class TBase>
+inline void CHB<TBase>::process(const typename TBase::ProcessArgs& args, int frames)
+{
+    const auto audioInput = args.getInputChannel(TBase::inputs[AUDIO_INPUT], AUDIO_INPUT, 0);
+    const auto output = args.getOutputChannel(TBase::outputs[MIX_OUTPUT], MIX_OUTPUT, 0);
+
+    for (int first = 0; first < frames; ) {
+        // the control rate processing reads the ports
+        args.loadInputs(TBase::inputs, first);
+        const int last = first + divider.stepBlock(frames - first);
+        if (numChannels > 1) {
+            // poly goes through the ports, one frame at a time
+            for (int frame = first; frame < last; ++frame) {
+                if (frame != first) {
+                    args.loadInput(TBase::inputs, AUDIO_INPUT, frame);
+                }
+                stepPoly();
+                args.saveOutputs(TBase::outputs, frame);
+            }
+            first = last;
+            continue;
+        }
+        updatePitch();
+
+        const float polyGain = std::min(finalGain, 1.f);
+        if (isExternalAudio) {
+            for (int frame = first; frame < last; ++frame) {
+                output[frame] = 5.0f * poly.run(processInput(audioInput[frame]), polyGain);
+            }
+        } else {
+            for (int frame = first; frame < last; ++frame) {
+                const float x = Osc::run(sinState, sinParams);
+                output[frame] = 5.0f * poly.run(processInput(x), polyGain);
+            }
+        }
+        first = last;
+    }
+    args.finishOutputs(TBase::outputs, frames);
 }
 
 
+
 template <class TBase>
 int CHBDescription<TBase>::getNumParams()
 {
@@ -6,8 +6,7 @@
 #include "AudioMath.h"
 #include "IComposite.h"
 #include "ManagedPool.h"
-#include "ThreadClient.h"
-#include "ThreadServer.h"
+#include "ThreadPool.h"
 #include "ThreadSharedState.h"
 
 #include "FFTData.h"
@@ -56,7 +55,7 @@ public:
 
     virtual ~ColoredNoise()
     {
-        thread.reset();     // kill the threads before deleting other things
+        thread.reset();     // disconnect from the workers before deleting other things
     }
 
     /** Implement IComposite
@@ -119,14 +118,14 @@ private:
 
     /**
      * crossFader generates the audio, but we must
-     * feed it with NoiseMessage data from the ThreadServer
+     * feed it with NoiseMessage data from the worker threads
      */
     FFTCrossFader   crossFader;
 
     // just for debugging
     int messageCount = 0;
 
-    std::unique_ptr<ThreadClient> thread;
+    std::unique_ptr<ThreadPoolClient> thread;
 
     /**
      * Messages moved between thread, messagePool, and crossFader
@@ -165,22 +164,18 @@ public:
     std::unique_ptr<FFTDataReal> dataBuffer;
 };
 
-class NoiseServer : public ThreadServer
+class NoiseServer : public ThreadPoolHandler
 {
 public:
-    NoiseServer(std::shared_ptr<ThreadSharedState> state) : ThreadServer(state)
-    {
-    }
-protected:
     /**
-     * This is called on the server thread, not the audio thread.
+     * This is called on a worker thread, not the audio thread.
      * We have plenty of time to do some heavy lifting here.
      */
-    virtual void handleMessage(ThreadMessage* msg) override
+    ThreadMessage* handleMessage(ThreadMessage* msg) override
     {
         if (msg->type != ThreadMessage::Type::NOISE) {
             assert(false);
-            return;
+            return msg;
         }
 
         // Unpack the parameters, convert to frequency domain "noise" recipe
@@ -190,13 +185,18 @@ protected:
             noiseMessage->noiseSpec);
 
         // Now inverse FFT to time domain noise in client's buffer
-        FFT::inverse(noiseMessage->dataBuffer.get(), *noiseSpectrum.get());
+        FFT::inverse(noiseMessage->dataBuffer.get(), *noiseSpectrum.get(), scratch);
         FFT::normalize(noiseMessage->dataBuffer.get(), 5);          // use 5v amplitude.
-        sendMessageToClient(noiseMessage);
+        return noiseMessage;
     }
 private:
     std::unique_ptr<FFTDataCpx> noiseSpectrum;
 
+    /**
+     * So that regenerating the noise doesn't make a new FFT plan each time.
+     */
+    FFTScratch scratch;
+
     // may do nothing, may create the first buffer,
     // may delete the old buffer and make a new one.
     void reallocSpectrum(const NoiseMessage* msg)
@@ -220,10 +220,10 @@ template <class TBase>
 void ColoredNoise<TBase>::commonConstruct()
 {
     crossFader.enableMakeupGain(true);
-    std::shared_ptr<ThreadSharedState> threadState = std::make_shared<ThreadSharedState>();
-    std::unique_ptr<ThreadServer> server(new NoiseServer(threadState));
 
-    std::unique_ptr<ThreadClient> client(new ThreadClient(threadState, std::move(server)));
+    // We don't get our own thread, we share the pool with all the other modules.
+    std::unique_ptr<ThreadPoolHandler> server(new NoiseServer());
+    std::unique_ptr<ThreadPoolClient> client(new ThreadPoolClient(std::move(server)));
     this->thread = std::move(client);
 }
 
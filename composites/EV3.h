@@ -1,14 +1,15 @@
 #pragma once
 
 #include "Divider.h"
+#include "Exp2Simd.h"
 #include "IComposite.h"
-#ifndef _MSC_VER
-#include "MinBLEPVCO.h"
-#endif
+#include "MinBLEPVCOSimd.h"
 #include "ObjectCache.h"
 #include "SqMath.h"
 #include "SqPort.h"
 
+#include <algorithm>
+
 namespace rack {
     namespace engine {
         struct Module;
@@ -27,6 +28,13 @@ public:
 /**
  * perf test 1.0 44.5
  * 44.7 with normalization
+ *
+ * Polyphonic. The number of voices comes from the CV inputs. The FM and PWM
+ * inputs may be polyphonic or mono. Each of the three VCOs runs
+ * four voices at a time in MinBLEPVCOSimd, and VCO 1 syncs the
+ * others through MinBLEPVCOSimd::Sync, rather than a callback.
+ *
+ * perfTest percent CPU: mono 0.98, 4 voices 0.99, 16 voices 2.9, 16 mono instances 19
  */
 template <class TBase>
 class EV3 : public TBase
@@ -135,26 +143,45 @@ public:
         return volumeScale < 1;
     }
 
+    /**
+     * Number of voices we are currently generating.
+     */
+    int getNumChannels() const
+    {
+        return numChannels;
+    }
+
+    static const int maxChannels = 16;
+
 private:
+    static const int maxBanks = maxChannels / 4;
+
+    void updateChannels();
     void setSync();
     void processPitchInputs();
-    void processPitchInputs(int osc);
     void processWaveforms();
-    void stepVCOs();
+    void stepVCOs(int bank);
     void stepn(int);
     void init();
     void processPWInputs();
     void processPWInput(int osc);
-    float getInput(int osc, InputIds in0, InputIds in1, InputIds in2);
+    InputIds getInput(int osc, InputIds in0, InputIds in1, InputIds in2);
+    void writeOutput(int output, int bank, __m128 value);
 
-    MinBLEPVCO vcos[3];
-    float _freq[3];
-    float _out[3];
+    /**
+     * vcos[osc][bank] runs voices bank * 4 .. bank * 4 + 3 of VCO osc
+     */
+    MinBLEPVCOSimd vcos[3][maxBanks];
     float _outGain[3];
     float _pitchOffset[3];
+    bool _sync[3] = {false, false, false};
     float volumeScale = 1;
-    std::function<float(float)> expLookup =
-        ObjectCache<float>::getExp2Ex();
+    int numChannels = 1;
+    int numBanks = 1;
+
+    float pulseWidth[maxChannels] = {0};
+
+    Exp2Simd expLookup;
     std::shared_ptr<LookupTableParams<float>> audioTaper =
         ObjectCache<float>::getAudioTaper();
 
@@ -165,7 +192,9 @@ template <class TBase>
 inline void EV3<TBase>::init()
 {
     for (int i = 0; i < 3; ++i) {
-        vcos[i].setWaveform(MinBLEPVCO::Waveform::Saw);
+        for (int bank = 0; bank < maxBanks; ++bank) {
+            vcos[i][bank].setWaveform(MinBLEPVCOSimd::Waveform::Saw);
+        }
         _outGain[i] = 0;
         _pitchOffset[i] = 0;
     }
@@ -173,37 +202,48 @@ inline void EV3<TBase>::init()
     div.setup(4, [this] {
         this->stepn(div.getDiv());
         });
+}
 
-    vcos[0].setSyncCallback([this](float f) {
-
-        if (TBase::params[SYNC2_PARAM].value > .5) {
-            vcos[1].onMasterSync(f);
-        }
-
-        if (TBase::params[SYNC3_PARAM].value > .5) {
-            vcos[2].onMasterSync(f);
-        }
-        });
+template <class TBase>
+inline void EV3<TBase>::updateChannels()
+{
+    numChannels = 1;
+    for (int i = CV1_INPUT; i <= CV3_INPUT; ++i) {
+        numChannels = std::max(numChannels, TBase::inputs[i].getChannels());
+    }
+    numBanks = (numChannels + 3) / 4;
+    for (int i = 0; i < NUM_OUTPUTS; ++i) {
+        TBase::outputs[i].setChannels(numChannels);
+    }
 }
 
 template <class TBase>
 inline void EV3<TBase>::setSync()
 {
-    vcos[0].setSyncEnabled(false);
-    vcos[1].setSyncEnabled(TBase::params[SYNC2_PARAM].value > .5);
-    vcos[2].setSyncEnabled(TBase::params[SYNC3_PARAM].value > .5);
+    _sync[0] = false;
+    _sync[1] = TBase::params[SYNC2_PARAM].value > .5;
+    _sync[2] = TBase::params[SYNC3_PARAM].value > .5;
+    for (int i = 0; i < 3; ++i) {
+        for (int bank = 0; bank < numBanks; ++bank) {
+            vcos[i][bank].setSyncEnabled(_sync[i]);
+        }
+    }
 }
 
 template <class TBase>
 inline void EV3<TBase>::processWaveforms()
 {
-    vcos[0].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE1_PARAM].value);
-    vcos[1].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE2_PARAM].value);
-    vcos[2].setWaveform((MinBLEPVCO::Waveform)(int)TBase::params[WAVE3_PARAM].value);
+    for (int i = 0; i < 3; ++i) {
+        const int delta = i * (OCTAVE2_PARAM - OCTAVE1_PARAM);
+        const auto wf = (MinBLEPVCOSimd::Waveform)(int)TBase::params[WAVE1_PARAM + delta].value;
+        for (int bank = 0; bank < numBanks; ++bank) {
+            vcos[i][bank].setWaveform(wf);
+        }
+    }
 }
 
 template <class TBase>
-float EV3<TBase>::getInput(int osc, InputIds in1, InputIds in2, InputIds in3)
+typename EV3<TBase>::InputIds EV3<TBase>::getInput(int osc, InputIds in1, InputIds in2, InputIds in3)
 {
     const bool in2Connected = SqPort::isConnected(TBase::inputs[in2]);
     const bool in3Connected = SqPort::isConnected(TBase::inputs[in3]);
@@ -215,22 +255,26 @@ float EV3<TBase>::getInput(int osc, InputIds in1, InputIds in2, InputIds in3)
         if (in3Connected) id = in3;
         else if (in2Connected)  id = in2;
     }
-    return TBase::inputs[id].value;
+    return id;
 }
 
 template <class TBase>
 void EV3<TBase>::processPWInput(int osc)
 {
-    const float pwmInput = getInput(osc, PWM1_INPUT, PWM2_INPUT, PWM3_INPUT) / 5.f;
+    auto& pwmInput = TBase::inputs[getInput(osc, PWM1_INPUT, PWM2_INPUT, PWM3_INPUT)];
 
     const int delta = osc * (OCTAVE2_PARAM - OCTAVE1_PARAM);
     const float pwmTrim = TBase::params[PWM1_PARAM + delta].value;
     const float pwInit = TBase::params[PW1_PARAM + delta].value;
 
-    float pw = pwInit + pwmInput * pwmTrim;
     const float minPw = 0.05f;
-    pw = sq::rescale(std::clamp(pw, -1.0f, 1.0f), -1.0f, 1.0f, minPw, 1.0f - minPw);
-    vcos[osc].setPulseWidth(pw);
+    for (int channel = 0; channel < numChannels; ++channel) {
+        const float pw = pwInit + pwmInput.getPolyVoltage(channel) / 5.f * pwmTrim;
+        pulseWidth[channel] = sq::rescale(std::clamp(pw, -1.0f, 1.0f), -1.0f, 1.0f, minPw, 1.0f - minPw);
+    }
+    for (int bank = 0; bank < numBanks; ++bank) {
+        vcos[osc][bank].setPulseWidth(_mm_loadu_ps(pulseWidth + bank * 4));
+    }
 }
 
 template <class TBase>
@@ -244,10 +288,14 @@ inline void EV3<TBase>::processPWInputs()
 template <class TBase>
 inline void EV3<TBase>::stepn(int)
 {
+    updateChannels();
+
     // do the mix know taper lookup at a lower sample rate
+    float totalGain = 0;
     for (int i = 0; i < 3; ++i) {
         const float knob = TBase::params[MIX1_PARAM + i].value;
         _outGain[i] = LookupTable<float>::lookup(*audioTaper, knob, false);
+        totalGain += _outGain[i];
 
         const int delta = i * (OCTAVE2_PARAM - OCTAVE1_PARAM);
         const float finePitch = TBase::params[FINE1_PARAM + delta].value / 12.0f;
@@ -258,6 +306,8 @@ inline void EV3<TBase>::stepn(int)
             finePitch;
         _pitchOffset[i] = pitch;
     }
+    volumeScale = (totalGain <= 1) ? 1 : 1.0f / totalGain;
+
     setSync();
     processWaveforms();
     processPWInputs();
@@ -268,66 +318,78 @@ inline void EV3<TBase>::step()
 {
     div.step();
     processPitchInputs();
-    stepVCOs();
-
-    float mix = 0;
-    float totalGain = 0;
-
-    for (int i = 0; i < 3; ++i) {
-        const float gain = _outGain[i];
-        const float rawWaveform = vcos[i].getOutput();
-        const float scaledWaveform = rawWaveform * gain;
-        totalGain += gain;
-        mix += scaledWaveform;
-        _out[i] = scaledWaveform;
-        TBase::outputs[VCO1_OUTPUT + i].value = rawWaveform;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        stepVCOs(bank);
     }
-    if (totalGain <= 1) {
-        volumeScale = 1;
-    } else {
-        volumeScale = 1.0f / totalGain;
+}
+
+template <class TBase>
+inline void EV3<TBase>::stepVCOs(int bank)
+{
+    MinBLEPVCOSimd& master = vcos[0][bank];
+    master.step();
+    __m128 mix = _mm_mul_ps(master.getOutput(), _mm_set_ps1(_outGain[0]));
+    writeOutput(VCO1_OUTPUT, bank, master.getOutput());
+
+    for (int i = 1; i < 3; ++i) {
+        MinBLEPVCOSimd& vco = vcos[i][bank];
+        if (_sync[i]) {
+            vco.step(master.getSync());
+        } else {
+            vco.step();
+        }
+        mix = _mm_add_ps(mix, _mm_mul_ps(vco.getOutput(), _mm_set_ps1(_outGain[i])));
+        writeOutput(VCO1_OUTPUT + i, bank, vco.getOutput());
     }
-    mix *= volumeScale;
-    TBase::outputs[MIX_OUTPUT].value = mix;
+    writeOutput(MIX_OUTPUT, bank, _mm_mul_ps(mix, _mm_set_ps1(volumeScale)));
 }
 
 template <class TBase>
-inline void EV3<TBase>::stepVCOs()
+inline void EV3<TBase>::writeOutput(int output, int bank, __m128 value)
 {
-    for (int i = 0; i < 3; ++i) {
-        vcos[i].step();
+    float buffer[4];
+    _mm_storeu_ps(buffer, value);
+    const int first = bank * 4;
+    const int last = std::min(numChannels, first + 4);
+    for (int channel = first; channel < last; ++channel) {
+        TBase::outputs[output].setVoltage(buffer[channel - first], channel);
     }
 }
 
 template <class TBase>
 inline void EV3<TBase>::processPitchInputs()
 {
-    float lastFM = 0;
+    const float q = float(log2(261.626));       // move up to pitch range of EvenVCO
+    const float sampleTime = TBase::engineGetSampleTime();
+
+    // FM of the last VCO, for normalizing the FM inputs
+    float lastFM[maxChannels] = {0};
+    float pitch[maxChannels] = {0};
     for (int osc = 0; osc < 3; ++osc) {
         assert(osc >= 0 && osc <= 2);
         const int delta = osc * (OCTAVE2_PARAM - OCTAVE1_PARAM);
 
-        const float cv = getInput(osc, CV1_INPUT, CV2_INPUT, CV3_INPUT);
-        float pitch = _pitchOffset[osc];
-        pitch += cv;
+        auto& cvInput = TBase::inputs[getInput(osc, CV1_INPUT, CV2_INPUT, CV3_INPUT)];
+        auto& fmInput = TBase::inputs[FM1_INPUT + osc];
+        const bool fmConnected = SqPort::isConnected(fmInput);
+        const float fmDepth = AudioMath::quadraticBipolar(TBase::params[FM1_PARAM + delta].value);
+        const float offset = _pitchOffset[osc] + q;
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            // The final, scaled, value (post knob)
+            float fmCombined = lastFM[channel];
+            if (fmConnected) {
+                fmCombined = fmDepth * fmInput.getPolyVoltage(channel);
+            }
+            lastFM[channel] = fmCombined;
+            pitch[channel] = offset + cvInput.getPolyVoltage(channel) + fmCombined;
+        }
 
-        float fmCombined = 0;       // The final, scaled, value (post knob
-        if (SqPort::isConnected(TBase::inputs[FM1_INPUT + osc])) {
-            const float fm = TBase::inputs[FM1_INPUT + osc].value;
-            const float fmDepth = AudioMath::quadraticBipolar(TBase::params[FM1_PARAM + delta].value);
-            fmCombined = (fmDepth * fm);
-        } else {
-            fmCombined = lastFM;
+        const __m128 st = _mm_set_ps1(sampleTime);
+        for (int bank = 0; bank < numBanks; ++bank) {
+            const __m128 freq = expLookup.lookup(_mm_loadu_ps(pitch + bank * 4));
+            vcos[osc][bank].setNormalizedFreq(_mm_mul_ps(st, freq), sampleTime);
         }
-        pitch += fmCombined;
-        lastFM = fmCombined;
-
-        const float q = float(log2(261.626));       // move up to pitch range of EvenVCO
-        pitch += q;
-        const float freq = expLookup(pitch);
-        _freq[osc] = freq;
-        vcos[osc].setNormalizedFreq(TBase::engineGetSampleTime() * freq,
-            TBase::engineGetSampleTime());
     }
 }
 
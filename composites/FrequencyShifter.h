@@ -4,6 +4,7 @@
 #include "LookupTable.h"
 #include "SinOscillator.h"
 #include "BiquadFilter.h"
+#include "BiquadFilterSimd.h"
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "HilbertFilterDesigner.h"
@@ -28,6 +29,8 @@ public:
  *
  * If TBase is WidgetComposite, this class is used as the implementation part of the Booty Shifter module.
  * If TBase is TestComposite, this class may stand alone for unit tests.
+ *
+ * The sin and cos Hilbert filters run together, in lanes 0 and 1 of a BiquadFilterSimd.
  */
 template <class TBase>
 class FrequencyShifter : public TBase
@@ -56,7 +59,11 @@ public:
     void setSampleRate(float rate)
     {
         reciprocalSampleRate = 1 / rate;
+        BiquadParams<T, 3> hilbertFilterParamsSin;
+        BiquadParams<T, 3> hilbertFilterParamsCos;
         HilbertFilterDesigner<T>::design(rate, hilbertFilterParamsSin, hilbertFilterParamsCos);
+        hilbertFilterParams.setLane(0, hilbertFilterParamsSin);
+        hilbertFilterParams.setLane(1, hilbertFilterParamsCos);
     }
 
     // must be called after setSampleRate
@@ -104,10 +111,12 @@ public:
 private:
     SinOscillatorParams<T> oscParams;
     SinOscillatorState<T> oscState;
-    BiquadParams<T, 3> hilbertFilterParamsSin;
-    BiquadParams<T, 3> hilbertFilterParamsCos;
-    BiquadState<T, 3> hilbertFilterStateSin;
-    BiquadState<T, 3> hilbertFilterStateCos;
+
+    /**
+     * Sin filter in lane 0, cos in lane 1.
+     */
+    BiquadParamsSimd<3> hilbertFilterParams;
+    BiquadStateSimd<3> hilbertFilterState;
 
     std::shared_ptr<LookupTableParams<T>> exponential2;
 
@@ -146,8 +155,10 @@ inline void FrequencyShifter<TBase>::step()
 
     // Filter the input through th quadrature filter
     const T input = TBase::inputs[AUDIO_INPUT].getVoltage(0);
-    const T hilbertSin = BiquadFilter<T>::run(input, hilbertFilterStateSin, hilbertFilterParamsSin);
-    const T hilbertCos = BiquadFilter<T>::run(input, hilbertFilterStateCos, hilbertFilterParamsCos);
+    float hilbert[4];
+    _mm_storeu_ps(hilbert, BiquadFilterSimd::run(_mm_set_ps1(input), hilbertFilterState, hilbertFilterParams));
+    const T hilbertSin = hilbert[0];
+    const T hilbertCos = hilbert[1];
 
     // Cross modulate the two sections.
     x *= hilbertSin;
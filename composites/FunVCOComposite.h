@@ -1,9 +1,13 @@
 #pragma once
 
+#include "Exp2Simd.h"
 #include "FunVCO.h"
 #include "IComposite.h"
+#include "MinBLEPVCOSimd.h"
 #include "SqPort.h"
 
+#include <algorithm>
+
 template <class TBase>
 class FunDescription : public IComposite
 {
@@ -12,6 +16,15 @@ public:
     int getNumParams() override;
 };
 
+/**
+ * With a mono (or no) pitch input, this is the Fundamental VCO, as it always was.
+ *
+ * With a polyphonic pitch input, each voice is a MinBLEPVCOSimd, four voices at a time,
+ * one per connected output. The FM, sync and PW inputs may be polyphonic or mono.
+ * The poly voices are always digital and always hard sync, so MODE_PARAM
+ * and SYNC_PARAM only affect mono. The poly triangle is integrated from a
+ * square wave, like EV3, and does not follow sync.
+ */
 template <class TBase>
 class FunVCOComposite : public TBase
 {
@@ -67,6 +80,18 @@ public:
     void init()
     {
         oscillator.init();
+        const MinBLEPVCOSimd::Waveform waveforms[NUM_OUTPUTS] = {
+            MinBLEPVCOSimd::Waveform::Sin,
+            MinBLEPVCOSimd::Waveform::Tri,
+            MinBLEPVCOSimd::Waveform::Saw,
+            MinBLEPVCOSimd::Waveform::Square
+        };
+        for (int bank = 0; bank < maxBanks; ++bank) {
+            for (int i = 0; i < NUM_OUTPUTS; ++i) {
+                polyVcos[i][bank].setWaveform(waveforms[i]);
+            }
+            lastSyncValue[bank] = _mm_setzero_ps();
+        }
     }
 
     void setSampleRate(float rate)
@@ -74,7 +99,32 @@ public:
         oscillator.sampleTime = 1.f / rate;
     }
 
+    /**
+     * Number of voices we are currently generating.
+     */
+    int getNumChannels() const
+    {
+        return numChannels;
+    }
+
+    static const int maxChannels = 16;
+
 private:
+    static const int maxBanks = maxChannels / 4;
+
+    int numChannels = 1;
+
+    /**
+     * polyVcos[output][bank] makes the waveform for that output,
+     * for voices bank * 4 .. bank * 4 + 3
+     */
+    MinBLEPVCOSimd polyVcos[NUM_OUTPUTS][maxBanks];
+    __m128 lastSyncValue[maxBanks];
+    Exp2Simd expLookup;
+
+    void stepPoly();
+    void writeOutput(int output, int bank, __m128 value);
+
 #ifdef _ORIGVCO
     VoltageControlledOscillatorOrig<16, 16> oscillator;
 #else
@@ -125,6 +175,15 @@ inline IComposite::Config FunDescription<TBase>::getParam(int i)
 template <class TBase>
 inline void FunVCOComposite<TBase>::step()
 {
+    numChannels = std::max(1, TBase::inputs[PITCH_INPUT].getChannels());
+    for (int i = 0; i < NUM_OUTPUTS; ++i) {
+        TBase::outputs[i].setChannels(numChannels);
+    }
+    if (numChannels > 1) {
+        stepPoly();
+        return;
+    }
+
     oscillator.analog = TBase::params[MODE_PARAM].value > 0.0f;
     oscillator.soft = TBase::params[SYNC_PARAM].value <= 0.0f;
 
@@ -158,4 +217,90 @@ inline void FunVCOComposite<TBase>::step()
     if (SqPort::isConnected(TBase::outputs[SQR_OUTPUT]))
         TBase::outputs[SQR_OUTPUT].setVoltage(5.0f * oscillator.sqr(), 0);
 
-}
\ No newline at end of file
+}
+
+template <class TBase>
+inline void FunVCOComposite<TBase>::stepPoly()
+{
+    const float sampleTime = TBase::engineGetSampleTime();
+    const float pitchKnob = roundf(TBase::params[FREQ_PARAM].value);
+    const float pitchFine = 3.0f * sq::quadraticBipolar(TBase::params[FINE_PARAM].value);
+    const bool fmConnected = SqPort::isConnected(TBase::inputs[FM_INPUT]);
+    const float fmDepth = sq::quadraticBipolar(TBase::params[FM_PARAM].value);
+    const float pwKnob = TBase::params[PW_PARAM].value;
+    const float pwmDepth = TBase::params[PWM_PARAM].value;
+    const bool syncConnected = SqPort::isConnected(TBase::inputs[SYNC_INPUT]);
+    const float q = float(log2(261.626));       // move up to pitch range
+
+    bool enabled[NUM_OUTPUTS];
+    for (int i = 0; i < NUM_OUTPUTS; ++i) {
+        enabled[i] = SqPort::isConnected(TBase::outputs[i]);
+    }
+
+    float pitch[maxChannels] = {0};
+    float pw[maxChannels] = {0};
+    float syncValue[maxChannels] = {0};
+    for (int channel = 0; channel < numChannels; ++channel) {
+        float pitchCv = 12.0f * TBase::inputs[PITCH_INPUT].getVoltage(channel);
+        if (fmConnected) {
+            pitchCv += fmDepth * 12.0f * TBase::inputs[FM_INPUT].getPolyVoltage(channel);
+        }
+        pitch[channel] = (pitchKnob + pitchFine + pitchCv) / 12.0f + q;
+
+        // Fundamental is high for the first part of the cycle, MinBLEPVCO for the last
+        const float pwMin = 0.01f;
+        const float pulseWidth = pwKnob + pwmDepth * TBase::inputs[PW_INPUT].getPolyVoltage(channel) / 10.0f;
+        pw[channel] = 1.f - sq::clamp(pulseWidth, pwMin, 1.0f - pwMin);
+
+        syncValue[channel] = TBase::inputs[SYNC_INPUT].getPolyVoltage(channel) - 0.01f;
+    }
+
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const __m128 freq = _mm_mul_ps(expLookup.lookup(_mm_loadu_ps(pitch + bank * 4)), _mm_set_ps1(sampleTime));
+
+        // sync on the rising edge of the sync input, at the sub-sample where it crosses zero
+        MinBLEPVCOSimd::Sync sync;
+        sync.mask = _mm_setzero_ps();
+        sync.crossing = _mm_setzero_ps();
+        if (syncConnected) {
+            const __m128 value = _mm_loadu_ps(syncValue + bank * 4);
+            const __m128 last = lastSyncValue[bank];
+            sync.mask = _mm_and_ps(_mm_cmpgt_ps(value, _mm_setzero_ps()), _mm_cmple_ps(last, _mm_setzero_ps()));
+            // only divide where there was a crossing, so value - last > 0
+            const __m128 delta = _mm_or_ps(_mm_and_ps(sync.mask, _mm_sub_ps(value, last)),
+                _mm_andnot_ps(sync.mask, _mm_set_ps1(1)));
+            sync.crossing = _mm_sub_ps(_mm_setzero_ps(), _mm_div_ps(value, delta));
+            lastSyncValue[bank] = value;
+        }
+
+        for (int i = 0; i < NUM_OUTPUTS; ++i) {
+            if (!enabled[i]) {
+                continue;
+            }
+            MinBLEPVCOSimd& vco = polyVcos[i][bank];
+            vco.setNormalizedFreq(freq, sampleTime);
+            if (i == SQR_OUTPUT) {
+                vco.setPulseWidth(_mm_loadu_ps(pw + bank * 4));
+            }
+            if (i == TRI_OUTPUT) {
+                vco.step();
+            } else {
+                vco.step(sync);
+            }
+            writeOutput(i, bank, vco.getOutput());
+        }
+    }
+}
+
+template <class TBase>
+inline void FunVCOComposite<TBase>::writeOutput(int output, int bank, __m128 value)
+{
+    float buffer[4];
+    _mm_storeu_ps(buffer, value);
+    const int first = bank * 4;
+    const int last = std::min(numChannels, first + 4);
+    for (int channel = first; channel < last; ++channel) {
+        TBase::outputs[output].setVoltage(buffer[channel - first], channel);
+    }
+}
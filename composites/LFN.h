@@ -1,7 +1,7 @@
 
 #pragma once
 
-#include "ButterworthFilterDesigner.h"
+#include "ButterworthLookup.h"
 #include "Decimator.h"
 #include "GraphicEq.h"
 #include "LowpassFilter.h"
@@ -9,8 +9,8 @@
 #include "BiquadState.h"
 #include "BiquadFilter.h"
 #include "ObjectCache.h"
+#include "RandomSimd.h"
 #include "IComposite.h"
-#include <random>
 
 namespace rack {
     namespace engine {
@@ -120,6 +120,7 @@ public:
         EQ2_INPUT,
         EQ3_INPUT,
         EQ4_INPUT,
+        FREQ_RANGE_INPUT,
         NUM_INPUTS
     };
 
@@ -149,12 +150,6 @@ public:
         return  TBase::params[XLFN_PARAM].value > .5;
     }
 
-    /**
-     * This lets the butterworth get re-calculated on the UI thread.
-     * We can't do it on the audio thread, because it calls malloc.
-     */
-    void pollForChangeOnUIThread();
-
 private:
     float reciprocalSampleRate = 0;
 
@@ -171,24 +166,30 @@ private:
     BiquadParams<TButter, 2> lpfParams;
     BiquadState<TButter, 2> lpfState;
 
+    /**
+     * Designing the butterworth calls malloc, so we look up
+     * the coefficients instead. That lets us do it on the audio
+     * thread, so the range can have CV.
+     */
+    ButterworthLookup3PLP<TButter> lpfLookup;
+
     /**
      * Frequency, in Hz, of the lowest band in the graphic EQ
      */
     float baseFrequency = 1;
 
-   /**
-    * The last value baked by the LPF filter calculation
-    * done on the UI thread.
-    */
-    float lastBaseFrequencyParamValue = -100;
-    float lastXLFMParamValue = -1;
+    /**
+     * The range (knob + CV) and XLFN setting that
+     * baseFrequency was last calculated from.
+     */
+    float lastRange = -100;
+    bool lastXLFN = false;
 
-    std::default_random_engine generator{57};
-    std::normal_distribution<double> distribution{-1.0, 1.0};
+    RandomSimd random;
 
     float noise()
     {
-        return  (float) distribution(generator);
+        return random.normal();
     }
 
     int controlUpdateCount = 0;
@@ -199,6 +200,12 @@ private:
      */
     void updateLPF();
 
+    /**
+     * Re-calculates baseFrequency from the range knob, CV and XLFN,
+     * if they changed.
+     */
+    void updateRange();
+
     /**
      * scaling function for the range / base frequency knob
      * map knob range from .1 Hz to 2.0 Hz
@@ -258,16 +265,17 @@ inline IComposite::Config LFNDescription<TBase>::getParam(int i)
 }
 
 template <class TBase>
-inline void LFN<TBase>::pollForChangeOnUIThread()
+inline void LFN<TBase>::updateRange()
 {
-    if ((lastBaseFrequencyParamValue != TBase::params[FREQ_RANGE_PARAM].value) ||
-        (lastXLFMParamValue != TBase::params[XLFN_PARAM].value)) {
-
-        lastBaseFrequencyParamValue = TBase::params[FREQ_RANGE_PARAM].value;
-        lastXLFMParamValue = TBase::params[XLFN_PARAM].value;
-
-        baseFrequency = float(rangeFunc(lastBaseFrequencyParamValue));
-        if (TBase::params[XLFN_PARAM].value > .5f) {
+    float range = TBase::params[FREQ_RANGE_PARAM].value + TBase::inputs[FREQ_RANGE_INPUT].getVoltage(0);
+    range = std::max(-5.f, std::min(5.f, range));
+    const bool xlfn = isXLFN();
+    if ((range != lastRange) || (xlfn != lastXLFN)) {
+        lastRange = range;
+        lastXLFN = xlfn;
+
+        baseFrequency = float(rangeFunc(range));
+        if (xlfn) {
             baseFrequency /= 10.f;
         }
 
@@ -289,14 +297,13 @@ inline void LFN<TBase>::updateLPF()
     // divided by base.
     float decimationDivider = float(100.0 / baseFrequency);
 
-    decimator.setDecimationRate(decimationDivider);
+    decimator.changeDecimationRate(decimationDivider);
 
     // calculate lpFc ( Fc / sr)
     // Imaging filter fc = 3.2khz / decimation-divider
     // fc/fs = 3200 * (reciprocal sr) / decimation-divider.
     const float lpFc = 3200 * reciprocalSampleRate / decimationDivider;
-    ButterworthFilterDesigner<TButter>::designThreePoleLowpass(
-        lpfParams, lpFc);
+    lpfLookup.get(lpfParams, lpFc);
 }
 
 template <class TBase>
@@ -306,6 +313,7 @@ inline void LFN<TBase>::step()
     // get the CPU usage down really far.
     if (controlUpdateCount++ > 4) {
         controlUpdateCount = 0;
+        updateRange();
         const int numEqStages = geq.getNumStages();
         for (int i = 0; i < numEqStages; ++i) {
             auto paramNum = i + EQ0_PARAM;
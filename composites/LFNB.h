@@ -9,9 +9,9 @@
 #include "BiquadFilter.h"
 #include "Divider.h"
 #include "ObjectCache.h"
+#include "RandomSimd.h"
 #include "IComposite.h"
 #include "StateVariableFilter.h"
-#include <random>
 
 /**
  * Noise generator feeding a bandpass filter.
@@ -104,11 +104,10 @@ private:
     BiquadParams<TButter, 2> lpfParams;
     BiquadState<TButter, 2> lpfState;
 
-    std::default_random_engine generator{57};
-    std::normal_distribution<double> distribution{-1.0, 1.0};
+    RandomSimd random;
     float noise()
     {
-        return  (float) distribution(generator);
+        return random.normal();
     }
     float _fc = .1f;
 };
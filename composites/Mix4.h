@@ -6,8 +6,7 @@
 #include "IComposite.h"
 #include "MixHelper.h"
 #include "mixpolyhelper.h"
-#include "MultiLag.h"
-#include "ObjectCache.h"
+#include "MixStrips.h"
 #include "SqMath.h"
 
 #include <assert.h>
@@ -113,6 +112,9 @@ public:
 
         CV_MUTE_TOGGLE,
 
+        VOICE_PAN_PARAM,        // pan each voice of poly inputs
+        VOICE_SPREAD_PARAM,     // and spread them out
+
         NUM_PARAMS
     };
 
@@ -182,55 +184,34 @@ public:
 
     void stepn(int steps);
 
-    // These are all calculated in stepn from the
-    // contents of filteredCV
-
-    float buf_channelSendGainsALeft[numChannels] = {0};
-    float buf_channelSendGainsARight[numChannels] = {0};
-    float buf_channelSendGainsBLeft[numChannels] = {0};
-    float buf_channelSendGainsBRight[numChannels] = {0};
-
      void _disableAntiPop();
 
 private:
     Divider divider;
 
-    /**
-     *      0..3 for smoothed input gain * channel mute
-     *      4..7 for left pan
-     *      8..11 for right pan
-     *      12..15 for mute
-     */
-
-    static const int cvOffsetGain = 0;
-    static const int cvOffsetPanLeft = 4;
-    static const int cvOffsetPanRight = 8;
-    static const int cvOffsetMute = 12;
-    MultiLPF<16> filteredCV;
-
-    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    MixStrips<numChannels, false> strips;
 
     const float* expansionInputs = nullptr;
     float* expansionOutputs = nullptr;
 
     MixHelper<Mix4<TBase>> helper;
     MixPolyHelper<Mix4<TBase>> polyHelper;
-
-    std::shared_ptr<LookupTableParams<float>> taperLookupParam =  ObjectCache<float>::getAudioTaper18();
 };
 
 template <class TBase>
 inline void Mix4<TBase>::stepn(int div)
 {
-    float unbufferedCV[cvOffsetMute + 4] = {0};
-
     const bool moduleIsMuted = TBase::params[ALL_CHANNELS_OFF_PARAM].value > .5f;
-    const bool AisPreFader = TBase::params[PRE_FADERa_PARAM].value > .5;
-    const bool BisPreFader = TBase::params[PRE_FADERb_PARAM].value > .5;
+    strips.preFaderA = TBase::params[PRE_FADERa_PARAM].value > .5;
+    strips.preFaderB = TBase::params[PRE_FADERb_PARAM].value > .5;
 
     helper.procMixInputs(this);
     polyHelper.updatePolyphony(this);
+    {
+        const bool spread = TBase::params[VOICE_SPREAD_PARAM].value > .5f;
+        const bool perVoice = spread || (TBase::params[VOICE_PAN_PARAM].value > .5f);
+        polyHelper.updateVoices(this, perVoice, spread, strips.prePanned);
+    }
 
     // If the is an external solo, then mute all channels
     bool anySolo = false;
@@ -242,21 +223,13 @@ inline void Mix4<TBase>::stepn(int div)
     }
 
     for (int i = 0; i < numChannels; ++i) {
-        float channelGain = 0;
-
-        // First let's round up the channel volume
-        {
-            const float rawSlider = TBase::params[i + GAIN0_PARAM].value;
-            const float slider = LookupTable<float>::lookup(*taperLookupParam, rawSlider);
-
-            const float rawCV = TBase::inputs[i + LEVEL0_INPUT].isConnected() ?
-                TBase::inputs[i + LEVEL0_INPUT].getVoltage(0) : 10.f;
-            const float cv = std::clamp(
-                rawCV / 10.0f,
-                0.0f,
-                1.0f);
-            channelGain = slider * cv;
-        }
+        strips.fader[i] = TBase::params[i + GAIN0_PARAM].value;
+        strips.levelCV[i] = TBase::inputs[i + LEVEL0_INPUT].isConnected() ?
+            TBase::inputs[i + LEVEL0_INPUT].getVoltage(0) : 10.f;
+        strips.pan[i] = TBase::params[i + PAN0_PARAM].value;
+        strips.panCV[i] = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
+        strips.sendA[i] = TBase::params[i + SEND0_PARAM].value;
+        strips.sendB[i] = TBase::params[i + SENDb0_PARAM].value;
 
         // now round up the mutes
         float rawMuteValue = 0;        // assume muted
@@ -271,58 +244,15 @@ inline void Mix4<TBase>::stepn(int div)
              // be applicable if no solo
             rawMuteValue = TBase::params[i + MUTE0_STATE_PARAM].value > .5 ? 0.f : 1.f;
         }
-        channelGain *= rawMuteValue;
-
-        // now the raw channel gains are all computed
-        unbufferedCV[cvOffsetGain + i] = channelGain;
-        unbufferedCV[cvOffsetMute + i] = rawMuteValue;
-
-        // now do the pan calculation
-        {
-            const float balance = TBase::params[i + PAN0_PARAM].value;
-            const float cv = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
-            const float panValue = std::clamp(balance + cv / 5, -1, 1);
-            unbufferedCV[cvOffsetPanLeft + i] = LookupTable<float>::lookup(*panL, panValue) * channelGain;
-            unbufferedCV[cvOffsetPanRight + i] = LookupTable<float>::lookup(*panR, panValue) * channelGain;
-        }
-
-        // TODO: precalc all the send gains
-        {
-            const float muteValue = filteredCV.get(cvOffsetMute + i);
-            const float sliderA = TBase::params[i + SEND0_PARAM].value;
-            const float sliderB = TBase::params[i + SENDb0_PARAM].value;
-
-
-            // TODO: we can do some main volume work ahead of time, just like the sends here
-            if (!AisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level    
-                buf_channelSendGainsALeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderA;
-                buf_channelSendGainsARight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderA;
-            } else {
-                // pre-fader fader, gain sees mutes and send only
-                buf_channelSendGainsALeft[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-                buf_channelSendGainsARight[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-            }
-
-            if (!BisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainsBLeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderB;
-                buf_channelSendGainsBRight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderB;
-            } else {
-                // pref fader, gain sees mutes and send only
-                buf_channelSendGainsBLeft[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-                buf_channelSendGainsBRight[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-            }
-        }
+        strips.mute[i] = rawMuteValue;
 
         // refresh the solo lights
         {
             const float soloValue = TBase::params[i + SOLO0_PARAM].value;
             TBase::lights[i + SOLO0_LIGHT].value = (soloValue > .5f) ? 10.f : 0.f;
         }
-
     }
-    filteredCV.step(unbufferedCV);
+    strips.update();
 }
 
 template <class TBase>
@@ -344,14 +274,16 @@ inline void Mix4<TBase>::onSampleRateChange()
 template <class TBase>
 inline void Mix4<TBase>::_disableAntiPop()
 {
-    filteredCV.setCutoff(0.49f);     // set it super fast
+    strips.setCutoff(0.49f);     // set it super fast
+    polyHelper.setVoiceCutoff(0.49f);
 }
 
 template <class TBase>
 inline void Mix4<TBase>::setupFilters()
 {
     const float x = TBase::engineGetSampleTime() * 44100.f / 100.f;
-    filteredCV.setCutoff(x);
+    strips.setCutoff(x);
+    polyHelper.setVoiceCutoff(x);
 }
 
 template <class TBase>
@@ -359,45 +291,30 @@ inline void Mix4<TBase>::step()
 {
     divider.step();
 
-    float left = 0, right = 0;              // these variables will be summed up over all channels
-    float lSend = 0, rSend = 0;
-    float lSendb = 0, rSendb = 0;
-
+    // these will be summed up over all channels
+    float busses[MixStrips<numChannels, false>::busBufferSize] = {0};
     if (expansionInputs) {
-        left = expansionInputs[0];
-        right = expansionInputs[1];
-        lSend = expansionInputs[2];
-        rSend = expansionInputs[3];
-        lSendb = expansionInputs[4];
-        rSendb = expansionInputs[5];
+        for (int i = 0; i < MixStrips<numChannels, false>::numBusses; ++i) {
+            busses[i] = expansionInputs[i];
+        }
     }
 
+    float channelInputs[numChannels];
+    float inputsLeft[numChannels];
+    float inputsRight[numChannels];
+    float channelOutputs[numChannels];
+    polyHelper.getInputs(this, channelInputs, inputsLeft, inputsRight);
+    strips.step(channelInputs, inputsLeft, inputsRight, channelOutputs, busses);
     for (int i = 0; i < numChannels; ++i) {
-        const float channelInput = polyHelper.getNormalizedInputSum(this, i);
-
-        // sum the channel output to the masters
-        left += channelInput * filteredCV.get(i + cvOffsetPanLeft);
-        right += channelInput * filteredCV.get(i + cvOffsetPanRight);
-
-        // TODO: aux sends
-        lSend += channelInput * buf_channelSendGainsALeft[i];
-        lSendb += channelInput * buf_channelSendGainsBLeft[i];
-        rSend += channelInput * buf_channelSendGainsARight[i];
-        rSendb += channelInput * buf_channelSendGainsBRight[i];
-
-        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelInput * filteredCV.get(i + cvOffsetGain), 0);
+        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelOutputs[i], 0);
     }
 
     // output the buses to the expansion port
     if (expansionOutputs) {
-        expansionOutputs[0] = left;
-        expansionOutputs[1] = right;
-        expansionOutputs[2] = lSend;
-        expansionOutputs[3] = rSend;
-        expansionOutputs[4] = lSendb;
-        expansionOutputs[5] = rSendb;
+        for (int i = 0; i < MixStrips<numChannels, false>::numBusses; ++i) {
+            expansionOutputs[i] = busses[i];
+        }
     }
-
 }
 
 template <class TBase>
@@ -521,6 +438,12 @@ inline IComposite::Config Mix4Description<TBase>::getParam(int i)
         case Mix4<TBase>::CV_MUTE_TOGGLE:
             ret = {0, 1, 0, "VCTM"};
             break;
+        case Mix4<TBase>::VOICE_PAN_PARAM:
+            ret = {0, 1, 0, "Pan poly voices"};
+            break;
+        case Mix4<TBase>::VOICE_SPREAD_PARAM:
+            ret = {0, 1, 0, "Spread poly voices"};
+            break;
         default:
             assert(false);
     }
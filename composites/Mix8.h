@@ -3,8 +3,9 @@
 
 #include "Divider.h"
 #include "IComposite.h"
+#include "mixpolyhelper.h"
+#include "MixStrips.h"
 #include "MultiLag.h"
-#include "ObjectCache.h"
 #include "SqMath.h"
 #include "SqPort.h"
 
@@ -155,6 +156,8 @@ public:
         SEND6_PARAM,
         SEND7_PARAM,
         RETURN_GAIN_PARAM,
+        VOICE_PAN_PARAM,        // pan each voice of poly inputs
+        VOICE_SPREAD_PARAM,     // and spread them out
         NUM_PARAMS
     };
 
@@ -235,33 +238,62 @@ public:
      */
     void step() override;
 
+    /**
+     * Block processing entry point.
+     * Output is the same as calling step() 'frames' times.
+     */
+    void process(const typename TBase::ProcessArgs& args, int frames) override;
+
     void stepn(int steps);
 
     const static int numChannels = 8;
 
-    float buf_inputs[numChannels] = {0};
-    float buf_channelGains[numChannels] = {0};
-    float buf_channelOuts[numChannels] = {0};
-    float buf_leftPanGains[numChannels] = {0};
-    float buf_rightPanGains[numChannels] = {0};
-    float buf_channelSendGains[numChannels] = {0};
-
-    /** 
-     * allocate extra bank for the master mute
-     */
-    float buf_muteInputs[numChannels + 4];
     float buf_masterGain=0;
     float buf_auxReturnGain = 0;
 
 private:
     Divider divider;
+    static const int divRate = 4;
+
+    using Channel = typename TBase::ProcessArgs::Channel;
+
+    /**
+     * All the audio for process(), looked up once per block.
+     */
+    class BlockPorts
+    {
+    public:
+        Channel inputs[numChannels][TBase::ProcessArgs::maxChannels];
+        int inputChannels[numChannels];
+        Channel channelOutputs[numChannels];
+        Channel leftReturn, rightReturn;
+        Channel leftExpand, rightExpand;
+        Channel left, right;
+        Channel leftSend, rightSend;
+    };
+
+    /**
+     * process up to divRate samples, all with the same control values.
+     */
+    void processRun(const BlockPorts& ports, int first, int frames);
 
     /**
-     * 8 input channels and one master
+     * The 8 input channels. Linear faders, and only send A,
+     * which is always post fader.
      */
-    MultiLPF<12> antiPop;
-    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    using Strips = MixStrips<numChannels, false>;
+    Strips strips;
+
+    /**
+     * [0] is the master mute. The rest are padding for SSE.
+     */
+    MultiLPF<4> antiPop;
+
+    /**
+     * Normally only the first voice of each input is used,
+     * but this does the per voice mode.
+     */
+    MixPolyHelper<Mix8<TBase>> polyHelper;
 };
 
 #ifndef _CLAMP
@@ -296,40 +328,20 @@ static inline float PanR(float balance, float cv)
 template <class TBase>
 inline void Mix8<TBase>::stepn(int div)
 {
-    // fill buf_channelGains
     for (int i = 0; i < numChannels; ++i) {
-        const float slider = TBase::params[i + GAIN0_PARAM].value;
+        strips.fader[i] = TBase::params[i + GAIN0_PARAM].value;
 
         // TODO: get rid of normalize. if active ? cv : 10;
-        const float rawCV = SqPort::isConnected(TBase::inputs[i + LEVEL0_INPUT]) ? 
+        strips.levelCV[i] = SqPort::isConnected(TBase::inputs[i + LEVEL0_INPUT]) ?
              TBase::inputs[i + LEVEL0_INPUT].getVoltage(0) : 10.f;
-        const float cv = std::clamp(
-            rawCV / 10.0f,
-            0.0f,
-            1.0f);
-        buf_channelGains[i] = slider * cv;
+        strips.pan[i] = TBase::params[i + PAN0_PARAM].value;
+        strips.panCV[i] = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
+        strips.sendA[i] = TBase::params[i + SEND0_PARAM].value;
     }
 
     buf_masterGain = TBase::params[MASTER_VOLUME_PARAM].value;
     buf_auxReturnGain = TBase::params[RETURN_GAIN_PARAM].value;
 
-        // send gains
-    for (int i = 0; i < numChannels; ++i) {
-        const float slider = TBase::params[i + SEND0_PARAM].value;
-        buf_channelSendGains[i] = slider;
-    }
-
-    // fill buf_leftPanGains and buf_rightPanGains
-    for (int i = 0; i < numChannels; ++i) {
-        const float balance = TBase::params[i + PAN0_PARAM].value;
-        const float cv = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
-        const float panValue = std::clamp(balance + cv / 5, -1, 1);
-        buf_leftPanGains[i] = LookupTable<float>::lookup(*panL, panValue);
-        buf_rightPanGains[i] = LookupTable<float>::lookup(*panR, panValue);
-    }
-
-    buf_masterGain = TBase::params[MASTER_VOLUME_PARAM].value;
-
     bool anySolo = false;
     for (int i = 0; i < numChannels; ++i) {
         if (TBase::params[i + SOLO0_PARAM].value > .5f) {
@@ -340,30 +352,39 @@ inline void Mix8<TBase>::stepn(int div)
 
     if (anySolo) {
         for (int i = 0; i < numChannels; ++i) {
-            buf_muteInputs[i] = TBase::params[i + SOLO0_PARAM].value;
+            strips.mute[i] = TBase::params[i + SOLO0_PARAM].value;
         }
     } else {
         for (int i = 0; i < numChannels; ++i) {
             const bool muteActivated = ((TBase::params[i + MUTE0_PARAM].value > .5f) ||
                 (TBase::inputs[i + MUTE0_INPUT].getVoltage(0) > 2));
-            buf_muteInputs[i] = muteActivated ? 0.f : 1.f;
-           // buf_muteInputs[i] = 1.0f - TBase::params[i + MUTE0_PARAM].value;       // invert mute
+            strips.mute[i] = muteActivated ? 0.f : 1.f;
         }
     }
-    buf_muteInputs[8] = 1.0f - TBase::params[MASTER_MUTE_PARAM].value;
-    antiPop.step(buf_muteInputs);
+    {
+        const bool spread = TBase::params[VOICE_SPREAD_PARAM].value > .5f;
+        const bool perVoice = spread || (TBase::params[VOICE_PAN_PARAM].value > .5f);
+        polyHelper.updateVoices(this, perVoice, spread, strips.prePanned);
+    }
+    strips.update();
+
+    float masterMute[4] = {0};
+    masterMute[0] = 1.0f - TBase::params[MASTER_MUTE_PARAM].value;
+    antiPop.step(masterMute);
 }
 
 template <class TBase>
 inline void Mix8<TBase>::init()
 {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
+    divider.setup(divRate, [this] {
         this->stepn(divRate);
         });
 
     // 400 was smooth, 100 popped
+    strips.setUseTaper(false);
+    strips.setCutoff(1.0f / 100.f);
     antiPop.setCutoff(1.0f / 100.f);
+    polyHelper.setVoiceCutoff(1.0f / 100.f);
 }
 
 template <class TBase>
@@ -371,43 +392,120 @@ inline void Mix8<TBase>::step()
 {
     divider.step();
 
-    // fill buf_inputs
+    float channelInputs[numChannels];
+    float channelOutputs[numChannels];
     for (int i = 0; i < numChannels; ++i) {
-        buf_inputs[i] = TBase::inputs[i + AUDIO0_INPUT].getVoltage(0);
-    }
-
-    // compute buf_channelOuts
-    for (int i = 0; i < numChannels; ++i) {
-        const float muteValue = antiPop.get(i);
-        buf_channelOuts[i] = buf_inputs[i] * buf_channelGains[i] * muteValue;
+        channelInputs[i] = TBase::inputs[i + AUDIO0_INPUT].getVoltage(0);
     }
 
     // compute and output master outputs
-    float left = 0, right = 0;
-    float lSend = 0, rSend = 0;
-    for (int i = 0; i < numChannels; ++i) {
-        left += buf_channelOuts[i] * buf_leftPanGains[i];
-        right += buf_channelOuts[i] * buf_rightPanGains[i];
-
-        lSend += buf_channelOuts[i] * buf_leftPanGains[i] * buf_channelSendGains[i];
-        rSend += buf_channelOuts[i] * buf_rightPanGains[i] * buf_channelSendGains[i];
+    float busses[Strips::busBufferSize] = {0};
+    if (polyHelper.anyPerVoice()) {
+        float inputsLeft[numChannels];
+        float inputsRight[numChannels];
+        for (int i = 0; i < numChannels; ++i) {
+            inputsLeft[i] = channelInputs[i];
+            inputsRight[i] = channelInputs[i];
+            if (polyHelper.isPerVoice(i)) {
+                polyHelper.getVoiceMix(this, i, inputsLeft[i], inputsRight[i], channelInputs[i]);
+            }
+        }
+        strips.step(channelInputs, inputsLeft, inputsRight, channelOutputs, busses);
+    } else {
+        strips.step(channelInputs, channelOutputs, busses);
     }
+    float left = busses[0];
+    float right = busses[1];
 
     left += TBase::inputs[LEFT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
     right += TBase::inputs[RIGHT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGain;
 
     // output the masters
-    const float masterMuteValue = antiPop.get(8);
+    const float masterMuteValue = antiPop.get(0);
     const float masterGain = buf_masterGain * masterMuteValue;
     TBase::outputs[LEFT_OUTPUT].setVoltage(left * masterGain + TBase::inputs[LEFT_EXPAND_INPUT].getVoltage(0), 0);
     TBase::outputs[RIGHT_OUTPUT].setVoltage(right * masterGain + TBase::inputs[RIGHT_EXPAND_INPUT].getVoltage(0), 0);
 
-    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(lSend, 0);
-    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(rSend, 0);
+    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(busses[2], 0);
+    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(busses[3], 0);
 
     // output channel outputs
     for (int i = 0; i < numChannels; ++i) {
-        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(buf_channelOuts[i], 0);
+        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelOutputs[i], 0);
+    }
+}
+
+template <class TBase>
+inline void Mix8<TBase>::process(const typename TBase::ProcessArgs& args, int frames)
+{
+    BlockPorts ports;
+    for (int i = 0; i < numChannels; ++i) {
+        const int id = i + AUDIO0_INPUT;
+        ports.inputChannels[i] = TBase::inputs[id].getChannels();
+
+        // we always need the first one, even if nothing is patched
+        for (int j = 0; j < std::max(ports.inputChannels[i], 1); ++j) {
+            ports.inputs[i][j] = args.getInputChannel(TBase::inputs[id], id, j);
+        }
+        ports.channelOutputs[i] = args.getOutputChannel(TBase::outputs[i + CHANNEL0_OUTPUT], i + CHANNEL0_OUTPUT, 0);
+    }
+    ports.leftReturn = args.getInputChannel(TBase::inputs[LEFT_RETURN_INPUT], LEFT_RETURN_INPUT, 0);
+    ports.rightReturn = args.getInputChannel(TBase::inputs[RIGHT_RETURN_INPUT], RIGHT_RETURN_INPUT, 0);
+    ports.leftExpand = args.getInputChannel(TBase::inputs[LEFT_EXPAND_INPUT], LEFT_EXPAND_INPUT, 0);
+    ports.rightExpand = args.getInputChannel(TBase::inputs[RIGHT_EXPAND_INPUT], RIGHT_EXPAND_INPUT, 0);
+    ports.left = args.getOutputChannel(TBase::outputs[LEFT_OUTPUT], LEFT_OUTPUT, 0);
+    ports.right = args.getOutputChannel(TBase::outputs[RIGHT_OUTPUT], RIGHT_OUTPUT, 0);
+    ports.leftSend = args.getOutputChannel(TBase::outputs[LEFT_SEND_OUTPUT], LEFT_SEND_OUTPUT, 0);
+    ports.rightSend = args.getOutputChannel(TBase::outputs[RIGHT_SEND_OUTPUT], RIGHT_SEND_OUTPUT, 0);
+
+    for (int first = 0; first < frames; ) {
+        // the control rate processing reads the ports
+        args.loadInputs(TBase::inputs, first);
+        const int n = divider.stepBlock(std::min(divRate, frames - first));
+        processRun(ports, first, n);
+        first += n;
+    }
+    args.finishOutputs(TBase::outputs, frames);
+}
+
+template <class TBase>
+inline void Mix8<TBase>::processRun(const BlockPorts& ports, int first, int frames)
+{
+    const float masterGain = buf_masterGain * antiPop.get(0);
+    for (int frame = 0; frame < frames; ++frame) {
+        const int f = first + frame;
+        float channelInputs[numChannels];
+        float channelOutputs[numChannels];
+        for (int i = 0; i < numChannels; ++i) {
+            channelInputs[i] = ports.inputs[i][0][f];
+        }
+
+        float busses[Strips::busBufferSize] = {0};
+        if (polyHelper.anyPerVoice()) {
+            float inputsLeft[numChannels];
+            float inputsRight[numChannels];
+            for (int i = 0; i < numChannels; ++i) {
+                inputsLeft[i] = channelInputs[i];
+                inputsRight[i] = channelInputs[i];
+                if (polyHelper.isPerVoice(i)) {
+                    polyHelper.getVoiceMix(i, ports.inputs[i], ports.inputChannels[i], f,
+                        inputsLeft[i], inputsRight[i], channelInputs[i]);
+                }
+            }
+            strips.step(channelInputs, inputsLeft, inputsRight, channelOutputs, busses);
+        } else {
+            strips.step(channelInputs, channelOutputs, busses);
+        }
+        for (int i = 0; i < numChannels; ++i) {
+            ports.channelOutputs[i][f] = channelOutputs[i];
+        }
+
+        const float left = busses[0] + ports.leftReturn[f] * buf_auxReturnGain;
+        const float right = busses[1] + ports.rightReturn[f] * buf_auxReturnGain;
+        ports.left[f] = left * masterGain + ports.leftExpand[f];
+        ports.right[f] = right * masterGain + ports.rightExpand[f];
+        ports.leftSend[f] = busses[2];
+        ports.rightSend[f] = busses[3];
     }
 }
 
@@ -552,6 +650,12 @@ inline IComposite::Config Mix8Description<TBase>::getParam(int i)
         case Mix8<TBase>::RETURN_GAIN_PARAM:
             ret = {0, 1.0f, 0, "Return Gain"};
             break;
+        case Mix8<TBase>::VOICE_PAN_PARAM:
+            ret = {0, 1, 0, "Pan poly voices"};
+            break;
+        case Mix8<TBase>::VOICE_SPREAD_PARAM:
+            ret = {0, 1, 0, "Spread poly voices"};
+            break;
         default:
             assert(false);
     }
@@ -5,6 +5,7 @@
 #include "IComposite.h"
 #include "MixHelper.h"
 #include "mixpolyhelper.h"
+#include "MixStrips.h"
 #include "MultiLag.h"
 #include "ObjectCache.h"
 #include "SqMath.h"
@@ -14,6 +15,20 @@
 #include <immintrin.h>
 #include <memory>
 
+#ifdef __V1x
+namespace rack {
+    namespace engine {
+        struct Module;
+    }
+}
+using Module = ::rack::engine::Module;
+#else
+namespace rack {
+    struct Module;
+};
+using Module = ::rack::Module;
+#endif
+
 #ifndef _CLAMP
 #define _CLAMP
 namespace std {
@@ -132,6 +147,11 @@ public:
         CV_MUTE_TOGGLE,
         MASTER_MUTE_STATE_PARAM,
 
+        BLOCK_BUS_PARAM,        // 1 = expanders send their busses in blocks
+
+        VOICE_PAN_PARAM,        // pan each voice of poly inputs
+        VOICE_SPREAD_PARAM,     // and spread them out
+
         NUM_PARAMS
     };
 
@@ -204,42 +224,56 @@ public:
      * Main processing entry point. Called every sample
      */
     void step() override;
+
+    /**
+     * Block processing entry point.
+     * Output is the same as calling step() 'frames' times.
+     */
+    void process(const typename TBase::ProcessArgs& args, int frames) override;
+
     void onSampleRateChange();
     void setupFilters();
 
     void stepn(int steps);
 
-    // These are all calculated in stepn from the
-    // contents of filteredCV
-
-    float buf_channelSendGainsALeft[numChannels] = {0};
-    float buf_channelSendGainsARight[numChannels] = {0};
-    float buf_channelSendGainsBLeft[numChannels] = {0};
-    float buf_channelSendGainsBRight[numChannels] = {0};
-
     float buf_auxReturnGainA = 0;
     float buf_auxReturnGainB = 0;
 
     void _disableAntiPop();
 private:
     Divider divider;
+    static const int divRate = 4;
+
+    using Channel = typename TBase::ProcessArgs::Channel;
 
     /**
-     *      0..3 for smoothed input gain * channel mute
-     *      4..7 for left pan
-     *      8..11 for right pan
-     *      12..15 for mute
-     *      [15] for master mute * master gain
+     * All the audio for process(), looked up once per block.
      */
-    static const int cvOffsetGain = 0;
-    static const int cvOffsetPanLeft = 4;
-    static const int cvOffsetPanRight = 8;
-    static const int cvOffsetMute = 12;
-    static const int cvOffsetMaster = 16;
-    MultiLPF<20> filteredCV;
+    class BlockPorts
+    {
+    public:
+        Channel inputs[numChannels][TBase::ProcessArgs::maxChannels];
+        int inputChannels[numChannels];
+        Channel channelOutputs[numChannels];
+        Channel leftReturn, rightReturn;
+        Channel leftReturnb, rightReturnb;
+        Channel left, right;
+        Channel leftSend, rightSend;
+        Channel leftSendb, rightSendb;
+    };
 
-    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    /**
+     * process up to divRate samples, all with the same control values.
+     */
+    void processRun(const BlockPorts& ports, int first, int frames);
+
+    using Strips = MixStrips<numChannels, false>;
+    Strips strips;
+
+    /**
+     * [0] is master mute * master gain. The rest are padding for SSE.
+     */
+    MultiLPF<4> filteredMaster;
 
     const float* expansionInputs = nullptr;
 
@@ -251,8 +285,7 @@ private:
 template <class TBase>
 inline void MixM<TBase>::init()
 {
-    const int divRate = 4;
-    divider.setup(divRate, [this, divRate] {
+    divider.setup(divRate, [this] {
         this->stepn(divRate);
         });
 
@@ -268,7 +301,9 @@ inline void MixM<TBase>::onSampleRateChange()
 template <class TBase>
 inline void MixM<TBase>::_disableAntiPop()
 {
-    filteredCV.setCutoff(0.49f);     // set it super fast
+    strips.setCutoff(0.49f);     // set it super fast
+    polyHelper.setVoiceCutoff(0.49f);
+    filteredMaster.setCutoff(0.49f);
 }
 
 template <class TBase>
@@ -276,21 +311,28 @@ inline void MixM<TBase>::setupFilters()
 {
     // 400 was smooth, 100 popped
     const float x = TBase::engineGetSampleTime() * 44100.f / 100.f;
-    filteredCV.setCutoff(x);
+    strips.setCutoff(x);
+    polyHelper.setVoiceCutoff(x);
+    filteredMaster.setCutoff(x);
 }
 
 template <class TBase>
 inline void MixM<TBase>::stepn(int div)
 {
-    float unbufferedCV[cvOffsetMaster + 1] = {0};
+    float unbufferedMaster[4] = {0};
 
     const bool moduleIsMuted = TBase::params[ALL_CHANNELS_OFF_PARAM].value > .5f;
-    const bool AisPreFader = TBase::params[PRE_FADERa_PARAM].value > .5;
-    const bool BisPreFader = TBase::params[PRE_FADERb_PARAM].value > .5;
+    strips.preFaderA = TBase::params[PRE_FADERa_PARAM].value > .5;
+    strips.preFaderB = TBase::params[PRE_FADERb_PARAM].value > .5;
  
     helper.procMixInputs(this);
     helper.procMasterMute(this);
     polyHelper.updatePolyphony(this);
+    {
+        const bool spread = TBase::params[VOICE_SPREAD_PARAM].value > .5f;
+        const bool perVoice = spread || (TBase::params[VOICE_PAN_PARAM].value > .5f);
+        polyHelper.updateVoices(this, perVoice, spread, strips.prePanned);
+    }
 
     // round up some scalars the we need for step()
     {
@@ -302,7 +344,7 @@ inline void MixM<TBase>::stepn(int div)
 
         rawSlider = TBase::params[MASTER_VOLUME_PARAM].value;
         float procMaster =  2 * LookupTable<float>::lookup(*taperLookupParam, rawSlider);
-        unbufferedCV[cvOffsetMaster] = (1.0f - TBase::params[MASTER_MUTE_STATE_PARAM].value) *
+        unbufferedMaster[0] = (1.0f - TBase::params[MASTER_MUTE_STATE_PARAM].value) *
            procMaster;
     }
 
@@ -316,21 +358,13 @@ inline void MixM<TBase>::stepn(int div)
     }
 
     for (int i = 0; i < numChannels; ++i) {
-        float channelGain = 0;
-       
-        // First let's round up the channel volume
-        {
-            const float rawSlider = TBase::params[i + GAIN0_PARAM].value;
-            const float slider = LookupTable<float>::lookup(*taperLookupParam, rawSlider);
-
-            const float rawCV = TBase::inputs[i + LEVEL0_INPUT].isConnected() ?
-                TBase::inputs[i + LEVEL0_INPUT].getVoltage(0) : 10.f;
-            const float cv = std::clamp(
-                rawCV / 10.0f,
-                0.0f,
-                1.0f);
-            channelGain = slider * cv;
-        }
+        strips.fader[i] = TBase::params[i + GAIN0_PARAM].value;
+        strips.levelCV[i] = TBase::inputs[i + LEVEL0_INPUT].isConnected() ?
+            TBase::inputs[i + LEVEL0_INPUT].getVoltage(0) : 10.f;
+        strips.pan[i] = TBase::params[i + PAN0_PARAM].value;
+        strips.panCV[i] = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
+        strips.sendA[i] = TBase::params[i + SEND0_PARAM].value;
+        strips.sendB[i] = TBase::params[i + SENDb0_PARAM].value;
 
         // now round up the mutes
         float rawMuteValue = 0;        // assume muted
@@ -345,49 +379,7 @@ inline void MixM<TBase>::stepn(int div)
              // be applicable if no solo
             rawMuteValue = TBase::params[i + MUTE0_STATE_PARAM].value > .5 ? 0.f : 1.f;
         }
-        channelGain *= rawMuteValue;
-
-        // now the raw channel gains are all computed
-        unbufferedCV[cvOffsetGain + i] = channelGain;
-        unbufferedCV[cvOffsetMute + i] = rawMuteValue;
-
-        // now do the pan calculation
-        {
-            const float balance = TBase::params[i + PAN0_PARAM].value;
-            const float cv = TBase::inputs[i + PAN0_INPUT].getVoltage(0);
-            const float panValue = std::clamp(balance + cv / 5, -1, 1);
-            unbufferedCV[cvOffsetPanLeft + i] = LookupTable<float>::lookup(*panL, panValue) * channelGain;
-            unbufferedCV[cvOffsetPanRight + i] = LookupTable<float>::lookup(*panR, panValue) * channelGain;
-        }
-
-        // precalc all the send gains
-        {
-            const float muteValue = filteredCV.get(cvOffsetMute + i);
-            const float sliderA = TBase::params[i + SEND0_PARAM].value;
-            const float sliderB = TBase::params[i + SENDb0_PARAM].value;
-               
-
-            // TODO: we can do some main volume work ahead of time, just like the sends here
-            if (!AisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level    
-                buf_channelSendGainsALeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderA;
-                buf_channelSendGainsARight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderA;
-            } else {
-                // pre-fader fader, gain sees mutes and send only
-                buf_channelSendGainsALeft[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-                buf_channelSendGainsARight[i] = muteValue * sliderA * (1.f / sqrt(2.f));
-            }
-
-            if (!BisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainsBLeft[i] = filteredCV.get(i + cvOffsetPanLeft) * sliderB;
-                buf_channelSendGainsBRight[i] = filteredCV.get(i + cvOffsetPanRight) * sliderB;
-            } else {
-                // pref fader, gain sees mutes and send only
-                buf_channelSendGainsBLeft[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-                buf_channelSendGainsBRight[i] = muteValue * sliderB * (1.f / sqrt(2.f));
-            }
-        }
+        strips.mute[i] = rawMuteValue;
 
         // refresh the solo lights
         {
@@ -395,7 +387,8 @@ inline void MixM<TBase>::stepn(int div)
             TBase::lights[i + SOLO0_LIGHT].value = (soloValue > .5f) ? 10.f : 0.f;
         }
     }
-    filteredCV.step(unbufferedCV);
+    strips.update();
+    filteredMaster.step(unbufferedMaster);
 }
         
 template <class TBase>
@@ -403,35 +396,27 @@ inline void MixM<TBase>::step()
 {
     divider.step();
 
-    float left = 0, right = 0;              // these variables will be summed up over all channels
-    float lSend = 0, rSend = 0;
-    float lSendb = 0, rSendb = 0;
-
+    // these will be summed up over all channels
+    float busses[Strips::busBufferSize] = {0};
     if (expansionInputs) {
-        left = expansionInputs[0];
-        right = expansionInputs[1];
-        lSend = expansionInputs[2];
-        rSend = expansionInputs[3];
-        lSendb = expansionInputs[4];
-        rSendb = expansionInputs[5];
+        for (int i = 0; i < Strips::numBusses; ++i) {
+            busses[i] = expansionInputs[i];
+        }
     }
 
+    float channelInputs[numChannels];
+    float inputsLeft[numChannels];
+    float inputsRight[numChannels];
+    float channelOutputs[numChannels];
+    polyHelper.getInputs(this, channelInputs, inputsLeft, inputsRight);
+    strips.step(channelInputs, inputsLeft, inputsRight, channelOutputs, busses);
     for (int i = 0; i < numChannels; ++i) {
-        const float channelInput = polyHelper.getNormalizedInputSum(this, i);
-
-        // sum the channel output to the masters
-        left += channelInput * filteredCV.get(i + cvOffsetPanLeft);
-        right += channelInput * filteredCV.get(i + cvOffsetPanRight);
-
-        // TODO: aux sends
-        lSend += channelInput * buf_channelSendGainsALeft[i];
-        lSendb += channelInput * buf_channelSendGainsBLeft[i];
-        rSend += channelInput * buf_channelSendGainsARight[i];
-        rSendb += channelInput * buf_channelSendGainsBRight[i];
-
-        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelInput * filteredCV.get(i + cvOffsetGain), 0);
+        TBase::outputs[i + CHANNEL0_OUTPUT].setVoltage(channelOutputs[i], 0);
     }
 
+    float left = busses[0];
+    float right = busses[1];
+
     // add the returns into the master mix
     left += TBase::inputs[LEFT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGainA;
     right += TBase::inputs[RIGHT_RETURN_INPUT].getVoltage(0) * buf_auxReturnGainA;
@@ -440,15 +425,105 @@ inline void MixM<TBase>::step()
     right += TBase::inputs[RIGHT_RETURNb_INPUT].getVoltage(0) * buf_auxReturnGainB;
 
     // Do send all the master section CV
-    const float masterGain = filteredCV.get(cvOffsetMaster);
+    const float masterGain = filteredMaster.get(0);
     TBase::outputs[LEFT_OUTPUT].setVoltage(left * masterGain, 0);
     TBase::outputs[RIGHT_OUTPUT].setVoltage(right * masterGain, 0);
 
-    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(lSend, 0);
-    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(rSend, 0);
+    TBase::outputs[LEFT_SEND_OUTPUT].setVoltage(busses[2], 0);
+    TBase::outputs[RIGHT_SEND_OUTPUT].setVoltage(busses[3], 0);
+
+    TBase::outputs[LEFT_SENDb_OUTPUT].setVoltage(busses[4], 0);
+    TBase::outputs[RIGHT_SENDb_OUTPUT].setVoltage(busses[5], 0);
+}
 
-    TBase::outputs[LEFT_SENDb_OUTPUT].setVoltage(lSendb, 0);
-    TBase::outputs[RIGHT_SENDb_OUTPUT].setVoltage(rSendb, 0);
+template <class TBase>
+inline void MixM<TBase>::process(const typename TBase::ProcessArgs& args, int frames)
+{
+    BlockPorts ports;
+    for (int i = 0; i < numChannels; ++i) {
+        const int id = i + AUDIO0_INPUT;
+        ports.inputChannels[i] = TBase::inputs[id].getChannels();
+        for (int j = 0; j < ports.inputChannels[i]; ++j) {
+            ports.inputs[i][j] = args.getInputChannel(TBase::inputs[id], id, j);
+        }
+        ports.channelOutputs[i] = args.getOutputChannel(TBase::outputs[i + CHANNEL0_OUTPUT], i + CHANNEL0_OUTPUT, 0);
+    }
+    ports.leftReturn = args.getInputChannel(TBase::inputs[LEFT_RETURN_INPUT], LEFT_RETURN_INPUT, 0);
+    ports.rightReturn = args.getInputChannel(TBase::inputs[RIGHT_RETURN_INPUT], RIGHT_RETURN_INPUT, 0);
+    ports.leftReturnb = args.getInputChannel(TBase::inputs[LEFT_RETURNb_INPUT], LEFT_RETURNb_INPUT, 0);
+    ports.rightReturnb = args.getInputChannel(TBase::inputs[RIGHT_RETURNb_INPUT], RIGHT_RETURNb_INPUT, 0);
+    ports.left = args.getOutputChannel(TBase::outputs[LEFT_OUTPUT], LEFT_OUTPUT, 0);
+    ports.right = args.getOutputChannel(TBase::outputs[RIGHT_OUTPUT], RIGHT_OUTPUT, 0);
+    ports.leftSend = args.getOutputChannel(TBase::outputs[LEFT_SEND_OUTPUT], LEFT_SEND_OUTPUT, 0);
+    ports.rightSend = args.getOutputChannel(TBase::outputs[RIGHT_SEND_OUTPUT], RIGHT_SEND_OUTPUT, 0);
+    ports.leftSendb = args.getOutputChannel(TBase::outputs[LEFT_SENDb_OUTPUT], LEFT_SENDb_OUTPUT, 0);
+    ports.rightSendb = args.getOutputChannel(TBase::outputs[RIGHT_SENDb_OUTPUT], RIGHT_SENDb_OUTPUT, 0);
+
+    for (int first = 0; first < frames; ) {
+        // the control rate processing reads the ports
+        args.loadInputs(TBase::inputs, first);
+        const int n = divider.stepBlock(std::min(divRate, frames - first));
+        processRun(ports, first, n);
+        first += n;
+    }
+    args.finishOutputs(TBase::outputs, frames);
+}
+
+template <class TBase>
+inline void MixM<TBase>::processRun(const BlockPorts& ports, int first, int frames)
+{
+    // all the channels, one frame after another
+    float channelInputs[divRate][numChannels];
+    float inputsLeft[divRate][numChannels];
+    float inputsRight[divRate][numChannels];
+    float channelInput[divRate];
+    for (int i = 0; i < numChannels; ++i) {
+        if (polyHelper.isPerVoice(i)) {
+            for (int frame = 0; frame < frames; ++frame) {
+                polyHelper.getVoiceMix(i, ports.inputs[i], ports.inputChannels[i], first + frame,
+                    inputsLeft[frame][i], inputsRight[frame][i], channelInputs[frame][i]);
+            }
+        } else {
+            polyHelper.getNormalizedInputSum(i, ports.inputs[i], ports.inputChannels[i], channelInput, first, frames);
+            for (int frame = 0; frame < frames; ++frame) {
+                channelInputs[frame][i] = channelInput[frame];
+                inputsLeft[frame][i] = channelInput[frame];
+                inputsRight[frame][i] = channelInput[frame];
+            }
+        }
+    }
+
+    const float masterGain = filteredMaster.get(0);
+    for (int frame = 0; frame < frames; ++frame) {
+        const int f = first + frame;
+        float busses[Strips::busBufferSize] = {0};
+        if (expansionInputs) {
+            for (int i = 0; i < Strips::numBusses; ++i) {
+                busses[i] = expansionInputs[i];
+            }
+        }
+
+        float channelOutputs[numChannels];
+        strips.step(channelInputs[frame], inputsLeft[frame], inputsRight[frame], channelOutputs, busses);
+        for (int i = 0; i < numChannels; ++i) {
+            ports.channelOutputs[i][f] = channelOutputs[i];
+        }
+
+        // add the returns into the master mix
+        float left = busses[0];
+        float right = busses[1];
+        left += ports.leftReturn[f] * buf_auxReturnGainA;
+        right += ports.rightReturn[f] * buf_auxReturnGainA;
+        left += ports.leftReturnb[f] * buf_auxReturnGainB;
+        right += ports.rightReturnb[f] * buf_auxReturnGainB;
+
+        ports.left[f] = left * masterGain;
+        ports.right[f] = right * masterGain;
+        ports.leftSend[f] = busses[2];
+        ports.rightSend[f] = busses[3];
+        ports.leftSendb[f] = busses[4];
+        ports.rightSendb[f] = busses[5];
+    }
 }
 
 template <class TBase>
@@ -580,6 +655,15 @@ inline IComposite::Config MixMDescription<TBase>::getParam(int i)
         case MixM<TBase>::CV_MUTE_TOGGLE:
             ret = {0, 1, 0, "VCTM"};
             break;
+        case MixM<TBase>::BLOCK_BUS_PARAM:
+            ret = {0, 1, 0, "Block bus"};
+            break;
+        case MixM<TBase>::VOICE_PAN_PARAM:
+            ret = {0, 1, 0, "Pan poly voices"};
+            break;
+        case MixM<TBase>::VOICE_SPREAD_PARAM:
+            ret = {0, 1, 0, "Spread poly voices"};
+            break;
         default:
             assert(false);
     }
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "MultiLag.h"
+#include "ObjectCache.h"
+
+#include <assert.h>
+#include <memory>
+#include <xmmintrin.h>
+
+/**
+ * Per voice panning for the polyphonic inputs of a mixer.
+ *
+ * Normally the voices of a polyphonic input are summed to mono before
+ * they get to the channel strip (see MixPolyHelper). In per voice mode each
+ * voice gets its own pan: the strip's pan, plus the same voice of the
+ * pan CV, plus an optional automatic spread across the stereo field.
+ * The panned voices are mixed to left and right, and go into
+ * the strip with its own pan bypassed (MixStrips::prePanned).
+ *
+ * All 16 voices are done at once with SSE. Like the mono sum,
+ * the mix is normalized by the number of voices.
+ *
+ * N is the number of mixer channels.
+ */
+template <int N>
+class MixPolyVoices
+{
+public:
+    static const int maxVoices = 16;
+
+    /**
+     * Control values, one per mixer channel. Fill these in before update().
+     */
+    int voices[N] = {0};
+    float pan[N] = {0};                         // -1..1
+    float panCV[N][maxVoices] = {{0}};          // volts, one per voice
+    bool spread = false;
+
+    /**
+     * For the anti-pop filters, normalized to the control rate.
+     */
+    void setCutoff(float fs)
+    {
+        filteredGains.setCutoff(fs);
+    }
+
+    /**
+     * Control rate processing.
+     */
+    void update();
+
+    /**
+     * Mixes the voices of one channel for one sample.
+     * @param input is maxVoices samples, zero past the last voice.
+     * @param left, right get the panned mix.
+     * @param mono gets the unpanned mix, for the channel's direct output.
+     */
+    void step(int channel, const float* input, float& left, float& right, float& mono) const;
+
+    /**
+     * Where voice 'voice' of 'numVoices' goes when spread, -1..1
+     */
+    static float spreadPosition(int voice, int numVoices)
+    {
+        return (numVoices < 2) ? 0.f : -1.f + 2.f * float(voice) / float(numVoices - 1);
+    }
+
+private:
+    static const int offsetRight = N * maxVoices;
+    MultiLPF<2 * N * maxVoices> filteredGains;
+
+    // what step() uses.
+    float gainLeft[N][maxVoices] = {{0}};
+    float gainRight[N][maxVoices] = {{0}};
+    float monoGain[N] = {0};
+
+    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
+    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+};
+
+template <int N>
+inline void MixPolyVoices<N>::update()
+{
+    float unbufferedGains[2 * N * maxVoices];
+    for (int channel = 0; channel < N; ++channel) {
+        const int numVoices = voices[channel];
+        assert(numVoices >= 0 && numVoices <= maxVoices);
+        const float normalize = numVoices ? 1.f / numVoices : 0.f;
+        monoGain[channel] = normalize;
+
+        float* left = unbufferedGains + channel * maxVoices;
+        float* right = left + offsetRight;
+        if (numVoices == 0) {
+            for (int voice = 0; voice < maxVoices; ++voice) {
+                left[voice] = 0;
+                right[voice] = 0;
+            }
+            continue;
+        }
+
+        float voicePan[maxVoices];
+        float voiceGain[maxVoices];
+        for (int voice = 0; voice < maxVoices; ++voice) {
+            const float position = spread ? spreadPosition(voice, numVoices) : 0.f;
+            voicePan[voice] = pan[channel] + position + panCV[channel][voice] / 5.f;
+            voiceGain[voice] = (voice < numVoices) ? normalize : 0.f;
+        }
+
+        // the lookups clamp the pan to -1..1 for us
+        for (int voice = 0; voice < maxVoices; voice += 4) {
+            const __m128 p = _mm_loadu_ps(voicePan + voice);
+            const __m128 g = _mm_loadu_ps(voiceGain + voice);
+            _mm_storeu_ps(left + voice, _mm_mul_ps(LookupTable<float>::lookup4(*panL, p), g));
+            _mm_storeu_ps(right + voice, _mm_mul_ps(LookupTable<float>::lookup4(*panR, p), g));
+        }
+    }
+
+    filteredGains.step(unbufferedGains);
+    for (int channel = 0; channel < N; ++channel) {
+        for (int voice = 0; voice < maxVoices; ++voice) {
+            gainLeft[channel][voice] = filteredGains.get(channel * maxVoices + voice);
+            gainRight[channel][voice] = filteredGains.get(offsetRight + channel * maxVoices + voice);
+        }
+    }
+}
+
+template <int N>
+inline void MixPolyVoices<N>::step(int channel, const float* input, float& left, float& right, float& mono) const
+{
+    const float* gl = gainLeft[channel];
+    const float* gr = gainRight[channel];
+    const __m128 gm = _mm_set_ps1(monoGain[channel]);
+
+    __m128 sumLeft = _mm_setzero_ps();
+    __m128 sumRight = _mm_setzero_ps();
+    __m128 sumMono = _mm_setzero_ps();
+    for (int voice = 0; voice < maxVoices; voice += 4) {
+        const __m128 x = _mm_loadu_ps(input + voice);
+        sumLeft = _mm_add_ps(sumLeft, _mm_mul_ps(x, _mm_loadu_ps(gl + voice)));
+        sumRight = _mm_add_ps(sumRight, _mm_mul_ps(x, _mm_loadu_ps(gr + voice)));
+        sumMono = _mm_add_ps(sumMono, _mm_mul_ps(x, gm));
+    }
+
+    // turn them sideways, so one add sums all the voices
+    __m128 pad = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(sumLeft, sumRight, sumMono, pad);
+    float sums[4];
+    _mm_storeu_ps(sums, _mm_add_ps(_mm_add_ps(sumLeft, sumRight), _mm_add_ps(sumMono, pad)));
+    left = sums[0];
+    right = sums[1];
+    mono = sums[2];
+}
@@ -5,8 +5,7 @@
 #include "Divider.h"
 #include "IComposite.h"
 #include "MixHelper.h"
-#include "MultiLag.h"
-#include "ObjectCache.h"
+#include "MixStrips.h"
 #include "SqMath.h"
 
 #include <assert.h>
@@ -156,35 +155,11 @@ public:
 
     void stepn(int steps);
 
-    // These are all calculated in stepn from the
-    // contents of filteredCV
-
-    // TODO: this should be numGroups
-    float buf_channelSendGainA[numChannels] = {0};
-    float buf_channelSendGainB[numChannels] = {0};
-
-    // TODO: reduce this number to what we actually need
-
     /**
-     * old idea (taken from mono)
-     *      0..1 for smoothed input gain * channel mute
-     *      2..3 for left  pan
-     *      4..5 for right pan
-     *      6..7 for mute
-     * 
-     * New idea
-     *      0..1 for smoothed input gain * channel mute
-     *      2..5 gain * balance (per channel)
-     *      6..7 mute
+     * Each group is a stereo strip, with a balance control.
+     * Public so the tests can look at the gains.
      */
-
-    static const int cvOffsetGain = 0;
-    static const int cvOffsetGainBalance = 2;
-    static const int cvOffsetMute = 6;
-    static const int cvFilterSize = 8;
-
-    // This is where we build up all the inputs to the CV filter
-    float unbufferedCV[cvFilterSize] = {0};
+    MixStrips<numChannels, true> strips;
 
 #ifdef _NN
     bool groupIsMono[numGroups] = {false};
@@ -195,31 +170,19 @@ public:
 private:
     Divider divider;
 
-    MultiLPF<cvFilterSize> filteredCV;
-
-   // std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
-   // std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
-
     const float* expansionInputs = nullptr;
     float* expansionOutputs = nullptr;
 
     // TODO:cut down mix helper size.
     MixHelper<MixStereo<TBase>> helper;
-
-     std::shared_ptr<LookupTableParams<float>> taperLookupParam =  ObjectCache<float>::getAudioTaper18();
 };
 
 template <class TBase>
 inline void MixStereo<TBase>::stepn(int div)
 {
-    const int numUb = cvFilterSize;
-    for (int i = 0; i < numUb; ++i) {
-        unbufferedCV[i] = 0;
-    }
-
     const bool moduleIsMuted = TBase::params[ALL_CHANNELS_OFF_PARAM].value > .5f;
-    const bool AisPreFader = TBase::params[PRE_FADERa_PARAM].value > .5;
-    const bool BisPreFader = TBase::params[PRE_FADERb_PARAM].value > .5;
+    strips.preFaderA = TBase::params[PRE_FADERa_PARAM].value > .5;
+    strips.preFaderB = TBase::params[PRE_FADERb_PARAM].value > .5;
 
     helper.procMixInputs(this);
 
@@ -234,23 +197,20 @@ inline void MixStereo<TBase>::stepn(int div)
     }
 
     for (int group = 0; group < numGroups; ++group) {
-        float groupGain = 0;
-
-        // First let's round up the channel volume
-        {
-            assert(group + GAIN0_PARAM < NUM_PARAMS);
-            const float rawSlider = TBase::params[group + GAIN0_PARAM].value;
-            const float slider = LookupTable<float>::lookup(*taperLookupParam, rawSlider);
-
-            assert(group + LEVEL0_INPUT < NUM_INPUTS);
-            const float rawCV = TBase::inputs[group + LEVEL0_INPUT].isConnected() ?
-                TBase::inputs[group + LEVEL0_INPUT].getVoltage(0) : 10.f;
-            const float cv = std::clamp(
-                rawCV / 10.0f,
-                0.0f,
-                1.0f);
-            groupGain = slider * cv;
-        }
+        // First let's round up the channel volume, pan and sends
+        assert(group + GAIN0_PARAM < NUM_PARAMS);
+        assert(group + LEVEL0_INPUT < NUM_INPUTS);
+        assert(group + PAN0_PARAM < NUM_PARAMS);
+        assert(group + PAN0_INPUT < NUM_INPUTS);
+        assert(group + SEND0_PARAM < NUM_PARAMS);
+        assert(group + SENDb0_PARAM < NUM_PARAMS);
+        strips.fader[group] = TBase::params[group + GAIN0_PARAM].value;
+        strips.levelCV[group] = TBase::inputs[group + LEVEL0_INPUT].isConnected() ?
+            TBase::inputs[group + LEVEL0_INPUT].getVoltage(0) : 10.f;
+        strips.pan[group] = TBase::params[group + PAN0_PARAM].value;
+        strips.panCV[group] = TBase::inputs[group + PAN0_INPUT].getVoltage(0);
+        strips.sendA[group] = TBase::params[group + SEND0_PARAM].value;
+        strips.sendB[group] = TBase::params[group + SENDb0_PARAM].value;
 
         // now round up the mutes
         float rawMuteValue = 0;        // assume muted
@@ -267,62 +227,7 @@ inline void MixStereo<TBase>::stepn(int div)
             assert(group + MUTE0_STATE_PARAM < NUM_PARAMS);
             rawMuteValue = TBase::params[group + MUTE0_STATE_PARAM].value > .5 ? 0.f : 1.f;
         }
-
-        groupGain *= rawMuteValue;
-
-        // now the raw channel gains are all computed
-        // TODO: split this out into a separate function, only needs to be done on groups
-        assert(cvOffsetGain + group < cvFilterSize);
-        assert(cvOffsetMute + group < cvFilterSize);
-        unbufferedCV[cvOffsetGain + group] = groupGain;
-        unbufferedCV[cvOffsetMute + group] = rawMuteValue;
-
-        // now do the pan calculation
-        {
-            assert(group + PAN0_PARAM < NUM_PARAMS);
-            assert(group + PAN0_INPUT < NUM_INPUTS);
-            const float balance = TBase::params[group + PAN0_PARAM].value;
-            const float cv = TBase::inputs[group + PAN0_INPUT].getVoltage(0);
-            const float panValue = std::clamp(balance + cv / 5, -1, 1);
-
-            float rightPan = 1 + panValue;   // 0..2
-            rightPan *= .5f;                // 0..1
-            float leftPan = 1 - rightPan;
-            unbufferedCV[cvOffsetGainBalance + group * 2] = leftPan * groupGain;
-            unbufferedCV[cvOffsetGainBalance + group * 2 + 1] = rightPan * groupGain;
-        }
-
-        // Calculate all the send gains
-        {
-            assert(group + SEND0_PARAM < NUM_PARAMS);
-            assert(group + SENDb0_PARAM < NUM_PARAMS);
-
-            const float muteValue = filteredCV.get(cvOffsetMute + group);
-            const float sliderA = TBase::params[group + SEND0_PARAM].value;
-            const float sliderB = TBase::params[group + SENDb0_PARAM].value;
-
-            const float panAttenuation = .5f;     // 6db pan law
-
-            // TODO: we can do some main volume work ahead of time, just like the sends here
-            if (!AisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level    
-                buf_channelSendGainA[group * 2] = filteredCV.get(group * 2 + cvOffsetGainBalance) * sliderA;
-                buf_channelSendGainA[group * 2 + 1] = filteredCV.get(group * 2 + 1 +  cvOffsetGainBalance) * sliderA;
-            } else {
-                // pre-fader fader, gain sees mutes and send only
-                buf_channelSendGainA[group * 2] = muteValue * sliderA * panAttenuation;
-                buf_channelSendGainA[group * 2 + 1] = muteValue * sliderA * panAttenuation;
-            }
-
-            if (!BisPreFader) {
-                // post faster, gain sees mutes, faders,  pan, and send level
-                buf_channelSendGainB[group * 2] = filteredCV.get(group * 2 + cvOffsetGainBalance) * sliderB;
-                buf_channelSendGainB[group * 2 + 1] = filteredCV.get(group * 2 + 1 + cvOffsetGainBalance) * sliderB;
-            } else {
-                buf_channelSendGainB[group * 2] = muteValue * sliderB * panAttenuation;
-                buf_channelSendGainB[group * 2 + 1] = muteValue * sliderB * panAttenuation;
-            }
-        }
+        strips.mute[group] = rawMuteValue;
 
         // look for normaled mono channels
         {
@@ -341,7 +246,7 @@ inline void MixStereo<TBase>::stepn(int div)
             TBase::lights[group + SOLO0_LIGHT].value = (soloValue > .5f) ? 10.f : 0.f;
         }
     }
-    filteredCV.step(unbufferedCV);
+    strips.update();
 }
 
 template <class TBase>
@@ -365,13 +270,13 @@ inline void MixStereo<TBase>::setupFilters()
 {
     // 400 was smooth, 100 popped
     const float x = TBase::engineGetSampleTime() * 44100.f / 100.f;
-    filteredCV.setCutoff(x);
+    strips.setCutoff(x);
 }
 
 template <class TBase>
 inline void MixStereo<TBase>::_disableAntiPop()
 {
-    filteredCV.setCutoff(0.49f);     // set it super fast
+    strips.setCutoff(0.49f);     // set it super fast
 }
 
 template <class TBase>
@@ -379,67 +284,42 @@ inline void MixStereo<TBase>::step()
 {
     divider.step();
 
-    float left = 0, right = 0;              // these variables will be summed up over all channels
-    float lSendA = 0, rSendA = 0;
-    float lSendB = 0, rSendB = 0;
-
+    // these will be summed up over all channels
+    float busses[MixStrips<numChannels, true>::busBufferSize] = {0};
     if (expansionInputs) {
-        left = expansionInputs[0];
-        right = expansionInputs[1];
-        lSendA = expansionInputs[2];
-        rSendA = expansionInputs[3];
-        lSendB = expansionInputs[4];
-        rSendB = expansionInputs[5];
+        for (int i = 0; i < MixStrips<numChannels, true>::numBusses; ++i) {
+            busses[i] = expansionInputs[i];
+        }
     }
 
+    float channelInputs[numChannels];
+    float channelOutputs[numChannels];
     for (int channel = 0; channel < numChannels; ++channel) {
-        const int group = channel / 2;
-        const bool isLeft = !(channel & 1);
-
         int inputChannel = channel;
 #ifdef _NN
+        const int group = channel / 2;
+        const bool isLeft = !(channel & 1);
         if (!isLeft && groupIsMono[group]) {
             inputChannel--;
         }
 #endif
         assert(channel + AUDIO0_INPUT < NUM_INPUTS);
-        const float channelInput = TBase::inputs[inputChannel + AUDIO0_INPUT].getVoltage(0);
-
-        if (isLeft) {
-            left += channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-            lSendA += channelInput * buf_channelSendGainA[channel];
-            lSendB += channelInput * buf_channelSendGainB[channel];
-        } else {
-            right += channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-            rSendA += channelInput * buf_channelSendGainA[channel];
-            rSendB += channelInput * buf_channelSendGainB[channel];
-        }
+        channelInputs[channel] = TBase::inputs[inputChannel + AUDIO0_INPUT].getVoltage(0);
+    }
 
-        // now calculate and output the channel outs
-        // TODO: clean this up
+    // the channel outs are always panned - mod for artem
+    strips.step(channelInputs, channelOutputs, busses);
+    for (int channel = 0; channel < numChannels; ++channel) {
         assert(channel + CHANNEL0_OUTPUT < NUM_OUTPUTS);
-        #ifdef _NN
-        float channelOutput = 0;
-            if (groupIsMono[group] || true) {           // mod for artem - pan all the time
-                channelOutput = channelInput * filteredCV.get(channel + cvOffsetGainBalance);
-            } else {
-                channelOutput = channelInput * filteredCV.get(group + cvOffsetGain);
-            }
-            TBase::outputs[channel + CHANNEL0_OUTPUT].setVoltage(channelOutput, 0);
-        #else
-            TBase::outputs[channel + CHANNEL0_OUTPUT].value = channelInput * filteredCV.get(group + cvOffsetGain);
-        #endif
+        TBase::outputs[channel + CHANNEL0_OUTPUT].setVoltage(channelOutputs[channel], 0);
     }
 
     // output the buses to the expansion port
     if (expansionOutputs) {
-        expansionOutputs[0] = left;
-        expansionOutputs[1] = right;
-        expansionOutputs[2] = lSendA;
-        expansionOutputs[3] = rSendA;
-        expansionOutputs[4] = lSendB;
-        expansionOutputs[5] = rSendB;
-    } 
+        for (int i = 0; i < MixStrips<numChannels, true>::numBusses; ++i) {
+            expansionOutputs[i] = busses[i];
+        }
+    }
 }
 
 template <class TBase>
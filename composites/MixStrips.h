@@ -0,0 +1,297 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "MultiLag.h"
+#include "ObjectCache.h"
+
+#include <assert.h>
+#include <cmath>
+#include <memory>
+#include <xmmintrin.h>
+
+/**
+ * The channel strips of a mixer: the faders, pans, mutes and sends,
+ * for all the channels at once.
+ *
+ * The mixer fills in the control values, and calls update() at the
+ * control rate. Then step() mixes each sample.
+ * Both work four channels at a time with SSE.
+ *
+ * N is the number of audio channels, and must be a multiple of four.
+ * If stereo, the channels are in pairs (left, right), and each pair has
+ * one set of controls. The pan is a balance control, and each side only
+ * goes to its own side of the busses.
+ * If not stereo, each channel has its own controls and an equal power pan.
+ *
+ * The busses are the same as the expansion bus:
+ *      left, right, send A left, send A right, send B left, send B right
+ *
+ * The gains, pans and mutes go through the anti-pop filters, the sends
+ * are calculated from the filtered values.
+ */
+template <int N, bool stereo>
+class MixStrips
+{
+public:
+    static const int numChannels = N;
+    static const int numStrips = stereo ? N / 2 : N;
+    static const int numBusses = 6;
+    static const int busBufferSize = 8;     // padded for SSE
+
+    MixStrips();
+
+    /**
+     * Control values, one per strip. Fill these in before update().
+     */
+    float fader[numStrips] = {0};      // 0..1, before the taper
+    float levelCV[numStrips] = {0};    // volts. 10 when nothing is patched
+    float pan[numStrips] = {0};        // -1..1
+    float panCV[numStrips] = {0};      // volts
+    float mute[numStrips] = {0};       // 1 is on, 0 is muted.
+    float sendA[numStrips] = {0};
+    float sendB[numStrips] = {0};
+    bool preFaderA = false;
+    bool preFaderB = false;
+
+    /**
+     * Mono strips only. If set the strip's input has already been panned,
+     * (like the voices from MixPolyVoices), so the strip's pan is bypassed
+     * and the left and right inputs go straight to the busses.
+     * Pre-fader sends keep that panning.
+     */
+    bool prePanned[numStrips] = {false};
+
+    /**
+     * If false, the faders are linear.
+     */
+    void setUseTaper(bool b)
+    {
+        useTaper = b;
+    }
+
+    /**
+     * For the anti-pop filters, normalized to the control rate.
+     */
+    void setCutoff(float fs)
+    {
+        filteredCV.setCutoff(fs);
+    }
+
+    /**
+     * Control rate processing.
+     */
+    void update();
+
+    /**
+     * Mixes one sample.
+     * @param input is numChannels audio inputs.
+     * @param channelOutputs gets numChannels outputs, after the fader and mute.
+     * @param busses is busBufferSize floats. The mix is added to what is there.
+     */
+    void step(const float* input, float* channelOutputs, float* busses) const
+    {
+        step(input, input, input, channelOutputs, busses);
+    }
+
+    /**
+     * Mixes one sample, with separate inputs for the left and right busses.
+     * Channels that aren't prePanned should have the same input in all three.
+     * @param input is what goes to the channel outputs.
+     */
+    void step(const float* input, const float* inputLeft, const float* inputRight,
+        float* channelOutputs, float* busses) const;
+
+    /**
+     * The filtered gains, after update().
+     */
+    float getChannelGain(int channel) const
+    {
+        return channelGain[channel];
+    }
+    float getBusGain(int bus, int channel) const
+    {
+        return busGains[bus][channel];
+    }
+
+private:
+    static const int offsetGain = 0;
+    static const int offsetLeft = N;
+    static const int offsetRight = 2 * N;
+    static const int offsetMute = 3 * N;
+    MultiLPF<4 * N> filteredCV;
+
+    // what step() uses.
+    float channelGain[N] = {0};
+    float busGains[numBusses][N] = {{0}};
+    float muteGain[N] = {0};
+
+    // per channel gain and side for pre-fader sends.
+    float preFaderLeft[N];
+    float preFaderRight[N];
+    float isLeft[N];
+    float isRight[N];
+
+    bool useTaper = true;
+
+    std::shared_ptr<LookupTableParams<float>> panL = ObjectCache<float>::getMixerPanL();
+    std::shared_ptr<LookupTableParams<float>> panR = ObjectCache<float>::getMixerPanR();
+    std::shared_ptr<LookupTableParams<float>> taperLookupParam = ObjectCache<float>::getAudioTaper18();
+
+    static int stripOf(int channel)
+    {
+        return stereo ? channel / 2 : channel;
+    }
+    static __m128 clamp4(__m128 x, float lo, float hi)
+    {
+        return _mm_min_ps(_mm_max_ps(x, _mm_set_ps1(lo)), _mm_set_ps1(hi));
+    }
+};
+
+template <int N, bool stereo>
+inline MixStrips<N, stereo>::MixStrips()
+{
+    static_assert((N % 4) == 0, "mix strips come in fours");
+    for (int i = 0; i < N; ++i) {
+        const bool left = !stereo || !(i & 1);
+        const bool right = !stereo || (i & 1);
+        isLeft[i] = left ? 1.f : 0.f;
+        isRight[i] = right ? 1.f : 0.f;
+
+        // mono: 3db pan law. stereo: 6db, and only to our own side
+        const float preGain = stereo ? .5f : (1.f / std::sqrt(2.f));
+        preFaderLeft[i] = left ? preGain : 0.f;
+        preFaderRight[i] = right ? preGain : 0.f;
+    }
+}
+
+template <int N, bool stereo>
+inline void MixStrips<N, stereo>::update()
+{
+    // spread the controls out to one per channel
+    float channelFader[N];
+    float channelCV[N];
+    float channelPan[N];
+    float channelPanCV[N];
+    float channelMute[N];
+    float channelSendA[N];
+    float channelSendB[N];
+    float channelPanned[N];
+    for (int i = 0; i < N; ++i) {
+        const int strip = stripOf(i);
+        channelFader[i] = fader[strip];
+        channelCV[i] = levelCV[strip];
+        channelPan[i] = pan[strip];
+        channelPanCV[i] = panCV[strip];
+        channelMute[i] = mute[strip];
+        channelSendA[i] = sendA[strip];
+        channelSendB[i] = sendB[strip];
+        channelPanned[i] = (!stereo && prePanned[strip]) ? 1.f : 0.f;
+    }
+
+    float unbufferedCV[4 * N];
+    for (int i = 0; i < N; i += 4) {
+        __m128 slider = _mm_loadu_ps(channelFader + i);
+        if (useTaper) {
+            slider = LookupTable<float>::lookup4(*taperLookupParam, slider);
+        }
+        const __m128 cv = clamp4(_mm_div_ps(_mm_loadu_ps(channelCV + i), _mm_set_ps1(10.f)), 0, 1);
+        const __m128 muteValue = _mm_loadu_ps(channelMute + i);
+        const __m128 gain = _mm_mul_ps(_mm_mul_ps(slider, cv), muteValue);
+
+        const __m128 panValue = clamp4(_mm_add_ps(
+            _mm_loadu_ps(channelPan + i),
+            _mm_div_ps(_mm_loadu_ps(channelPanCV + i), _mm_set_ps1(5.f))), -1, 1);
+
+        __m128 left, right, output;
+        if (stereo) {
+            // balance: each side gets only its own gain
+            const __m128 rightPan = _mm_mul_ps(_mm_add_ps(panValue, _mm_set_ps1(1.f)), _mm_set_ps1(.5f));
+            const __m128 leftPan = _mm_sub_ps(_mm_set_ps1(1.f), rightPan);
+            const __m128 sideL = _mm_loadu_ps(isLeft + i);
+            const __m128 sideR = _mm_loadu_ps(isRight + i);
+            const __m128 balance = _mm_add_ps(_mm_mul_ps(leftPan, sideL), _mm_mul_ps(rightPan, sideR));
+            output = _mm_mul_ps(balance, gain);
+            left = _mm_mul_ps(output, sideL);
+            right = _mm_mul_ps(output, sideR);
+        } else {
+            // pre-panned channels get unity instead of the pan law
+            const __m128 panned = _mm_loadu_ps(channelPanned + i);
+            const __m128 notPanned = _mm_sub_ps(_mm_set_ps1(1.f), panned);
+            const __m128 panLeft = _mm_add_ps(_mm_mul_ps(LookupTable<float>::lookup4(*panL, panValue), notPanned), panned);
+            const __m128 panRight = _mm_add_ps(_mm_mul_ps(LookupTable<float>::lookup4(*panR, panValue), notPanned), panned);
+            left = _mm_mul_ps(panLeft, gain);
+            right = _mm_mul_ps(panRight, gain);
+            output = gain;
+        }
+        _mm_storeu_ps(unbufferedCV + offsetGain + i, output);
+        _mm_storeu_ps(unbufferedCV + offsetLeft + i, left);
+        _mm_storeu_ps(unbufferedCV + offsetRight + i, right);
+        _mm_storeu_ps(unbufferedCV + offsetMute + i, muteValue);
+    }
+
+    // the sends come from the filtered gains we already have
+    for (int i = 0; i < N; i += 4) {
+        const __m128 filteredLeft = _mm_loadu_ps(busGains[0] + i);
+        const __m128 filteredRight = _mm_loadu_ps(busGains[1] + i);
+        const __m128 filteredMute = _mm_loadu_ps(muteGain + i);
+        const __m128 panned = _mm_loadu_ps(channelPanned + i);
+        const __m128 notPanned = _mm_sub_ps(_mm_set_ps1(1.f), panned);
+        const __m128 preLeft = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(preFaderLeft + i), notPanned), panned);
+        const __m128 preRight = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(preFaderRight + i), notPanned), panned);
+
+        const __m128 levelA = _mm_loadu_ps(channelSendA + i);
+        const __m128 levelB = _mm_loadu_ps(channelSendB + i);
+        const __m128 preA = _mm_mul_ps(filteredMute, levelA);
+        const __m128 preB = _mm_mul_ps(filteredMute, levelB);
+
+        // post fader sees mutes, faders, pan, and send level.
+        // pre fader sees mutes and send level
+        _mm_storeu_ps(busGains[2] + i, preFaderA ? _mm_mul_ps(preA, preLeft) : _mm_mul_ps(filteredLeft, levelA));
+        _mm_storeu_ps(busGains[3] + i, preFaderA ? _mm_mul_ps(preA, preRight) : _mm_mul_ps(filteredRight, levelA));
+        _mm_storeu_ps(busGains[4] + i, preFaderB ? _mm_mul_ps(preB, preLeft) : _mm_mul_ps(filteredLeft, levelB));
+        _mm_storeu_ps(busGains[5] + i, preFaderB ? _mm_mul_ps(preB, preRight) : _mm_mul_ps(filteredRight, levelB));
+    }
+
+    filteredCV.step(unbufferedCV);
+    for (int i = 0; i < N; ++i) {
+        channelGain[i] = filteredCV.get(offsetGain + i);
+        busGains[0][i] = filteredCV.get(offsetLeft + i);
+        busGains[1][i] = filteredCV.get(offsetRight + i);
+        muteGain[i] = filteredCV.get(offsetMute + i);
+    }
+}
+
+template <int N, bool stereo>
+inline void MixStrips<N, stereo>::step(const float* input, const float* inputLeft, const float* inputRight,
+    float* channelOutputs, float* busses) const
+{
+    __m128 sum0 = _mm_loadu_ps(busses);         // left, right, send A
+    __m128 sum1 = _mm_loadu_ps(busses + 4);     // send B
+    const __m128 zero = _mm_setzero_ps();
+
+    for (int i = 0; i < N; i += 4) {
+        const __m128 x = _mm_loadu_ps(input + i);
+        const __m128 xl = _mm_loadu_ps(inputLeft + i);
+        const __m128 xr = _mm_loadu_ps(inputRight + i);
+        _mm_storeu_ps(channelOutputs + i, _mm_mul_ps(x, _mm_loadu_ps(channelGain + i)));
+
+        // each of these has four channels of one bus
+        __m128 left = _mm_mul_ps(xl, _mm_loadu_ps(busGains[0] + i));
+        __m128 right = _mm_mul_ps(xr, _mm_loadu_ps(busGains[1] + i));
+        __m128 leftA = _mm_mul_ps(xl, _mm_loadu_ps(busGains[2] + i));
+        __m128 rightA = _mm_mul_ps(xr, _mm_loadu_ps(busGains[3] + i));
+        __m128 leftB = _mm_mul_ps(xl, _mm_loadu_ps(busGains[4] + i));
+        __m128 rightB = _mm_mul_ps(xr, _mm_loadu_ps(busGains[5] + i));
+        __m128 padB0 = zero;
+        __m128 padB1 = zero;
+
+        // turn them sideways so that adding them up sums the channels
+        // and leaves us with one bus in each lane.
+        _MM_TRANSPOSE4_PS(left, right, leftA, rightA);
+        sum0 = _mm_add_ps(sum0, _mm_add_ps(_mm_add_ps(left, right), _mm_add_ps(leftA, rightA)));
+        _MM_TRANSPOSE4_PS(leftB, rightB, padB0, padB1);
+        sum1 = _mm_add_ps(sum1, _mm_add_ps(_mm_add_ps(leftB, rightB), _mm_add_ps(padB0, padB1)));
+    }
+    _mm_storeu_ps(busses, sum0);
+    _mm_storeu_ps(busses + 4, sum1);
+}
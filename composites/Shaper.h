@@ -2,6 +2,8 @@
 
 #include "AsymWaveShaper.h"
 #include "ButterworthFilterDesigner.h"
+#include "HalfBandDecimator.h"
+#include "HalfBandUpsampler.h"
 #include "IComposite.h"
 #include "IIRUpsampler.h"
 #include "IIRDecimator.h"
@@ -94,6 +96,7 @@ public:
         PARAM_OFFSET_TRIM,
         PARAM_OVERSAMPLE,
         PARAM_ACDC,
+        PARAM_POLYPHASE,
         NUM_PARAMS
     };
 
@@ -148,6 +151,7 @@ private:
     AsymWaveShaper asymShaper;
     int cycleCount = 0;
     Shapes shape = Shapes::Clip;
+    bool polyphase = false;
     int asymCurveindex = 0;
 
   
@@ -162,6 +166,8 @@ private:
 
         IIRUpsampler up;
         IIRDecimator dec;
+        HalfBandUpsampler upPolyphase;
+        HalfBandDecimator decPolyphase;
 
         bool isActive = false;
     };
@@ -227,6 +233,8 @@ void  Shaper<TBase>::setOversample()
         DSPImp& imp = dsp[i];
         imp.up.setup(curOversample);
         imp.dec.setup(curOversample);
+        imp.upPolyphase.setup(curOversample);
+        imp.decPolyphase.setup(curOversample);
     }
 }
 
@@ -278,6 +286,8 @@ void Shaper<TBase>::processCV()
 
     _offset = offsetInput;
 
+    polyphase = TBase::params[PARAM_POLYPHASE].value > .5;
+
     const int iShape = (int) std::round(TBase::params[PARAM_SHAPE].value);
     shape = Shapes(iShape);
 
@@ -313,7 +323,11 @@ void  Shaper<TBase>::step()
             }
 
             if (curOversample != 1) {
-                imp.up.process(buffer, input);
+                if (polyphase) {
+                    imp.upPolyphase.process(buffer, input);
+                } else {
+                    imp.up.process(buffer, input);
+                }
             } else {
                 buffer[0] = input;
             }
@@ -321,7 +335,7 @@ void  Shaper<TBase>::step()
             processBuffer(buffer);
             float output;
             if (curOversample != 1) {
-                output = imp.dec.process(buffer);
+                output = polyphase ? imp.decPolyphase.process(buffer) : imp.dec.process(buffer);
             } else {
                 output = buffer[0];
             }
@@ -480,6 +494,9 @@ IComposite::Config ShaperDescription<TBase>::getParam(int i)
         case Shaper<TBase>::PARAM_ACDC:
             ret = {0.0f, 1.f, 0, "AC/DC"};
             break;
+        case Shaper<TBase>::PARAM_POLYPHASE:
+            ret = {0.0f, 1.f, 0, "Polyphase oversampling"};
+            break;
         default:
             assert(false);
     }
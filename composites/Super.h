@@ -3,12 +3,16 @@
 
 #include "Divider.h"
 #include "GateTrigger.h"
+#include "HalfBandDecimator.h"
 #include "IComposite.h"
 #include "IIRDecimator.h"
 #include "NonUniformLookupTable.h"
 #include "ObjectCache.h"
+#include "RandomSimd.h"
 #include "StateVariable4PHP.h"
 
+#include <xmmintrin.h>
+
 namespace rack {
     namespace engine {
         struct Module;
@@ -68,17 +72,21 @@ public:
  * classic cpu: 14.4
  * clean: 29.6
  * clean2: 85.3
+ *
+ * Polyphonic. The number of voices is set by the number of channels
+ * in the CV input. Voices are processed four at a time, one voice
+ * in each lane of an __m128, so 4 voices cost about the same as one.
  */
 template <class TBase>
 class Super : public TBase
 {
 public:
 
-    Super(Module * module) : TBase(module), gateTrigger(true)
+    Super(Module * module) : TBase(module)
     {
         init();
     }
-    Super() : TBase(), gateTrigger(true)
+    Super() : TBase()
     {
         init();
     }
@@ -110,6 +118,7 @@ public:
         FM_PARAM,
         CLEAN_PARAM,
         HARD_PAN_PARAM,
+        POLYPHASE_PARAM,
         NUM_PARAMS
     };
 
@@ -140,21 +149,49 @@ public:
      */
     void step() override;
 
+    /**
+     * Block processing entry point.
+     * Output is the same as calling step() 'frames' times.
+     */
+    void process(const typename TBase::ProcessArgs& args, int frames) override;
+
+    /**
+     * Number of voices we are currently generating.
+     */
+    int getNumChannels() const
+    {
+        return numChannels;
+    }
+
+    static const int maxChannels = 16;
+
 private:
     static const unsigned int MAX_OVERSAMPLE = 16;
     static const int numSaws = 7;
+    static const int maxBanks = maxChannels / 4;
 
-    float phase[numSaws] = {0};
-    float phaseInc[numSaws] = {0};
-    float globalPhaseInc = 0;
+    /**
+     * All the per-saw state is organized in "banks".
+     * Each bank holds four voices, one in each lane.
+     */
+    __m128 phase[maxBanks][numSaws];
+    __m128 phaseInc[maxBanks][numSaws];
+
+    // current left and right gains, including the 4.5 make-up gain.
+    // In mono, only [0] is used.
+    __m128 sawGains[maxBanks][2][numSaws];
+
+    float globalPhaseInc[maxChannels] = {0};
+    float detuneInput[maxChannels] = {0};
+    float gainCenter[maxChannels] = {0};
+    float gainSides[maxChannels] = {0};
+
+    int numChannels = 1;
+    int numBanks = 1;
+    int oversampleRate = 1;
+    bool polyphase = false;
     bool isStereo = false;
 
-    // current left and right gains
-    float sawGainsStereo[2][numSaws] = {
-        {.2f},
-        {.2f}
-    };
-
     float sawGainsNorm[2][numSaws] = {
         {1.f, .26f, .87f, .71f, .5f, .97f, 0.f},
         {0.f, .97f, .5f,  .71f, .87f,.26f, 1.f}
@@ -166,6 +203,14 @@ private:
     };
     Divider div;
 
+    /**
+     * While inside process(), the output buffers (if any) for every channel,
+     * and the frame we are on.
+     */
+    bool inBlock = false;
+    float* blockOutputs[NUM_OUTPUTS][maxChannels] = {};
+    int blockFrame = 0;
+
     std::function<float(float)> expLookup =
         ObjectCache<float>::getExp2Ex();
     std::shared_ptr<LookupTableParams<float>> audioTaper =
@@ -174,23 +219,27 @@ private:
     // knob, cv, trim -> 0..1
     AudioMath::ScaleFun<float> scaleDetune;
 
-    void runSaws(float& left);
-    void runSawsStereo(float& left, float& right);
+    void runSaws(int bank, __m128& left);
+    void runSawsStereo(int bank, __m128& left, __m128& right);
     void updatePhaseInc();
 
-    void updateAudioClassic();
-    void updateAudioClean();
-    void updateAudioClassicStereo();
-    void updateAudioCleanStereo();
+    void updateAudioClassic(int bank);
+    void updateAudioClean(int bank);
+    void updateAudioClassicStereo(int bank);
+    void updateAudioCleanStereo(int bank);
+    void updateAudio();
     void updateTrigger();
     void updateMix();
     void updateStereo();
     void updateStereoGains();
+    void updateChannels();
+    void randomizePhase(int channel);
+    void writeOutput(int output, int bank, __m128 value);
     void stepn(int);
 
     int getOversampleRate();
 
-    AudioMath::RandomUniformFunc random = AudioMath::random();
+    RandomSimd random;
 
    // int inputSubSampleCounter = 1;
     const static int inputSubSample = 4;    // only look at knob/cv every 4
@@ -209,17 +258,17 @@ private:
     void updateHPFilters();
 
     SawtoothDetuneCurve detuneCurve;
-    GateTrigger gateTrigger;
-    float gainCenter = 0;
-    float gainSides = 0;
+    GateTrigger gateTrigger[maxChannels];
 
-    StateVariable4PHP hpfLeft;
-    StateVariable4PHP hpfRight;
+    StateVariable4PHPSimd hpfLeft[maxBanks];
+    StateVariable4PHPSimd hpfRight[maxBanks];
 
-    float bufferLeft[MAX_OVERSAMPLE] = {0};
-    float bufferRight[MAX_OVERSAMPLE] = {0};
-    IIRDecimator decimatorLeft;
-    IIRDecimator decimatorRight;
+    __m128 bufferLeft[MAX_OVERSAMPLE];
+    __m128 bufferRight[MAX_OVERSAMPLE];
+    IIRDecimatorSimd decimatorLeft[maxBanks];
+    IIRDecimatorSimd decimatorRight[maxBanks];
+    HalfBandDecimatorSimd polyphaseLeft[maxBanks];
+    HalfBandDecimatorSimd polyphaseRight[maxBanks];
 };
 
 template <class TBase>
@@ -231,10 +280,23 @@ inline void Super<TBase>::init()
 
     scaleDetune = AudioMath::makeLinearScaler<float>(0, 1);
 
+    for (int bank = 0; bank < maxBanks; ++bank) {
+        for (int i = 0; i < numSaws; ++i) {
+            phase[bank][i] = _mm_setzero_ps();
+            phaseInc[bank][i] = _mm_setzero_ps();
+            sawGains[bank][0][i] = _mm_set_ps1(.2f);
+            sawGains[bank][1][i] = _mm_set_ps1(.2f);
+        }
+    }
+
     const int rate = getOversampleRate();
     const int decimateDiv = std::max(rate, (int) MAX_OVERSAMPLE);
-    decimatorLeft.setup(decimateDiv);
-    decimatorRight.setup(decimateDiv);
+    for (int bank = 0; bank < maxBanks; ++bank) {
+        decimatorLeft[bank].setup(decimateDiv);
+        decimatorRight[bank].setup(decimateDiv);
+        polyphaseLeft[bank].setup(decimateDiv);
+        polyphaseRight[bank].setup(decimateDiv);
+    }
 }
 
 template <class TBase>
@@ -260,156 +322,194 @@ inline int Super<TBase>::getOversampleRate()
 }
 
 template <class TBase>
-inline void Super<TBase>::updatePhaseInc()
+inline void Super<TBase>::updateChannels()
 {
-    const float cv = TBase::inputs[CV_INPUT].getVoltage(0);
+    numChannels = std::max(1, TBase::inputs[CV_INPUT].getChannels());
+    numBanks = (numChannels + 3) / 4;
+    TBase::outputs[MAIN_OUTPUT_LEFT].setChannels(numChannels);
+    TBase::outputs[MAIN_OUTPUT_RIGHT].setChannels(numChannels);
+}
 
+template <class TBase>
+inline void Super<TBase>::updatePhaseInc()
+{
     const float finePitch = TBase::params[FINE_PARAM].value / 12.0f;
     const float semiPitch = TBase::params[SEMI_PARAM].value / 12.0f;
-
-    float pitch = 1.0f + roundf(TBase::params[OCTAVE_PARAM].value) +
-        semiPitch +
-        finePitch;
-
-    pitch += cv;
-
-    const float fm = TBase::inputs[FM_INPUT].getVoltage(0);
     const float fmDepth = AudioMath::quadraticBipolar(TBase::params[FM_PARAM].value);
-
-    pitch += (fmDepth * fm);
-
     const float q = float(log2(261.626));       // move up to pitch range of EvenVCO
-    pitch += q;
-    const float freq = expLookup(pitch);
-    globalPhaseInc = TBase::engineGetSampleTime() * freq;
 
-    const float rawDetuneValue = scaleDetune(
-        TBase::inputs[DETUNE_INPUT].getVoltage(0),
-        TBase::params[DETUNE_PARAM].value,
-        TBase::params[DETUNE_TRIM_PARAM].value);
+    const float basePitch = 1.0f + roundf(TBase::params[OCTAVE_PARAM].value) +
+        semiPitch +
+        finePitch + q;
 
-    const float detuneInput = detuneCurve.getDetuneFactor(rawDetuneValue);
+    // The pitch and detune curve lookups are scalar, one per voice.
+    for (int channel = 0; channel < numChannels; ++channel) {
+        const float cv = TBase::inputs[CV_INPUT].getVoltage(channel);
+        const float fm = TBase::inputs[FM_INPUT].getPolyVoltage(channel);
 
+        const float pitch = basePitch + cv + (fmDepth * fm);
+        const float freq = expLookup(pitch);
+        globalPhaseInc[channel] = TBase::engineGetSampleTime() * freq;
 
-   // const bool classic = TBase::params[CLEAN_PARAM].value < .5f;
-    const int oversampleRate = getOversampleRate();
+        const float rawDetuneValue = scaleDetune(
+            TBase::inputs[DETUNE_INPUT].getPolyVoltage(channel),
+            TBase::params[DETUNE_PARAM].value,
+            TBase::params[DETUNE_TRIM_PARAM].value);
 
-    for (int i = 0; i < numSaws; ++i) {
-        float detune = (detuneFactors[i] - 1) * detuneInput;
-        detune += 1;
-        float phaseIncI = globalPhaseInc * detune;
-        phaseIncI = std::min(phaseIncI, .4f);         // limit so saws don't go crazy
-        if (oversampleRate > 1) {
-            phaseIncI /= oversampleRate;
+        detuneInput[channel] = detuneCurve.getDetuneFactor(rawDetuneValue);
+    }
+
+    // Spreading out to the seven saws is done four voices at a time.
+    const __m128 one = _mm_set_ps1(1.f);
+    const __m128 maxInc = _mm_set_ps1(.4f);    // limit so saws don't go crazy
+    const __m128 oversampleScale = _mm_set_ps1(1.f / oversampleRate);
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const __m128 globalInc = _mm_loadu_ps(globalPhaseInc + bank * 4);
+        const __m128 detuneIn = _mm_loadu_ps(detuneInput + bank * 4);
+        for (int i = 0; i < numSaws; ++i) {
+            const __m128 detuneFactor = _mm_set_ps1(detuneFactors[i] - 1);
+            const __m128 detune = _mm_add_ps(_mm_mul_ps(detuneFactor, detuneIn), one);
+            __m128 phaseIncI = _mm_mul_ps(globalInc, detune);
+            phaseIncI = _mm_min_ps(phaseIncI, maxInc);
+            phaseInc[bank][i] = _mm_mul_ps(phaseIncI, oversampleScale);
         }
-        phaseInc[i] = phaseIncI;
     }
 }
 
-
 template <class TBase>
-inline void Super<TBase>::runSaws(float& left)
+inline void Super<TBase>::runSaws(int bank, __m128& left)
 {
-    float mix = 0;
+    const __m128 one = _mm_set_ps1(1.f);
+    const __m128 half = _mm_set_ps1(.5f);
+    __m128 mix = _mm_setzero_ps();
     for (int i = 0; i < numSaws; ++i) {
-        phase[i] += phaseInc[i];
-        if (phase[i] > 1) {
-            phase[i] -= 1;
-        }
-        assert(phase[i] <= 1);
-        assert(phase[i] >= 0);
-
-        const float gain = (i == numSaws / 2) ? gainCenter : gainSides;
-        mix += (phase[i] - .5f) * gain;        // experiment to get rid of DC
-
+        __m128 p = _mm_add_ps(phase[bank][i], phaseInc[bank][i]);
+        const __m128 wrap = _mm_cmpgt_ps(p, one);
+        p = _mm_sub_ps(p, _mm_and_ps(wrap, one));
+        phase[bank][i] = p;
+
+        // subtract .5 to get rid of DC
+        const __m128 saw = _mm_sub_ps(p, half);
+        mix = _mm_add_ps(mix, _mm_mul_ps(saw, sawGains[bank][0][i]));
     }
-
-    mix *= 4.5;       // too low 2 too high 10
     left = mix;
 }
 
 template <class TBase>
-inline void Super<TBase>::runSawsStereo(float& left, float& right)
+inline void Super<TBase>::runSawsStereo(int bank, __m128& left, __m128& right)
 {
-    left = right = 0;
+    const __m128 one = _mm_set_ps1(1.f);
+    const __m128 half = _mm_set_ps1(.5f);
+    left = right = _mm_setzero_ps();
     for (int i = 0; i < numSaws; ++i) {
-        phase[i] += phaseInc[i];
-        if (phase[i] > 1) {
-            phase[i] -= 1;
-        }
-        assert(phase[i] <= 1);
-        assert(phase[i] >= 0);
+        __m128 p = _mm_add_ps(phase[bank][i], phaseInc[bank][i]);
+        const __m128 wrap = _mm_cmpgt_ps(p, one);
+        p = _mm_sub_ps(p, _mm_and_ps(wrap, one));
+        phase[bank][i] = p;
+
+        const __m128 saw = _mm_sub_ps(p, half);
+        left = _mm_add_ps(left, _mm_mul_ps(saw, sawGains[bank][0][i]));
+        right = _mm_add_ps(right, _mm_mul_ps(saw, sawGains[bank][1][i]));
+    }
+}
 
-        left +=  (phase[i] - .5f) *sawGainsStereo[0][i];
-        right +=  (phase[i] - .5f) *sawGainsStereo[1][i];
+template <class TBase>
+inline void Super<TBase>::writeOutput(int output, int bank, __m128 value)
+{
+    float buffer[4];
+    _mm_storeu_ps(buffer, value);
+    const int first = bank * 4;
+    const int last = std::min(numChannels, first + 4);
+    for (int channel = first; channel < last; ++channel) {
+        TBase::outputs[output].setVoltage(buffer[channel - first], channel);
+    }
+    if (inBlock) {
+        for (int channel = first; channel < last; ++channel) {
+            float* data = blockOutputs[output][channel];
+            if (data) {
+                data[blockFrame] = buffer[channel - first];
+            }
+        }
     }
 }
 
 template <class TBase>
-inline void Super<TBase>::updateAudioClassic()
+inline void Super<TBase>::updateAudioClassic(int bank)
 {
-    float left;
-    runSaws(left);
+    __m128 left;
+    runSaws(bank, left);
 
-    const float outputLeft = hpfLeft.run(left);
-    TBase::outputs[MAIN_OUTPUT_LEFT].setVoltage(outputLeft, 0);
-    TBase::outputs[MAIN_OUTPUT_RIGHT].setVoltage(outputLeft, 0);
+    const __m128 outputLeft = hpfLeft[bank].run(left);
+    writeOutput(MAIN_OUTPUT_LEFT, bank, outputLeft);
+    writeOutput(MAIN_OUTPUT_RIGHT, bank, outputLeft);
 }
 
 template <class TBase>
-inline void Super<TBase>::updateAudioClassicStereo()
+inline void Super<TBase>::updateAudioClassicStereo(int bank)
 {
-    float left, right;
-    runSawsStereo(left, right);
+    __m128 left, right;
+    runSawsStereo(bank, left, right);
 
-    const float outputLeft = hpfLeft.run(left);
-    const float outputRight = hpfRight.run(right);
-    TBase::outputs[MAIN_OUTPUT_LEFT].setVoltage(outputLeft, 0);  
-    TBase::outputs[MAIN_OUTPUT_RIGHT].setVoltage(outputRight, 0);
+    const __m128 outputLeft = hpfLeft[bank].run(left);
+    const __m128 outputRight = hpfRight[bank].run(right);
+    writeOutput(MAIN_OUTPUT_LEFT, bank, outputLeft);
+    writeOutput(MAIN_OUTPUT_RIGHT, bank, outputRight);
 }
 
 template <class TBase>
-inline void Super<TBase>::updateAudioClean()
+inline void Super<TBase>::updateAudioClean(int bank)
 {
-    const int bufferSize = getOversampleRate();
-    decimatorLeft.setup(bufferSize);
+    const int bufferSize = oversampleRate;
     for (int i = 0; i < bufferSize; ++i) {
-        float left;
-        runSaws(left);
-        bufferLeft[i] = left;
+        runSaws(bank, bufferLeft[i]);
     }
 
-    const float output = decimatorLeft.process(bufferLeft);
-    TBase::outputs[MAIN_OUTPUT_LEFT].setVoltage(output, 0);
-    TBase::outputs[MAIN_OUTPUT_RIGHT].setVoltage(output, 0);
+    __m128 output;
+    if (polyphase) {
+        polyphaseLeft[bank].setup(bufferSize);
+        output = polyphaseLeft[bank].process(bufferLeft);
+    } else {
+        decimatorLeft[bank].setup(bufferSize);
+        output = decimatorLeft[bank].process(bufferLeft);
+    }
+    writeOutput(MAIN_OUTPUT_LEFT, bank, output);
+    writeOutput(MAIN_OUTPUT_RIGHT, bank, output);
 }
 
 template <class TBase>
-inline void Super<TBase>::updateAudioCleanStereo()
+inline void Super<TBase>::updateAudioCleanStereo(int bank)
 {
-    const int bufferSize = getOversampleRate();
-    decimatorLeft.setup(bufferSize);
-    decimatorRight.setup(bufferSize);
+    const int bufferSize = oversampleRate;
     for (int i = 0; i < bufferSize; ++i) {
-        float left, right;
-        runSawsStereo(left, right);
-        bufferLeft[i] = left;
-        bufferRight[i] = right;
+        runSawsStereo(bank, bufferLeft[i], bufferRight[i]);
     }
 
-    const float outputLeft = decimatorLeft.process(bufferLeft);
-    const float outputRight = decimatorRight.process(bufferRight);
-    TBase::outputs[MAIN_OUTPUT_LEFT].setVoltage(outputLeft, 0);
-    TBase::outputs[MAIN_OUTPUT_RIGHT].setVoltage(outputRight, 0);
+    __m128 outputLeft, outputRight;
+    if (polyphase) {
+        polyphaseLeft[bank].setup(bufferSize);
+        polyphaseRight[bank].setup(bufferSize);
+        outputLeft = polyphaseLeft[bank].process(bufferLeft);
+        outputRight = polyphaseRight[bank].process(bufferRight);
+    } else {
+        decimatorLeft[bank].setup(bufferSize);
+        decimatorRight[bank].setup(bufferSize);
+        outputLeft = decimatorLeft[bank].process(bufferLeft);
+        outputRight = decimatorRight[bank].process(bufferRight);
+    }
+    writeOutput(MAIN_OUTPUT_LEFT, bank, outputLeft);
+    writeOutput(MAIN_OUTPUT_RIGHT, bank, outputRight);
 }
 
 template <class TBase>
 inline void Super<TBase>::updateHPFilters()
 {
-    const float filterCutoff = std::min(globalPhaseInc, .1f);
-    hpfLeft.setCutoff(filterCutoff);
-    if (isStereo) {
-        hpfRight.setCutoff(filterCutoff);
+    const __m128 maxCutoff = _mm_set_ps1(.1f);
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const __m128 filterCutoff = _mm_min_ps(_mm_loadu_ps(globalPhaseInc + bank * 4), maxCutoff);
+        hpfLeft[bank].setCutoff(filterCutoff);
+        if (isStereo) {
+            hpfRight[bank].setCutoff(filterCutoff);
+        }
     }
 }
 
@@ -467,29 +567,23 @@ template <class TBase>
 inline void Super<TBase>::updateStereoGains()
 {
     const bool hardPan = TBase::params[HARD_PAN_PARAM].value > .5;
-    for (int i=0; i< numSaws; ++i) 
-    {
-        const float monoGain = 4.5f * ((i == numSaws / 2) ? gainCenter : gainSides);
-       
-        float l = monoGain;
-        float r = monoGain;
-
-        if (!hardPan) {
-            l *=  sawGainsNorm[0][i];
-            r *=  sawGainsNorm[1][i];
-        } else {
-            l *=  sawGainsHardPan[0][i];
-            r *=  sawGainsHardPan[1][i];
-        }
+    const __m128 makeupGain = _mm_set_ps1(4.5f);       // too low 2 too high 10
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const __m128 center = _mm_mul_ps(makeupGain, _mm_loadu_ps(gainCenter + bank * 4));
+        const __m128 sides = _mm_mul_ps(makeupGain, _mm_loadu_ps(gainSides + bank * 4));
+        for (int i = 0; i < numSaws; ++i) {
+            const __m128 monoGain = (i == numSaws / 2) ? center : sides;
+            if (!isStereo) {
+                sawGains[bank][0][i] = monoGain;
+                continue;
+            }
 
-        sawGainsStereo[0][i] = l;
-        sawGainsStereo[1][i] = r;
+            const float l = hardPan ? sawGainsHardPan[0][i] : sawGainsNorm[0][i];
+            const float r = hardPan ? sawGainsHardPan[1][i] : sawGainsNorm[1][i];
 
-        #if 0
-        if (i == 0) printf("\n");
-        printf("g[%d] = %.2f,%.2f\n", 
-            i, sawGainsStereo[0][i], sawGainsStereo[1][i]);
-        #endif
+            sawGains[bank][0][i] = _mm_mul_ps(monoGain, _mm_set_ps1(l));
+            sawGains[bank][1][i] = _mm_mul_ps(monoGain, _mm_set_ps1(r));
+        }
     }
 }
 
@@ -542,10 +636,13 @@ inline void Super<TBase>::updateStereoGains()
 template <class TBase>
 inline void Super<TBase>::stepn(int n)
 {
+    updateChannels();
+    oversampleRate = getOversampleRate();
+    polyphase = TBase::params[POLYPHASE_PARAM].value > .5;
     updatePhaseInc();
+    updateStereo();
     updateHPFilters();
     updateMix();
-    updateStereo(); 
     updateStereoGains();  
 }
 
@@ -554,26 +651,81 @@ inline void Super<TBase>::step()
 {
     div.step();
     updateTrigger();
-    
-    int rate = getOversampleRate();
-    if ((rate == 1) && !isStereo) {
-        updateAudioClassic();
-    } else if ((rate == 1) && isStereo) {
-        updateAudioClassicStereo();
-    } else if ((rate != 1) && !isStereo) {
-        updateAudioClean();
-    } else {
-        updateAudioCleanStereo();
+    updateAudio();
+}
+
+template <class TBase>
+inline void Super<TBase>::process(const typename TBase::ProcessArgs& args, int frames)
+{
+    for (int output = 0; output < NUM_OUTPUTS; ++output) {
+        for (int channel = 0; channel < maxChannels; ++channel) {
+            blockOutputs[output][channel] = args.getOutput(output, channel);
+        }
+    }
+    inBlock = true;
+    for (int first = 0; first < frames; ) {
+        // the control rate processing reads the ports
+        args.loadInputs(TBase::inputs, first);
+        const int n = div.stepBlock(frames - first);
+        for (int frame = first; frame < first + n; ++frame) {
+            if (frame != first) {
+                // the trigger is the only input we look at every sample
+                args.loadInput(TBase::inputs, TRIGGER_INPUT, frame);
+            }
+            blockFrame = frame;
+            updateTrigger();
+            updateAudio();
+        }
+        first += n;
+    }
+    inBlock = false;
+}
+
+template <class TBase>
+inline void Super<TBase>::updateAudio()
+{
+    for (int bank = 0; bank < numBanks; ++bank) {
+        if ((oversampleRate == 1) && !isStereo) {
+            updateAudioClassic(bank);
+        } else if ((oversampleRate == 1) && isStereo) {
+            updateAudioClassicStereo(bank);
+        } else if ((oversampleRate != 1) && !isStereo) {
+            updateAudioClean(bank);
+        } else {
+            updateAudioCleanStereo(bank);
+        }
+    }
+}
+
+template <class TBase>
+inline void Super<TBase>::randomizePhase(int channel)
+{
+    const int bank = channel / 4;
+    const int lane = channel % 4;
+    for (int i = 0; i < numSaws; ++i) {
+        float* p = reinterpret_cast<float*>(&phase[bank][i]);
+        p[lane] = random.uniform();
     }
 }
 
+/**
+ * A monophonic trigger re-starts all the voices,
+ * a polyphonic trigger re-starts each voice independently.
+ */
 template <class TBase>
 inline void Super<TBase>::updateTrigger()
 {
-    gateTrigger.go(TBase::inputs[TRIGGER_INPUT].getVoltage(0));
-    if (gateTrigger.trigger()) {
-        for (int i = 0; i < numSaws; ++i) {
-            phase[i] = this->random();
+    const int triggerChannels = std::min(numChannels, TBase::inputs[TRIGGER_INPUT].getChannels());
+    for (int channel = 0; channel < triggerChannels; ++channel) {
+        gateTrigger[channel].go(TBase::inputs[TRIGGER_INPUT].getVoltage(channel));
+        if (gateTrigger[channel].trigger()) {
+            if (triggerChannels == 1) {
+                for (int i = 0; i < numChannels; ++i) {
+                    randomizePhase(i);
+                }
+            } else {
+                randomizePhase(channel);
+            }
         }
     }
 }
@@ -581,15 +733,17 @@ inline void Super<TBase>::updateTrigger()
 template <class TBase>
 inline void Super<TBase>::updateMix()
 {
-    const float rawMixValue = scaleDetune(
-        TBase::inputs[MIX_INPUT].getVoltage(0),
-        TBase::params[MIX_PARAM].value,
-        TBase::params[MIX_TRIM_PARAM].value);
+    for (int channel = 0; channel < numChannels; ++channel) {
+        const float rawMixValue = scaleDetune(
+            TBase::inputs[MIX_INPUT].getPolyVoltage(channel),
+            TBase::params[MIX_PARAM].value,
+            TBase::params[MIX_TRIM_PARAM].value);
 
-    gainCenter = -0.55366f * rawMixValue + 0.99785f;
+        gainCenter[channel] = -0.55366f * rawMixValue + 0.99785f;
 
-    gainSides = -0.73764f * rawMixValue * rawMixValue +
-        1.2841f * rawMixValue + 0.044372f;
+        gainSides[channel] = -0.73764f * rawMixValue * rawMixValue +
+            1.2841f * rawMixValue + 0.044372f;
+    }
 }
 
 template <class TBase>
@@ -633,6 +787,9 @@ inline IComposite::Config SuperDescription<TBase>::getParam(int i)
         case Super<TBase>::HARD_PAN_PARAM:
             ret =  {0.0f, 1.0f, 0.0f, "Hard Pan"};
             break;
+        case Super<TBase>::POLYPHASE_PARAM:
+            ret =  {0.0f, 1.0f, 0.0f, "Polyphase oversampling"};
+            break;
         default:
             assert(false);
     }
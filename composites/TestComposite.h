@@ -1,5 +1,7 @@
 #pragma once
 
+#include "SqProcessArgs.h"
+
 #include <vector>
 #include <cstdint>
 
@@ -206,6 +208,7 @@ class TestComposite
 public:
 
     using Port = ::Port;
+    using ProcessArgs = SqProcessArgs;
 
     TestComposite() :
         inputs(40),
@@ -231,15 +234,42 @@ public:
 
     float engineGetSampleTime()
     {
-        return 1.0f / 44100.0f;
+        return 1.0f / engineSampleRate;
     }
 
     float engineGetSampleRate()
     {
-        return 44100.f;
+        return engineSampleRate;
+    }
+
+    /**
+     * Pretend the engine is running at a different rate.
+     * The composite still has to be told about it, the same
+     * way it would in VCV (onSampleRateChange, setSampleRate, etc).
+     */
+    void setEngineSampleRate(float rate)
+    {
+        engineSampleRate = rate;
     }
 
     virtual void step()
     {
     }
+
+    /**
+     * Block processing entry point.
+     * The default just calls step() once per frame. Composites
+     * that can do better override it.
+     */
+    virtual void process(const ProcessArgs& args, int frames)
+    {
+        for (int frame = 0; frame < frames; ++frame) {
+            args.loadInputs(inputs, frame);
+            step();
+            args.saveOutputs(outputs, frame);
+        }
+    }
+
+private:
+    float engineSampleRate = 44100;
 };
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "ClockMult.h"
+#include "Divider.h"
 #include "ObjectCache.h"
 #include "AsymRampShaper.h"
 #include "GateTrigger.h"
@@ -107,8 +108,14 @@ public:
      */
     void step() override;
 
+    /**
+     * Block processing entry point.
+     * Output is the same as calling step() 'frames' times.
+     */
+    void process(const typename TBase::ProcessArgs& args, int frames) override;
+
 private:
-    int inputSubSampleCounter = 1;
+    Divider divider;
     const static int inputSubSample = 4;    // only look at knob/cv every 4
     float skew = .1f;
     float phase = 0;
@@ -120,6 +127,12 @@ private:
 
     void stepInput();
 
+    /**
+     * The per-sample LFO and VCA.
+     * returns the audio output, sets saw and lfo.
+     */
+    float processSample(float input, float clockInput, float& saw, float& lfo);
+
     ClockMult clock;
     std::shared_ptr<LookupTableParams<float>> tanhLookup;
     float reciprocalSampleRate = 0;
@@ -152,6 +165,9 @@ inline void Tremolo<TBase>::init()
     scale_phase = AudioMath::makeLinearScaler(-1.f, 1.f);
 
     stepInput();            // call once to init
+    divider.setup(inputSubSample, [this] {
+        this->stepInput();
+        });
 }
 
 template <class TBase>
@@ -211,33 +227,63 @@ inline void Tremolo<TBase>::stepInput()
 template <class TBase>
 inline void Tremolo<TBase>::step()
 {
-    if (--inputSubSampleCounter <= 0) {
-        inputSubSampleCounter = inputSubSample;
-        stepInput();
+    divider.step();
+
+    float saw, lfo;
+    const float output = processSample(
+        TBase::inputs[AUDIO_INPUT].getVoltage(0),
+        TBase::inputs[CLOCK_INPUT].getVoltage(0),
+        saw, lfo);
+
+    TBase::outputs[SAW_OUTPUT].setVoltage(saw, 0);
+    TBase::outputs[LFO_OUTPUT].setVoltage(lfo, 0);
+    TBase::outputs[AUDIO_OUTPUT].setVoltage(output, 0);
+}
+
+template <class TBase>
+inline void Tremolo<TBase>::process(const typename TBase::ProcessArgs& args, int frames)
+{
+    const auto input = args.getInputChannel(TBase::inputs[AUDIO_INPUT], AUDIO_INPUT, 0);
+    const auto clockInput = args.getInputChannel(TBase::inputs[CLOCK_INPUT], CLOCK_INPUT, 0);
+    const auto sawOutput = args.getOutputChannel(TBase::outputs[SAW_OUTPUT], SAW_OUTPUT, 0);
+    const auto lfoOutput = args.getOutputChannel(TBase::outputs[LFO_OUTPUT], LFO_OUTPUT, 0);
+    const auto output = args.getOutputChannel(TBase::outputs[AUDIO_OUTPUT], AUDIO_OUTPUT, 0);
+
+    for (int first = 0; first < frames; ) {
+        // stepInput reads the ports
+        args.loadInputs(TBase::inputs, first);
+        const int last = first + divider.stepBlock(frames - first);
+        for (int frame = first; frame < last; ++frame) {
+            output[frame] = processSample(input[frame], clockInput[frame], sawOutput[frame], lfoOutput[frame]);
+        }
+        first = last;
     }
+    args.finishOutputs(TBase::outputs, frames);
+}
 
+template <class TBase>
+inline float Tremolo<TBase>::processSample(float input, float clockInput, float& saw, float& lfo)
+{
     // First: external clock proc
-    gateTrigger.go(TBase::inputs[CLOCK_INPUT].getVoltage(0));
+    gateTrigger.go(clockInput);
     if (gateTrigger.trigger()) {
         clock.refClock();
     }
 
-
     // ------------ now generate the lfo waveform
     clock.sampleClock();
     float mod = clock.getSaw();
     mod = AsymRampShaper::proc_1(rampShaper, mod);
     mod -= 0.5f;
     // now we have a skewed saw -.5 to .5
-    TBase::outputs[SAW_OUTPUT].setVoltage(10 * mod, 0);
+    saw = 10 * mod;
 
     // TODO: don't scale twice - just get it right the first time
   //  const float shapeMul = std::max(.25f, 10 * shape);
     mod *= shapeMul;
 
     mod = LookupTable<float>::lookup(*tanhLookup.get(), mod);
-    TBase::outputs[LFO_OUTPUT].setVoltage(5 * mod, 0);
-
+    lfo = 5 * mod;
 
     // TODO: move this intp input proc
    // const float gain = modDepth /
@@ -245,7 +291,7 @@ inline void Tremolo<TBase>::step()
     const float finalMod = gain * mod + 1;      // TODO: this offset by 1 is pretty good, but we 
                                                 // could add an offset control to make it really "chop" off
 
-    TBase::outputs[AUDIO_OUTPUT].setVoltage(TBase::inputs[AUDIO_INPUT].getVoltage(0) * finalMod, 0);
+    return input * finalMod;
 }
 
 /*
@@ -2,6 +2,7 @@
 #include <algorithm>
 
 #include "AudioMath.h"
+#include "FormantFilterBankSimd.h"
 #include "IComposite.h"
 #include "LookupTable.h"
 #include "LookupTableFactory.h"
@@ -39,6 +40,11 @@ public:
  * Version 2 - make the math sane.
  * was 46
  * with mod sub-sample 2 => 26
+ * SSE filter bank: perfTest percent CPU: mono 0.47, 4 voices 0.48, 16 voices 0.95
+ *
+ * Polyphonic, up to 16 voices. The number of voices comes from the audio input.
+ * The Q, Fc and mod depth CV may be poly or mono. There is only one set of
+ * LFOs, shared by all the voices, so the LFO rate CV only uses its first channel.
  */
 template <class TBase>
 class VocalAnimator : public TBase
@@ -157,9 +163,6 @@ public:
     typename osc::State modulatorState;
     typename osc::Params modulatorParams;
 
-    StateVariableFilterState<T> filterStates[numFilters];
-    StateVariableFilterParams<T> filterParams[numFilters];
-
     std::shared_ptr<LookupTableParams<T>> expLookup;
 
     // We need a bunch of scalers to convert knob, CV, trim into the voltage 
@@ -168,20 +171,44 @@ public:
     AudioMath::ScaleFun<T> scalem2_2;
     AudioMath::ScaleFun<T> scaleQ;
     AudioMath::ScaleFun<T> scalen5_5;
+
+    int getNumChannels() const
+    {
+        return numChannels;
+    }
+
+    static const int maxChannels = 16;
+
+private:
+    static const int maxBanks = maxChannels / 4;
+
+    FormantFilterBankSimd<numFilters> filters[maxBanks];
+
+    /**
+     * The gain after the filters, which tracks the bandwidth.
+     */
+    __m128 filterGain[maxBanks];
+    int numChannels = 0;
+
+    void calcVoiceSettings(int channel, int cvScaleMode, T* normFreq, T& normalizedBandwidth);
 };
 
 template <class TBase>
 inline void VocalAnimator<TBase>::init()
 {
     for (int i = 0; i < numFilters; ++i) {
-        filterParams[i].setMode(StateVariableFilterParams<T>::Mode::BandPass);
-        filterParams[i].setQ(15);           // or should it be 5?
-
-        filterParams[i].setFreq(nominalFilterCenterHz[i] * reciprocalSampleRate);
+        for (int bank = 0; bank < maxBanks; ++bank) {
+            filters[bank].setMode(FormantFilterBankSimd<numFilters>::Mode::BandPass);
+            filters[bank].setNormalizedBandwidth(i, _mm_set_ps1(T(1) / 15));
+            filters[bank].setFreq(i, _mm_set_ps1(nominalFilterCenterHz[i] * reciprocalSampleRate));
+        }
         filterFrequencyLog[i] = nominalFilterCenterLog2[i];
 
         normalizedFilterFreq[i] = nominalFilterCenterHz[i] * reciprocalSampleRate;
     }
+    for (int bank = 0; bank < maxBanks; ++bank) {
+        filterGain[bank] = _mm_set_ps1(filterNormalizedBandwidth * 2);
+    }
     scale0_1 = AudioMath::makeScalerWithBipolarAudioTrim(0, 1); // full CV range -> 0..1
     scalem2_2 = AudioMath::makeScalerWithBipolarAudioTrim(-2, 2); // full CV range -> -2..2
     scaleQ = AudioMath::makeScalerWithBipolarAudioTrim(.71f, 21);
@@ -195,65 +222,60 @@ inline void VocalAnimator<TBase>::init()
 template <class TBase>
 inline void VocalAnimator<TBase>::step()
 {
-   // printf("step %d\n", modulationSubSampleCounter);
+    auto& input = TBase::inputs[AUDIO_INPUT];
+    auto& output = TBase::outputs[AUDIO_OUTPUT];
+
+    const int channels = std::max(1, input.getChannels());
+    if (channels != numChannels) {
+        numChannels = channels;
+        modulationSubSampleCounter = 0;     // new voices need their filters now
+    }
+    output.setChannels(numChannels);
+
     if (--modulationSubSampleCounter <= 0) {
         modulationSubSampleCounter = modulationSubSample;
         stepModulation();
     }
 
     // Now run the filters
-    T filterMix = 0;                // Sum the folder outputs here
-    const T input = TBase::inputs[AUDIO_INPUT].getVoltage(0);
-
-    for (int i = 0; i < numFilters; ++i) {
-        filterMix += StateVariableFilter<T>::run(input, filterStates[i], filterParams[i]);
-    }
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        const int first = bank * 4;
+        const int last = std::min(numChannels, first + 4);
+
+        // Channels past the last one are zero, and in any case each lane is independent.
+        const __m128 x = _mm_setr_ps(
+            input.getVoltage(first),
+            input.getVoltage(first + 1),
+            input.getVoltage(first + 2),
+            input.getVoltage(first + 3));
+
+        // Sum the filter outputs here
+        __m128 filterMix = filters[bank].run(x);
 #ifdef _ANORM
-    filterMix *= filterNormalizedBandwidth * 2;
+        filterMix = _mm_mul_ps(filterMix, filterGain[bank]);
 #else
-    filterMix *= T(.3);            // attenuate to avoid clip
+        filterMix = _mm_mul_ps(filterMix, _mm_set_ps1(T(.3)));      // attenuate to avoid clip
 #endif
-    TBase::outputs[AUDIO_OUTPUT].setVoltage(filterMix, 0);
-
+        float buffer[4];
+        _mm_storeu_ps(buffer, filterMix);
+        for (int channel = first; channel < last; ++channel) {
+            output.setVoltage(buffer[channel - first], channel);
+        }
+    }
 }
 
 template <class TBase>
-inline void VocalAnimator<TBase>::stepModulation()
+inline void VocalAnimator<TBase>::calcVoiceSettings(int channel, int cvScaleMode, T* normFreq, T& normalizedBandwidth)
 {
-   // printf("step mod\n");
-    const bool bass = TBase::params[BASS_EXP_PARAM].value > .5;
-    const auto mode = bass ?
-        StateVariableFilterParams<T>::Mode::LowPass :
-        StateVariableFilterParams<T>::Mode::BandPass;
-
-    for (int i = 0; i < numFilters + 1 - 1; ++i) {
-        filterParams[i].setMode(mode);
-    }
-
-    // Run the modulators, hold onto their output.
-    // Raw Modulator outputs put in modulatorOutputs[].
-    osc::run(modulatorOutput, modulatorState, modulatorParams);
-
-    static const OutputIds LEDOutputs[] = {
-        LFO0_OUTPUT,
-        LFO1_OUTPUT,
-        LFO2_OUTPUT,
-    };
-    // Light up the LEDs with the unscaled Modulator outputs.
-    for (int i = LFO0_LIGHT; i <= LFO2_LIGHT; ++i) {
-        TBase::outputs[LEDOutputs[i]].setVoltage(modulatorOutput[i], 0);
-        TBase::lights[i].value = (modulatorOutput[i]) * .3f;
-        TBase::outputs[LEDOutputs[i]].setVoltage(modulatorOutput[i], 0);
-    }
-
     // Normalize all the parameters out here
     const T qFinal = scaleQ(
-        TBase::inputs[FILTER_Q_CV_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_Q_CV_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_Q_PARAM].value,
         TBase::params[FILTER_Q_TRIM_PARAM].value);
 
     const T fc = scalen5_5(
-        TBase::inputs[FILTER_FC_CV_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_FC_CV_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_FC_PARAM].value,
         TBase::params[FILTER_FC_TRIM_PARAM].value);
 
@@ -262,27 +284,12 @@ inline void VocalAnimator<TBase>::stepModulation()
 
     // cv, knob, trim
     const T baseModDepth = scale0_1(
-        TBase::inputs[FILTER_MOD_DEPTH_CV_INPUT].getVoltage(0),
+        TBase::inputs[FILTER_MOD_DEPTH_CV_INPUT].getPolyVoltage(channel),
         TBase::params[FILTER_MOD_DEPTH_PARAM].value,
         TBase::params[FILTER_MOD_DEPTH_TRIM_PARAM].value);
 
-    // tracking:
-    //  0 = all 1v/octave, mod scaled, no on top
-    //  1 = mod and cv scaled
-    //  2 = 1, + top filter gets some mod
-    int cvScaleMode = 0;
-    const float cvScaleParam = TBase::params[TRACK_EXP_PARAM].value;
-    if (cvScaleParam < .5) {
-        cvScaleMode = 0;
-    } else if (cvScaleParam < 1.5) {
-        cvScaleMode = 1;
-    } else {
-        cvScaleMode = 2;
-        assert(cvScaleParam < 2.5);
-    }
-
     // Just do the Q division once, in the outer loop
-    filterNormalizedBandwidth = T(1) / qFinal;
+    normalizedBandwidth = T(1) / qFinal;
     for (int i = 0; i < numFilters; ++i) {
         T logFreq = nominalFilterCenterLog2[i];
 
@@ -324,16 +331,96 @@ inline void VocalAnimator<TBase>::stepModulation()
             baseModDepth *
             nominalModSensitivity[i];
 
-        filterFrequencyLog[i] = logFreq;
+        if (channel == 0) {
+            filterFrequencyLog[i] = logFreq;
+        }
 
         // tell lookup not to assert - we know we can go slightly out of range.
-        T normFreq = LookupTable<T>::lookup(*expLookup, logFreq, true) * reciprocalSampleRate;
-        normFreq = std::min(normFreq, T(.2));
+        T normFreqI = LookupTable<T>::lookup(*expLookup, logFreq, true) * reciprocalSampleRate;
+        normFreq[i] = std::min(normFreqI, T(.2));
+    }
+}
+
+template <class TBase>
+inline void VocalAnimator<TBase>::stepModulation()
+{
+    const bool bass = TBase::params[BASS_EXP_PARAM].value > .5;
+    const auto mode = bass ?
+        StateVariableFilterParams<T>::Mode::LowPass :
+        StateVariableFilterParams<T>::Mode::BandPass;
 
-        normalizedFilterFreq[i] = normFreq;
-        filterParams[i].setFreq(normFreq);
+    // Run the modulators, hold onto their output.
+    // Raw Modulator outputs put in modulatorOutputs[].
+    osc::run(modulatorOutput, modulatorState, modulatorParams);
 
-        filterParams[i].setNormalizedBandwidth(filterNormalizedBandwidth);
+    static const OutputIds LEDOutputs[] = {
+        LFO0_OUTPUT,
+        LFO1_OUTPUT,
+        LFO2_OUTPUT,
+    };
+    // Light up the LEDs with the unscaled Modulator outputs.
+    for (int i = LFO0_LIGHT; i <= LFO2_LIGHT; ++i) {
+        TBase::outputs[LEDOutputs[i]].setVoltage(modulatorOutput[i], 0);
+        TBase::lights[i].value = (modulatorOutput[i]) * .3f;
+        TBase::outputs[LEDOutputs[i]].setVoltage(modulatorOutput[i], 0);
+    }
+
+    // tracking:
+    //  0 = all 1v/octave, mod scaled, no on top
+    //  1 = mod and cv scaled
+    //  2 = 1, + top filter gets some mod
+    int cvScaleMode = 0;
+    const float cvScaleParam = TBase::params[TRACK_EXP_PARAM].value;
+    if (cvScaleParam < .5) {
+        cvScaleMode = 0;
+    } else if (cvScaleParam < 1.5) {
+        cvScaleMode = 1;
+    } else {
+        cvScaleMode = 2;
+        assert(cvScaleParam < 2.5);
+    }
+
+    // If none of the CV is poly, all the voices are the same.
+    const bool polyCV = TBase::inputs[FILTER_Q_CV_INPUT].getChannels() > 1 ||
+        TBase::inputs[FILTER_FC_CV_INPUT].getChannels() > 1 ||
+        TBase::inputs[FILTER_MOD_DEPTH_CV_INPUT].getChannels() > 1;
+    const int settingsChannels = polyCV ? numChannels : 1;
+
+    T normFreq[maxChannels][numFilters];
+    T normalizedBandwidth[maxChannels];
+    for (int channel = 0; channel < settingsChannels; ++channel) {
+        calcVoiceSettings(channel, cvScaleMode, normFreq[channel], normalizedBandwidth[channel]);
+    }
+
+    // the first voice is exposed for testing
+    filterNormalizedBandwidth = normalizedBandwidth[0];
+    for (int i = 0; i < numFilters; ++i) {
+        normalizedFilterFreq[i] = normFreq[0][i];
+    }
+
+    const int numBanks = (numChannels + 3) / 4;
+    for (int bank = 0; bank < numBanks; ++bank) {
+        int channels[4];
+        for (int i = 0; i < 4; ++i) {
+            channels[i] = std::min(bank * 4 + i, settingsChannels - 1);
+        }
+        const __m128 bw = _mm_setr_ps(
+            normalizedBandwidth[channels[0]],
+            normalizedBandwidth[channels[1]],
+            normalizedBandwidth[channels[2]],
+            normalizedBandwidth[channels[3]]);
+
+        FormantFilterBankSimd<numFilters>& f = filters[bank];
+        f.setMode(mode);
+        for (int i = 0; i < numFilters; ++i) {
+            f.setFreq(i, _mm_setr_ps(
+                normFreq[channels[0]][i],
+                normFreq[channels[1]][i],
+                normFreq[channels[2]][i],
+                normFreq[channels[3]][i]));
+            f.setNormalizedBandwidth(i, bw);
+        }
+        filterGain[bank] = _mm_mul_ps(bw, _mm_set_ps1(2));
     }
 
     int matrixMode;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "rack.hpp"
+#include "DspTiming.h"
+#include "SqProcessArgs.h"
 
 using Input = ::rack::engine::Input;
 using Output = ::rack::engine::Output;
@@ -17,18 +19,39 @@ class WidgetComposite
 public:
 
     using Port = ::rack::engine::Port;
+    using ProcessArgs = SqProcessArgs;
     
     WidgetComposite(::rack::engine::Module * parent) :
         inputs(parent->inputs),
         outputs(parent->outputs),
         params(parent->params),
-        lights(parent->lights)
+        lights(parent->lights),
+        parentModule(parent)
     {
+        DspTiming::add(parentModule, &dspTiming);
+    }
+    virtual ~WidgetComposite()
+    {
+        DspTiming::remove(parentModule);
     }
-    virtual ~WidgetComposite() {}
     virtual void step()
     {
     };
+
+    /**
+     * Block processing entry point.
+     * The default just calls step() once per frame. Composites
+     * that can do better override it.
+     * Rack itself still calls step() every sample.
+     */
+    virtual void process(const ProcessArgs& args, int frames)
+    {
+        for (int frame = 0; frame < frames; ++frame) {
+            args.loadInputs(inputs, frame);
+            step();
+            args.saveOutputs(outputs, frame);
+        }
+    }
     float engineGetSampleRate()
     {
         return ::rack::appGet()->engine->getSampleRate();
@@ -38,10 +61,17 @@ public:
     {
         return ::rack::appGet()->engine->getSampleTime();
     }
+
+    /**
+     * The module times its calls to step() into this.
+     * See DspTiming.h
+     */
+    DspTimingStats dspTiming;
 protected:
     std::vector<Input>& inputs;
     std::vector<Output>& outputs;
     std::vector<Param>& params;
     std::vector<Light>& lights;
 private:
+    const ::rack::engine::Module* const parentModule;
 };
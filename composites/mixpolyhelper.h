@@ -1,5 +1,7 @@
 #pragma once
 
+#include "MixPolyVoices.h"
+
 template <class TMixComposite>
 class MixPolyHelper
 {
@@ -11,8 +13,57 @@ public:
 
     void updatePolyphony(TMixComposite*);
     float getNormalizedInputSum(TMixComposite*, int channel);
+
+    /**
+     * Block processing version of getNormalizedInputSum.
+     * inputs are the poly channels of the mixer channel's input.
+     * Fills dest with 'frames' samples, starting at 'first'.
+     */
+    template <class TChannel>
+    void getNormalizedInputSum(int channel, const TChannel* inputs, int polyChannels, float* dest, int first, int frames);
+
+    /**
+     * Per voice mode (see MixPolyVoices). Call at the control rate, after updatePolyphony.
+     * Only inputs with more than one voice are done per voice. Those
+     * get prePanned set, so the strip knows to bypass its pan.
+     */
+    void updateVoices(TMixComposite*, bool perVoice, bool spread, bool* prePanned);
+    bool isPerVoice(int channel) const
+    {
+        return voices.voices[channel] > 0;
+    }
+    bool anyPerVoice() const
+    {
+        return anyVoices;
+    }
+    void setVoiceCutoff(float fs)
+    {
+        voices.setCutoff(fs);
+    }
+
+    /**
+     * Mixes the voices of a per voice channel, for one sample.
+     * mono is the same as getNormalizedInputSum.
+     */
+    void getVoiceMix(TMixComposite*, int channel, float& left, float& right, float& mono);
+
+    /**
+     * Block processing version of getVoiceMix.
+     * inputs are the poly channels of the mixer channel's input.
+     */
+    template <class TChannel>
+    void getVoiceMix(int channel, const TChannel* inputs, int polyChannels, int frame,
+        float& left, float& right, float& mono);
+
+    /**
+     * Gets all the inputs for MixStrips::step: the mono sum of every channel,
+     * and what goes to the left and right busses.
+     */
+    void getInputs(TMixComposite*, float* mono, float* left, float* right);
 private:
     float gain[TMixComposite::numChannels] = {0};
+    MixPolyVoices<TMixComposite::numChannels> voices;
+    bool anyVoices = false;
 };
 
 template <class TMixComposite>
@@ -30,4 +81,93 @@ inline float MixPolyHelper<TMixComposite>::getNormalizedInputSum(TMixComposite*
 {
     const float sum = mixer->inputs[TMixComposite::AUDIO0_INPUT + channel].getVoltageSum();
     return sum * gain[channel];
-}
\ No newline at end of file
+}
+
+template <class TMixComposite>
+template <class TChannel>
+inline void MixPolyHelper<TMixComposite>::getNormalizedInputSum(int channel,
+    const TChannel* inputs, int polyChannels, float* dest, int first, int frames)
+{
+    for (int frame = 0; frame < frames; ++frame) {
+        dest[frame] = 0;
+    }
+    for (int polyChannel = 0; polyChannel < polyChannels; ++polyChannel) {
+        const TChannel& input = inputs[polyChannel];
+        for (int frame = 0; frame < frames; ++frame) {
+            dest[frame] += input[first + frame];
+        }
+    }
+    for (int frame = 0; frame < frames; ++frame) {
+        dest[frame] *= gain[channel];
+    }
+}
+
+template <class TMixComposite>
+inline void MixPolyHelper<TMixComposite>::updateVoices(TMixComposite* mixer, bool perVoice, bool spread, bool* prePanned)
+{
+    const int maxVoices = MixPolyVoices<TMixComposite::numChannels>::maxVoices;
+    voices.spread = spread;
+    anyVoices = false;
+    for (int i = 0; i < TMixComposite::numChannels; ++i) {
+        const int channels = mixer->inputs[TMixComposite::AUDIO0_INPUT + i].getChannels();
+        const bool voicePan = perVoice && (channels > 1);
+        prePanned[i] = voicePan;
+        voices.voices[i] = voicePan ? channels : 0;
+        if (!voicePan) {
+            continue;
+        }
+        anyVoices = true;
+        voices.pan[i] = mixer->params[TMixComposite::PAN0_PARAM + i].value;
+
+        // like everything else in VCV, a mono CV goes to all the voices
+        auto& panInput = mixer->inputs[TMixComposite::PAN0_INPUT + i];
+        for (int voice = 0; voice < maxVoices; ++voice) {
+            voices.panCV[i][voice] = panInput.getPolyVoltage(voice);
+        }
+    }
+
+    // most of the time nothing is polyphonic, so don't bother
+    if (anyVoices) {
+        voices.update();
+    }
+}
+
+template <class TMixComposite>
+inline void MixPolyHelper<TMixComposite>::getVoiceMix(TMixComposite* mixer, int channel, float& left, float& right, float& mono)
+{
+    const int maxVoices = MixPolyVoices<TMixComposite::numChannels>::maxVoices;
+    auto& input = mixer->inputs[TMixComposite::AUDIO0_INPUT + channel];
+    const int channels = input.getChannels();
+    float x[maxVoices];
+    for (int voice = 0; voice < maxVoices; ++voice) {
+        x[voice] = (voice < channels) ? input.getVoltage(voice) : 0.f;
+    }
+    voices.step(channel, x, left, right, mono);
+}
+
+template <class TMixComposite>
+template <class TChannel>
+inline void MixPolyHelper<TMixComposite>::getVoiceMix(int channel, const TChannel* inputs, int polyChannels, int frame,
+    float& left, float& right, float& mono)
+{
+    const int maxVoices = MixPolyVoices<TMixComposite::numChannels>::maxVoices;
+    float x[maxVoices];
+    for (int voice = 0; voice < maxVoices; ++voice) {
+        x[voice] = (voice < polyChannels) ? inputs[voice][frame] : 0.f;
+    }
+    voices.step(channel, x, left, right, mono);
+}
+
+template <class TMixComposite>
+inline void MixPolyHelper<TMixComposite>::getInputs(TMixComposite* mixer, float* mono, float* left, float* right)
+{
+    for (int i = 0; i < TMixComposite::numChannels; ++i) {
+        if (isPerVoice(i)) {
+            getVoiceMix(mixer, i, left[i], right[i], mono[i]);
+        } else {
+            mono[i] = getNormalizedInputSum(mixer, i);
+            left[i] = mono[i];
+            right[i] = mono[i];
+        }
+    }
+}
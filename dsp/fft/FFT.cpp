@@ -4,41 +4,119 @@
 #include "FFTData.h"
 
 #include <assert.h>
+#include <map>
+#include <mutex>
 #include "kiss_fft.h"
 #include "kiss_fftr.h"
 
 #include "AudioMath.h"
 
 
+/**
+ * Process wide cache of kiss_fftr plans, by size and direction.
+ * Plans are never modified after they are made (FFTScratch holds the
+ * temp buffer), so they can be shared by all threads. They live until exit.
+ */
+class FFTPlanCache
+{
+public:
+    ~FFTPlanCache()
+    {
+        for (auto it : plans) {
+            kiss_fftr_free(it.second);
+        }
+    }
+
+    kiss_fftr_cfg get(int numBins, bool inverse)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        const auto key = std::make_pair(numBins, inverse);
+        auto it = plans.find(key);
+        if (it != plans.end()) {
+            return it->second;
+        }
+        kiss_fftr_cfg plan = kiss_fftr_alloc(numBins, inverse, nullptr, nullptr);
+        assert(plan);
+        if (plan) {
+            plans[key] = plan;
+        }
+        return plan;
+    }
+
+    int size()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        return int(plans.size());
+    }
+private:
+    std::mutex mutex;
+    std::map<std::pair<int, bool>, kiss_fftr_cfg> plans;
+};
+
+static FFTPlanCache& getPlanCache()
+{
+    static FFTPlanCache cache;
+    return cache;
+}
+
+int FFT::_numPlans()
+{
+    return getPlanCache().size();
+}
+
+FFTScratch::FFTScratch(int numBins)
+{
+    if (numBins) {
+        setSize(numBins);
+    }
+}
+
+void FFTScratch::setSize(int numBins)
+{
+    if (numBins == planSize) {
+        return;
+    }
+    // kiss_fftr does a complex fft of half the size
+    buffer.resize(numBins / 2);
+    forwardPlan = nullptr;
+    inversePlan = nullptr;
+    planSize = numBins;
+}
+
 bool FFT::forward(FFTDataCpx* out, const FFTDataReal& in)
+{
+    FFTScratch scratch;
+    return forward(out, in, scratch);
+}
+
+bool FFT::inverse(FFTDataReal* out, const FFTDataCpx& in)
+{
+    FFTScratch scratch;
+    return inverse(out, in, scratch);
+}
+
+bool FFT::forward(FFTDataCpx* out, const FFTDataReal& in, FFTScratch& scratch)
 {
     if (out->buffer.size() != in.buffer.size()) {
         return false;
     }
 
-    // step 1: create the cfg, if needed
-    if (in.kiss_cfg == 0) {
-        bool inverse_fft = false;
-        kiss_fftr_cfg newCfg=  kiss_fftr_alloc((int)in.buffer.size(),
-            inverse_fft,
-           nullptr, nullptr);
-
-        assert (newCfg);
-        if (!newCfg) {
+    // step 1: get the plan, if needed
+    scratch.setSize(in.size());
+    if (!scratch.forwardPlan) {
+        scratch.forwardPlan = getPlanCache().get(in.size(), false);
+        if (!scratch.forwardPlan) {
             return false;
         }
-
-        // now save off in our typeless pointer.
-        assert(sizeof(newCfg) == sizeof(in.kiss_cfg));
-        in.kiss_cfg = newCfg;
     }
 
     // step 2: do the fft
-    kiss_fftr_cfg theCfg = reinterpret_cast<kiss_fftr_cfg>(in.kiss_cfg);
+    kiss_fftr_cfg theCfg = reinterpret_cast<kiss_fftr_cfg>(scratch.forwardPlan);
 
     // TODO: need a test that this assumption is correct (that we kiss_fft_cpx == std::complex.
     kiss_fft_cpx * outBuffer = reinterpret_cast<kiss_fft_cpx *>(out->buffer.data());
-    kiss_fftr(theCfg, in.buffer.data(), outBuffer);
+    kiss_fft_cpx * tmpBuffer = reinterpret_cast<kiss_fft_cpx *>(scratch.buffer.data());
+    kiss_fftr_scratch(theCfg, in.buffer.data(), outBuffer, tmpBuffer);
 
     // step 4: scale
     const float scale = float(1.0 / in.buffer.size());
@@ -49,36 +127,29 @@ bool FFT::forward(FFTDataCpx* out, const FFTDataReal& in)
     return true;
 }
 
-bool FFT::inverse(FFTDataReal* out, const FFTDataCpx& in)
+bool FFT::inverse(FFTDataReal* out, const FFTDataCpx& in, FFTScratch& scratch)
 {
     if (out->buffer.size() != in.buffer.size()) {
         return false;
     }
 
-    // step 1: create the cfg, if needed
-    if (in.kiss_cfg == 0) {
-        bool inverse_fft = true;
-        kiss_fftr_cfg newCfg = kiss_fftr_alloc((int) in.buffer.size(),
-            inverse_fft,
-            nullptr, nullptr);
-
-        assert(newCfg);
-        if (!newCfg) {
+    // step 1: get the plan, if needed
+    scratch.setSize(in.size());
+    if (!scratch.inversePlan) {
+        scratch.inversePlan = getPlanCache().get(in.size(), true);
+        if (!scratch.inversePlan) {
             return false;
         }
-
-        // now save off in our typeless pointer.
-        assert(sizeof(newCfg) == sizeof(in.kiss_cfg));
-        in.kiss_cfg = newCfg;
     }
 
     // step 2: do the fft
-    kiss_fftr_cfg theCfg = reinterpret_cast<kiss_fftr_cfg>(in.kiss_cfg);
+    kiss_fftr_cfg theCfg = reinterpret_cast<kiss_fftr_cfg>(scratch.inversePlan);
 
     // TODO: need a test that this assumption is correct (that we kiss_fft_cpx == std::complex.
     const kiss_fft_cpx * inBuffer = reinterpret_cast<const kiss_fft_cpx *>(in.buffer.data());
+    kiss_fft_cpx * tmpBuffer = reinterpret_cast<kiss_fft_cpx *>(scratch.buffer.data());
 
-    kiss_fftri(theCfg, inBuffer, out->buffer.data());
+    kiss_fftri_scratch(theCfg, inBuffer, out->buffer.data(), tmpBuffer);
     return true;
 }
 
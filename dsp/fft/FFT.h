@@ -19,14 +19,55 @@ public:
     }
 };
 
+/**
+ * Work memory for FFTs, owned by the caller.
+ * Keep one around for each thread (or each object) that does FFTs.
+ * Once it has been used for a given size, more FFTs of that size
+ * will not allocate memory or take a lock.
+ */
+class FFTScratch
+{
+public:
+    FFTScratch(int numBins = 0);
+private:
+    friend FFT;
+    std::vector<cpx> buffer;
+
+    /**
+     * Plans for the size we were last used with, from the plan cache.
+     * Stored without type so that clients don't need
+     * to pull in the kiss_fft headers.
+     */
+    int planSize = 0;
+    void* forwardPlan = nullptr;
+    void* inversePlan = nullptr;
+
+    void setSize(int numBins);
+};
+
 class FFT
 {
 public:
     /** Forward FFT will do the 1/N scaling
+     * These versions allocate scratch memory for every call.
      */
     static bool forward(FFTDataCpx* out, const FFTDataReal& in);
     static bool inverse(FFTDataReal* out, const FFTDataCpx& in);
 
+    /**
+     * These versions use the caller's scratch memory, so they
+     * don't allocate (after the first call), and may be called from any thread.
+     */
+    static bool forward(FFTDataCpx* out, const FFTDataReal& in, FFTScratch& scratch);
+    static bool inverse(FFTDataReal* out, const FFTDataCpx& in, FFTScratch& scratch);
+
+    /**
+     * Number of plans in the process wide cache.
+     * Plans are made once for each size and direction, and shared
+     * (read only) by all threads.
+     */
+    static int _numPlans();
+
   //  static FFTDataCpx* makeNoiseFormula(float slope, float highFreqCorner, int frameSize);
 
     /**
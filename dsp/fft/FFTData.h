@@ -43,15 +43,6 @@ public:
     static int _count;
 private:
     std::vector<T> buffer;
-
-    /**
-    * we store this without type so that clients don't need
-    * to pull in the kiss_fft headers. It's mutable so it can
-    * be lazy created by FFT functions.
-    * Note that the cfg has a "direction" baked into it. For
-    * now we assume that all FFT with complex input will be inverse FFTs.
-    */
-    mutable void * kiss_cfg = 0;
 };
 
 using FFTDataReal = FFTData<float>;
@@ -69,11 +60,6 @@ inline FFTData<T>::FFTData(int numBins) :
 template <typename T>
 inline FFTData<T>::~FFTData()
 {
-    // We need to manually delete the cfg, since only "we" know
-    // what type it is.
-    if (kiss_cfg) {
-        free(kiss_cfg);
-    }
     --_count;
 }
 
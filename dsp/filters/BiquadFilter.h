@@ -33,6 +33,18 @@ public:
     template<int N>
     static T run(T input, BiquadState<T, N>& state, const BiquadParams<T, N>& params);
 
+    /**
+     * Block mode: runs n samples of one channel through the filter.
+     * Same results as calling run() n times, but the state and taps
+     * stay in registers for the whole block.
+     *
+     * output may be the same buffer as input, or nullptr if the caller
+     * only wants the last sample.
+     * returns the last output sample.
+     */
+    template<int N>
+    static T runBlock(const T* input, T* output, int n, BiquadState<T, N>& state, const BiquadParams<T, N>& params);
+
     /**
      * Translate filter coefficients from Dsp:: conventions to DspParam structure
      */
@@ -73,3 +85,43 @@ inline T BiquadFilter<T>::run(T input, BiquadState<T, N>& state, const BiquadPar
     }
     return input;
 }
+
+template<typename T>
+template<int N>
+inline T BiquadFilter<T>::runBlock(const T* input, T* output, int n, BiquadState<T, N>& state, const BiquadParams<T, N>& params)
+{
+    T b0[N], b1[N], b2[N], a1[N], a2[N];
+    T z0[N], z1[N];
+    for (int stage = 0; stage < N; ++stage) {
+        b0[stage] = params.B0(stage);
+        b1[stage] = params.B1(stage);
+        b2[stage] = params.B2(stage);
+        a1[stage] = params.A1(stage);
+        a2[stage] = params.A2(stage);
+        z0[stage] = state.z0(stage);
+        z1[stage] = state.z1(stage);
+    }
+
+    T y = 0;
+    for (int i = 0; i < n; ++i) {
+        y = input[i];
+        for (int stage = 0; stage < N; ++stage) {
+            // exactly the same math as run()
+            T x = y + (a1[stage] * z0[stage] + a2[stage] * z1[stage]);
+            y = b0[stage] * x +
+                b1[stage] * z0[stage] +
+                b2[stage] * z1[stage];
+            z1[stage] = z0[stage];
+            z0[stage] = x;
+        }
+        if (output) {
+            output[i] = y;
+        }
+    }
+
+    for (int stage = 0; stage < N; ++stage) {
+        state.z0(stage) = z0[stage];
+        state.z1(stage) = z1[stage];
+    }
+    return y;
+}
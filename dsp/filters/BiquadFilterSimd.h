@@ -0,0 +1,191 @@
+#pragma once
+
+#include "BiquadParams.h"
+
+#include <assert.h>
+#include <xmmintrin.h>
+
+/**
+ * Delay memory for four independent biquad filters,
+ * one in each lane of an __m128.
+ *
+ * N is the number of stages.
+ */
+template <int N>
+class BiquadStateSimd
+{
+public:
+    __m128 z0[N];
+    __m128 z1[N];
+
+    BiquadStateSimd()
+    {
+        for (int i = 0; i < N; ++i) {
+            z0[i] = _mm_setzero_ps();
+            z1[i] = _mm_setzero_ps();
+        }
+    }
+};
+
+/**
+ * Taps for four independent biquad filters, one in each lane.
+ * Laid out as structure of arrays: each tap of each stage
+ * is an __m128 holding that tap for all four filters.
+ *
+ * N is the number of stages.
+ */
+template <int N>
+class BiquadParamsSimd
+{
+public:
+    __m128 b0[N];
+    __m128 b1[N];
+    __m128 b2[N];
+    __m128 a1[N];
+    __m128 a2[N];
+
+    BiquadParamsSimd()
+    {
+        for (int i = 0; i < N; ++i) {
+            b0[i] = b1[i] = b2[i] = a1[i] = a2[i] = _mm_setzero_ps();
+        }
+    }
+
+    /**
+     * Copy the taps of a scalar filter into one lane.
+     * Not fast, meant to be called when the filter is designed.
+     */
+    template <typename T>
+    void setLane(int lane, const BiquadParams<T, N>& params)
+    {
+        assert(lane >= 0 && lane < 4);
+        for (int stage = 0; stage < N; ++stage) {
+            setLane(b0[stage], lane, float(params.B0(stage)));
+            setLane(b1[stage], lane, float(params.B1(stage)));
+            setLane(b2[stage], lane, float(params.B2(stage)));
+            setLane(a1[stage], lane, float(params.A1(stage)));
+            setLane(a2[stage], lane, float(params.A2(stage)));
+        }
+    }
+
+private:
+    static void setLane(__m128& x, int lane, float value)
+    {
+        float buffer[4];
+        _mm_storeu_ps(buffer, x);
+        buffer[lane] = value;
+        x = _mm_loadu_ps(buffer);
+    }
+};
+
+/**
+ * SSE version of BiquadFilter<float>.
+ * Runs four independent filters at once, one per lane.
+ * Same topology as the scalar version.
+ *
+ * With BiquadParams, the four filters share the same taps.
+ * With BiquadParamsSimd each lane has its own taps, and each lane
+ * gives exactly the same output as BiquadFilter<float>.
+ */
+class BiquadFilterSimd
+{
+public:
+    BiquadFilterSimd() = delete;       // we are only static
+    template<int N>
+    static __m128 run(__m128 input, BiquadStateSimd<N>& state, const BiquadParams<float, N>& params);
+
+    template<int N>
+    static __m128 run(__m128 input, BiquadStateSimd<N>& state, const BiquadParamsSimd<N>& params);
+
+    /**
+     * Block mode: runs n samples through the filter, with the state
+     * and taps kept in registers for the whole block.
+     * Same results as calling run() n times.
+     *
+     * output may be the same buffer as input, or nullptr if the caller
+     * only wants the last sample.
+     * returns the last output sample.
+     */
+    template<int N>
+    static __m128 runBlock(const __m128* input, __m128* output, int n,
+        BiquadStateSimd<N>& state, const BiquadParams<float, N>& params);
+};
+
+template<int N>
+inline __m128 BiquadFilterSimd::run(__m128 input, BiquadStateSimd<N>& state, const BiquadParams<float, N>& params)
+{
+    for (int stage = 0; stage < N; ++stage) {
+        const __m128 x = _mm_add_ps(input, _mm_add_ps(
+            _mm_mul_ps(_mm_set_ps1(params.A1(stage)), state.z0[stage]),
+            _mm_mul_ps(_mm_set_ps1(params.A2(stage)), state.z1[stage])));
+
+        input = _mm_add_ps(_mm_mul_ps(_mm_set_ps1(params.B0(stage)), x), _mm_add_ps(
+            _mm_mul_ps(_mm_set_ps1(params.B1(stage)), state.z0[stage]),
+            _mm_mul_ps(_mm_set_ps1(params.B2(stage)), state.z1[stage])));
+        state.z1[stage] = state.z0[stage];
+        state.z0[stage] = x;
+    }
+    return input;
+}
+
+template<int N>
+inline __m128 BiquadFilterSimd::run(__m128 input, BiquadStateSimd<N>& state, const BiquadParamsSimd<N>& params)
+{
+    for (int stage = 0; stage < N; ++stage) {
+        // same order of operations as the scalar version, so lanes match it exactly
+        const __m128 x = _mm_add_ps(input, _mm_add_ps(
+            _mm_mul_ps(params.a1[stage], state.z0[stage]),
+            _mm_mul_ps(params.a2[stage], state.z1[stage])));
+
+        input = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(params.b0[stage], x),
+            _mm_mul_ps(params.b1[stage], state.z0[stage])),
+            _mm_mul_ps(params.b2[stage], state.z1[stage]));
+        state.z1[stage] = state.z0[stage];
+        state.z0[stage] = x;
+    }
+    return input;
+}
+
+template<int N>
+inline __m128 BiquadFilterSimd::runBlock(const __m128* input, __m128* output, int n,
+    BiquadStateSimd<N>& state, const BiquadParams<float, N>& params)
+{
+    __m128 b0[N], b1[N], b2[N], a1[N], a2[N];
+    __m128 z0[N], z1[N];
+    for (int stage = 0; stage < N; ++stage) {
+        b0[stage] = _mm_set_ps1(params.B0(stage));
+        b1[stage] = _mm_set_ps1(params.B1(stage));
+        b2[stage] = _mm_set_ps1(params.B2(stage));
+        a1[stage] = _mm_set_ps1(params.A1(stage));
+        a2[stage] = _mm_set_ps1(params.A2(stage));
+        z0[stage] = state.z0[stage];
+        z1[stage] = state.z1[stage];
+    }
+
+    __m128 y = _mm_setzero_ps();
+    for (int i = 0; i < n; ++i) {
+        y = input[i];
+        for (int stage = 0; stage < N; ++stage) {
+            // exactly the same math as run()
+            const __m128 x = _mm_add_ps(y, _mm_add_ps(
+                _mm_mul_ps(a1[stage], z0[stage]),
+                _mm_mul_ps(a2[stage], z1[stage])));
+
+            y = _mm_add_ps(_mm_mul_ps(b0[stage], x), _mm_add_ps(
+                _mm_mul_ps(b1[stage], z0[stage]),
+                _mm_mul_ps(b2[stage], z1[stage])));
+            z1[stage] = z0[stage];
+            z0[stage] = x;
+        }
+        if (output) {
+            output[i] = y;
+        }
+    }
+
+    for (int stage = 0; stage < N; ++stage) {
+        state.z0[stage] = z0[stage];
+        state.z1[stage] = z1[stage];
+    }
+    return y;
+}
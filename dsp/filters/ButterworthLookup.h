@@ -38,4 +38,126 @@ inline void ButterworthLookup4PHP::get(BiquadParams<float, 2>& params, float nor
         float p = LookupTable<float>::lookup(tables[i], normalizedCutoff, true);
         params.setAtIndex(p, i);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Interpolating lookup for three pole lowpass parameters.
+ *
+ * Made for filters that go very low, like LFN's, so the table is indexed
+ * by log2 of the normalized cutoff, and covers minCutoff() to maxCutoff().
+ * Cutoffs outside that get limited.
+ *
+ * At low cutoffs the taps are all close to +-1 or 2, and the response
+ * depends on the tiny differences between them, so interpolating the taps
+ * directly is not very accurate. Instead we interpolate things that go as
+ * a power of the cutoff, so their logs are close to straight lines:
+ * 1 - A1 - A2 and 1 + A2. For the feed forward taps we interpolate their
+ * shape, and the DC gain of the whole filter, which is very close to one.
+ * Then the taps are re-made from those.
+ *
+ * All the designing (which allocates) is done in the constructor, so get()
+ * may be called from the audio thread.
+ */
+template <typename T>
+class ButterworthLookup3PLP
+{
+public:
+    ButterworthLookup3PLP();
+    void get(BiquadParams<T, 2>& params, T normalizedCutoff) const;
+
+    static T minCutoff()
+    {
+        return T(1.0 / (1 << 22));
+    }
+    static T maxCutoff()
+    {
+        return T(1.0 / 16);
+    }
+private:
+    static const int numStages = 2;
+    static const int binsPerOctave = 16;
+
+    /**
+     * For each stage: B0, B1, B2 over their sum,
+     * log(1 - A1 - A2), and log(1 + A2).
+     * Then one more for the DC gain.
+     */
+    static const int tablesPerStage = 5;
+    static const int numTables = numStages * tablesPerStage + 1;
+    LookupTableParams<T> tables[numTables];
+
+    static double getTableValue(int table, const BiquadParams<T, 2>&);
+};
+
+template <typename T>
+inline ButterworthLookup3PLP<T>::ButterworthLookup3PLP()
+{
+    const T xMin = std::log2(minCutoff());
+    const T xMax = std::log2(maxCutoff());
+    const int numBins = int(xMax - xMin) * binsPerOctave;
+    for (int index = 0; index < numTables; ++index) {
+        LookupTable<T>::init(tables[index], numBins, xMin, xMax, [index](double x) {
+            // init looks one bin past the end
+            x = std::min(x, double(std::log2(maxCutoff())));
+            BiquadParams<T, 2> params;
+            ButterworthFilterDesigner<T>::designThreePoleLowpass(params, T(std::exp2(x)));
+            return getTableValue(index, params);
+            });
+    }
+}
+
+template <typename T>
+inline double ButterworthLookup3PLP<T>::getTableValue(int table, const BiquadParams<T, 2>& params)
+{
+    if (table == numTables - 1) {
+        double gain = 1;
+        for (int stage = 0; stage < numStages; ++stage) {
+            gain *= (params.B0(stage) + params.B1(stage) + params.B2(stage)) /
+                (1 - params.A1(stage) - params.A2(stage));
+        }
+        return gain;
+    }
+
+    const int stage = table / tablesPerStage;
+    const double b0 = params.B0(stage);
+    const double b1 = params.B1(stage);
+    const double b2 = params.B2(stage);
+    const double a1 = params.A1(stage);
+    const double a2 = params.A2(stage);
+    const double bSum = b0 + b1 + b2;
+    switch (table % tablesPerStage) {
+        case 0:
+            return b0 / bSum;
+        case 1:
+            return b1 / bSum;
+        case 2:
+            return b2 / bSum;
+        case 3:
+            return std::log(1 - a1 - a2);
+        case 4:
+            return std::log(1 + a2);
+    }
+    assert(false);
+    return 0;
+}
+
+template <typename T>
+inline void ButterworthLookup3PLP<T>::get(BiquadParams<T, 2>& params, T normalizedCutoff) const
+{
+    normalizedCutoff = std::max(normalizedCutoff, minCutoff());
+    const T x = std::log2(normalizedCutoff);
+    const T gain = LookupTable<T>::lookup(tables[numTables - 1], x, true);
+    for (int stage = 0; stage < numStages; ++stage) {
+        const LookupTableParams<T>* t = tables + stage * tablesPerStage;
+        const T a2 = std::exp(LookupTable<T>::lookup(t[4], x, true)) - 1;
+        const T a1 = 1 - a2 - std::exp(LookupTable<T>::lookup(t[3], x, true));
+
+        // the first stage gets all the gain, the others are unity gain at DC
+        const T bSum = (1 - a1 - a2) * (stage == 0 ? gain : 1);
+        params.B0(stage) = LookupTable<T>::lookup(t[0], x, true) * bSum;
+        params.B1(stage) = LookupTable<T>::lookup(t[1], x, true) * bSum;
+        params.B2(stage) = LookupTable<T>::lookup(t[2], x, true) * bSum;
+        params.A1(stage) = a1;
+        params.A2(stage) = a2;
+    }
+}
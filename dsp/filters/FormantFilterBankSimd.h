@@ -0,0 +1,155 @@
+#pragma once
+
+#include "StateVariableFilter.h"
+
+#include <assert.h>
+#include <xmmintrin.h>
+
+/**
+ * A bank of N state variable filters, all fed the same input, with
+ * their outputs summed together. This is the formant section of
+ * VocalFilter and VocalAnimator.
+ *
+ * Runs four voices at once, one in each lane of an __m128.
+ *
+ * Coefficients and state are kept as arrays of __m128, one entry per
+ * band (structure of arrays), so all the bands of all four voices are
+ * run in a single pass with no shuffling. All the bands share the same mode.
+ *
+ * Each band is the same math as StateVariableFilter<float>,
+ * and the bands are summed in order, so a lane gives exactly
+ * the same output as the scalar filters.
+ */
+template <int N>
+class FormantFilterBankSimd
+{
+public:
+    using Mode = StateVariableFilterParams<float>::Mode;
+    static const int numBands = N;
+
+    FormantFilterBankSimd();
+
+    /**
+     * Returns the sum of (band output * band gain)
+     */
+    __m128 run(__m128 input);
+
+    void setMode(Mode m)
+    {
+        mode = m;
+    }
+
+    /**
+     * Set the center frequency, one per lane.
+     * units are 1 == sample rate
+     */
+    void setFreq(int band, __m128 fc)
+    {
+        assert(band >= 0 && band < N);
+        // Note that we are skipping the high freq warping, same as the scalar filter.
+        fcGain[band] = _mm_mul_ps(fc, _mm_set_ps1(float(AudioMath::Pi) * 2.f));
+    }
+
+    /**
+     * Normalized bandwidth is bw / fc, one per lane
+     * Also is 1 / Q
+     */
+    void setNormalizedBandwidth(int band, __m128 bw)
+    {
+        assert(band >= 0 && band < N);
+        qGain[band] = bw;
+    }
+
+    void setGain(int band, __m128 g)
+    {
+        assert(band >= 0 && band < N);
+        gain[band] = g;
+    }
+
+private:
+    __m128 fcGain[N];
+    __m128 qGain[N];
+    __m128 gain[N];
+    __m128 z1[N];
+    __m128 z2[N];
+    Mode mode = Mode::BandPass;
+
+    template <Mode M>
+    __m128 runMode(__m128 input);
+
+    static __m128 select(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+};
+
+template <int N>
+inline FormantFilterBankSimd<N>::FormantFilterBankSimd()
+{
+    for (int i = 0; i < N; ++i) {
+        fcGain[i] = _mm_set_ps1(.001f);
+        qGain[i] = _mm_set_ps1(1.f);
+        gain[i] = _mm_set_ps1(1.f);
+        z1[i] = _mm_setzero_ps();
+        z2[i] = _mm_setzero_ps();
+    }
+}
+
+template <int N>
+inline __m128 FormantFilterBankSimd<N>::run(__m128 input)
+{
+    // pick the mode once, so the inner loop has no branches
+    switch (mode) {
+        case Mode::BandPass:
+            return runMode<Mode::BandPass>(input);
+        case Mode::LowPass:
+            return runMode<Mode::LowPass>(input);
+        case Mode::HiPass:
+            return runMode<Mode::HiPass>(input);
+        case Mode::Notch:
+            return runMode<Mode::Notch>(input);
+        default:
+            assert(false);
+    }
+    return _mm_setzero_ps();
+}
+
+template <int N>
+template <typename FormantFilterBankSimd<N>::Mode M>
+inline __m128 FormantFilterBankSimd<N>::runMode(__m128 input)
+{
+    __m128 mix = _mm_setzero_ps();
+    for (int i = 0; i < N; ++i) {
+        const __m128 dLow = _mm_add_ps(z2[i], _mm_mul_ps(fcGain[i], z1[i]));
+        const __m128 dHi = _mm_sub_ps(input, _mm_add_ps(_mm_mul_ps(z1[i], qGain[i]), dLow));
+        __m128 dBand = _mm_add_ps(_mm_mul_ps(dHi, fcGain[i]), z1[i]);
+
+        // same clipping as the scalar version
+        const __m128 tooHigh = _mm_cmpge_ps(dBand, _mm_set_ps1(1000.f));
+        const __m128 tooLow = _mm_cmplt_ps(dBand, _mm_set_ps1(-1000.f));
+        dBand = select(tooHigh, _mm_set_ps1(999.f), dBand);
+        dBand = select(tooLow, _mm_set_ps1(-999.f), dBand);
+
+        __m128 d;
+        switch (M) {
+            case Mode::LowPass:
+                d = dLow;
+                break;
+            case Mode::HiPass:
+                d = dHi;
+                break;
+            case Mode::Notch:
+                d = _mm_add_ps(dLow, dHi);
+                break;
+            case Mode::BandPass:
+            default:
+                d = dBand;
+                break;
+        }
+
+        z1[i] = dBand;
+        z2[i] = dLow;
+        mix = _mm_add_ps(mix, _mm_mul_ps(gain[i], d));
+    }
+    return mix;
+}
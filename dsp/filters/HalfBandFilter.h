@@ -0,0 +1,251 @@
+#pragma once
+
+#include "AudioMath.h"
+
+#include <assert.h>
+#include <cmath>
+#include <xmmintrin.h>
+
+/**
+ * Designs half band lowpass FIR filters.
+ *
+ * A half band filter with 4K - 1 taps has a center tap of exactly .5,
+ * every other tap is zero, and the rest are symmetric. So the whole
+ * filter is described by the K taps at center +- 1, 3, 5, ...
+ *
+ * These are windowed sinc, using a Kaiser window with beta = 8.
+ * That gives about 80 db of stop band rejection, and the pass band
+ * ends where the stop band begins.
+ */
+class HalfBandDesigner
+{
+public:
+    /**
+     * Fills coefficients[0..K-1] with the taps at center +- (2j + 1).
+     * They are normalized so that DC gain is exactly one.
+     */
+    static void design(float* coefficients, int K);
+
+private:
+    /**
+     * Modified Bessel function of the first kind, order zero.
+     */
+    static double besselI0(double);
+};
+
+/**
+ * One stage of decimation by two.
+ *
+ * Uses the polyphase form, so it only computes the samples it keeps.
+ * Each output takes K multiplies.
+ *
+ * T is float, or __m128 to do four channels at once.
+ */
+template <typename T, int K>
+class HalfBandDecimatorStage
+{
+public:
+    HalfBandDecimatorStage();
+
+    /**
+     * Filters input[0..2n-1] and writes output[0..n-1].
+     * Output may be the same buffer as input.
+     */
+    void process(T* output, const T* input, int n);
+
+private:
+    T taps[K];
+
+    /**
+     * The even input samples. Every sample is written twice, so that the
+     * last 2K of them are always contiguous.
+     */
+    T history[4 * K];
+    int historyPos = 0;
+
+    /**
+     * The odd input samples only go through the center tap,
+     * so they just need to be delayed.
+     */
+    T delay[K];
+    int delayPos = 0;
+};
+
+/**
+ * One stage of up-sampling by two.
+ *
+ * Uses the polyphase form, so it never multiplies the stuffed zeros.
+ * Of each pair of outputs, one takes K multiplies, and the other
+ * is just the delayed input.
+ */
+template <typename T, int K>
+class HalfBandUpsamplerStage
+{
+public:
+    HalfBandUpsamplerStage();
+
+    /**
+     * Filters input[0..n-1] and writes output[0..2n-1].
+     * Output may not be the same buffer as input.
+     */
+    void process(T* output, const T* input, int n);
+
+private:
+    T taps[K];
+    T history[4 * K];
+    int historyPos = 0;
+};
+
+/**
+ * The arithmetic, for float and __m128.
+ */
+class HalfBandMath
+{
+public:
+    static float add(float a, float b)
+    {
+        return a + b;
+    }
+    static __m128 add(__m128 a, __m128 b)
+    {
+        return _mm_add_ps(a, b);
+    }
+    static float mul(float a, float b)
+    {
+        return a * b;
+    }
+    static __m128 mul(__m128 a, __m128 b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+    static void set(float& x, float value)
+    {
+        x = value;
+    }
+    static void set(__m128& x, float value)
+    {
+        x = _mm_set_ps1(value);
+    }
+};
+
+inline double HalfBandDesigner::besselI0(double x)
+{
+    double sum = 1;
+    double term = 1;
+    for (int k = 1; term > 1e-12 * sum; ++k) {
+        const double t = x / (2 * k);
+        term *= t * t;
+        sum += term;
+    }
+    return sum;
+}
+
+inline void HalfBandDesigner::design(float* coefficients, int K)
+{
+    assert(K > 0);
+    const double beta = 8;
+    const int center = 2 * K - 1;
+    double h[64];
+    assert(K <= 64);
+
+    double sum = 0;
+    for (int j = 0; j < K; ++j) {
+        const int offset = 2 * j + 1;
+        const double sinc = std::sin(AudioMath::Pi * offset / 2) / (AudioMath::Pi * offset);
+        const double r = double(offset) / center;
+        const double window = besselI0(beta * std::sqrt(1 - r * r)) / besselI0(beta);
+        h[j] = sinc * window;
+        sum += h[j];
+    }
+
+    // the center tap is .5, so the two sides must add up to .5
+    for (int j = 0; j < K; ++j) {
+        coefficients[j] = float(h[j] * .25 / sum);
+    }
+}
+
+template <typename T, int K>
+inline HalfBandDecimatorStage<T, K>::HalfBandDecimatorStage()
+{
+    float c[K];
+    HalfBandDesigner::design(c, K);
+    for (int j = 0; j < K; ++j) {
+        HalfBandMath::set(taps[j], c[j]);
+        HalfBandMath::set(delay[j], 0);
+    }
+    for (int i = 0; i < 4 * K; ++i) {
+        HalfBandMath::set(history[i], 0);
+    }
+}
+
+template <typename T, int K>
+inline void HalfBandDecimatorStage<T, K>::process(T* output, const T* input, int n)
+{
+    T center;
+    HalfBandMath::set(center, .5f);
+    for (int i = 0; i < n; ++i) {
+        const T odd = input[2 * i];
+        const T even = input[2 * i + 1];
+
+        // delay the odd sample by K - 1
+        delay[delayPos] = odd;
+        if (++delayPos == K) {
+            delayPos = 0;
+        }
+        const T delayed = delay[delayPos];
+
+        if (++historyPos == 2 * K) {
+            historyPos = 0;
+        }
+        history[historyPos] = even;
+        history[historyPos + 2 * K] = even;
+
+        // x[-i] is the even sample from i outputs ago
+        const T* x = history + historyPos + 2 * K;
+        T acc = HalfBandMath::mul(center, delayed);
+        for (int j = 0; j < K; ++j) {
+            const T pair = HalfBandMath::add(x[j + 1 - K], x[-K - j]);
+            acc = HalfBandMath::add(acc, HalfBandMath::mul(taps[j], pair));
+        }
+        output[i] = acc;
+    }
+}
+
+template <typename T, int K>
+inline HalfBandUpsamplerStage<T, K>::HalfBandUpsamplerStage()
+{
+    float c[K];
+    HalfBandDesigner::design(c, K);
+    for (int j = 0; j < K; ++j) {
+        // The zero stuffing halves the gain, so double it here
+        HalfBandMath::set(taps[j], 2 * c[j]);
+    }
+    for (int i = 0; i < 4 * K; ++i) {
+        HalfBandMath::set(history[i], 0);
+    }
+}
+
+template <typename T, int K>
+inline void HalfBandUpsamplerStage<T, K>::process(T* output, const T* input, int n)
+{
+    assert(output != input);
+    for (int i = 0; i < n; ++i) {
+        if (++historyPos == 2 * K) {
+            historyPos = 0;
+        }
+        history[historyPos] = input[i];
+        history[historyPos + 2 * K] = input[i];
+
+        const T* x = history + historyPos + 2 * K;
+        T acc = HalfBandMath::mul(taps[0], HalfBandMath::add(x[1 - K], x[-K]));
+        for (int j = 1; j < K; ++j) {
+            const T pair = HalfBandMath::add(x[j + 1 - K], x[-K - j]);
+            acc = HalfBandMath::add(acc, HalfBandMath::mul(taps[j], pair));
+        }
+        output[2 * i] = acc;
+
+        // the other phase is only the center tap, which is
+        // .5 times the doubled gain
+        output[2 * i + 1] = x[1 - K];
+    }
+}
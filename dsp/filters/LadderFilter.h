@@ -1,6 +1,8 @@
 #pragma once
 
 #include "AsymWaveShaper.h"
+#include "HalfBandDecimator.h"
+#include "HalfBandUpsampler.h"
 #include "IIRDecimator.h"
 #include "IIRUpsampler.h"
 #include "LookupTable.h"
@@ -114,6 +116,15 @@ public:
     void setSlope(T);       // 0..3. only works in 4 pole
     void setVolume(T vol);  // 0..1
 
+    /**
+     * If true, oversample with the polyphase half band filters
+     * instead of the IIR filters.
+     */
+    void setPolyphase(bool b)
+    {
+        polyphase = b;
+    }
+
     float getLEDValue(int tapNumber);
 
     static std::vector<std::string> getTypeNames();
@@ -125,6 +136,29 @@ public:
         _disableQComp = true;
     }
 
+    /**
+     * Helpers for computing the filter coefficients.
+     * Shared with the polyphonic LadderFilterSimd.
+     */
+
+    /**
+     * fills taps with the output mixer gain for each stage.
+     * bypassFirstStage will be set for the types that need it.
+     */
+    static void getTypeTaps(Types type, T* taps, bool& bypassFirstStage);
+
+    /**
+     * fills taps with the output mixer gains for a 4 pole lowpass
+     * with a given slope (0..3)
+     */
+    static void getSlopeTaps(T slope, T* taps);
+
+    /**
+     * Max feedback as a function of normalized Fc.
+     */
+    static std::shared_ptr<NonUniformLookupTableParams<T>> makeFeedbackLookup();
+    static T processFeedback(T fcNorm, T feedback, NonUniformLookupTableParams<T>& feedbackLookup);
+
 private:
     TrapezoidalLowpass<T> lpfs[4];
     EdgeTables edgeLookup;
@@ -168,6 +202,7 @@ private:
 
     bool bypassFirstStage = false;
     bool _disableQComp = false;
+    bool polyphase = false;
 
     std::shared_ptr<NonUniformLookupTableParams<T>> fs2gLookup = makeTrapFilter_Lookup<T>();
     std::shared_ptr<NonUniformLookupTableParams<T>> feedbackAdjust;
@@ -177,6 +212,8 @@ private:
     static const int oversampleRate = 4;
     IIRUpsampler up;
     IIRDecimator down;
+    HalfBandUpsampler upPolyphase;
+    HalfBandDecimator downPolyphase;
 
     AsymWaveShaper shaper;
 
@@ -205,6 +242,8 @@ LadderFilter<T>::LadderFilter()
     // fix at 4X oversample
     up.setup(oversampleRate);
     down.setup(oversampleRate);
+    upPolyphase.setup(oversampleRate);
+    downPolyphase.setup(oversampleRate);
 }
 
 template <typename T>
@@ -241,15 +280,21 @@ inline void  LadderFilter<T>::updateSlope()
     }
    
   //  printf("\n update slope %f\n", slope);
+    getSlopeTaps(slope, stageTaps);
+}
+
+template <typename T>
+inline void  LadderFilter<T>::getSlopeTaps(T slope, T* taps)
+{
     int iSlope = (int) std::floor(slope);
     for (int i = 0; i < 4; ++i) {
         if (i == iSlope) {
-            stageTaps[i] = ((i + 1) - slope) * 1;
+            taps[i] = ((i + 1) - slope) * 1;
             if (i < 3) {
-                stageTaps[i + 1] = (slope - i) * 1;
+                taps[i + 1] = (slope - i) * 1;
             }
         } else if (i != (iSlope + 1)) {
-            stageTaps[i] = 0;
+            taps[i] = 0;
         }
     }
 }
@@ -414,111 +459,117 @@ void LadderFilter<T>::setType(Types t)
     if (t == type)
         return;
 
-    bypassFirstStage = false;
     type = t;
-    switch (type) {
+    getTypeTaps(type, stageTaps, bypassFirstStage);
+    updateFilter();
+    updateSlope();
+    updateStageGains();         // many filter types turn off the edge
+    dump("set type");
+}
+
+template <typename T>
+void LadderFilter<T>::getTypeTaps(Types t, T* taps, bool& bypassFirstStage)
+{
+    bypassFirstStage = false;
+    switch (t) {
         case Types::_4PLP:
-            stageTaps[3] = 1;
-            stageTaps[2] = 0;
-            stageTaps[1] = 0;
-            stageTaps[0] = 0;
+            taps[3] = 1;
+            taps[2] = 0;
+            taps[1] = 0;
+            taps[0] = 0;
             break;
         case Types::_3PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 1;
-            stageTaps[1] = 0;
-            stageTaps[0] = 0;
+            taps[3] = 0;
+            taps[2] = 1;
+            taps[1] = 0;
+            taps[0] = 0;
             break;
         case Types::_2PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = 1;
-            stageTaps[0] = 0;
+            taps[3] = 0;
+            taps[2] = 0;
+            taps[1] = 1;
+            taps[0] = 0;
             break;
         case Types::_1PLP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = 0;
-            stageTaps[0] = 1;
+            taps[3] = 0;
+            taps[2] = 0;
+            taps[1] = 0;
+            taps[0] = 1;
             break;
         case Types::_2PBP:
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = T(-.68) * 2;
-            stageTaps[0] = T(.68) * 2;
+            taps[3] = 0;
+            taps[2] = 0;
+            taps[1] = T(-.68) * 2;
+            taps[0] = T(.68) * 2;
             break;
         case Types::_2HP1LP:
-            stageTaps[3] = 0;
-            stageTaps[2] = T(.68) * 2;
-            stageTaps[1] = T(-1.36) * 2;
-            stageTaps[0] = T(.68) * 2;
+            taps[3] = 0;
+            taps[2] = T(.68) * 2;
+            taps[1] = T(-1.36) * 2;
+            taps[0] = T(.68) * 2;
             break;
         case Types::_3HP1LP:
-            stageTaps[3] = T(-.68) * 4;
-            stageTaps[2] = T(2.05) * 4;
-            stageTaps[1] = T(-2.05) * 4;
-            stageTaps[0] = T(.68) * 4;
+            taps[3] = T(-.68) * 4;
+            taps[2] = T(2.05) * 4;
+            taps[1] = T(-2.05) * 4;
+            taps[0] = T(.68) * 4;
             break;
         case Types::_3PHP:
             bypassFirstStage = true;
-            stageTaps[3] = -1;
-            stageTaps[2] = 3;
-            stageTaps[1] = -3;
-            stageTaps[0] = 1;
+            taps[3] = -1;
+            taps[2] = 3;
+            taps[1] = -3;
+            taps[0] = 1;
             break;
         case Types::_2PHP:
             bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 1;
-            stageTaps[1] = -2;
-            stageTaps[0] = 1;
+            taps[3] = 0;
+            taps[2] = 1;
+            taps[1] = -2;
+            taps[0] = 1;
             break;
         case Types::_1PHP:
             bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 0;
-            stageTaps[1] = -1;
-            stageTaps[0] = 1;
+            taps[3] = 0;
+            taps[2] = 0;
+            taps[1] = -1;
+            taps[0] = 1;
             break;
         case Types::_4PBP:
-            stageTaps[3] = T(-.68) * 4;
-            stageTaps[2] = T(1.36) * 4;
-            stageTaps[1] = T(-.68) * 4;
-            stageTaps[0] = 0;
+            taps[3] = T(-.68) * 4;
+            taps[2] = T(1.36) * 4;
+            taps[1] = T(-.68) * 4;
+            taps[0] = 0;
             break;
         case Types::_1LPNotch:
-            stageTaps[3] = 0;
-            stageTaps[2] = T(1.36);
-            stageTaps[1] = T(-1.36);
-            stageTaps[0] = T(.68);
+            taps[3] = 0;
+            taps[2] = T(1.36);
+            taps[1] = T(-1.36);
+            taps[0] = T(.68);
             break;
         case Types::_3AP1LP:
-            stageTaps[3] = T(-2.73);
-            stageTaps[2] = T(4.12);
-            stageTaps[1] = T(-2.05);
-            stageTaps[0] = T(.68);
+            taps[3] = T(-2.73);
+            taps[2] = T(4.12);
+            taps[1] = T(-2.05);
+            taps[0] = T(.68);
             break;
         case Types::_NOTCH:
             bypassFirstStage = true;
-            stageTaps[3] = 0;
-            stageTaps[2] = 2;
-            stageTaps[1] = -2;
-            stageTaps[0] = 1;
+            taps[3] = 0;
+            taps[2] = 2;
+            taps[1] = -2;
+            taps[0] = 1;
             break;
         case Types::_PHASER:
             bypassFirstStage = true;
-            stageTaps[3] = -4;
-            stageTaps[2] = 6;
-            stageTaps[1] = -3;
-            stageTaps[0] = 1;
+            taps[3] = -4;
+            taps[2] = 6;
+            taps[1] = -3;
+            taps[0] = 1;
             break;
         default:
             assert(false);
     }
-    updateFilter();
-    updateSlope();
-    updateStageGains();         // many filter types turn off the edge
-    dump("set type");
 }
 
 template <typename T>
@@ -595,7 +646,11 @@ inline void LadderFilter<T>::run(T input)
 {
     input *= gain;
     float buffer[oversampleRate];
-    up.process(buffer, (float) input);
+    if (polyphase) {
+        upPolyphase.process(buffer, (float) input);
+    } else {
+        up.process(buffer, (float) input);
+    }
 
     switch (voicing) {
         case Voicing::Classic:
@@ -616,7 +671,8 @@ inline void LadderFilter<T>::run(T input)
         default:
             assert(false);
     }
-    mixedOutput = down.process(buffer) * finalVolume;
+    const float output = polyphase ? downPolyphase.process(buffer) : down.process(buffer);
+    mixedOutput = output * finalVolume;
 }
 
 /**************************************************************************************
@@ -856,12 +912,18 @@ inline T LadderFilter<T>::processFeedback(T fcNorm, T feedback) const
 
 template <typename T>
 inline T LadderFilter<T>::processFeedback(T fcNorm, T feedback) const
+{
+    return processFeedback(fcNorm, feedback, *feedbackAdjust);
+}
+
+template <typename T>
+inline T LadderFilter<T>::processFeedback(T fcNorm, T feedback, NonUniformLookupTableParams<T>& feedbackLookup)
 {
     const T x = feedback * T(.25);         // range 0..1
     const T y = x * (2 - x);            // still 0..1, but now a smooshed parabola
   //  const t z = 4 * y;                  // now 0..4 again, but still squared and inverted
 
-    const T maxFeedback = NonUniformLookupTable<T>::lookup(*feedbackAdjust, fcNorm);
+    const T maxFeedback = NonUniformLookupTable<T>::lookup(feedbackLookup, fcNorm);
 
   //  printf("proc f. raw f = %f, x = %f, x = %f, will ret %f\n", feedback, x, y, y * maxFeedback);
     return y * maxFeedback;
@@ -873,6 +935,12 @@ inline T LadderFilter<T>::processFeedback(T fcNorm, T feedback) const
 
 template <typename T>
 void LadderFilter<T>::initQLookup()
+{
+    feedbackAdjust = makeFeedbackLookup();
+}
+
+template <typename T>
+std::shared_ptr<NonUniformLookupTableParams<T>> LadderFilter<T>::makeFeedbackLookup()
 {
     std::shared_ptr<NonUniformLookupTableParams<T>> ret =
         std::make_shared<NonUniformLookupTableParams<T>>();
@@ -894,7 +962,7 @@ void LadderFilter<T>::initQLookup()
     NonUniformLookupTable<T>::addPoint(*ret, T(0.498866), T(2.390137));
     
     NonUniformLookupTable<T>::finalize(*ret);
-    feedbackAdjust = ret;
+    return ret;
 }
 #if 0 // gain=40 = too much
 template <typename T>
@@ -0,0 +1,531 @@
+#pragma once
+
+#include "HalfBandDecimator.h"
+#include "HalfBandUpsampler.h"
+#include "IIRDecimator.h"
+#include "IIRUpsampler.h"
+#include "LadderFilter.h"
+
+#include <emmintrin.h>
+
+/**
+ * SSE version of LadderFilter<float>.
+ *
+ * Runs four independent ladder filters at once, one voice in each lane
+ * of an __m128. The signal processing is the same as LadderFilter,
+ * including all the Types and Voicings, and the 4X oversampling.
+ *
+ * Settings that come from CV (Fc, Q, gain, edge, slope, bass) are per voice.
+ * Settings that only come from knobs (type, voicing, spread, volume) are shared.
+ * The coefficient math is done per voice, in scalar code, and only
+ * when the setting changes.
+ */
+class LadderFilterSimd
+{
+public:
+    using Types = LadderFilter<float>::Types;
+    using Voicing = LadderFilter<float>::Voicing;
+
+    LadderFilterSimd();
+
+    void run(__m128);
+    __m128 getOutput() const;
+
+    /**
+     * Per voice settings. Same ranges as LadderFilter.
+     */
+    void setNormalizedFc(__m128);
+    void setFeedback(__m128);
+    void setGain(__m128);
+    void setEdge(__m128);
+    void setBassMakeupGain(__m128);
+    void setSlope(__m128);
+
+    /**
+     * Settings shared by all four voices.
+     */
+    void setType(Types);
+    void setVoicing(Voicing);
+    void setFreqSpread(float);
+    void setVolume(float);
+    void setPolyphase(bool);
+
+    float getLEDValue(int voice, int tapNumber) const;
+
+private:
+    static const int numVoices = 4;
+    static const int oversampleRate = 4;
+
+    /**
+     * The processing state and coefficients, in SSE registers.
+     */
+    __m128 lpfState[4];
+    __m128 stageOutputs[4];
+    __m128 stageG[4];
+    __m128 stageTaps[4];
+    __m128 stageGain[4];
+    __m128 adjustedFeedback;
+    __m128 gain;
+    __m128 bassMakeupGain;
+    __m128 mixedOutput;
+    __m128 finalVolume;
+
+    /**
+     * The per voice values we need to keep around to
+     * calculate the coefficients. Indexed [stage][voice].
+     */
+    float voiceStageG[4][numVoices];
+    float voiceStageTaps[4][numVoices];
+    float voiceStageGain[4][numVoices];
+    float voiceG[numVoices];
+    float voiceAdjustedFeedback[numVoices];
+
+    float lastNormalizedFc[numVoices];
+    float requestedFeedback[numVoices];
+    float rawEdge[numVoices];
+    float slope[numVoices];
+
+    Types type = Types::_4PLP;
+    Voicing voicing = Voicing::Classic;
+    bool bypassFirstStage = false;
+    float typeTaps[4] = {0, 0, 0, 1};
+    float freqSpread = 0;
+    float stageFreqOffsets[4] = {1, 1, 1, 1};
+    float lastVolume = -1;
+    bool polyphase = false;
+
+    EdgeTables edgeLookup;
+
+    std::shared_ptr<NonUniformLookupTableParams<float>> fs2gLookup = makeTrapFilter_Lookup<float>();
+    std::shared_ptr<NonUniformLookupTableParams<float>> feedbackAdjust = LadderFilter<float>::makeFeedbackLookup();
+    std::shared_ptr<LookupTableParams<float>> tanhLookup = ObjectCache<float>::getTanh5();
+
+    IIRUpsamplerSimd up;
+    IIRDecimatorSimd down;
+    HalfBandUpsamplerSimd upPolyphase;
+    HalfBandDecimatorSimd downPolyphase;
+
+    /**
+     * The different non-linearities we put in front of each stage.
+     */
+    enum class Shape
+    {
+        Tanh,
+        ClipTop,
+        ClipBottom,
+        Fold,
+        FoldAtten,
+        FoldTop,
+        FoldBottom,
+        None
+    };
+
+    template <Shape s0, Shape s1, Shape s2, Shape s3>
+    void runBuffer(__m128* buffer);
+
+    template <Shape s>
+    __m128 shape(__m128) const;
+
+    __m128 lookupTanh(__m128) const;
+    static __m128 fold(__m128);
+
+    float getGfromNormFreq(float nf) const;
+    void updateFilter(int voice);
+    void updateFeedback(int voice);
+    void updateStageGains(int voice);
+    void updateTaps(int voice);
+    void loadCoefficients();
+};
+
+inline LadderFilterSimd::LadderFilterSimd()
+{
+    up.setup(oversampleRate);
+    down.setup(oversampleRate);
+    upPolyphase.setup(oversampleRate);
+    downPolyphase.setup(oversampleRate);
+
+    for (int i = 0; i < 4; ++i) {
+        lpfState[i] = _mm_setzero_ps();
+        stageOutputs[i] = _mm_setzero_ps();
+    }
+    adjustedFeedback = _mm_setzero_ps();
+    gain = _mm_set_ps1(.3f);
+    bassMakeupGain = _mm_set_ps1(1);
+    mixedOutput = _mm_setzero_ps();
+    finalVolume = _mm_set_ps1(1);
+
+    for (int voice = 0; voice < numVoices; ++voice) {
+        voiceG[voice] = .001f;
+        voiceAdjustedFeedback[voice] = 0;
+        lastNormalizedFc[voice] = .0001f;
+        requestedFeedback[voice] = 0;
+        rawEdge[voice] = 0;
+        slope[voice] = 3;
+        for (int stage = 0; stage < 4; ++stage) {
+            voiceStageGain[stage][voice] = 1;
+        }
+        updateFilter(voice);
+        updateTaps(voice);
+    }
+    loadCoefficients();
+}
+
+inline void LadderFilterSimd::loadCoefficients()
+{
+    for (int stage = 0; stage < 4; ++stage) {
+        stageG[stage] = _mm_loadu_ps(voiceStageG[stage]);
+        stageTaps[stage] = _mm_loadu_ps(voiceStageTaps[stage]);
+        stageGain[stage] = _mm_loadu_ps(voiceStageGain[stage]);
+    }
+    adjustedFeedback = _mm_loadu_ps(voiceAdjustedFeedback);
+}
+
+inline float LadderFilterSimd::getGfromNormFreq(float nf) const
+{
+    nf *= (1.f / oversampleRate);
+    return NonUniformLookupTable<float>::lookup(*fs2gLookup, nf);
+}
+
+inline void LadderFilterSimd::updateFilter(int voice)
+{
+    for (int stage = 0; stage < 4; ++stage) {
+        voiceStageG[stage][voice] = voiceG[voice] * stageFreqOffsets[stage];
+    }
+    if (bypassFirstStage) {
+        voiceStageG[0][voice] = getGfromNormFreq(.9f);
+    }
+}
+
+inline void LadderFilterSimd::updateFeedback(int voice)
+{
+    voiceAdjustedFeedback[voice] = LadderFilter<float>::processFeedback(
+        lastNormalizedFc[voice],
+        requestedFeedback[voice],
+        *feedbackAdjust);
+}
+
+inline void LadderFilterSimd::updateStageGains(int voice)
+{
+    float gains[4];
+    edgeLookup.lookup((type == Types::_4PLP), rawEdge[voice], gains);
+    for (int stage = 0; stage < 4; ++stage) {
+        voiceStageGain[stage][voice] = gains[stage];
+    }
+}
+
+inline void LadderFilterSimd::updateTaps(int voice)
+{
+    float taps[4];
+    if (type == Types::_4PLP) {
+        LadderFilter<float>::getSlopeTaps(slope[voice], taps);
+    } else {
+        for (int stage = 0; stage < 4; ++stage) {
+            taps[stage] = typeTaps[stage];
+        }
+    }
+    for (int stage = 0; stage < 4; ++stage) {
+        voiceStageTaps[stage][voice] = taps[stage];
+    }
+}
+
+inline void LadderFilterSimd::setNormalizedFc(__m128 fc)
+{
+    float input[numVoices];
+    _mm_storeu_ps(input, fc);
+    bool changed = false;
+    for (int voice = 0; voice < numVoices; ++voice) {
+        if (input[voice] != lastNormalizedFc[voice]) {
+            changed = true;
+            lastNormalizedFc[voice] = input[voice];
+            voiceG[voice] = getGfromNormFreq(input[voice]);
+            updateFilter(voice);
+            updateFeedback(voice);
+        }
+    }
+    if (changed) {
+        loadCoefficients();
+    }
+}
+
+inline void LadderFilterSimd::setFeedback(__m128 f)
+{
+    float input[numVoices];
+    _mm_storeu_ps(input, f);
+    bool changed = false;
+    for (int voice = 0; voice < numVoices; ++voice) {
+        if (input[voice] != requestedFeedback[voice]) {
+            changed = true;
+            requestedFeedback[voice] = input[voice];
+            updateFeedback(voice);
+        }
+    }
+    if (changed) {
+        adjustedFeedback = _mm_loadu_ps(voiceAdjustedFeedback);
+    }
+}
+
+inline void LadderFilterSimd::setEdge(__m128 e)
+{
+    float input[numVoices];
+    _mm_storeu_ps(input, e);
+    bool changed = false;
+    for (int voice = 0; voice < numVoices; ++voice) {
+        if (input[voice] != rawEdge[voice]) {
+            assert(input[voice] <= 1 && input[voice] >= 0);
+            changed = true;
+            rawEdge[voice] = input[voice];
+            updateStageGains(voice);
+        }
+    }
+    if (changed) {
+        loadCoefficients();
+    }
+}
+
+inline void LadderFilterSimd::setSlope(__m128 s)
+{
+    s = _mm_min_ps(s, _mm_set_ps1(3));
+    s = _mm_max_ps(s, _mm_setzero_ps());
+    float input[numVoices];
+    _mm_storeu_ps(input, s);
+    bool changed = false;
+    for (int voice = 0; voice < numVoices; ++voice) {
+        if (input[voice] != slope[voice]) {
+            changed = true;
+            slope[voice] = input[voice];
+            updateTaps(voice);
+        }
+    }
+    if (changed) {
+        loadCoefficients();
+    }
+}
+
+inline void LadderFilterSimd::setGain(__m128 g)
+{
+    gain = g;
+}
+
+inline void LadderFilterSimd::setBassMakeupGain(__m128 g)
+{
+    bassMakeupGain = g;
+}
+
+inline void LadderFilterSimd::setVolume(float vol)
+{
+    if (lastVolume == vol) {
+        return;
+    }
+    lastVolume = vol;
+    finalVolume = _mm_set_ps1(4 * vol * vol);
+}
+
+inline void LadderFilterSimd::setPolyphase(bool b)
+{
+    polyphase = b;
+}
+
+inline void LadderFilterSimd::setVoicing(Voicing v)
+{
+    voicing = v;
+}
+
+inline void LadderFilterSimd::setFreqSpread(float s)
+{
+    if (s == freqSpread) {
+        return;
+    }
+    freqSpread = s;
+
+    s *= .5;        // cut it down
+    assert(s <= 1 && s >= 0);
+
+    float s2 = s + 1;       // 1..2
+    AudioMath::distributeEvenly(stageFreqOffsets, 4, s2);
+
+    for (int voice = 0; voice < numVoices; ++voice) {
+        updateFilter(voice);
+    }
+    loadCoefficients();
+}
+
+inline void LadderFilterSimd::setType(Types t)
+{
+    if (t == type) {
+        return;
+    }
+    type = t;
+    LadderFilter<float>::getTypeTaps(type, typeTaps, bypassFirstStage);
+    for (int voice = 0; voice < numVoices; ++voice) {
+        updateFilter(voice);
+        updateTaps(voice);
+        updateStageGains(voice);         // many filter types turn off the edge
+    }
+    loadCoefficients();
+}
+
+inline float LadderFilterSimd::getLEDValue(int voice, int tapNumber) const
+{
+    assert(voice >= 0 && voice < numVoices);
+    return (type == Types::_4PLP) ? voiceStageTaps[tapNumber][voice] : 0;
+}
+
+inline __m128 LadderFilterSimd::getOutput() const
+{
+    return _mm_mul_ps(_mm_mul_ps(mixedOutput, _mm_set_ps1(5)), bassMakeupGain);
+}
+
+inline void LadderFilterSimd::run(__m128 input)
+{
+    input = _mm_mul_ps(input, gain);
+    __m128 buffer[oversampleRate];
+    if (polyphase) {
+        upPolyphase.process(buffer, input);
+    } else {
+        up.process(buffer, input);
+    }
+
+    switch (voicing) {
+        case Voicing::Classic:
+            runBuffer<Shape::Tanh, Shape::Tanh, Shape::Tanh, Shape::Tanh>(buffer);
+            break;
+        case Voicing::Clip2:
+            runBuffer<Shape::ClipTop, Shape::ClipBottom, Shape::ClipTop, Shape::ClipBottom>(buffer);
+            break;
+        case Voicing::Fold:
+            runBuffer<Shape::FoldAtten, Shape::Fold, Shape::Fold, Shape::Fold>(buffer);
+            break;
+        case Voicing::Fold2:
+            runBuffer<Shape::FoldTop, Shape::FoldBottom, Shape::FoldTop, Shape::FoldBottom>(buffer);
+            break;
+        case Voicing::Clean:
+            runBuffer<Shape::None, Shape::None, Shape::None, Shape::None>(buffer);
+            break;
+        default:
+            assert(false);
+    }
+    const __m128 output = polyphase ? downPolyphase.process(buffer) : down.process(buffer);
+    mixedOutput = _mm_mul_ps(output, finalVolume);
+}
+
+/**
+ * Same as the PROC_PREAMBLE / BODY / PROC_END macros in LadderFilter.
+ */
+template <LadderFilterSimd::Shape s0, LadderFilterSimd::Shape s1, LadderFilterSimd::Shape s2, LadderFilterSimd::Shape s3>
+inline void LadderFilterSimd::runBuffer(__m128* buffer)
+{
+    for (int i = 0; i < oversampleRate; ++i) {
+        __m128 temp = _mm_sub_ps(buffer[i], _mm_mul_ps(adjustedFeedback, stageOutputs[3]));
+        temp = _mm_max_ps(temp, _mm_set_ps1(-3));
+        temp = _mm_min_ps(temp, _mm_set_ps1(3));
+
+        for (int stage = 0; stage < 4; ++stage) {
+            temp = _mm_mul_ps(temp, stageGain[stage]);
+            switch (stage) {
+                case 0:
+                    temp = shape<s0>(temp);
+                    break;
+                case 1:
+                    temp = shape<s1>(temp);
+                    break;
+                case 2:
+                    temp = shape<s2>(temp);
+                    break;
+                case 3:
+                    temp = shape<s3>(temp);
+                    break;
+            }
+
+            // trapezoidal one pole lowpass
+            const __m128 t = _mm_mul_ps(_mm_sub_ps(temp, lpfState[stage]), stageG[stage]);
+            temp = _mm_add_ps(t, lpfState[stage]);
+            lpfState[stage] = _mm_add_ps(temp, t);
+            stageOutputs[stage] = temp;
+        }
+
+        temp = _mm_mul_ps(stageOutputs[0], stageTaps[0]);
+        for (int stage = 1; stage < 4; ++stage) {
+            temp = _mm_add_ps(temp, _mm_mul_ps(stageOutputs[stage], stageTaps[stage]));
+        }
+        temp = _mm_max_ps(temp, _mm_set_ps1(-1.7f));
+        temp = _mm_min_ps(temp, _mm_set_ps1(1.7f));
+        buffer[i] = temp;
+    }
+}
+
+template <LadderFilterSimd::Shape s>
+inline __m128 LadderFilterSimd::shape(__m128 x) const
+{
+    const __m128 one = _mm_set_ps1(1);
+    const __m128 zero = _mm_setzero_ps();
+    switch (s) {
+        case Shape::Tanh:
+            return _mm_mul_ps(_mm_set_ps1(2), lookupTanh(_mm_mul_ps(_mm_set_ps1(.5f), x)));
+        case Shape::ClipTop:
+            return _mm_min_ps(x, one);
+        case Shape::ClipBottom:
+            return _mm_max_ps(x, _mm_set_ps1(-1));
+        case Shape::Fold:
+            return fold(x);
+        case Shape::FoldAtten:
+            return fold(_mm_mul_ps(x, _mm_set_ps1(.5f)));
+        case Shape::FoldTop:
+        {
+            const __m128 mask = _mm_cmpgt_ps(x, zero);
+            return _mm_or_ps(_mm_and_ps(mask, fold(x)), _mm_andnot_ps(mask, x));
+        }
+        case Shape::FoldBottom:
+        {
+            const __m128 mask = _mm_cmplt_ps(x, zero);
+            return _mm_or_ps(_mm_and_ps(mask, fold(x)), _mm_andnot_ps(mask, x));
+        }
+        case Shape::None:
+            return x;
+    }
+    return x;
+}
+
+/**
+ * SSE version of AudioMath::fold.
+ */
+inline __m128 LadderFilterSimd::fold(__m128 x)
+{
+    const __m128 signBit = _mm_set_ps1(-0.f);
+    const __m128 bias = _mm_or_ps(_mm_and_ps(x, signBit), _mm_set_ps1(1));
+    const __m128i phase = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(x, bias), _mm_set_ps1(.5f)));
+
+    // move the low bit of phase up to the sign bit. Set for odd phase.
+    const __m128 isOdd = _mm_castsi128_ps(_mm_slli_epi32(phase, 31));
+    const __m128 folded = _mm_sub_ps(x, _mm_mul_ps(_mm_set_ps1(2), _mm_cvtepi32_ps(phase)));
+
+    // odd phases get inverted.
+    return _mm_xor_ps(folded, isOdd);
+}
+
+/**
+ * Four lookups into the tanh table. The interpolation is done in SSE,
+ * but the table entries are fetched one lane at a time.
+ */
+inline __m128 LadderFilterSimd::lookupTanh(__m128 x) const
+{
+    const LookupTableParams<float>& params = *tanhLookup;
+    x = _mm_min_ps(x, _mm_set_ps1(params.xMax));
+    x = _mm_max_ps(x, _mm_set_ps1(params.xMin));
+
+    const __m128 scaled = _mm_add_ps(_mm_mul_ps(x, _mm_set_ps1(params.a)), _mm_set_ps1(params.b));
+    const __m128i index = _mm_cvttps_epi32(scaled);
+    __m128 frac = _mm_sub_ps(scaled, _mm_cvtepi32_ps(index));
+    frac = _mm_max_ps(frac, _mm_setzero_ps());
+    frac = _mm_min_ps(frac, _mm_set_ps1(1));
+
+    int indices[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(indices), index);
+    float y[4];
+    float slope[4];
+    for (int i = 0; i < 4; ++i) {
+        const float* entry = params.entries + (2 * indices[i]);
+        y[i] = entry[0];
+        slope[i] = entry[1];
+    }
+    return _mm_add_ps(_mm_loadu_ps(y), _mm_mul_ps(frac, _mm_loadu_ps(slope)));
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "StateVariableFilter.h"
+#include "StateVariableFilterSimd.h"
 
 class StateVariable4PHP
 {
@@ -38,4 +39,45 @@ inline void StateVariable4PHP::setCutoff(float fc)
 {
     params1.setFreq(fc);
     params2.setFreq(fc);
-}
\ No newline at end of file
+}
+
+/**
+ * SSE version of StateVariable4PHP.
+ * Four independent four pole high-pass filters, one per lane.
+ */
+class StateVariable4PHPSimd
+{
+public:
+    StateVariable4PHPSimd();
+
+    __m128 run(__m128);
+    void setCutoff(__m128);
+private:
+    StateVariableFilterParamsSimd params1;
+    StateVariableFilterParamsSimd params2;
+
+    StateVariableFilterStateSimd state1;
+    StateVariableFilterStateSimd state2;
+};
+
+inline StateVariable4PHPSimd::StateVariable4PHPSimd()
+{
+    params1.setMode(StateVariableFilterParamsSimd::Mode::HiPass);
+    params1.setQ(.54119f);
+
+    params2.setMode(StateVariableFilterParamsSimd::Mode::HiPass);
+    params2.setQ(1.30656296f);
+}
+
+inline __m128 StateVariable4PHPSimd::run(__m128 input)
+{
+    __m128 output = StateVariableFilterSimd::run(input, state1, params1);
+    output = StateVariableFilterSimd::run(output, state2, params2);
+    return output;
+}
+
+inline void StateVariable4PHPSimd::setCutoff(__m128 fc)
+{
+    params1.setFreq(fc);
+    params2.setFreq(fc);
+}
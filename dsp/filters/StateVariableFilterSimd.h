@@ -0,0 +1,114 @@
+#pragma once
+
+#include "StateVariableFilter.h"
+
+#include <assert.h>
+#include <xmmintrin.h>
+
+class StateVariableFilterStateSimd;
+class StateVariableFilterParamsSimd;
+
+/**
+ * SSE version of StateVariableFilter.
+ * Runs four independent filters at once, one in each lane of an __m128.
+ * Each lane may have its own Fc and Q, but they all share the same mode.
+ *
+ * The math is exactly the same as the scalar StateVariableFilter<float>,
+ * including the clipping of the band-pass integrator.
+ */
+class StateVariableFilterSimd
+{
+public:
+    StateVariableFilterSimd() = delete;       // we are only static
+    static __m128 run(__m128 input, StateVariableFilterStateSimd& state, const StateVariableFilterParamsSimd& params);
+};
+
+class StateVariableFilterParamsSimd
+{
+public:
+    friend StateVariableFilterSimd;
+    using Mode = StateVariableFilterParams<float>::Mode;
+
+    /**
+     * Set the filter Q, same value in all four lanes.
+     * Values must be > .5
+     */
+    void setQ(float q)
+    {
+        if (q < .49) {
+            assert(false);
+            q = .6f;
+        }
+        qGain = _mm_set_ps1(1.f / q);
+    }
+
+    /**
+     * Set the center frequency, one per lane.
+     * units are 1 == sample rate
+     */
+    void setFreq(__m128 fc)
+    {
+        // Note that we are skipping the high freq warping.
+        // Going for speed over accuracy
+        fcGain = _mm_mul_ps(fc, _mm_set_ps1(float(AudioMath::Pi) * 2.f));
+    }
+
+    /**
+     * Normalized bandwidth is bw / fc, one per lane
+     * Also is 1 / Q
+     */
+    void setNormalizedBandwidth(__m128 bw)
+    {
+        qGain = bw;
+    }
+
+    void setMode(Mode m)
+    {
+        mode = m;
+    }
+private:
+    Mode mode = Mode::BandPass;
+    __m128 qGain = _mm_set_ps1(1.f);
+    __m128 fcGain = _mm_set_ps1(.001f);
+};
+
+class StateVariableFilterStateSimd
+{
+public:
+    __m128 z1 = _mm_setzero_ps();
+    __m128 z2 = _mm_setzero_ps();
+};
+
+inline __m128 StateVariableFilterSimd::run(__m128 input, StateVariableFilterStateSimd& state, const StateVariableFilterParamsSimd& params)
+{
+    const __m128 dLow = _mm_add_ps(state.z2, _mm_mul_ps(params.fcGain, state.z1));
+    const __m128 dHi = _mm_sub_ps(input, _mm_add_ps(_mm_mul_ps(state.z1, params.qGain), dLow));
+    __m128 dBand = _mm_add_ps(_mm_mul_ps(dHi, params.fcGain), state.z1);
+
+    // same clipping as the scalar version
+    dBand = _mm_min_ps(dBand, _mm_set_ps1(999.f));
+    dBand = _mm_max_ps(dBand, _mm_set_ps1(-999.f));
+
+    __m128 d;
+    switch (params.mode) {
+        case StateVariableFilterParamsSimd::Mode::LowPass:
+            d = dLow;
+            break;
+        case StateVariableFilterParamsSimd::Mode::HiPass:
+            d = dHi;
+            break;
+        case StateVariableFilterParamsSimd::Mode::BandPass:
+            d = dBand;
+            break;
+        case StateVariableFilterParamsSimd::Mode::Notch:
+            d = _mm_add_ps(dLow, dHi);
+            break;
+        default:
+            assert(false);
+            d = _mm_setzero_ps();
+    }
+
+    state.z1 = dBand;
+    state.z2 = dLow;
+    return d;
+}
@@ -0,0 +1,392 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "LookupTableFactory.h"
+#include "ObjectCache.h"
+
+#include <assert.h>
+#include <emmintrin.h>
+#include <memory>
+#include <xmmintrin.h>
+
+/**
+ * SSE version of MinBLEPVCO.
+ * Runs four oscillators at once, one in each lane. Every lane has its own
+ * frequency and pulse width. The waveform is shared by all the lanes.
+ *
+ * All the oscillators use the same minBLEP table, from ObjectCache.
+ * Each one has a single buffer of band limited step residuals, four lanes wide.
+ * Steps are only inserted on samples where some lane has an edge, and they are
+ * masked off in the lanes that don't.
+ *
+ * Hard sync is done without callbacks: after step(), getSync() tells
+ * which lanes started a new cycle, and when. Pass that to step(sync)
+ * on the oscillators that are synced to this one.
+ *
+ * The waveforms, and the output level, are the same as MinBLEPVCO.
+ */
+class MinBLEPVCOSimd
+{
+public:
+    enum class Waveform
+    {
+        Sin, Tri, Saw, Square, Even, END
+    };
+
+    /**
+     * Which lanes started a new cycle.
+     * mask is all ones in those lanes.
+     * crossing is when, -1..0 relative to the current sample, like minBLEP.
+     */
+    class Sync
+    {
+    public:
+        __m128 mask;
+        __m128 crossing;
+    };
+
+    MinBLEPVCOSimd();
+
+    /**
+     * Free running.
+     */
+    void step();
+
+    /**
+     * Reset to the start of the cycle in every lane where sync.mask is set.
+     */
+    void step(const Sync& sync);
+
+    __m128 getOutput() const
+    {
+        return output;
+    }
+
+    /**
+     * Where this oscillator started a new cycle on the last step.
+     */
+    const Sync& getSync() const
+    {
+        return syncOut;
+    }
+
+    /**
+     * f is freq / sample rate. st is the sample time.
+     */
+    void setNormalizedFreq(__m128 f, float st);
+
+    void setWaveform(Waveform wf)
+    {
+        waveform = wf;
+    }
+
+    /**
+     * 0..1. Square wave only.
+     */
+    void setPulseWidth(__m128 pw)
+    {
+        pulseWidth = pw;
+    }
+
+    /**
+     * Like MinBLEPVCO, the triangle can't be synced, so
+     * it switches to sine when sync is enabled.
+     */
+    void setSyncEnabled(bool f)
+    {
+        syncEnabled = f;
+    }
+
+private:
+    static const int bufferSize = 32;
+
+    std::shared_ptr<LookupTableParams<float>> minBLEP = ObjectCache<float>::getMinBLEP();
+    std::shared_ptr<LookupTableParams<float>> sinLookup = ObjectCache<float>::getSinLookup();
+
+    Waveform waveform = Waveform::Saw;
+    bool syncEnabled = false;
+
+    __m128 phase;
+    __m128 freq;
+    __m128 invFreq;
+    __m128 pulseWidth;
+    __m128 tri;
+    __m128 triLeak;
+    __m128 lastSqHigh;
+    __m128 output;
+    Sync syncOut;
+
+    /**
+     * Residuals of the band limited steps.
+     * Ring buffer, starting at bufferPos.
+     */
+    __m128 buffer[bufferSize];
+    int bufferPos = 0;
+
+    void stepSaw(const Sync&);
+    void stepSquare(const Sync&);
+    void stepSin(const Sync&);
+    void stepTri();
+    void stepEven(const Sync&);
+
+    /**
+     * Adds a band limited step of size jump to every lane in mask.
+     * Crossing is when, -1..0 relative to the current sample.
+     */
+    void insertStep(__m128 mask, __m128 crossing, __m128 jump);
+
+    /**
+     * Takes the residual for the current sample out of the buffer.
+     */
+    __m128 nextStep();
+
+    __m128 sineLook(__m128 phase) const;
+    __m128 evenLook(__m128 phase) const;
+
+    static __m128 select(__m128 mask, __m128 a, __m128 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+};
+
+inline MinBLEPVCOSimd::MinBLEPVCOSimd()
+{
+    assert(bufferSize == 2 * LookupTableFactory<float>::minBLEPZeroCrossings());
+    phase = _mm_setzero_ps();
+    pulseWidth = _mm_set_ps1(.5f);
+    tri = _mm_setzero_ps();
+    lastSqHigh = _mm_setzero_ps();
+    output = _mm_setzero_ps();
+    syncOut.mask = _mm_setzero_ps();
+    syncOut.crossing = _mm_setzero_ps();
+    for (int i = 0; i < bufferSize; ++i) {
+        buffer[i] = _mm_setzero_ps();
+    }
+    setNormalizedFreq(_mm_set_ps1(1e-6f), 1.f / 44100.f);
+}
+
+inline void MinBLEPVCOSimd::setNormalizedFreq(__m128 f, float st)
+{
+    freq = _mm_min_ps(_mm_max_ps(f, _mm_set_ps1(1e-6f)), _mm_set_ps1(.5f));
+    invFreq = _mm_div_ps(_mm_set_ps1(1), freq);
+    triLeak = _mm_set_ps1(1.f - 40.f * st);
+}
+
+inline void MinBLEPVCOSimd::step()
+{
+    Sync noSync;
+    noSync.mask = _mm_setzero_ps();
+    noSync.crossing = _mm_setzero_ps();
+    step(noSync);
+}
+
+inline void MinBLEPVCOSimd::step(const Sync& sync)
+{
+    switch (waveform) {
+        case Waveform::Saw:
+            stepSaw(sync);
+            break;
+        case Waveform::Square:
+            stepSquare(sync);
+            break;
+        case Waveform::Sin:
+            stepSin(sync);
+            break;
+        case Waveform::Tri:
+            if (syncEnabled) {
+                stepSin(sync);
+            } else {
+                stepTri();
+            }
+            break;
+        case Waveform::Even:
+            stepEven(sync);
+            break;
+        case Waveform::END:
+            output = _mm_setzero_ps();
+            syncOut.mask = _mm_setzero_ps();
+            break;
+        default:
+            assert(false);
+    }
+}
+
+inline void MinBLEPVCOSimd::insertStep(__m128 mask, __m128 crossing, __m128 jump)
+{
+    if (!_mm_movemask_ps(mask)) {
+        return;
+    }
+    jump = _mm_and_ps(mask, jump);
+
+    // rounding can put the crossing a little outside -1..0
+    crossing = _mm_max_ps(crossing, _mm_set_ps1(-1));
+    crossing = _mm_and_ps(mask, _mm_min_ps(crossing, _mm_setzero_ps()));
+
+    const LookupTableParams<float>& table = *minBLEP;
+    const __m128 oversample = _mm_set_ps1(float(LookupTableFactory<float>::minBLEPOversample()));
+    const __m128 one = _mm_set_ps1(1);
+    __m128 index = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), crossing), oversample);
+    for (int i = 0; i < bufferSize; ++i) {
+        const __m128 step = LookupTable<float>::lookup4(table, index);
+        __m128& x = buffer[(bufferPos + i) & (bufferSize - 1)];
+        x = _mm_add_ps(x, _mm_mul_ps(jump, _mm_sub_ps(step, one)));
+        index = _mm_add_ps(index, oversample);
+    }
+}
+
+inline __m128 MinBLEPVCOSimd::nextStep()
+{
+    const __m128 ret = buffer[bufferPos];
+    buffer[bufferPos] = _mm_setzero_ps();
+    bufferPos = (bufferPos + 1) & (bufferSize - 1);
+    return ret;
+}
+
+inline __m128 MinBLEPVCOSimd::sineLook(__m128 x) const
+{
+    // want -cosine, but only have sine lookup
+    __m128 adjPhase = _mm_add_ps(x, _mm_set_ps1(.25f));
+    adjPhase = _mm_sub_ps(adjPhase, _mm_and_ps(_mm_cmpge_ps(adjPhase, _mm_set_ps1(1)), _mm_set_ps1(1)));
+    return _mm_sub_ps(_mm_setzero_ps(), LookupTable<float>::lookup4(*sinLookup, adjPhase));
+}
+
+inline __m128 MinBLEPVCOSimd::evenLook(__m128 x) const
+{
+    const __m128 half = _mm_set_ps1(.5f);
+    const __m128 upper = _mm_and_ps(_mm_cmpge_ps(x, half), half);
+    const __m128 doubleSaw = _mm_sub_ps(_mm_mul_ps(_mm_set_ps1(4), _mm_sub_ps(x, upper)), _mm_set_ps1(1));
+    const __m128 sine = _mm_mul_ps(_mm_set_ps1(1.27f), sineLook(x));
+    return _mm_mul_ps(_mm_set_ps1(.55f), _mm_add_ps(doubleSaw, sine));
+}
+
+inline void MinBLEPVCOSimd::stepSaw(const Sync& sync)
+{
+    const __m128 one = _mm_set_ps1(1);
+    const __m128 predictedPhase = _mm_add_ps(phase, freq);
+
+    // on sync, reset to the phase we would have reached since the crossing
+    const __m128 excess = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sync.crossing), freq);
+    __m128 newPhase = select(sync.mask, excess, predictedPhase);
+    const __m128 wrap = _mm_cmpge_ps(newPhase, one);
+    newPhase = _mm_sub_ps(newPhase, _mm_and_ps(wrap, one));
+
+    const __m128 edge = _mm_or_ps(sync.mask, wrap);
+    const __m128 crossing = select(sync.mask, sync.crossing,
+        _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), newPhase), invFreq));
+    const __m128 jump = _mm_mul_ps(_mm_set_ps1(2), _mm_sub_ps(newPhase, predictedPhase));
+    insertStep(edge, crossing, jump);
+    syncOut.mask = edge;
+    syncOut.crossing = crossing;
+    phase = newPhase;
+
+    const __m128 saw = _mm_add_ps(_mm_sub_ps(_mm_add_ps(phase, phase), one), nextStep());
+    output = _mm_mul_ps(_mm_set_ps1(5), saw);
+}
+
+inline void MinBLEPVCOSimd::stepSquare(const Sync& sync)
+{
+    const __m128 one = _mm_set_ps1(1);
+    const __m128 excess = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sync.crossing), freq);
+    __m128 newPhase = select(sync.mask, excess, _mm_add_ps(phase, freq));
+    const __m128 overflow = _mm_cmpgt_ps(newPhase, one);
+    newPhase = _mm_sub_ps(newPhase, _mm_and_ps(overflow, one));
+
+    const __m128 high = _mm_cmpge_ps(newPhase, pulseWidth);
+    const __m128 changed = _mm_xor_ps(high, lastSqHigh);
+    lastSqHigh = high;
+
+    // the edge is from sync, from the end of the cycle, or from the pulse width
+    const __m128 wrapCrossing = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), newPhase), invFreq);
+    const __m128 pwCrossing = _mm_mul_ps(_mm_sub_ps(pulseWidth, newPhase), invFreq);
+    const __m128 crossing = select(sync.mask, sync.crossing, select(overflow, wrapCrossing, pwCrossing));
+    const __m128 jump = select(high, _mm_set_ps1(2), _mm_set_ps1(-2));
+    insertStep(changed, crossing, jump);
+    syncOut.mask = _mm_or_ps(sync.mask, overflow);
+    syncOut.crossing = select(sync.mask, sync.crossing, wrapCrossing);
+    phase = newPhase;
+
+    const __m128 square = _mm_add_ps(select(high, one, _mm_set_ps1(-1)), nextStep());
+    output = _mm_mul_ps(_mm_set_ps1(5), square);
+}
+
+inline void MinBLEPVCOSimd::stepSin(const Sync& sync)
+{
+    const __m128 one = _mm_set_ps1(1);
+    __m128 advanced = _mm_add_ps(phase, freq);
+    const __m128 wrap = _mm_andnot_ps(sync.mask, _mm_cmpge_ps(advanced, one));
+    advanced = _mm_sub_ps(advanced, _mm_and_ps(wrap, one));
+
+    __m128 newPhase = advanced;
+    if (_mm_movemask_ps(sync.mask)) {
+        // synced lanes go to the middle of the cycle, where the slope matches
+        const __m128 excess = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sync.crossing), freq);
+        const __m128 synced = _mm_add_ps(_mm_set_ps1(.5f), excess);
+        const __m128 jump = _mm_sub_ps(sineLook(synced), sineLook(phase));
+        insertStep(sync.mask, sync.crossing, jump);
+        newPhase = select(sync.mask, synced, advanced);
+    }
+    syncOut.mask = wrap;
+    syncOut.crossing = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), newPhase), invFreq);
+    phase = newPhase;
+
+    output = _mm_mul_ps(_mm_set_ps1(5), _mm_add_ps(sineLook(phase), nextStep()));
+}
+
+inline void MinBLEPVCOSimd::stepTri()
+{
+    const __m128 one = _mm_set_ps1(1);
+    const __m128 half = _mm_set_ps1(.5f);
+    __m128 newPhase = _mm_add_ps(phase, freq);
+    const __m128 halfWay = _mm_and_ps(_mm_cmplt_ps(phase, half), _mm_cmpge_ps(newPhase, half));
+    const __m128 wrap = _mm_cmpge_ps(newPhase, one);
+    newPhase = _mm_sub_ps(newPhase, _mm_and_ps(wrap, one));
+
+    // integrate a square wave
+    const __m128 wrapCrossing = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), newPhase), invFreq);
+    const __m128 halfCrossing = _mm_mul_ps(_mm_sub_ps(half, newPhase), invFreq);
+    const __m128 crossing = select(wrap, wrapCrossing, halfCrossing);
+    insertStep(_mm_or_ps(wrap, halfWay), crossing, select(wrap, _mm_set_ps1(-2), _mm_set_ps1(2)));
+    syncOut.mask = wrap;
+    syncOut.crossing = wrapCrossing;
+    phase = newPhase;
+
+    __m128 triSquare = select(_mm_cmplt_ps(phase, half), _mm_set_ps1(-1), one);
+    triSquare = _mm_add_ps(triSquare, nextStep());
+    tri = _mm_add_ps(tri, _mm_mul_ps(_mm_mul_ps(_mm_set_ps1(4), triSquare), freq));
+    tri = _mm_mul_ps(tri, triLeak);
+    output = _mm_mul_ps(_mm_set_ps1(5), tri);
+}
+
+inline void MinBLEPVCOSimd::stepEven(const Sync& sync)
+{
+    const __m128 one = _mm_set_ps1(1);
+    const __m128 half = _mm_set_ps1(.5f);
+    __m128 advanced = _mm_add_ps(phase, freq);
+    const __m128 halfWay = _mm_andnot_ps(sync.mask,
+        _mm_and_ps(_mm_cmplt_ps(phase, half), _mm_cmpge_ps(advanced, half)));
+    const __m128 advancedWrap = _mm_cmpge_ps(advanced, one);
+    advanced = _mm_sub_ps(advanced, _mm_and_ps(advancedWrap, one));
+    const __m128 wrap = _mm_andnot_ps(sync.mask, advancedWrap);
+
+    // the edges of the double saw are .55 high, after mixing with the sine
+    const __m128 wrapCrossing = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), advanced), invFreq);
+    const __m128 halfCrossing = _mm_mul_ps(_mm_sub_ps(half, advanced), invFreq);
+    __m128 crossing = select(wrap, wrapCrossing, halfCrossing);
+    __m128 jump = _mm_set_ps1(-2 * .55f);
+
+    __m128 newPhase = advanced;
+    if (_mm_movemask_ps(sync.mask)) {
+        const __m128 excess = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sync.crossing), freq);
+        __m128 synced = _mm_add_ps(half, excess);
+        synced = _mm_sub_ps(synced, _mm_and_ps(_mm_cmpge_ps(synced, one), one));
+        jump = select(sync.mask, _mm_sub_ps(evenLook(synced), evenLook(advanced)), jump);
+        crossing = select(sync.mask, sync.crossing, crossing);
+        newPhase = select(sync.mask, synced, advanced);
+    }
+    insertStep(_mm_or_ps(sync.mask, _mm_or_ps(wrap, halfWay)), crossing, jump);
+    syncOut.mask = _mm_or_ps(sync.mask, wrap);
+    syncOut.crossing = select(sync.mask, sync.crossing, wrapCrossing);
+    phase = newPhase;
+
+    output = _mm_mul_ps(_mm_set_ps1(5), _mm_add_ps(evenLook(phase), nextStep()));
+}
@@ -38,6 +38,13 @@ void kiss_fftri(kiss_fftr_cfg cfg,const kiss_fft_cpx *freqdata,kiss_fft_scalar *
  output timedata has nfft scalar points
 */
 
+/*
+ Same as kiss_fftr and kiss_fftri, but use the caller's tmpbuf (nfft/2 complex points)
+ instead of the one in cfg. So cfg is not modified, and may be used by several threads at once.
+ */
+void kiss_fftr_scratch(kiss_fftr_cfg cfg,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata,kiss_fft_cpx *tmpbuf);
+void kiss_fftri_scratch(kiss_fftr_cfg cfg,const kiss_fft_cpx *freqdata,kiss_fft_scalar *timedata,kiss_fft_cpx *tmpbuf);
+
 #define kiss_fftr_free free
 
 #ifdef __cplusplus
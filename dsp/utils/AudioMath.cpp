@@ -110,19 +110,20 @@ AudioMath::SimpleScaleFun<float> AudioMath::makeSimpleScalerAudioTaper(float y0,
     };
 }
 
-// TODO: move this to audio math
 AudioMath::RandomUniformFunc AudioMath::random()
 {
-    return []() {
-        static std::default_random_engine generator{57};
-        static std::uniform_real_distribution<float> distribution{0, 1.0};
+    // every function gets its own generator, with its own seed
+    static std::atomic<unsigned> nextSeed(57);
+    std::default_random_engine generator{nextSeed++};
+    std::uniform_real_distribution<float> distribution{0, 1.0};
+    return [generator, distribution]() mutable {
         return  distribution(generator);
     };
 }
 
 
  // declare some test variables here
-int _numLookupParams = 0;
+std::atomic<int> _numLookupParams(0);
 int _numBiquads = 0;
 
 
@@ -150,6 +150,9 @@ public:
 
     /**
      * A random number generator function. uniform random 0..1
+     * Each call to random() makes a new generator, with a different seed,
+     * so different clients may use theirs on different threads.
+     * For the audio thread, RandomSimd is much faster.
      */
     using RandomUniformFunc = std::function<float(void)>;
 
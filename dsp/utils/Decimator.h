@@ -39,6 +39,20 @@ public:
         phaseAccumulator = rate;
     }
 
+    /**
+     * Like setDecimationRate, but keeps our place in the
+     * current period, so the rate may be modulated.
+     */
+    void changeDecimationRate(float r)
+    {
+        if (rate > 0) {
+            phaseAccumulator *= r / rate;
+        } else {
+            phaseAccumulator = r;
+        }
+        rate = r;
+    }
+
 private:
     float rate=0;
     float memory=0;
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "LookupTableFactory.h"
+#include "ObjectCache.h"
+
+#include <emmintrin.h>
+#include <memory>
+#include <xmmintrin.h>
+
+/**
+ * SSE version of ObjectCache::getExp2Ex.
+ * Looks up 2 ** x for four lanes at once, from the same two tables,
+ * without going through a std::function.
+ */
+class Exp2Simd
+{
+public:
+    __m128 lookup(__m128 x) const
+    {
+        const __m128 xDivide = _mm_set_ps1(float(LookupTableFactory<float>::exp2ExHighXMin()));
+        const __m128 lowValue = LookupTable<float>::lookup4(*low, x);
+        const __m128 highValue = LookupTable<float>::lookup4(*high, x);
+        const __m128 isLow = _mm_cmplt_ps(x, xDivide);
+        return _mm_or_ps(_mm_and_ps(isLow, lowValue), _mm_andnot_ps(isLow, highValue));
+    }
+
+private:
+    std::shared_ptr<LookupTableParams<float>> low = ObjectCache<float>::getExp2ExtendedLow();
+    std::shared_ptr<LookupTableParams<float>> high = ObjectCache<float>::getExp2ExtendedHigh();
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "HalfBandFilter.h"
+
+/**
+ * A polyphase decimator, made from a cascade of half band FIR filters.
+ * Same interface as IIRDecimator, so either one may be used.
+ *
+ * Each stage decimates by two. The last stage (down to the final rate)
+ * has the sharpest filter, since it is the only one that has to cut
+ * right above the audio band. The stages before it have lots of room,
+ * so they are much cheaper. Every stage rejects about 80 db.
+ *
+ * Compared to IIRDecimator, which filters every oversampled sample with
+ * a six pole Butterworth that starts rolling off at 1/4 of the final
+ * sample rate, this has a flat pass band up to 45% of the final sample
+ * rate (20k at 44.1k), much more stop band rejection, and linear phase.
+ * In exchange it has about 30 samples of latency (at the final rate),
+ * where the IIR has a few.
+ *
+ * T is float, or __m128 to decimate four channels at once.
+ * Oversample factor may be 1, 2, 4, 8, or 16.
+ */
+template <typename T>
+class HalfBandDecimatorT
+{
+public:
+    static const int maxOversample = 16;
+
+    void setup(int oversampleFactor)
+    {
+        assert(oversampleFactor == 1 || oversampleFactor == 2 || oversampleFactor == 4 ||
+            oversampleFactor == 8 || oversampleFactor == 16);
+        oversample = oversampleFactor;
+    }
+
+    /**
+     * Down-sample a buffer of data.
+     * input is an array, the size is our oversampling factor.
+     *
+     * return value is a single sample
+     */
+    T process(const T* input)
+    {
+        // Each stage works in place on buffer, except the first,
+        // which reads straight from the input.
+        const T* source = input;
+        switch (oversample) {
+            case 16:
+                stage16.process(buffer, source, 8);
+                source = buffer;
+                // fall through
+            case 8:
+                stage8.process(buffer, source, 4);
+                source = buffer;
+                // fall through
+            case 4:
+                stage4.process(buffer, source, 2);
+                source = buffer;
+                // fall through
+            case 2:
+                stage2.process(buffer, source, 1);
+                break;
+            default:
+                return input[0];
+        }
+        return buffer[0];
+    }
+
+private:
+    int oversample = 1;
+
+    // named for the rate they take as input
+    HalfBandDecimatorStage<T, 28> stage2;
+    HalfBandDecimatorStage<T, 6> stage4;
+    HalfBandDecimatorStage<T, 5> stage8;
+    HalfBandDecimatorStage<T, 4> stage16;
+
+    T buffer[maxOversample / 2];
+};
+
+using HalfBandDecimator = HalfBandDecimatorT<float>;
+
+/**
+ * SSE version of HalfBandDecimator.
+ * Decimates four independent channels at once, one per lane.
+ */
+using HalfBandDecimatorSimd = HalfBandDecimatorT<__m128>;
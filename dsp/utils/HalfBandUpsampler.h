@@ -0,0 +1,79 @@
+#pragma once
+
+#include "HalfBandFilter.h"
+
+/**
+ * Inverse of the HalfBandDecimator.
+ * Same interface as IIRUpsampler, so either one may be used.
+ *
+ * Up-samples by two at a time, through a cascade of half band FIR filters.
+ * The first stage (up from the original rate) has the sharpest filter,
+ * the later ones have lots of room, so they are much cheaper.
+ *
+ * T is float, or __m128 to up-sample four channels at once.
+ * Oversample factor may be 1, 2, 4, 8, or 16.
+ */
+template <typename T>
+class HalfBandUpsamplerT
+{
+public:
+    static const int maxOversample = 16;
+
+    void setup(int oversampleFactor)
+    {
+        assert(oversampleFactor == 1 || oversampleFactor == 2 || oversampleFactor == 4 ||
+            oversampleFactor == 8 || oversampleFactor == 16);
+        oversample = oversampleFactor;
+    }
+
+    /**
+     * processes one sample of input. Output is a buffer of data at the
+     * higher sample rate. Buffer size is just the oversample amount.
+     */
+    void process(T* outputBuffer, T input)
+    {
+        // Stages can't work in place, so ping-pong between the
+        // output and scratch, arranged so the last stage writes the output.
+        switch (oversample) {
+            case 16:
+                stage1.process(scratch, &input, 1);
+                stage2.process(outputBuffer, scratch, 2);
+                stage4.process(scratch, outputBuffer, 4);
+                stage8.process(outputBuffer, scratch, 8);
+                break;
+            case 8:
+                stage1.process(outputBuffer, &input, 1);
+                stage2.process(scratch, outputBuffer, 2);
+                stage4.process(outputBuffer, scratch, 4);
+                break;
+            case 4:
+                stage1.process(scratch, &input, 1);
+                stage2.process(outputBuffer, scratch, 2);
+                break;
+            case 2:
+                stage1.process(outputBuffer, &input, 1);
+                break;
+            default:
+                outputBuffer[0] = input;
+        }
+    }
+
+private:
+    int oversample = 1;
+
+    // named for the rate they take as input
+    HalfBandUpsamplerStage<T, 28> stage1;
+    HalfBandUpsamplerStage<T, 6> stage2;
+    HalfBandUpsamplerStage<T, 5> stage4;
+    HalfBandUpsamplerStage<T, 4> stage8;
+
+    T scratch[maxOversample / 2];
+};
+
+using HalfBandUpsampler = HalfBandUpsamplerT<float>;
+
+/**
+ * SSE version of HalfBandUpsampler.
+ * Up-samples four independent channels at once, one per lane.
+ */
+using HalfBandUpsamplerSimd = HalfBandUpsamplerT<__m128>;
@@ -3,6 +3,7 @@
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "BiquadFilter.h"
+#include "BiquadFilterSimd.h"
 #include "ObjectCache.h"
 
 /**
@@ -36,17 +37,13 @@ public:
      */
     float process(const float * input)
     {
-        float x = 0;
-        for (int i = 0; i < oversample; ++i) {
-            // The key here is to filter out all the frequencies that will
-            // be higher than the destination Nyquist frequency.
-            x = BiquadFilter<float>::run(input[i], state, *params);
-        }
+        // The key here is to filter out all the frequencies that will
+        // be higher than the destination Nyquist frequency.
         // Note that we return just the last sample, and ignore the others.
         // Decimator is supposed to only keep one out of 'n' samples. We could 
         // average them all, but that would just apply a little undesired high
         // frequency roll-off.
-        return x;
+        return BiquadFilter<float>::runBlock(input, nullptr, oversample, state, *params);
     }
 
 private:
@@ -61,4 +58,40 @@ private:
      */
     std::shared_ptr<BiquadParams<float, 3>> params;
     BiquadState<float, 3> state;
-};
\ No newline at end of file
+};
+
+/**
+ * SSE version of IIRDecimator.
+ * Decimates four independent channels at once, one per lane.
+ * All four channels share the same filter, so they must
+ * all use the same oversample factor.
+ */
+class IIRDecimatorSimd
+{
+public:
+    void setup(int oversampleFactor)
+    {
+        if (oversampleFactor != oversample) {
+            oversample = oversampleFactor;
+            params = ObjectCache<float>::get6PLPParams(1.f / (4.0f * oversample));
+        }
+    }
+
+    /**
+     * Down-sample a buffer of data.
+     * input is an array of __m128, the size is our oversampling factor.
+     *
+     * return value is a single sample for each lane.
+     */
+    __m128 process(const __m128 * input)
+    {
+        // As with the scalar version, keep only the last sample
+        return BiquadFilterSimd::runBlock(input, nullptr, oversample, state, *params);
+    }
+
+private:
+    int oversample = -1;
+
+    std::shared_ptr<BiquadParams<float, 3>> params;
+    BiquadStateSimd<3> state;
+};
@@ -3,6 +3,7 @@
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "BiquadFilter.h"
+#include "BiquadFilterSimd.h"
 #include "ObjectCache.h"
 
 /**
@@ -39,12 +40,11 @@ public:
     {
         // The zero packing reduced the overall volume. To preserve the volume,
         // multiply be the reduction amount, which is oversample.
-        input *= oversample;
-
-        for (int i = 0; i < oversample; ++i) {
-            outputBuffer[i] = BiquadFilter<float>::run(input, state, *params);
-            input = 0;      // just filter a delta - don't average the whole signal (i.e. zero pack)
+        outputBuffer[0] = input * oversample;
+        for (int i = 1; i < oversample; ++i) {
+            outputBuffer[i] = 0;      // just filter a delta - don't average the whole signal (i.e. zero pack)
         }
+        BiquadFilter<float>::runBlock(outputBuffer, outputBuffer, oversample, state, *params);
     }
 
 private:
@@ -52,4 +52,38 @@ private:
 
     std::shared_ptr<BiquadParams<float, 3>> params;
     BiquadState<float, 3> state;
-};
\ No newline at end of file
+};
+
+/**
+ * SSE version of IIRUpsampler.
+ * Up-samples four independent channels at once, one per lane.
+ */
+class IIRUpsamplerSimd
+{
+public:
+    void setup(int oversampleFactor)
+    {
+        oversample = oversampleFactor;
+        params = ObjectCache<float>::get6PLPParams(1.f / (4.0f * oversample));
+    }
+
+    /**
+     * processes one sample of input for each lane. Output is a buffer of
+     * data at the higher sample rate. Buffer size is just the oversample amount.
+     * Uses the same zero packing as the scalar version.
+     */
+    void process(__m128 * outputBuffer, __m128 input)
+    {
+        outputBuffer[0] = _mm_mul_ps(input, _mm_set_ps1(float(oversample)));
+        for (int i = 1; i < oversample; ++i) {
+            outputBuffer[i] = _mm_setzero_ps();
+        }
+        BiquadFilterSimd::runBlock(outputBuffer, outputBuffer, oversample, state, *params);
+    }
+
+private:
+    int oversample = 16;
+
+    std::shared_ptr<BiquadParams<float, 3>> params;
+    BiquadStateSimd<3> state;
+};
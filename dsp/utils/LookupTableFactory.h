@@ -1,8 +1,11 @@
 #pragma once
 
+#include "FFT.h"
 #include "LookupTable.h"
 #include "SqMath.h"
 
+#include <vector>
+
 #ifndef _CLAMP
 #define _CLAMP
 namespace std {
@@ -101,6 +104,42 @@ public:
     {
         return  std::log2(exp2ExHighYMax());
     }
+
+    /**
+     * Band limited step, for MinBLEP oscillators. Same as Rack's minBlepImpulse:
+     * a windowed sinc, made minimum phase, then integrated.
+     * domain (x) = 0 .. 2 * minBLEPZeroCrossings() * minBLEPOversample()
+     * range goes from 0 to exactly 1 at the end.
+     */
+    static void makeMinBLEP(LookupTableParams<T>& params);
+    static int minBLEPZeroCrossings()
+    {
+        return 16;
+    }
+    static int minBLEPOversample()
+    {
+        return 32;
+    }
+
+    /**
+     * Inverse of the normal (Gaussian) CDF, for turning uniform random
+     * numbers into normal ones.
+     * domain (x) = normalInverseXMin() .. 1 - normalInverseXMin()
+     * range is about -3.5 .. 3.5. Inputs outside the domain get limited,
+     * so the tails are cut off there.
+     */
+    static void makeNormalInverse(LookupTableParams<T>& params);
+    static double normalInverseXMin()
+    {
+        return 1.0 / 4096;
+    }
+
+    /**
+     * The exact function that makeNormalInverse approximates.
+     * p is 0..1, exclusive. From Peter Acklam's algorithm, which is
+     * good to about 1e-9.
+     */
+    static double normalInverse(double p);
 };
 
 static inline float _PanL(float balance, float cv)
@@ -214,4 +253,99 @@ inline void LookupTableFactory<T>::makeAudioTaper(LookupTableParams<T>& params,
         return audioTaper(x);
         });
 
-}
\ No newline at end of file
+}
+template<typename T>
+inline void LookupTableFactory<T>::makeMinBLEP(LookupTableParams<T>& params)
+{
+    const int z = minBLEPZeroCrossings();
+    const int n = 2 * z * minBLEPOversample();
+
+    // sinc with z zero crossings on each side, Blackman-Harris window
+    FFTDataReal x(n);
+    for (int i = 0; i < n; ++i) {
+        const double p = -z + 2.0 * z * i / (n - 1);
+        const double sinc = (p == 0) ? 1 : std::sin(AudioMath::Pi * p) / (AudioMath::Pi * p);
+        const double w = 2 * AudioMath::Pi * i / (n - 1);
+        const double window = .35875 - .48829 * std::cos(w) + .14128 * std::cos(2 * w) - .01168 * std::cos(3 * w);
+        x.set(i, float(sinc * window));
+    }
+
+    // Real cepstrum. The FFT scaling only changes the overall gain,
+    // which gets normalized out at the end.
+    FFTDataCpx spectrum(n);
+    FFT::forward(&spectrum, x);
+    for (int i = 0; i <= n / 2; ++i) {
+        spectrum.set(i, std::log(std::max(std::abs(spectrum.get(i)), 1e-30f)));
+    }
+    FFTDataReal cepstrum(n);
+    FFT::inverse(&cepstrum, spectrum);
+
+    // fold to make it minimum phase
+    for (int i = 1; i < n / 2; ++i) {
+        cepstrum.set(i, 2 * cepstrum.get(i));
+    }
+    for (int i = n / 2 + 1; i < n; ++i) {
+        cepstrum.set(i, 0);
+    }
+    FFT::forward(&spectrum, cepstrum);
+    for (int i = 0; i <= n / 2; ++i) {
+        spectrum.set(i, std::exp(spectrum.get(i)));
+    }
+    FFT::inverse(&x, spectrum);
+
+    // integrate to get the step, and normalize so it ends at one
+    std::vector<T> step(n + 1);
+    double total = 0;
+    for (int i = 0; i < n; ++i) {
+        total += x.get(i);
+        step[i] = T(total);
+    }
+    for (int i = 0; i < n; ++i) {
+        step[i] = T(step[i] / total);
+    }
+    step[n] = 1;
+    LookupTable<T>::initDiscrete(params, n + 1, step.data());
+}
+
+template<typename T>
+inline void LookupTableFactory<T>::makeNormalInverse(LookupTableParams<T>& params)
+{
+    const int bins = 2048;
+    const T xMin = T(normalInverseXMin());
+    const T xMax = T(1 - normalInverseXMin());
+    LookupTable<T>::init(params, bins, xMin, xMax, [](double x) {
+        // init looks one bin past the end
+        x = std::max(x, normalInverseXMin());
+        x = std::min(x, 1 - normalInverseXMin());
+        return normalInverse(x);
+        });
+}
+
+template<typename T>
+inline double LookupTableFactory<T>::normalInverse(double p)
+{
+    assert(p > 0 && p < 1);
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+        1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+        6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+        -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+        3.754408661907416e+00};
+    const double pLow = .02425;
+
+    if (p < pLow || p > 1 - pLow) {
+        // rational approximation for the tails
+        const double q = std::sqrt(-2 * std::log(std::min(p, 1 - p)));
+        const double x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+        return (p < pLow) ? x : -x;
+    }
+
+    // rational approximation for the central region
+    const double q = p - .5;
+    const double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <assert.h>
 #include <map>
+#include <vector>
 
 template <typename T> class NonUniformLookupTable;
 
@@ -25,7 +27,18 @@ private:
     };
     using container = std::map<T, Entry>;
     bool isFinalized = false;
+
+    /**
+     * the points, as they are added.
+     */
     container entries;
+
+    /**
+     * finalize() flattens the map into contiguous, sorted arrays,
+     * so lookup is a binary search over the x values.
+     */
+    std::vector<T> xValues;
+    std::vector<Entry> flatEntries;
 };
 
 template <typename T>
@@ -36,6 +49,13 @@ public:
     static void addPoint(NonUniformLookupTableParams<T>& params, T x, T y);
     static void finalize(NonUniformLookupTableParams<T>& params);
     static T lookup(NonUniformLookupTableParams<T>& params, T x);
+
+    /**
+     * The original lookup, that searches the std::map.
+     * Gives the same answer as lookup(), but slower.
+     * Kept for testing and benchmarking.
+     */
+    static T lookupMap(NonUniformLookupTableParams<T>& params, T x);
 };
 
 template <typename T>
@@ -69,12 +89,41 @@ inline void NonUniformLookupTable<T>::finalize(NonUniformLookupTableParams<T>& p
         }
     }
 
+    params.xValues.clear();
+    params.flatEntries.clear();
+    for (auto entry : params.entries) {
+        params.xValues.push_back(entry.second.x);
+        params.flatEntries.push_back(entry.second);
+    }
+
     params.isFinalized = true;
 }
 
 
 template <typename T>
 inline T NonUniformLookupTable<T>::lookup(NonUniformLookupTableParams<T>& params, T x)
+{
+    assert(params.isFinalized);
+    assert(!params.xValues.empty());
+
+    // find the first point past x
+    const auto upper = std::upper_bound(params.xValues.begin(), params.xValues.end(), x);
+    const int index = int(upper - params.xValues.begin());
+    if (index == 0) {
+        return params.flatEntries.front().y;
+    }
+    if (index == int(params.xValues.size())) {
+        return params.flatEntries.back().y;
+    }
+
+    // interpolate from the point at or before x
+    const auto& entry = params.flatEntries[index - 1];
+    T ret = entry.a * (x - entry.x) + entry.y;
+    return ret;
+}
+
+template <typename T>
+inline T NonUniformLookupTable<T>::lookupMap(NonUniformLookupTableParams<T>& params, T x)
 {
     assert(params.isFinalized);
     assert(!params.entries.empty());
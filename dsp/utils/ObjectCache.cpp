@@ -1,5 +1,10 @@
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
 
 #include "AudioMath.h"
 #include "ButterworthFilterDesigner.h"
@@ -7,146 +12,195 @@
 #include "ObjectCache.h"
 
 template <typename T>
-std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper()
+template <typename TObj>
+std::shared_ptr<TObj> ObjectCache<T>::getCached(std::weak_ptr<TObj>& cache, std::function<void(TObj&)> make)
 {
-    std::shared_ptr< LookupTableParams<T>> ret = bipolarAudioTaper.lock();
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        std::shared_ptr<TObj> ret = cache.lock();
+        if (ret) {
+            return ret;
+        }
+    }
+
+    // make it without the lock, so other threads can make other objects
+    std::shared_ptr<TObj> made = std::make_shared<TObj>();
+    make(*made);
+
+    std::lock_guard<std::mutex> guard(mutex);
+    std::shared_ptr<TObj> ret = cache.lock();
     if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeBipolarAudioTaper(*ret);
-        bipolarAudioTaper = ret;
+        ret = made;
+        cache = ret;
     }
+    // else another thread beat us to it, so use theirs
     return ret;
 }
 
 template <typename T>
-std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper()
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getTable(CachedTableId id)
 {
+    const int index = int(id);
+    assert(index >= 0 && index < numTables);
+    return getCached<LookupTableParams<T>>(tables[index], [id](LookupTableParams<T>& params) {
+        if (!loadPrecomputed(params, id)) {
+            makeTable(params, id);
+        }
+        });
+}
 
-    std::shared_ptr< LookupTableParams<T>> ret = audioTaper.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret);
-        audioTaper = ret;
+template <typename T>
+void ObjectCache<T>::makeTable(LookupTableParams<T>& params, CachedTableId id)
+{
+    switch (id) {
+        case CachedTableId::BipolarAudioTaper:
+            LookupTableFactory<T>::makeBipolarAudioTaper(params);
+            break;
+        case CachedTableId::AudioTaper:
+            LookupTableFactory<T>::makeAudioTaper(params);
+            break;
+        case CachedTableId::AudioTaper18:
+            LookupTableFactory<T>::makeAudioTaper(params, -18);
+            break;
+        case CachedTableId::Sin:
+            // Used to use 4096, but 512 gives about 92db  snr, so let's save memory
+            LookupTable<T>::init(params, 512, 0, 1, AudioMath::makeFunc_Sin());
+            break;
+        case CachedTableId::MixerPanL:
+            LookupTableFactory<T>::makeMixerPanL(params);
+            break;
+        case CachedTableId::MixerPanR:
+            LookupTableFactory<T>::makeMixerPanR(params);
+            break;
+        case CachedTableId::Exp2:
+            LookupTableFactory<T>::makeExp2(params);
+            break;
+        case CachedTableId::Exp2ExLow:
+            LookupTableFactory<T>::makeExp2ExLow(params);
+            break;
+        case CachedTableId::Exp2ExHigh:
+            LookupTableFactory<T>::makeExp2ExHigh(params);
+            break;
+        case CachedTableId::Db2Gain:
+            LookupTable<T>::init(params, 32, -80, 20, [](double x) {
+                return AudioMath::gainFromDb(x);
+                });
+            break;
+        case CachedTableId::Tanh5:
+            LookupTable<T>::init(params, 256, -5, 5, [](double x) {
+                return std::tanh(x);
+                });
+            break;
+        case CachedTableId::MinBLEP:
+            LookupTableFactory<T>::makeMinBLEP(params);
+            break;
+        case CachedTableId::NormalInverse:
+            LookupTableFactory<T>::makeNormalInverse(params);
+            break;
+        default:
+            assert(false);
     }
-    return ret;
 }
 
 template <typename T>
-std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper18()
+bool ObjectCache<T>::loadPrecomputed(LookupTableParams<T>& params, CachedTableId id)
+{
+    return false;
+}
+
+#ifdef _PRECOMPUTED_TABLES
+extern const PrecomputedTable precomputedTables[];
+
+template <>
+bool ObjectCache<float>::loadPrecomputed(LookupTableParams<float>& params, CachedTableId id)
 {
+    const PrecomputedTable& table = precomputedTables[int(id)];
+    params.alloc(table.numBins);
+    memcpy(params.entries, table.entries, (table.numBins + 1) * 2 * sizeof(float));
+    params.a = table.a;
+    params.b = table.b;
+    params.xMin = table.xMin;
+    params.xMax = table.xMax;
+    return true;
+}
+#endif
 
-    std::shared_ptr< LookupTableParams<T>> ret = audioTaper18.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeAudioTaper(*ret, -18);
-        audioTaper18 = ret;
-    }
-    return ret;
+template <typename T>
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getBipolarAudioTaper()
+{
+    return getTable(CachedTableId::BipolarAudioTaper);
+}
+
+template <typename T>
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper()
+{
+    return getTable(CachedTableId::AudioTaper);
+}
+
+template <typename T>
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getAudioTaper18()
+{
+    return getTable(CachedTableId::AudioTaper18);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getSinLookup()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = sinLookupTable.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        std::function<double(double)> f = AudioMath::makeFunc_Sin();
-        // Used to use 4096, but 512 gives about 92db  snr, so let's save memory
-        LookupTable<T>::init(*ret, 512, 0, 1, f);
-        sinLookupTable = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Sin);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanL()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = mixerPanL.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanL(*ret);
-        mixerPanL = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::MixerPanL);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMixerPanR()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = mixerPanR.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeMixerPanR(*ret);
-        mixerPanR = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::MixerPanR);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2(*ret);
-        exp2 = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Exp2);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedLow()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2ExLow.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExLow(*ret);
-        exp2ExLow = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Exp2ExLow);
 }
 
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getExp2ExtendedHigh()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = exp2ExHigh.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTableFactory<T>::makeExp2ExHigh(*ret);
-        exp2ExHigh = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Exp2ExHigh);
 }
 
-
-
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getDb2Gain()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = db2Gain.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 32, -80, 20, [](double x) {
-            return AudioMath::gainFromDb(x);
-            });
-        db2Gain = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Db2Gain);
 }
 
-
 template <typename T>
 std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getTanh5()
 {
-    std::shared_ptr< LookupTableParams<T>> ret = tanh5.lock();
-    if (!ret) {
-        ret = std::make_shared<LookupTableParams<T>>();
-        LookupTable<T>::init(*ret, 256, -5, 5, [](double x) {
-            return std::tanh(x);
-            });
-        tanh5 = ret;
-    }
-    return ret;
+    return getTable(CachedTableId::Tanh5);
+}
+
+template <typename T>
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getMinBLEP()
+{
+    return getTable(CachedTableId::MinBLEP);
+}
+
+template <typename T>
+std::shared_ptr<LookupTableParams<T>> ObjectCache<T>::getNormalInverse()
+{
+    return getTable(CachedTableId::NormalInverse);
 }
 
 /**
@@ -168,77 +222,133 @@ std::function<T(T)> ObjectCache<T>::getExp2Ex()
 template <typename T>
 std::shared_ptr<BiquadParams<float, 3>> ObjectCache<T>::get6PLPParams(float normalizedFc)
 {
+    auto make = [normalizedFc](BiquadParams<float, 3>& params) {
+        ButterworthFilterDesigner<float>::designSixPoleLowpass(params, normalizedFc);
+    };
     const int div = (int) std::round(1.0 / normalizedFc);
     if (div == 64) {
-        std::shared_ptr < BiquadParams<float, 3>> ret = lowpass64.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<float, 3>>();
-            ButterworthFilterDesigner<float>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass64 = ret;
-        }
-        return ret;
+        return getCached<BiquadParams<float, 3>>(lowpass64, make);
     } else if (div == 16) {
-        std::shared_ptr < BiquadParams<float, 3>> ret = lowpass16.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<float, 3>>();
-            ButterworthFilterDesigner<float>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass16 = ret;
-        }
-        return ret;
+        return getCached<BiquadParams<float, 3>>(lowpass16, make);
     } else if (div == 32) {
-        std::shared_ptr < BiquadParams<float, 3>> ret = lowpass32.lock();
-        if (!ret) {
-            ret = std::make_shared<BiquadParams<float, 3>>();
-            ButterworthFilterDesigner<float>::designSixPoleLowpass(*ret, normalizedFc);
-            lowpass32 = ret;
-        }
-        return ret;
+        return getCached<BiquadParams<float, 3>>(lowpass32, make);
     } else {
         assert(false);
     }
     return nullptr;
 };
 
-// The weak pointers that hold our singletons.
-template <typename T>
-std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass64;
-template <typename T>
-std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass32;
 template <typename T>
-std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass16;
+void ObjectCache<T>::warmUp(bool parallel)
+{
+    std::vector<std::function<std::shared_ptr<void>()>> makers;
+    for (int i = 0; i < numTables; ++i) {
+        makers.push_back([i]() {
+            return getTable(CachedTableId(i));
+            });
+    }
+    for (int div : {16, 32, 64}) {
+        makers.push_back([div]() {
+            return get6PLPParams(1.f / div);
+            });
+    }
 
-template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::bipolarAudioTaper;
+    std::vector<std::shared_ptr<void>> objects(makers.size());
+    if (!parallel) {
+        for (size_t i = 0; i < makers.size(); ++i) {
+            objects[i] = makers[i]();
+        }
+    } else {
+        // each thread takes the next object that no one has started yet
+        std::atomic<int> next(0);
+        auto worker = [&makers, &objects, &next]() {
+            for (int i = next++; i < int(makers.size()); i = next++) {
+                objects[i] = makers[i]();
+            }
+        };
+        const int numThreads = std::max(1, std::min(4, int(std::thread::hardware_concurrency())));
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) {
+            threads.push_back(std::thread(worker));
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
 
-template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::audioTaper;
+    std::lock_guard<std::mutex> guard(mutex);
+    pinned = objects;
+}
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::audioTaper18;
+void ObjectCache<T>::unpin()
+{
+    std::vector<std::shared_ptr<void>> temp;
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        temp.swap(pinned);
+    }
+    // now the objects are freed outside the lock
+}
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::sinLookupTable;
+void ObjectCache<T>::genTables()
+{
+    const char* names[numTables] = {
+        "bipolarAudioTaper", "audioTaper", "audioTaper18", "sin",
+        "mixerPanL", "mixerPanR", "exp2", "exp2ExLow", "exp2ExHigh",
+        "db2Gain", "tanh5", "minBLEP", "normalInverse"
+    };
 
-template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2;
+    printf("// Generated by \"test --tables\", from ObjectCache::genTables(). Do not edit.\n");
+    printf("#include \"ObjectCache.h\"\n\n");
+
+    for (int i = 0; i < numTables; ++i) {
+        LookupTableParams<T> params;
+        makeTable(params, CachedTableId(i));
+        const int numEntries = (params.numBins_i + 1) * 2;
+        printf("static const float %sTable[%d] = {\n", names[i], numEntries);
+        for (int j = 0; j < numEntries; ++j) {
+            printf("%.9ef", float(params.entries[j]));
+            if (j != numEntries - 1) {
+                printf(",");
+                printf(((j % 6) == 5) ? "\n" : " ");
+            }
+        }
+        printf("\n};\n\n");
+    }
 
-template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2ExLow;
+    printf("extern const PrecomputedTable precomputedTables[] = {\n");
+    for (int i = 0; i < numTables; ++i) {
+        LookupTableParams<T> params;
+        makeTable(params, CachedTableId(i));
+        printf("    {%d, %.9ef, %.9ef, %.9ef, %.9ef, %sTable}%s\n",
+            params.numBins_i,
+            float(params.a), float(params.b),
+            float(params.xMin), float(params.xMax),
+            names[i],
+            (i == numTables - 1) ? "" : ",");
+    }
+    printf("};\n");
+    fflush(stdout);
+}
 
+// The weak pointers that hold our singletons.
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::exp2ExHigh;
-
+std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass64;
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::db2Gain;
+std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass32;
+template <typename T>
+std::weak_ptr< BiquadParams<float, 3> >  ObjectCache<T>::lowpass16;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::tanh5;
+std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::tables[ObjectCache<T>::numTables];
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::mixerPanL;
+std::mutex ObjectCache<T>::mutex;
 
 template <typename T>
-std::weak_ptr<LookupTableParams<T>> ObjectCache<T>::mixerPanR;
+std::vector<std::shared_ptr<void>> ObjectCache<T>::pinned;
 
 // Explicit instantiation, so we can put implementation into .cpp file
 template class ObjectCache<double>;
@@ -3,6 +3,43 @@
 #include "LookupTable.h"
 #include "BiquadParams.h"
 
+#include <mutex>
+#include <vector>
+
+/**
+ * The lookup tables that ObjectCache knows how to make.
+ */
+enum class CachedTableId
+{
+    BipolarAudioTaper,
+    AudioTaper,
+    AudioTaper18,
+    Sin,
+    MixerPanL,
+    MixerPanR,
+    Exp2,
+    Exp2ExLow,
+    Exp2ExHigh,
+    Db2Gain,
+    Tanh5,
+    MinBLEP,
+    NormalInverse,
+    NumTables
+};
+
+/**
+ * A float lookup table that was calculated ahead of time, and compiled in.
+ * The data is in ObjectCacheTables.cpp, which is generated by "test --tables".
+ */
+class PrecomputedTable
+{
+public:
+    int numBins;
+    float a, b;
+    float xMin, xMax;
+    const float* entries;
+};
+
 /**
  * This class creates objects and caches them.
  * Objects in the cache only stay alive as long as there is a reference to the object,
@@ -11,6 +48,14 @@
  * All accessors return shared pointers to make the lifetime management easy.
  * Clients are free to use the shared_ptr directly, or may use the raw pointer,
  * as long as the client holds onto the reference.
+ *
+ * The accessors are thread safe, but they are not meant for the audio thread.
+ *
+ * warmUp() makes every object ahead of time, and holds a reference to them,
+ * so that making modules never has to wait for table math.
+ *
+ * If built with _PRECOMPUTED_TABLES, the float lookup tables are copied from
+ * data compiled into the plugin, rather than calculated.
  */
 
 template <typename T>
@@ -50,27 +95,72 @@ public:
      */
     static std::shared_ptr<LookupTableParams<T>> getTanh5();
 
+    /**
+     * The band limited step shared by all the MinBLEP oscillators.
+     * See LookupTableFactory::makeMinBLEP
+     */
+    static std::shared_ptr<LookupTableParams<T>> getMinBLEP();
+
+    /**
+     * Turns uniform random numbers into normal ones.
+     * See LookupTableFactory::makeNormalInverse
+     */
+    static std::shared_ptr<LookupTableParams<T>> getNormalInverse();
+
     static std::shared_ptr<BiquadParams<float, 3>> get6PLPParams(float normalizedFc);
 
+    /**
+     * Makes every cached object now, and keeps them alive until unpin().
+     * If parallel, the objects are made on several threads at once.
+     * Call from the UI thread, not the audio thread.
+     */
+    static void warmUp(bool parallel);
+
+    /**
+     * Lets go of the objects from warmUp(). Once all the clients
+     * let go also, they will be freed.
+     */
+    static void unpin();
+
+    /**
+     * Makes the table from scratch, never uses the cache or the precomputed data.
+     */
+    static void makeTable(LookupTableParams<T>& params, CachedTableId id);
+
+    /**
+     * Prints the source for ObjectCacheTables.cpp to stdout.
+     * Only makes sense for T == float.
+     */
+    static void genTables();
+
 private:
+    static const int numTables = int(CachedTableId::NumTables);
+
     /**
      * Cache uses weak pointers. This allows the cached objects to be
      * freed when the last client reference goes away.
      */
-    static std::weak_ptr<LookupTableParams<T>> bipolarAudioTaper;
-    static std::weak_ptr<LookupTableParams<T>> audioTaper;
-    static std::weak_ptr<LookupTableParams<T>> audioTaper18;
-    static std::weak_ptr<LookupTableParams<T>> sinLookupTable;
-    static std::weak_ptr<LookupTableParams<T>> exp2;
-    static std::weak_ptr<LookupTableParams<T>> exp2ExHigh;
-    static std::weak_ptr<LookupTableParams<T>> exp2ExLow;
-    static std::weak_ptr<LookupTableParams<T>> db2Gain;
-    static std::weak_ptr<LookupTableParams<T>> tanh5;
+    static std::weak_ptr<LookupTableParams<T>> tables[numTables];
 
     static std::weak_ptr< BiquadParams<float, 3>> lowpass64;
     static std::weak_ptr< BiquadParams<float, 3>> lowpass32; 
     static std::weak_ptr< BiquadParams<float, 3>> lowpass16;
 
-    static std::weak_ptr<LookupTableParams<T>> mixerPanL;
-    static std::weak_ptr<LookupTableParams<T>> mixerPanR;
+    /**
+     * Protects the weak pointers and pinned. Not held while making objects,
+     * so that warmUp can make them in parallel.
+     */
+    static std::mutex mutex;
+    static std::vector<std::shared_ptr<void>> pinned;
+
+    static std::shared_ptr<LookupTableParams<T>> getTable(CachedTableId id);
+
+    template <typename TObj>
+    static std::shared_ptr<TObj> getCached(std::weak_ptr<TObj>& cache, std::function<void(TObj&)> make);
+
+    /**
+     * Fills in params from the precomputed data, if we have it.
+     * Returns false if it must be calculated.
+     */
+    static bool loadPrecomputed(LookupTableParams<T>& params, CachedTableId id);
 };
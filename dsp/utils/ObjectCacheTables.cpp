@@ -0,0 +1,1738 @@
+// Generated by "test --tables", from ObjectCache::genTables(). Do not edit.
+#include "ObjectCache.h"
+
+static const float bipolarAudioTaperTable[66] = {
+-1.000000000e+00f, 2.056717724e-01f, -7.943282127e-01f, 1.633708924e-01f, -6.309573650e-01f, 1.297701150e-01f,
+-5.011872053e-01f, 1.030800641e-01f, -3.981071711e-01f, 8.187940717e-02f, -3.162277639e-01f, 6.503912061e-02f,
+-2.511886358e-01f, 5.166241154e-02f, -1.995262355e-01f, 4.103691131e-02f, -1.584893167e-01f, 3.259677812e-02f,
+-1.258925349e-01f, 2.589254081e-02f, -1.000000015e-01f, 2.056717686e-02f, -7.943282276e-02f, 1.633708924e-02f,
+-6.309573352e-02f, 1.577393338e-02f, -4.732180014e-02f, 1.577393338e-02f, -3.154786676e-02f, 1.577393338e-02f,
+-1.577393338e-02f, 1.577393338e-02f, 0.000000000e+00f, 1.577393338e-02f, 1.577393338e-02f, 1.577393338e-02f,
+3.154786676e-02f, 1.577393338e-02f, 4.732180014e-02f, 1.577393338e-02f, 6.309573352e-02f, 1.633708924e-02f,
+7.943282276e-02f, 2.056717686e-02f, 1.000000015e-01f, 2.589254081e-02f, 1.258925349e-01f, 3.259677812e-02f,
+1.584893167e-01f, 4.103691131e-02f, 1.995262355e-01f, 5.166241154e-02f, 2.511886358e-01f, 6.503912061e-02f,
+3.162277639e-01f, 8.187940717e-02f, 3.981071711e-01f, 1.030800641e-01f, 5.011872053e-01f, 1.297701150e-01f,
+6.309573650e-01f, 1.633708924e-01f, 7.943282127e-01f, 2.056717724e-01f, 1.000000000e+00f, 2.589254081e-01f
+};
+
+static const float audioTaperTable[66] = {
+0.000000000e+00f, 7.886966690e-03f, 7.886966690e-03f, 7.886966690e-03f, 1.577393338e-02f, 7.886966690e-03f,
+2.366090007e-02f, 7.886966690e-03f, 3.154786676e-02f, 7.886966690e-03f, 3.943483531e-02f, 7.886966690e-03f,
+4.732180014e-02f, 7.886966690e-03f, 5.520876870e-02f, 7.886966690e-03f, 6.309573352e-02f, 7.698844187e-03f,
+7.079457492e-02f, 8.638245054e-03f, 7.943282276e-02f, 9.692270309e-03f, 8.912509680e-02f, 1.087490655e-02f,
+1.000000015e-01f, 1.220184565e-02f, 1.122018471e-01f, 1.369069610e-02f, 1.258925349e-01f, 1.536121313e-02f,
+1.412537545e-01f, 1.723556407e-02f, 1.584893167e-01f, 1.933862083e-02f, 1.778279394e-01f, 2.169829048e-02f,
+1.995262355e-01f, 2.434588224e-02f, 2.238721102e-01f, 2.731652930e-02f, 2.511886358e-01f, 3.064965084e-02f,
+2.818382978e-01f, 3.438947350e-02f, 3.162277639e-01f, 3.858562186e-02f, 3.548133969e-01f, 4.329378158e-02f,
+3.981071711e-01f, 4.857642204e-02f, 4.466835856e-01f, 5.450364202e-02f, 5.011872053e-01f, 6.115408987e-02f,
+5.623413324e-01f, 6.861601770e-02f, 6.309573650e-01f, 7.698843628e-02f, 7.079457641e-01f, 8.638244867e-02f,
+7.943282127e-01f, 9.692270309e-02f, 8.912509084e-01f, 1.087490618e-01f, 1.000000000e+00f, 1.220184565e-01f
+};
+
+static const float audioTaper18Table[66] = {
+0.000000000e+00f, 1.573656686e-02f, 1.573656686e-02f, 1.573656686e-02f, 3.147313371e-02f, 1.573656686e-02f,
+4.720970243e-02f, 1.573656686e-02f, 6.294626743e-02f, 1.573656686e-02f, 7.868283987e-02f, 1.573656686e-02f,
+9.441940486e-02f, 1.573656686e-02f, 1.101559699e-01f, 1.573656686e-02f, 1.258925349e-01f, 1.135355514e-02f,
+1.372461021e-01f, 1.237746980e-02f, 1.496235728e-01f, 1.349372510e-02f, 1.631172895e-01f, 1.471064985e-02f,
+1.778279394e-01f, 1.603732258e-02f, 1.938652694e-01f, 1.748364046e-02f, 2.113489062e-01f, 1.906039380e-02f,
+2.304092944e-01f, 2.077934518e-02f, 2.511886358e-01f, 2.265332080e-02f, 2.738419771e-01f, 2.469629794e-02f,
+2.985382676e-01f, 2.692352235e-02f, 3.254617751e-01f, 2.935160510e-02f, 3.548133969e-01f, 3.199866414e-02f,
+3.868120611e-01f, 3.488444909e-02f, 4.216965139e-01f, 3.803048655e-02f, 4.597269893e-01f, 4.146024585e-02f,
+5.011872053e-01f, 4.519931599e-02f, 5.463865399e-01f, 4.927559197e-02f, 5.956621170e-01f, 5.371948704e-02f,
+6.493816376e-01f, 5.856415257e-02f, 7.079457641e-01f, 6.384573132e-02f, 7.717915177e-01f, 6.960362941e-02f,
+8.413951397e-01f, 7.588079572e-02f, 9.172759056e-01f, 8.272406459e-02f, 1.000000000e+00f, 9.018449485e-02f
+};
+
+static const float sinTable[1026] = {
+0.000000000e+00f, 1.227153838e-02f, 1.227153838e-02f, 1.226969063e-02f, 2.454122901e-02f, 1.226599421e-02f,
+3.680722415e-02f, 1.226045098e-02f, 4.906767607e-02f, 1.225306187e-02f, 6.132073700e-02f, 1.224382687e-02f,
+7.356456667e-02f, 1.223274879e-02f, 8.579730988e-02f, 1.221982762e-02f, 9.801714122e-02f, 1.220506709e-02f,
+1.102222055e-01f, 1.218846813e-02f, 1.224106774e-01f, 1.217003353e-02f, 1.345807016e-01f, 1.214976609e-02f,
+1.467304677e-01f, 1.212766860e-02f, 1.588581502e-01f, 1.210374571e-02f, 1.709618866e-01f, 1.207799930e-02f,
+1.830398887e-01f, 1.205043402e-02f, 1.950903237e-01f, 1.202105451e-02f, 2.071113735e-01f, 1.198986359e-02f,
+2.191012353e-01f, 1.195686776e-02f, 2.310581058e-01f, 1.192207169e-02f, 2.429801822e-01f, 1.188548002e-02f,
+2.548656464e-01f, 1.184709743e-02f, 2.667127550e-01f, 1.180693228e-02f, 2.785196900e-01f, 1.176498830e-02f,
+2.902846634e-01f, 1.172127202e-02f, 3.020059466e-01f, 1.167579088e-02f, 3.136817515e-01f, 1.162855141e-02f,
+3.253102899e-01f, 1.157956105e-02f, 3.368898630e-01f, 1.152882725e-02f, 3.484186828e-01f, 1.147635654e-02f,
+3.598950505e-01f, 1.142215729e-02f, 3.713172078e-01f, 1.136623882e-02f, 3.826834261e-01f, 1.130860765e-02f,
+3.939920366e-01f, 1.124927402e-02f, 4.052413106e-01f, 1.118824631e-02f, 4.164295495e-01f, 1.112553291e-02f,
+4.275550842e-01f, 1.106114499e-02f, 4.386162460e-01f, 1.099509094e-02f, 4.496113360e-01f, 1.092738099e-02f,
+4.605387151e-01f, 1.085802633e-02f, 4.713967443e-01f, 1.078703534e-02f, 4.821837842e-01f, 1.071442012e-02f,
+4.928981960e-01f, 1.064019185e-02f, 5.035383701e-01f, 1.056436077e-02f, 5.141027570e-01f, 1.048693806e-02f,
+5.245896578e-01f, 1.040793676e-02f, 5.349976420e-01f, 1.032736897e-02f, 5.453249812e-01f, 1.024524495e-02f,
+5.555702448e-01f, 1.016157772e-02f, 5.657318234e-01f, 1.007638033e-02f, 5.758081675e-01f, 9.989665821e-03f,
+5.857978463e-01f, 9.901447222e-03f, 5.956993103e-01f, 9.811736643e-03f, 6.055110693e-01f, 9.720548987e-03f,
+6.152315736e-01f, 9.627897292e-03f, 6.248595119e-01f, 9.533796459e-03f, 6.343932748e-01f, 9.438258596e-03f,
+6.438315511e-01f, 9.341300465e-03f, 6.531728506e-01f, 9.242934175e-03f, 6.624158025e-01f, 9.143177420e-03f,
+6.715589762e-01f, 9.042043239e-03f, 6.806010008e-01f, 8.939546533e-03f, 6.895405650e-01f, 8.835704997e-03f,
+6.983762383e-01f, 8.730531670e-03f, 7.071067691e-01f, 8.624044247e-03f, 7.157308459e-01f, 8.516257629e-03f,
+7.242470980e-01f, 8.407188579e-03f, 7.326542735e-01f, 8.296853863e-03f, 7.409511209e-01f, 8.185269311e-03f,
+7.491363883e-01f, 8.072451688e-03f, 7.572088242e-01f, 7.958418690e-03f, 7.651672363e-01f, 7.843188010e-03f,
+7.730104327e-01f, 7.726775017e-03f, 7.807372212e-01f, 7.609199267e-03f, 7.883464098e-01f, 7.490477059e-03f,
+7.958369255e-01f, 7.370627020e-03f, 8.032075167e-01f, 7.249666844e-03f, 8.104571700e-01f, 7.127614692e-03f,
+8.175848126e-01f, 7.004489657e-03f, 8.245893121e-01f, 6.880309433e-03f, 8.314695954e-01f, 6.755093113e-03f,
+8.382247090e-01f, 6.628859788e-03f, 8.448535800e-01f, 6.501628086e-03f, 8.513551950e-01f, 6.373417098e-03f,
+8.577286005e-01f, 6.244245917e-03f, 8.639728427e-01f, 6.114135031e-03f, 8.700869679e-01f, 5.983103067e-03f,
+8.760700822e-01f, 5.851170048e-03f, 8.819212914e-01f, 5.718355998e-03f, 8.876396418e-01f, 5.584680941e-03f,
+8.932242990e-01f, 5.450164434e-03f, 8.986744881e-01f, 5.314827431e-03f, 9.039893150e-01f, 5.178689957e-03f,
+9.091680050e-01f, 5.041772500e-03f, 9.142097831e-01f, 4.904096015e-03f, 9.191138744e-01f, 4.765680991e-03f,
+9.238795042e-01f, 4.626547918e-03f, 9.285060763e-01f, 4.486718215e-03f, 9.329928160e-01f, 4.346213304e-03f,
+9.373390079e-01f, 4.205053207e-03f, 9.415440559e-01f, 4.063260276e-03f, 9.456073046e-01f, 3.920855001e-03f,
+9.495281577e-01f, 3.777859733e-03f, 9.533060193e-01f, 3.634295426e-03f, 9.569403529e-01f, 3.490183735e-03f,
+9.604305029e-01f, 3.345546313e-03f, 9.637760520e-01f, 3.200405277e-03f, 9.669764638e-01f, 3.054782050e-03f,
+9.700312614e-01f, 2.908698982e-03f, 9.729399681e-01f, 2.762177726e-03f, 9.757021070e-01f, 2.615240635e-03f,
+9.783173800e-01f, 2.467909595e-03f, 9.807852507e-01f, 2.320206957e-03f, 9.831054807e-01f, 2.172155073e-03f,
+9.852776527e-01f, 2.023775829e-03f, 9.873014092e-01f, 1.875091810e-03f, 9.891765118e-01f, 1.726125483e-03f,
+9.909026623e-01f, 1.576899202e-03f, 9.924795628e-01f, 1.427435433e-03f, 9.939069748e-01f, 1.277756644e-03f,
+9.951847196e-01f, 1.127885538e-03f, 9.963126183e-01f, 9.778444655e-04f, 9.972904325e-01f, 8.276562439e-04f,
+9.981181026e-01f, 6.773432833e-04f, 9.987954497e-01f, 5.269284011e-04f, 9.993223548e-01f, 3.764340945e-04f,
+9.996988177e-01f, 2.258831373e-04f, 9.999247193e-01f, 7.529815775e-05f, 1.000000000e+00f, -7.529815775e-05f,
+9.999247193e-01f, -2.258831373e-04f, 9.996988177e-01f, -3.764340945e-04f, 9.993223548e-01f, -5.269284011e-04f,
+9.987954497e-01f, -6.773432833e-04f, 9.981181026e-01f, -8.276562439e-04f, 9.972904325e-01f, -9.778444655e-04f,
+9.963126183e-01f, -1.127885538e-03f, 9.951847196e-01f, -1.277756644e-03f, 9.939069748e-01f, -1.427435433e-03f,
+9.924795628e-01f, -1.576899202e-03f, 9.909026623e-01f, -1.726125483e-03f, 9.891765118e-01f, -1.875091810e-03f,
+9.873014092e-01f, -2.023775829e-03f, 9.852776527e-01f, -2.172155073e-03f, 9.831054807e-01f, -2.320206957e-03f,
+9.807852507e-01f, -2.467909595e-03f, 9.783173800e-01f, -2.615240635e-03f, 9.757021070e-01f, -2.762177726e-03f,
+9.729399681e-01f, -2.908698982e-03f, 9.700312614e-01f, -3.054782050e-03f, 9.669764638e-01f, -3.200405277e-03f,
+9.637760520e-01f, -3.345546313e-03f, 9.604305029e-01f, -3.490183735e-03f, 9.569403529e-01f, -3.634295426e-03f,
+9.533060193e-01f, -3.777859733e-03f, 9.495281577e-01f, -3.920855001e-03f, 9.456073046e-01f, -4.063260276e-03f,
+9.415440559e-01f, -4.205053207e-03f, 9.373390079e-01f, -4.346213304e-03f, 9.329928160e-01f, -4.486718215e-03f,
+9.285060763e-01f, -4.626547918e-03f, 9.238795042e-01f, -4.765680991e-03f, 9.191138744e-01f, -4.904096015e-03f,
+9.142097831e-01f, -5.041772500e-03f, 9.091680050e-01f, -5.178689957e-03f, 9.039893150e-01f, -5.314827431e-03f,
+8.986744881e-01f, -5.450164434e-03f, 8.932242990e-01f, -5.584680941e-03f, 8.876396418e-01f, -5.718355998e-03f,
+8.819212914e-01f, -5.851170048e-03f, 8.760700822e-01f, -5.983103067e-03f, 8.700869679e-01f, -6.114135031e-03f,
+8.639728427e-01f, -6.244245917e-03f, 8.577286005e-01f, -6.373417098e-03f, 8.513551950e-01f, -6.501628086e-03f,
+8.448535800e-01f, -6.628859788e-03f, 8.382247090e-01f, -6.755093113e-03f, 8.314695954e-01f, -6.880309433e-03f,
+8.245893121e-01f, -7.004489657e-03f, 8.175848126e-01f, -7.127614692e-03f, 8.104571700e-01f, -7.249666844e-03f,
+8.032075167e-01f, -7.370627020e-03f, 7.958369255e-01f, -7.490477059e-03f, 7.883464098e-01f, -7.609199267e-03f,
+7.807372212e-01f, -7.726775017e-03f, 7.730104327e-01f, -7.843188010e-03f, 7.651672363e-01f, -7.958418690e-03f,
+7.572088242e-01f, -8.072451688e-03f, 7.491363883e-01f, -8.185269311e-03f, 7.409511209e-01f, -8.296853863e-03f,
+7.326542735e-01f, -8.407188579e-03f, 7.242470980e-01f, -8.516257629e-03f, 7.157308459e-01f, -8.624044247e-03f,
+7.071067691e-01f, -8.730531670e-03f, 6.983762383e-01f, -8.835704997e-03f, 6.895405650e-01f, -8.939546533e-03f,
+6.806010008e-01f, -9.042043239e-03f, 6.715589762e-01f, -9.143177420e-03f, 6.624158025e-01f, -9.242934175e-03f,
+6.531728506e-01f, -9.341300465e-03f, 6.438315511e-01f, -9.438258596e-03f, 6.343932748e-01f, -9.533796459e-03f,
+6.248595119e-01f, -9.627897292e-03f, 6.152315736e-01f, -9.720548987e-03f, 6.055110693e-01f, -9.811736643e-03f,
+5.956993103e-01f, -9.901447222e-03f, 5.857978463e-01f, -9.989665821e-03f, 5.758081675e-01f, -1.007638033e-02f,
+5.657318234e-01f, -1.016157772e-02f, 5.555702448e-01f, -1.024524495e-02f, 5.453249812e-01f, -1.032736897e-02f,
+5.349976420e-01f, -1.040793676e-02f, 5.245896578e-01f, -1.048693806e-02f, 5.141027570e-01f, -1.056436077e-02f,
+5.035383701e-01f, -1.064019185e-02f, 4.928981960e-01f, -1.071442012e-02f, 4.821837842e-01f, -1.078703534e-02f,
+4.713967443e-01f, -1.085802633e-02f, 4.605387151e-01f, -1.092738099e-02f, 4.496113360e-01f, -1.099509094e-02f,
+4.386162460e-01f, -1.106114499e-02f, 4.275550842e-01f, -1.112553291e-02f, 4.164295495e-01f, -1.118824631e-02f,
+4.052413106e-01f, -1.124927402e-02f, 3.939920366e-01f, -1.130860765e-02f, 3.826834261e-01f, -1.136623882e-02f,
+3.713172078e-01f, -1.142215729e-02f, 3.598950505e-01f, -1.147635654e-02f, 3.484186828e-01f, -1.152882725e-02f,
+3.368898630e-01f, -1.157956105e-02f, 3.253102899e-01f, -1.162855141e-02f, 3.136817515e-01f, -1.167579088e-02f,
+3.020059466e-01f, -1.172127202e-02f, 2.902846634e-01f, -1.176498830e-02f, 2.785196900e-01f, -1.180693228e-02f,
+2.667127550e-01f, -1.184709743e-02f, 2.548656464e-01f, -1.188548002e-02f, 2.429801822e-01f, -1.192207169e-02f,
+2.310581058e-01f, -1.195686776e-02f, 2.191012353e-01f, -1.198986359e-02f, 2.071113735e-01f, -1.202105451e-02f,
+1.950903237e-01f, -1.205043402e-02f, 1.830398887e-01f, -1.207799930e-02f, 1.709618866e-01f, -1.210374571e-02f,
+1.588581502e-01f, -1.212766860e-02f, 1.467304677e-01f, -1.214976609e-02f, 1.345807016e-01f, -1.217003353e-02f,
+1.224106774e-01f, -1.218846813e-02f, 1.102222055e-01f, -1.220506709e-02f, 9.801714122e-02f, -1.221982762e-02f,
+8.579730988e-02f, -1.223274879e-02f, 7.356456667e-02f, -1.224382687e-02f, 6.132073700e-02f, -1.225306187e-02f,
+4.906767607e-02f, -1.226045098e-02f, 3.680722415e-02f, -1.226599421e-02f, 2.454122901e-02f, -1.226969063e-02f,
+1.227153838e-02f, -1.227153838e-02f, 1.224646853e-16f, -1.227153838e-02f, -1.227153838e-02f, -1.226969063e-02f,
+-2.454122901e-02f, -1.226599421e-02f, -3.680722415e-02f, -1.226045098e-02f, -4.906767607e-02f, -1.225306187e-02f,
+-6.132073700e-02f, -1.224382687e-02f, -7.356456667e-02f, -1.223274879e-02f, -8.579730988e-02f, -1.221982762e-02f,
+-9.801714122e-02f, -1.220506709e-02f, -1.102222055e-01f, -1.218846813e-02f, -1.224106774e-01f, -1.217003353e-02f,
+-1.345807016e-01f, -1.214976609e-02f, -1.467304677e-01f, -1.212766860e-02f, -1.588581502e-01f, -1.210374571e-02f,
+-1.709618866e-01f, -1.207799930e-02f, -1.830398887e-01f, -1.205043402e-02f, -1.950903237e-01f, -1.202105451e-02f,
+-2.071113735e-01f, -1.198986359e-02f, -2.191012353e-01f, -1.195686776e-02f, -2.310581058e-01f, -1.192207169e-02f,
+-2.429801822e-01f, -1.188548002e-02f, -2.548656464e-01f, -1.184709743e-02f, -2.667127550e-01f, -1.180693228e-02f,
+-2.785196900e-01f, -1.176498830e-02f, -2.902846634e-01f, -1.172127202e-02f, -3.020059466e-01f, -1.167579088e-02f,
+-3.136817515e-01f, -1.162855141e-02f, -3.253102899e-01f, -1.157956105e-02f, -3.368898630e-01f, -1.152882725e-02f,
+-3.484186828e-01f, -1.147635654e-02f, -3.598950505e-01f, -1.142215729e-02f, -3.713172078e-01f, -1.136623882e-02f,
+-3.826834261e-01f, -1.130860765e-02f, -3.939920366e-01f, -1.124927402e-02f, -4.052413106e-01f, -1.118824631e-02f,
+-4.164295495e-01f, -1.112553291e-02f, -4.275550842e-01f, -1.106114499e-02f, -4.386162460e-01f, -1.099509094e-02f,
+-4.496113360e-01f, -1.092738099e-02f, -4.605387151e-01f, -1.085802633e-02f, -4.713967443e-01f, -1.078703534e-02f,
+-4.821837842e-01f, -1.071442012e-02f, -4.928981960e-01f, -1.064019185e-02f, -5.035383701e-01f, -1.056436077e-02f,
+-5.141027570e-01f, -1.048693806e-02f, -5.245896578e-01f, -1.040793676e-02f, -5.349976420e-01f, -1.032736897e-02f,
+-5.453249812e-01f, -1.024524495e-02f, -5.555702448e-01f, -1.016157772e-02f, -5.657318234e-01f, -1.007638033e-02f,
+-5.758081675e-01f, -9.989665821e-03f, -5.857978463e-01f, -9.901447222e-03f, -5.956993103e-01f, -9.811736643e-03f,
+-6.055110693e-01f, -9.720548987e-03f, -6.152315736e-01f, -9.627897292e-03f, -6.248595119e-01f, -9.533796459e-03f,
+-6.343932748e-01f, -9.438258596e-03f, -6.438315511e-01f, -9.341300465e-03f, -6.531728506e-01f, -9.242934175e-03f,
+-6.624158025e-01f, -9.143177420e-03f, -6.715589762e-01f, -9.042043239e-03f, -6.806010008e-01f, -8.939546533e-03f,
+-6.895405650e-01f, -8.835704997e-03f, -6.983762383e-01f, -8.730531670e-03f, -7.071067691e-01f, -8.624044247e-03f,
+-7.157308459e-01f, -8.516257629e-03f, -7.242470980e-01f, -8.407188579e-03f, -7.326542735e-01f, -8.296853863e-03f,
+-7.409511209e-01f, -8.185269311e-03f, -7.491363883e-01f, -8.072451688e-03f, -7.572088242e-01f, -7.958418690e-03f,
+-7.651672363e-01f, -7.843188010e-03f, -7.730104327e-01f, -7.726775017e-03f, -7.807372212e-01f, -7.609199267e-03f,
+-7.883464098e-01f, -7.490477059e-03f, -7.958369255e-01f, -7.370627020e-03f, -8.032075167e-01f, -7.249666844e-03f,
+-8.104571700e-01f, -7.127614692e-03f, -8.175848126e-01f, -7.004489657e-03f, -8.245893121e-01f, -6.880309433e-03f,
+-8.314695954e-01f, -6.755093113e-03f, -8.382247090e-01f, -6.628859788e-03f, -8.448535800e-01f, -6.501628086e-03f,
+-8.513551950e-01f, -6.373417098e-03f, -8.577286005e-01f, -6.244245917e-03f, -8.639728427e-01f, -6.114135031e-03f,
+-8.700869679e-01f, -5.983103067e-03f, -8.760700822e-01f, -5.851170048e-03f, -8.819212914e-01f, -5.718355998e-03f,
+-8.876396418e-01f, -5.584680941e-03f, -8.932242990e-01f, -5.450164434e-03f, -8.986744881e-01f, -5.314827431e-03f,
+-9.039893150e-01f, -5.178689957e-03f, -9.091680050e-01f, -5.041772500e-03f, -9.142097831e-01f, -4.904096015e-03f,
+-9.191138744e-01f, -4.765680991e-03f, -9.238795042e-01f, -4.626547918e-03f, -9.285060763e-01f, -4.486718215e-03f,
+-9.329928160e-01f, -4.346213304e-03f, -9.373390079e-01f, -4.205053207e-03f, -9.415440559e-01f, -4.063260276e-03f,
+-9.456073046e-01f, -3.920855001e-03f, -9.495281577e-01f, -3.777859733e-03f, -9.533060193e-01f, -3.634295426e-03f,
+-9.569403529e-01f, -3.490183735e-03f, -9.604305029e-01f, -3.345546313e-03f, -9.637760520e-01f, -3.200405277e-03f,
+-9.669764638e-01f, -3.054782050e-03f, -9.700312614e-01f, -2.908698982e-03f, -9.729399681e-01f, -2.762177726e-03f,
+-9.757021070e-01f, -2.615240635e-03f, -9.783173800e-01f, -2.467909595e-03f, -9.807852507e-01f, -2.320206957e-03f,
+-9.831054807e-01f, -2.172155073e-03f, -9.852776527e-01f, -2.023775829e-03f, -9.873014092e-01f, -1.875091810e-03f,
+-9.891765118e-01f, -1.726125483e-03f, -9.909026623e-01f, -1.576899202e-03f, -9.924795628e-01f, -1.427435433e-03f,
+-9.939069748e-01f, -1.277756644e-03f, -9.951847196e-01f, -1.127885538e-03f, -9.963126183e-01f, -9.778444655e-04f,
+-9.972904325e-01f, -8.276562439e-04f, -9.981181026e-01f, -6.773432833e-04f, -9.987954497e-01f, -5.269284011e-04f,
+-9.993223548e-01f, -3.764340945e-04f, -9.996988177e-01f, -2.258831373e-04f, -9.999247193e-01f, -7.529815775e-05f,
+-1.000000000e+00f, 7.529815775e-05f, -9.999247193e-01f, 2.258831373e-04f, -9.996988177e-01f, 3.764340945e-04f,
+-9.993223548e-01f, 5.269284011e-04f, -9.987954497e-01f, 6.773432833e-04f, -9.981181026e-01f, 8.276562439e-04f,
+-9.972904325e-01f, 9.778444655e-04f, -9.963126183e-01f, 1.127885538e-03f, -9.951847196e-01f, 1.277756644e-03f,
+-9.939069748e-01f, 1.427435433e-03f, -9.924795628e-01f, 1.576899202e-03f, -9.909026623e-01f, 1.726125483e-03f,
+-9.891765118e-01f, 1.875091810e-03f, -9.873014092e-01f, 2.023775829e-03f, -9.852776527e-01f, 2.172155073e-03f,
+-9.831054807e-01f, 2.320206957e-03f, -9.807852507e-01f, 2.467909595e-03f, -9.783173800e-01f, 2.615240635e-03f,
+-9.757021070e-01f, 2.762177726e-03f, -9.729399681e-01f, 2.908698982e-03f, -9.700312614e-01f, 3.054782050e-03f,
+-9.669764638e-01f, 3.200405277e-03f, -9.637760520e-01f, 3.345546313e-03f, -9.604305029e-01f, 3.490183735e-03f,
+-9.569403529e-01f, 3.634295426e-03f, -9.533060193e-01f, 3.777859733e-03f, -9.495281577e-01f, 3.920855001e-03f,
+-9.456073046e-01f, 4.063260276e-03f, -9.415440559e-01f, 4.205053207e-03f, -9.373390079e-01f, 4.346213304e-03f,
+-9.329928160e-01f, 4.486718215e-03f, -9.285060763e-01f, 4.626547918e-03f, -9.238795042e-01f, 4.765680991e-03f,
+-9.191138744e-01f, 4.904096015e-03f, -9.142097831e-01f, 5.041772500e-03f, -9.091680050e-01f, 5.178689957e-03f,
+-9.039893150e-01f, 5.314827431e-03f, -8.986744881e-01f, 5.450164434e-03f, -8.932242990e-01f, 5.584680941e-03f,
+-8.876396418e-01f, 5.718355998e-03f, -8.819212914e-01f, 5.851170048e-03f, -8.760700822e-01f, 5.983103067e-03f,
+-8.700869679e-01f, 6.114135031e-03f, -8.639728427e-01f, 6.244245917e-03f, -8.577286005e-01f, 6.373417098e-03f,
+-8.513551950e-01f, 6.501628086e-03f, -8.448535800e-01f, 6.628859788e-03f, -8.382247090e-01f, 6.755093113e-03f,
+-8.314695954e-01f, 6.880309433e-03f, -8.245893121e-01f, 7.004489657e-03f, -8.175848126e-01f, 7.127614692e-03f,
+-8.104571700e-01f, 7.249666844e-03f, -8.032075167e-01f, 7.370627020e-03f, -7.958369255e-01f, 7.490477059e-03f,
+-7.883464098e-01f, 7.609199267e-03f, -7.807372212e-01f, 7.726775017e-03f, -7.730104327e-01f, 7.843188010e-03f,
+-7.651672363e-01f, 7.958418690e-03f, -7.572088242e-01f, 8.072451688e-03f, -7.491363883e-01f, 8.185269311e-03f,
+-7.409511209e-01f, 8.296853863e-03f, -7.326542735e-01f, 8.407188579e-03f, -7.242470980e-01f, 8.516257629e-03f,
+-7.157308459e-01f, 8.624044247e-03f, -7.071067691e-01f, 8.730531670e-03f, -6.983762383e-01f, 8.835704997e-03f,
+-6.895405650e-01f, 8.939546533e-03f, -6.806010008e-01f, 9.042043239e-03f, -6.715589762e-01f, 9.143177420e-03f,
+-6.624158025e-01f, 9.242934175e-03f, -6.531728506e-01f, 9.341300465e-03f, -6.438315511e-01f, 9.438258596e-03f,
+-6.343932748e-01f, 9.533796459e-03f, -6.248595119e-01f, 9.627897292e-03f, -6.152315736e-01f, 9.720548987e-03f,
+-6.055110693e-01f, 9.811736643e-03f, -5.956993103e-01f, 9.901447222e-03f, -5.857978463e-01f, 9.989665821e-03f,
+-5.758081675e-01f, 1.007638033e-02f, -5.657318234e-01f, 1.016157772e-02f, -5.555702448e-01f, 1.024524495e-02f,
+-5.453249812e-01f, 1.032736897e-02f, -5.349976420e-01f, 1.040793676e-02f, -5.245896578e-01f, 1.048693806e-02f,
+-5.141027570e-01f, 1.056436077e-02f, -5.035383701e-01f, 1.064019185e-02f, -4.928981960e-01f, 1.071442012e-02f,
+-4.821837842e-01f, 1.078703534e-02f, -4.713967443e-01f, 1.085802633e-02f, -4.605387151e-01f, 1.092738099e-02f,
+-4.496113360e-01f, 1.099509094e-02f, -4.386162460e-01f, 1.106114499e-02f, -4.275550842e-01f, 1.112553291e-02f,
+-4.164295495e-01f, 1.118824631e-02f, -4.052413106e-01f, 1.124927402e-02f, -3.939920366e-01f, 1.130860765e-02f,
+-3.826834261e-01f, 1.136623882e-02f, -3.713172078e-01f, 1.142215729e-02f, -3.598950505e-01f, 1.147635654e-02f,
+-3.484186828e-01f, 1.152882725e-02f, -3.368898630e-01f, 1.157956105e-02f, -3.253102899e-01f, 1.162855141e-02f,
+-3.136817515e-01f, 1.167579088e-02f, -3.020059466e-01f, 1.172127202e-02f, -2.902846634e-01f, 1.176498830e-02f,
+-2.785196900e-01f, 1.180693228e-02f, -2.667127550e-01f, 1.184709743e-02f, -2.548656464e-01f, 1.188548002e-02f,
+-2.429801822e-01f, 1.192207169e-02f, -2.310581058e-01f, 1.195686776e-02f, -2.191012353e-01f, 1.198986359e-02f,
+-2.071113735e-01f, 1.202105451e-02f, -1.950903237e-01f, 1.205043402e-02f, -1.830398887e-01f, 1.207799930e-02f,
+-1.709618866e-01f, 1.210374571e-02f, -1.588581502e-01f, 1.212766860e-02f, -1.467304677e-01f, 1.214976609e-02f,
+-1.345807016e-01f, 1.217003353e-02f, -1.224106774e-01f, 1.218846813e-02f, -1.102222055e-01f, 1.220506709e-02f,
+-9.801714122e-02f, 1.221982762e-02f, -8.579730988e-02f, 1.223274879e-02f, -7.356456667e-02f, 1.224382687e-02f,
+-6.132073700e-02f, 1.225306187e-02f, -4.906767607e-02f, 1.226045098e-02f, -3.680722415e-02f, 1.226599421e-02f,
+-2.454122901e-02f, 1.226969063e-02f, -1.227153838e-02f, 1.227153838e-02f, -2.449293705e-16f, 1.227153838e-02f
+};
+
+static const float mixerPanLTable[34] = {
+1.000000000e+00f, -4.815280437e-03f, 9.951847196e-01f, -1.439946890e-02f, 9.807852507e-01f, -2.384489775e-02f,
+9.569403529e-01f, -3.306084871e-02f, 9.238795042e-01f, -4.195821285e-02f, 8.819212914e-01f, -5.045169592e-02f,
+8.314695954e-01f, -5.845910311e-02f, 7.730104923e-01f, -6.590372324e-02f, 7.071067691e-01f, -7.271349430e-02f,
+6.343932748e-01f, -7.882302999e-02f, 5.555702448e-01f, -8.417347074e-02f, 4.713967741e-01f, -8.871334791e-02f,
+3.826834261e-01f, -9.239879251e-02f, 2.902846336e-01f, -9.519428015e-02f, 1.950903535e-01f, -9.707321972e-02f,
+9.801713377e-02f, -9.801717848e-02f, -4.371138829e-08f, 0.000000000e+00f
+};
+
+static const float mixerPanRTable[34] = {
+0.000000000e+00f, 9.801714122e-02f, 9.801714122e-02f, 9.707318246e-02f, 1.950903237e-01f, 9.519433975e-02f,
+2.902846634e-01f, 9.239879251e-02f, 3.826834559e-01f, 8.871325850e-02f, 4.713967144e-01f, 8.417353034e-02f,
+5.555702448e-01f, 7.882302999e-02f, 6.343932748e-01f, 7.271349430e-02f, 7.071067691e-01f, 6.590366364e-02f,
+7.730104327e-01f, 5.845916271e-02f, 8.314695954e-01f, 5.045163631e-02f, 8.819212317e-01f, 4.195827246e-02f,
+9.238795042e-01f, 3.306084871e-02f, 9.569403529e-01f, 2.384489775e-02f, 9.807852507e-01f, 1.439946890e-02f,
+9.951847196e-01f, 4.815280437e-03f, 1.000000000e+00f, 0.000000000e+00f
+};
+
+static const float exp2Table[514] = {
+4.000000000e+00f, 1.465317905e-01f, 4.146531582e+00f, 1.518996954e-01f, 4.298431396e+00f, 1.574642211e-01f,
+4.455895901e+00f, 1.632318348e-01f, 4.619127750e+00f, 1.692122668e-01f, 4.788339615e+00f, 1.754110008e-01f,
+4.963750839e+00f, 1.818368286e-01f, 5.145587444e+00f, 1.884980500e-01f, 5.334085464e+00f, 1.954032928e-01f,
+5.529489040e+00f, 2.025614828e-01f, 5.732050419e+00f, 2.099819183e-01f, 5.942032337e+00f, 2.176731527e-01f,
+6.159705639e+00f, 2.256481797e-01f, 6.385353565e+00f, 2.339143306e-01f, 6.619267941e+00f, 2.424833030e-01f,
+6.861751556e+00f, 2.513661981e-01f, 7.113117695e+00f, 2.605744600e-01f, 7.373692036e+00f, 2.701200843e-01f,
+7.643812180e+00f, 2.800153792e-01f, 7.923827648e+00f, 2.902718186e-01f, 8.214098930e+00f, 3.009066880e-01f,
+8.515006065e+00f, 3.119297922e-01f, 8.826935768e+00f, 3.233566880e-01f, 9.150292397e+00f, 3.352021873e-01f,
+9.485494614e+00f, 3.474816382e-01f, 9.832976341e+00f, 3.602109253e-01f, 1.019318676e+01f, 3.734064996e-01f,
+1.056659412e+01f, 3.870854974e-01f, 1.095367908e+01f, 4.012655616e-01f, 1.135494518e+01f, 4.159651101e-01f,
+1.177091026e+01f, 4.312031567e-01f, 1.220211315e+01f, 4.469993711e-01f, 1.264911270e+01f, 4.633742869e-01f,
+1.311248684e+01f, 4.803467989e-01f, 1.359283352e+01f, 4.979455769e-01f, 1.409077930e+01f, 5.161867738e-01f,
+1.460696602e+01f, 5.350962281e-01f, 1.514206219e+01f, 5.546984076e-01f, 1.569676018e+01f, 5.750186443e-01f,
+1.627178001e+01f, 5.960832834e-01f, 1.686786270e+01f, 6.179195642e-01f, 1.748578262e+01f, 6.405557394e-01f,
+1.812633705e+01f, 6.640211940e-01f, 1.879035950e+01f, 6.883462667e-01f, 1.947870445e+01f, 7.135557532e-01f,
+2.019226074e+01f, 7.397020459e-01f, 2.093196297e+01f, 7.667995095e-01f, 2.169876289e+01f, 7.948896885e-01f,
+2.249365234e+01f, 8.240088224e-01f, 2.331766129e+01f, 8.541947007e-01f, 2.417185593e+01f, 8.854863644e-01f,
+2.505734253e+01f, 9.179243445e-01f, 2.597526550e+01f, 9.515506029e-01f, 2.692681694e+01f, 9.864087105e-01f,
+2.791322517e+01f, 1.022543788e+00f, 2.893577003e+01f, 1.060002565e+00f, 2.999577141e+01f, 1.098833561e+00f,
+3.109460640e+01f, 1.139087081e+00f, 3.223369217e+01f, 1.180815220e+00f, 3.341450882e+01f, 1.224060535e+00f,
+3.463856888e+01f, 1.268912911e+00f, 3.590748215e+01f, 1.315396905e+00f, 3.722287750e+01f, 1.363583803e+00f,
+3.858646393e+01f, 1.413535953e+00f, 3.999999619e+01f, 1.465317845e+00f, 4.146531677e+01f, 1.518996835e+00f,
+4.298431396e+01f, 1.574642181e+00f, 4.455895615e+01f, 1.632325888e+00f, 4.619128036e+01f, 1.692122817e+00f,
+4.788340378e+01f, 1.754110336e+00f, 4.963751221e+01f, 1.818368554e+00f, 5.145588303e+01f, 1.884980679e+00f,
+5.334086227e+01f, 1.954033136e+00f, 5.529489517e+01f, 2.025615215e+00f, 5.732051086e+01f, 2.099819422e+00f,
+5.942033005e+01f, 2.176721573e+00f, 6.159705353e+01f, 2.256481647e+00f, 6.385353470e+01f, 2.339143276e+00f,
+6.619268036e+01f, 2.424833059e+00f, 6.861750793e+01f, 2.513661861e+00f, 7.113117218e+01f, 2.605744600e+00f,
+7.373691559e+01f, 2.701200724e+00f, 7.643811798e+01f, 2.800153732e+00f, 7.923827362e+01f, 2.902731657e+00f,
+8.214099884e+01f, 3.009067059e+00f, 8.515007019e+01f, 3.119298220e+00f, 8.826937103e+01f, 3.233567238e+00f,
+9.150293732e+01f, 3.352022409e+00f, 9.485495758e+01f, 3.474816799e+00f, 9.832977295e+01f, 3.602109671e+00f,
+1.019318848e+02f, 3.734030485e+00f, 1.056659164e+02f, 3.870854139e+00f, 1.095367661e+02f, 4.012654781e+00f,
+1.135494232e+02f, 4.159650326e+00f, 1.177090759e+02f, 4.312030315e+00f, 1.220211029e+02f, 4.469993114e+00f,
+1.264910965e+02f, 4.633741856e+00f, 1.311248322e+02f, 4.803489685e+00f, 1.359283295e+02f, 4.979455471e+00f,
+1.409077911e+02f, 5.161867619e+00f, 1.460696564e+02f, 5.350962162e+00f, 1.514206085e+02f, 5.546983719e+00f,
+1.569675903e+02f, 5.750185966e+00f, 1.627177887e+02f, 5.960832119e+00f, 1.686786194e+02f, 6.179194927e+00f,
+1.748578186e+02f, 6.405497551e+00f, 1.812633057e+02f, 6.640209675e+00f, 1.879035187e+02f, 6.883460045e+00f,
+1.947869720e+02f, 7.135621548e+00f, 2.019225922e+02f, 7.397020340e+00f, 2.093196259e+02f, 7.667994976e+00f,
+2.169876099e+02f, 7.948896408e+00f, 2.249365082e+02f, 8.240087509e+00f, 2.331766052e+02f, 8.541946411e+00f,
+2.417185516e+02f, 8.854863167e+00f, 2.505734100e+02f, 9.179157257e+00f, 2.597525635e+02f, 9.515591621e+00f,
+2.692681580e+02f, 9.863994598e+00f, 2.791321411e+02f, 1.022552967e+01f, 2.893576660e+02f, 1.059992599e+01f,
+2.999576111e+02f, 1.098843479e+01f, 3.109460449e+02f, 1.139076424e+01f, 3.223367920e+02f, 1.180825806e+01f,
+3.341450500e+02f, 1.224060440e+01f, 3.463856812e+02f, 1.268924713e+01f, 3.590749207e+02f, 1.315384960e+01f,
+3.722287598e+02f, 1.363596535e+01f, 3.858647156e+02f, 1.413523102e+01f, 3.999999695e+02f, 1.465304089e+01f,
+4.146530151e+02f, 1.519010448e+01f, 4.298431091e+02f, 1.574627304e+01f, 4.455893860e+02f, 1.632340622e+01f,
+4.619127808e+02f, 1.692107010e+01f, 4.788338623e+02f, 1.754125977e+01f, 4.963751221e+02f, 1.818351364e+01f,
+5.145586548e+02f, 1.884997559e+01f, 5.334086304e+02f, 1.954014778e+01f, 5.529487305e+02f, 2.025633240e+01f,
+5.732050781e+02f, 2.099799538e+01f, 5.942030640e+02f, 2.176761436e+01f, 6.159707031e+02f, 2.256461143e+01f,
+6.385353394e+02f, 2.339165115e+01f, 6.619269409e+02f, 2.424810982e+01f, 6.861750488e+02f, 2.513685226e+01f,
+7.113119507e+02f, 2.605720901e+01f, 7.373691406e+02f, 2.701175308e+01f, 7.643808594e+02f, 2.800178719e+01f,
+7.923826904e+02f, 2.902704239e+01f, 8.214097290e+02f, 3.009094238e+01f, 8.515006714e+02f, 3.119268799e+01f,
+8.826933594e+02f, 3.233596420e+01f, 9.150292969e+02f, 3.351990891e+01f, 9.485491943e+02f, 3.474848175e+01f,
+9.832976685e+02f, 3.602075577e+01f, 1.019318481e+03f, 3.734099197e+01f, 1.056659424e+03f, 3.870819092e+01f,
+1.095367676e+03f, 4.012692261e+01f, 1.135494507e+03f, 4.159612656e+01f, 1.177090698e+03f, 4.312070465e+01f,
+1.220211426e+03f, 4.469952393e+01f, 1.264910889e+03f, 4.633698273e+01f, 1.311247925e+03f, 4.803532791e+01f,
+1.359283203e+03f, 4.979408646e+01f, 1.409077271e+03f, 5.161914062e+01f, 1.460696411e+03f, 5.350911713e+01f,
+1.514205566e+03f, 5.547033310e+01f, 1.569675903e+03f, 5.750131989e+01f, 1.627177246e+03f, 5.960885620e+01f,
+1.686786133e+03f, 6.179137039e+01f, 1.748577393e+03f, 6.405614471e+01f, 1.812633545e+03f, 6.640148926e+01f,
+1.879035034e+03f, 6.883524323e+01f, 1.947870361e+03f, 7.135556793e+01f, 2.019225952e+03f, 7.397089386e+01f,
+2.093196777e+03f, 7.667925262e+01f, 2.169875977e+03f, 7.948821259e+01f, 2.249364258e+03f, 8.240161896e+01f,
+2.331765869e+03f, 8.541866302e+01f, 2.417184570e+03f, 8.854942322e+01f, 2.505733887e+03f, 9.179156494e+01f,
+2.597525635e+03f, 9.515590668e+01f, 2.692681396e+03f, 9.863993835e+01f, 2.791321289e+03f, 1.022552872e+02f,
+2.893576660e+03f, 1.059992523e+02f, 2.999575928e+03f, 1.098843384e+02f, 3.109460205e+03f, 1.139076309e+02f,
+3.223367920e+03f, 1.180825729e+02f, 3.341450439e+03f, 1.224060364e+02f, 3.463856445e+03f, 1.268924637e+02f,
+3.590749023e+03f, 1.315384979e+02f, 3.722287354e+03f, 1.363570862e+02f, 3.858644531e+03f, 1.413548584e+02f,
+3.999999512e+03f, 1.465304108e+02f, 4.146529785e+03f, 1.519010315e+02f, 4.298430664e+03f, 1.574627228e+02f,
+4.455893555e+03f, 1.632340546e+02f, 4.619127441e+03f, 1.692106781e+02f, 4.788338379e+03f, 1.754125977e+02f,
+4.963750977e+03f, 1.818351288e+02f, 5.145585938e+03f, 1.884997559e+02f, 5.334085938e+03f, 1.954014587e+02f,
+5.529487305e+03f, 2.025633240e+02f, 5.732050781e+03f, 2.099799500e+02f, 5.942030762e+03f, 2.176761322e+02f,
+6.159706543e+03f, 2.256461029e+02f, 6.385352539e+03f, 2.339121094e+02f, 6.619265137e+03f, 2.424854584e+02f,
+6.861750488e+03f, 2.513638000e+02f, 7.113114258e+03f, 2.605767822e+02f, 7.373690918e+03f, 2.701175232e+02f,
+7.643808594e+03f, 2.800178528e+02f, 7.923826172e+03f, 2.902704163e+02f, 8.214096680e+03f, 3.009093933e+02f,
+8.515005859e+03f, 3.119268799e+02f, 8.826932617e+03f, 3.233596191e+02f, 9.150292969e+03f, 3.351990662e+02f,
+9.485491211e+03f, 3.474847717e+02f, 9.832976562e+03f, 3.602008057e+02f, 1.019317773e+04f, 3.734096375e+02f,
+1.056658691e+04f, 3.870816345e+02f, 1.095366895e+04f, 4.012689209e+02f, 1.135493750e+04f, 4.159609680e+02f,
+1.177089844e+04f, 4.312067566e+02f, 1.220210547e+04f, 4.469949036e+02f, 1.264910059e+04f, 4.633781738e+02f,
+1.311247852e+04f, 4.803442688e+02f, 1.359282227e+04f, 4.979405212e+02f, 1.409076270e+04f, 5.161910400e+02f,
+1.460695410e+04f, 5.350908203e+02f, 1.514204492e+04f, 5.547029419e+02f, 1.569674805e+04f, 5.750127563e+02f,
+1.627176074e+04f, 5.960881348e+02f, 1.686784961e+04f, 6.179132690e+02f, 1.748576172e+04f, 6.405610352e+02f,
+1.812632227e+04f, 6.640144653e+02f, 1.879033789e+04f, 6.883519287e+02f, 1.947868945e+04f, 7.135551758e+02f,
+2.019224414e+04f, 7.397083740e+02f, 2.093195312e+04f, 7.667919922e+02f, 2.169874414e+04f, 7.948964844e+02f,
+2.249364062e+04f, 8.240007324e+02f, 2.331764258e+04f, 8.541860352e+02f, 2.417182812e+04f, 8.854936523e+02f,
+2.505732227e+04f, 9.179149780e+02f, 2.597523633e+04f, 9.515584106e+02f, 2.692679492e+04f, 9.863986816e+02f,
+2.791319336e+04f, 1.022552185e+03f, 2.893574609e+04f, 1.059991821e+03f, 2.999573828e+04f, 1.098842651e+03f,
+3.109458008e+04f, 1.139075562e+03f, 3.223365625e+04f, 1.180824951e+03f, 3.341448047e+04f, 1.224059570e+03f,
+3.463853906e+04f, 1.268923706e+03f, 3.590746484e+04f, 1.315384033e+03f, 3.722284766e+04f, 1.363595459e+03f,
+3.858644531e+04f, 1.413521973e+03f, 3.999996484e+04f, 1.465302979e+03f
+};
+
+static const float exp2ExLowTable[514] = {
+2.000000000e+00f, 4.182444140e-02f, 2.041824341e+00f, 4.269908369e-02f, 2.084523439e+00f, 4.359201714e-02f,
+2.128115654e+00f, 4.450344294e-02f, 2.172619104e+00f, 4.543428868e-02f, 2.218053341e+00f, 4.638442025e-02f,
+2.264437675e+00f, 4.735442251e-02f, 2.311792135e+00f, 4.834470898e-02f, 2.360136747e+00f, 4.935570434e-02f,
+2.409492493e+00f, 5.038784072e-02f, 2.459880352e+00f, 5.144135654e-02f, 2.511321783e+00f, 5.251731724e-02f,
+2.563838959e+00f, 5.361557007e-02f, 2.617454529e+00f, 5.473678932e-02f, 2.672191381e+00f, 5.588145927e-02f,
+2.728072882e+00f, 5.705006421e-02f, 2.785122871e+00f, 5.824310705e-02f, 2.843366146e+00f, 5.946109816e-02f,
+2.902827024e+00f, 6.070431694e-02f, 2.963531494e+00f, 6.197402626e-02f, 3.025505543e+00f, 6.327003986e-02f,
+3.088775396e+00f, 6.459315866e-02f, 3.153368711e+00f, 6.594394147e-02f, 3.219312668e+00f, 6.732297689e-02f,
+3.286635637e+00f, 6.873085350e-02f, 3.355366468e+00f, 7.016788423e-02f, 3.425534248e+00f, 7.163552940e-02f,
+3.497169971e+00f, 7.313358784e-02f, 3.570303440e+00f, 7.466297597e-02f, 3.644966364e+00f, 7.622434199e-02f,
+3.721190691e+00f, 7.781836390e-02f, 3.799009085e+00f, 7.944571972e-02f, 3.878454924e+00f, 8.110678196e-02f,
+3.959561586e+00f, 8.280356228e-02f, 4.042365074e+00f, 8.453483880e-02f, 4.126900196e+00f, 8.630264550e-02f,
+4.213202477e+00f, 8.810671419e-02f, 4.301309586e+00f, 8.994993567e-02f, 4.391259193e+00f, 9.183098376e-02f,
+4.483090401e+00f, 9.375137836e-02f, 4.576841831e+00f, 9.571192414e-02f, 4.672553539e+00f, 9.771347791e-02f,
+4.770267010e+00f, 9.975688159e-02f, 4.870023727e+00f, 1.018430218e-01f, 4.971867085e+00f, 1.039727852e-01f,
+5.075839996e+00f, 1.061470807e-01f, 5.181986809e+00f, 1.083668545e-01f, 5.290353775e+00f, 1.106330454e-01f,
+5.400986671e+00f, 1.129466295e-01f, 5.513933182e+00f, 1.153085977e-01f, 5.629241943e+00f, 1.177199557e-01f,
+5.746962070e+00f, 1.201807708e-01f, 5.867142677e+00f, 1.226949841e-01f, 5.989837646e+00f, 1.252608150e-01f,
+6.115098476e+00f, 1.278802902e-01f, 6.242978573e+00f, 1.305545568e-01f, 6.373533249e+00f, 1.332847327e-01f,
+6.506818295e+00f, 1.360720247e-01f, 6.642889977e+00f, 1.389175802e-01f, 6.781807899e+00f, 1.418226659e-01f,
+6.923630238e+00f, 1.447884887e-01f, 7.068418980e+00f, 1.478163451e-01f, 7.216235161e+00f, 1.509075016e-01f,
+7.367142677e+00f, 1.540633142e-01f, 7.521205902e+00f, 1.572851241e-01f, 7.678491116e+00f, 1.605730057e-01f,
+7.839064121e+00f, 1.639322490e-01f, 8.002996445e+00f, 1.673604250e-01f, 8.170356750e+00f, 1.708603054e-01f,
+8.341217041e+00f, 1.744333804e-01f, 8.515650749e+00f, 1.780811697e-01f, 8.693731308e+00f, 1.818052381e-01f,
+8.875536919e+00f, 1.856071949e-01f, 9.061143875e+00f, 1.894886494e-01f, 9.250632286e+00f, 1.934512854e-01f,
+9.444084167e+00f, 1.974967718e-01f, 9.641580582e+00f, 2.016268671e-01f, 9.843207359e+00f, 2.058433294e-01f,
+1.004905128e+01f, 2.101479769e-01f, 1.025919914e+01f, 2.145426422e-01f, 1.047374153e+01f, 2.190274298e-01f,
+1.069276905e+01f, 2.236095518e-01f, 1.091637897e+01f, 2.282857299e-01f, 1.114466476e+01f, 2.330596894e-01f,
+1.137772369e+01f, 2.379334867e-01f, 1.161565781e+01f, 2.429091930e-01f, 1.185856628e+01f, 2.479889691e-01f,
+1.210655594e+01f, 2.531749606e-01f, 1.235973072e+01f, 2.584694326e-01f, 1.261820030e+01f, 2.638745904e-01f,
+1.288207436e+01f, 2.693927884e-01f, 1.315146732e+01f, 2.750264108e-01f, 1.342649364e+01f, 2.807778120e-01f,
+1.370727158e+01f, 2.866494954e-01f, 1.399392128e+01f, 2.926416099e-01f, 1.428656292e+01f, 2.987637520e-01f,
+1.458532619e+01f, 3.050115705e-01f, 1.489033794e+01f, 3.113900423e-01f, 1.520172787e+01f, 3.179019094e-01f,
+1.551963043e+01f, 3.245499432e-01f, 1.584418011e+01f, 3.313370049e-01f, 1.617551613e+01f, 3.382687271e-01f,
+1.651378632e+01f, 3.453371525e-01f, 1.685912323e+01f, 3.525588512e-01f, 1.721168137e+01f, 3.599373996e-01f,
+1.757161903e+01f, 3.674586117e-01f, 1.793907738e+01f, 3.751489818e-01f, 1.831422615e+01f, 3.829880655e-01f,
+1.869721413e+01f, 3.910034597e-01f, 1.908821869e+01f, 3.991738260e-01f, 1.948739243e+01f, 4.075279534e-01f,
+1.989492035e+01f, 4.160436094e-01f, 2.031096268e+01f, 4.247508049e-01f, 2.073571396e+01f, 4.336263537e-01f,
+2.116934013e+01f, 4.427015185e-01f, 2.161204147e+01f, 4.519521594e-01f, 2.206399536e+01f, 4.614033997e-01f,
+2.252539825e+01f, 4.710599184e-01f, 2.299645805e+01f, 4.809031188e-01f, 2.347736168e+01f, 4.909677207e-01f,
+2.396832848e+01f, 5.012269616e-01f, 2.446955490e+01f, 5.117169023e-01f, 2.498127174e+01f, 5.224096775e-01f,
+2.550368118e+01f, 5.333429575e-01f, 2.603702545e+01f, 5.444876552e-01f, 2.658151245e+01f, 5.558829308e-01f,
+2.713739586e+01f, 5.674986243e-01f, 2.770489502e+01f, 5.793755651e-01f, 2.828426933e+01f, 5.914821625e-01f,
+2.887575150e+01f, 6.038609743e-01f, 2.947961235e+01f, 6.164792180e-01f, 3.009609222e+01f, 6.293710470e-01f,
+3.072546387e+01f, 6.425428987e-01f, 3.136800575e+01f, 6.559693813e-01f, 3.202397537e+01f, 6.696978807e-01f,
+3.269367218e+01f, 6.836917996e-01f, 3.337736511e+01f, 6.980004907e-01f, 3.407536697e+01f, 7.125858068e-01f,
+3.478795242e+01f, 7.274991870e-01f, 3.551544952e+01f, 7.427009940e-01f, 3.625815201e+01f, 7.582446337e-01f,
+3.701639557e+01f, 7.740888000e-01f, 3.779048538e+01f, 7.902893424e-01f, 3.858077621e+01f, 8.068031669e-01f,
+3.938757706e+01f, 8.236883879e-01f, 4.021126556e+01f, 8.409001231e-01f, 4.105216599e+01f, 8.584850430e-01f,
+4.191065216e+01f, 8.764519095e-01f, 4.278710175e+01f, 8.947661519e-01f, 4.368186951e+01f, 9.134922624e-01f,
+4.459535980e+01f, 9.325805306e-01f, 4.552794266e+01f, 9.520980716e-01f, 4.648004150e+01f, 9.719930291e-01f,
+4.745203400e+01f, 9.923354387e-01f, 4.844437027e+01f, 1.013071179e+00f, 4.945743942e+01f, 1.034273267e+00f,
+5.049171448e+01f, 1.055885315e+00f, 5.154759979e+01f, 1.077983499e+00f, 5.262558365e+01f, 1.100508928e+00f,
+5.372608948e+01f, 1.123540998e+00f, 5.484963226e+01f, 1.147018433e+00f, 5.599665070e+01f, 1.171004891e+00f,
+5.716765594e+01f, 1.195512295e+00f, 5.836316681e+01f, 1.220493674e+00f, 5.958366013e+01f, 1.246036768e+00f,
+6.082969666e+01f, 1.272073865e+00f, 6.210177231e+01f, 1.298696518e+00f, 6.340046692e+01f, 1.325833917e+00f,
+6.472630310e+01f, 1.353581667e+00f, 6.607988739e+01f, 1.381865978e+00f, 6.746174622e+01f, 1.410786390e+00f,
+6.887253571e+01f, 1.440266132e+00f, 7.031280518e+01f, 1.470408678e+00f, 7.178321075e+01f, 1.501134276e+00f,
+7.328434753e+01f, 1.532526016e+00f, 7.481687164e+01f, 1.564599633e+00f, 7.638146973e+01f, 1.597293377e+00f,
+7.797876740e+01f, 1.630722284e+00f, 7.960948944e+01f, 1.664797783e+00f, 8.127428436e+01f, 1.699639559e+00f,
+8.297392273e+01f, 1.735155106e+00f, 8.470907593e+01f, 1.771469235e+00f, 8.648054504e+01f, 1.808485746e+00f,
+8.828903198e+01f, 1.846334696e+00f, 9.013536835e+01f, 1.884915590e+00f, 9.202028656e+01f, 1.924364090e+00f,
+9.394464874e+01f, 1.964575410e+00f, 9.590922546e+01f, 2.005691051e+00f, 9.791491699e+01f, 2.047601938e+00f,
+9.996251678e+01f, 2.090421438e+00f, 1.020529404e+02f, 2.134170771e+00f, 1.041871109e+02f, 2.178766251e+00f,
+1.063658752e+02f, 2.224364758e+00f, 1.085902405e+02f, 2.270844698e+00f, 1.108610840e+02f, 2.318370342e+00f,
+1.131794510e+02f, 2.366814613e+00f, 1.155462723e+02f, 2.416348696e+00f, 1.179626160e+02f, 2.466840506e+00f,
+1.204294586e+02f, 2.518467903e+00f, 1.229479294e+02f, 2.571093559e+00f, 1.255190201e+02f, 2.624902725e+00f,
+1.281439209e+02f, 2.679752350e+00f, 1.308236694e+02f, 2.735835791e+00f, 1.335595093e+02f, 2.793003559e+00f,
+1.363525085e+02f, 2.851410866e+00f, 1.392039185e+02f, 2.911086798e+00f, 1.421150055e+02f, 2.971916676e+00f,
+1.450869293e+02f, 3.034114361e+00f, 1.481210480e+02f, 3.097515106e+00f, 1.512185516e+02f, 3.162341356e+00f,
+1.543809052e+02f, 3.228421450e+00f, 1.576093140e+02f, 3.295987606e+00f, 1.609053040e+02f, 3.364860296e+00f,
+1.642701721e+02f, 3.435281754e+00f, 1.677054443e+02f, 3.507065296e+00f, 1.712125092e+02f, 3.580462933e+00f,
+1.747929840e+02f, 3.655279875e+00f, 1.784482574e+02f, 3.731779575e+00f, 1.821800385e+02f, 3.809758425e+00f,
+1.859897919e+02f, 3.889428377e+00f, 1.898792267e+02f, 3.970828295e+00f, 1.938500519e+02f, 4.053802490e+00f,
+1.979038544e+02f, 4.138709545e+00f, 2.020425720e+02f, 4.225124836e+00f, 2.062676849e+02f, 4.313550472e+00f,
+2.105812378e+02f, 4.403686047e+00f, 2.149849243e+02f, 4.495848656e+00f, 2.194807739e+02f, 4.589793682e+00f,
+2.240705719e+02f, 4.685851097e+00f, 2.287564240e+02f, 4.783766270e+00f, 2.335401917e+02f, 4.883883476e+00f,
+2.384240723e+02f, 4.985936642e+00f, 2.434100037e+02f, 5.090202808e+00f, 2.485002136e+02f, 5.196733475e+00f,
+2.536969452e+02f, 5.305323601e+00f, 2.590022583e+02f, 5.416268826e+00f, 2.644185486e+02f, 5.529712677e+00f,
+2.699482422e+02f, 5.645172119e+00f, 2.755934143e+02f, 5.763224125e+00f, 2.813566284e+02f, 5.883744717e+00f,
+2.872403870e+02f, 6.006979942e+00f, 2.932473755e+02f, 6.132404327e+00f, 2.993797607e+02f, 6.260645390e+00f,
+3.056404114e+02f, 6.391568661e+00f, 3.120319824e+02f, 6.525439739e+00f, 3.185574341e+02f, 6.661689758e+00f,
+3.252191162e+02f, 6.800999165e+00f, 3.320201111e+02f, 6.943222046e+00f, 3.389633484e+02f, 7.088418961e+00f,
+3.460517578e+02f, 7.236886024e+00f, 3.532886353e+02f, 7.387990475e+00f, 3.606766357e+02f, 7.542488575e+00f,
+3.682191162e+02f, 7.700217724e+00f, 3.759193420e+02f, 7.861498833e+00f, 3.837808533e+02f, 8.025645256e+00f,
+3.918064880e+02f, 8.193477631e+00f, 3.999999695e+02f, 8.364820480e+00f
+};
+
+static const float exp2ExHighTable[1026] = {
+3.999999695e+02f, 3.068075418e+00f, 4.030680237e+02f, 3.091339588e+00f, 4.061593628e+02f, 3.115319252e+00f,
+4.092746887e+02f, 3.139214277e+00f, 4.124139099e+02f, 3.163017988e+00f, 4.155769348e+02f, 3.187553644e+00f,
+4.187644958e+02f, 3.212002754e+00f, 4.219764709e+02f, 3.236358404e+00f, 4.252128296e+02f, 3.261462927e+00f,
+4.284743042e+02f, 3.286193609e+00f, 4.317604980e+02f, 3.311684608e+00f, 4.350721741e+02f, 3.337085962e+00f,
+4.384092712e+02f, 3.362390041e+00f, 4.417716675e+02f, 3.388472080e+00f, 4.451601257e+02f, 3.414165974e+00f,
+4.485743103e+02f, 3.440649748e+00f, 4.520149536e+02f, 3.467040062e+00f, 4.554819946e+02f, 3.493329525e+00f,
+4.589753113e+02f, 3.520427465e+00f, 4.624957581e+02f, 3.547429800e+00f, 4.660431824e+02f, 3.574328899e+00f,
+4.696174927e+02f, 3.602055073e+00f, 4.732195435e+02f, 3.629368305e+00f, 4.768489380e+02f, 3.657521486e+00f,
+4.805064392e+02f, 3.685575247e+00f, 4.841920166e+02f, 3.713521957e+00f, 4.879055481e+02f, 3.742327929e+00f,
+4.916478577e+02f, 3.770704746e+00f, 4.954185791e+02f, 3.799954176e+00f, 4.992185364e+02f, 3.829100609e+00f,
+5.030476379e+02f, 3.858135462e+00f, 5.069057617e+02f, 3.888063192e+00f, 5.107938232e+02f, 3.917885303e+00f,
+5.147117310e+02f, 3.947593451e+00f, 5.186593018e+02f, 3.978214979e+00f, 5.226375122e+02f, 4.008380413e+00f,
+5.266459351e+02f, 4.039473534e+00f, 5.306853638e+02f, 4.070457458e+00f, 5.347558594e+02f, 4.101322174e+00f,
+5.388571777e+02f, 4.133136272e+00f, 5.429902954e+02f, 4.164476395e+00f, 5.471547852e+02f, 4.196780682e+00f,
+5.513515625e+02f, 4.228970528e+00f, 5.555805054e+02f, 4.261037827e+00f, 5.598415527e+02f, 4.294090748e+00f,
+5.641356201e+02f, 4.327027321e+00f, 5.684627075e+02f, 4.359837532e+00f, 5.728225098e+02f, 4.393657207e+00f,
+5.772161865e+02f, 4.426972866e+00f, 5.816431274e+02f, 4.461312771e+00f, 5.861044312e+02f, 4.495532036e+00f,
+5.905999756e+02f, 4.529620171e+00f, 5.951296387e+02f, 4.564756870e+00f, 5.996943970e+02f, 4.599769115e+00f,
+6.042941284e+02f, 4.634647846e+00f, 6.089287720e+02f, 4.670598984e+00f, 6.135993652e+02f, 4.706014633e+00f,
+6.183054199e+02f, 4.742519379e+00f, 6.230479126e+02f, 4.778895378e+00f, 6.278267822e+02f, 4.815132141e+00f,
+6.326419678e+02f, 4.852483273e+00f, 6.374944458e+02f, 4.889278412e+00f, 6.423837280e+02f, 4.927204609e+00f,
+6.473109131e+02f, 4.964997292e+00f, 6.522758789e+02f, 5.002645016e+00f, 6.572785645e+02f, 5.041450977e+00f,
+6.623200073e+02f, 5.080119610e+00f, 6.674001465e+02f, 5.118640423e+00f, 6.725187378e+02f, 5.158346176e+00f,
+6.776771240e+02f, 5.197460175e+00f, 6.828745728e+02f, 5.237777233e+00f, 6.881123657e+02f, 5.277951717e+00f,
+6.933903198e+02f, 5.317972660e+00f, 6.987082520e+02f, 5.359224796e+00f, 7.040675049e+02f, 5.399861813e+00f,
+7.094673462e+02f, 5.441748619e+00f, 7.149091187e+02f, 5.483488083e+00f, 7.203925781e+02f, 5.525067806e+00f,
+7.259176636e+02f, 5.567925930e+00f, 7.314855957e+02f, 5.610632896e+00f, 7.370961914e+02f, 5.653176308e+00f,
+7.427493896e+02f, 5.697028160e+00f, 7.484464111e+02f, 5.740227222e+00f, 7.541866455e+02f, 5.784754276e+00f,
+7.599714355e+02f, 5.829124451e+00f, 7.658005371e+02f, 5.873324871e+00f, 7.716738281e+02f, 5.918884277e+00f,
+7.775927124e+02f, 5.964283466e+00f, 7.835570068e+02f, 6.009508610e+00f, 7.895665283e+02f, 6.056124687e+00f,
+7.956226807e+02f, 6.102046490e+00f, 8.017247314e+02f, 6.149380207e+00f, 8.078740845e+02f, 6.196547031e+00f,
+8.140706177e+02f, 6.243533611e+00f, 8.203141479e+02f, 6.291965008e+00f, 8.266061401e+02f, 6.339674950e+00f,
+8.329458008e+02f, 6.388851643e+00f, 8.393346558e+02f, 6.437855721e+00f, 8.457725220e+02f, 6.486671925e+00f,
+8.522591553e+02f, 6.536989212e+00f, 8.587961426e+02f, 6.587129116e+00f, 8.653833008e+02f, 6.637077332e+00f,
+8.720203857e+02f, 6.688561440e+00f, 8.787089233e+02f, 6.739278316e+00f, 8.854482422e+02f, 6.791555405e+00f,
+8.922397461e+02f, 6.843647957e+00f, 8.990834351e+02f, 6.895541191e+00f, 9.059789429e+02f, 6.949029922e+00f,
+9.129279785e+02f, 7.001722336e+00f, 9.199296875e+02f, 7.056035042e+00f, 9.269857788e+02f, 7.110156059e+00f,
+9.340958862e+02f, 7.164070129e+00f, 9.412599487e+02f, 7.219642162e+00f, 9.484796143e+02f, 7.275018215e+00f,
+9.557546387e+02f, 7.330182076e+00f, 9.630848389e+02f, 7.387042522e+00f, 9.704718628e+02f, 7.443056107e+00f,
+9.779149170e+02f, 7.500792503e+00f, 9.854157104e+02f, 7.558324814e+00f, 9.929740601e+02f, 7.615637302e+00f,
+1.000589661e+03f, 7.674712181e+00f, 1.008264404e+03f, 7.732906818e+00f, 1.015997314e+03f, 7.792891502e+00f,
+1.023790161e+03f, 7.852664471e+00f, 1.031642822e+03f, 7.912208557e+00f, 1.039555054e+03f, 7.973583698e+00f,
+1.047528687e+03f, 8.034742355e+00f, 1.055563354e+03f, 8.095667839e+00f, 1.063659058e+03f, 8.158466339e+00f,
+1.071817505e+03f, 8.220329285e+00f, 1.080037842e+03f, 8.284094810e+00f, 1.088321899e+03f, 8.347635269e+00f,
+1.096669556e+03f, 8.410932541e+00f, 1.105080566e+03f, 8.476176262e+00f, 1.113556641e+03f, 8.541190147e+00f,
+1.122097900e+03f, 8.605955124e+00f, 1.130703857e+03f, 8.672712326e+00f, 1.139376587e+03f, 8.738474846e+00f,
+1.148114990e+03f, 8.806259155e+00f, 1.156921265e+03f, 8.873805046e+00f, 1.165795044e+03f, 8.941092491e+00f,
+1.174736206e+03f, 9.010448456e+00f, 1.183746582e+03f, 9.078771591e+00f, 1.192825439e+03f, 9.149196625e+00f,
+1.201974609e+03f, 9.219372749e+00f, 1.211193970e+03f, 9.289279938e+00f, 1.220483276e+03f, 9.361337662e+00f,
+1.229844604e+03f, 9.433140755e+00f, 1.239277710e+03f, 9.504669189e+00f, 1.248782349e+03f, 9.578396797e+00f,
+1.258360840e+03f, 9.651026726e+00f, 1.268011841e+03f, 9.725890160e+00f, 1.277737671e+03f, 9.800489426e+00f,
+1.287538208e+03f, 9.874803543e+00f, 1.297412964e+03f, 9.951402664e+00f, 1.307364380e+03f, 1.002686119e+01f,
+1.317391235e+03f, 1.010464001e+01f, 1.327495850e+03f, 1.018214512e+01f, 1.337678101e+03f, 1.025935268e+01f,
+1.347937378e+03f, 1.033893490e+01f, 1.358276367e+03f, 1.041823673e+01f, 1.368694580e+03f, 1.049723434e+01f,
+1.379191772e+03f, 1.057866192e+01f, 1.389770508e+03f, 1.065887642e+01f, 1.400429321e+03f, 1.074155807e+01f,
+1.411170898e+03f, 1.082394791e+01f, 1.421994873e+03f, 1.090602207e+01f, 1.432900879e+03f, 1.099062061e+01f,
+1.443891479e+03f, 1.107492065e+01f, 1.454966431e+03f, 1.115889835e+01f, 1.466125366e+03f, 1.124545860e+01f,
+1.477370728e+03f, 1.133072948e+01f, 1.488701538e+03f, 1.141862202e+01f, 1.500120117e+03f, 1.150620461e+01f,
+1.511626343e+03f, 1.159345245e+01f, 1.523219727e+03f, 1.168338394e+01f, 1.534903198e+03f, 1.177197552e+01f,
+1.546675171e+03f, 1.186329079e+01f, 1.558538452e+03f, 1.195428467e+01f, 1.570492676e+03f, 1.204493046e+01f,
+1.582537598e+03f, 1.213836288e+01f, 1.594676025e+03f, 1.223146629e+01f, 1.606907471e+03f, 1.232421398e+01f,
+1.619231689e+03f, 1.241981316e+01f, 1.631651489e+03f, 1.251398849e+01f, 1.644165527e+03f, 1.261106014e+01f,
+1.656776489e+03f, 1.270778942e+01f, 1.669484375e+03f, 1.280414867e+01f, 1.682288452e+03f, 1.290347099e+01f,
+1.695192017e+03f, 1.300131416e+01f, 1.708193237e+03f, 1.310216522e+01f, 1.721295410e+03f, 1.320266151e+01f,
+1.734498047e+03f, 1.330277348e+01f, 1.747800903e+03f, 1.340596294e+01f, 1.761206787e+03f, 1.350878906e+01f,
+1.774715576e+03f, 1.361122227e+01f, 1.788326904e+03f, 1.371680546e+01f, 1.802043701e+03f, 1.382081509e+01f,
+1.815864502e+03f, 1.392802429e+01f, 1.829792480e+03f, 1.403485489e+01f, 1.843827393e+03f, 1.414127636e+01f,
+1.857968628e+03f, 1.425097084e+01f, 1.872219604e+03f, 1.436027813e+01f, 1.886579834e+03f, 1.446916771e+01f,
+1.901049072e+03f, 1.458140564e+01f, 1.915630493e+03f, 1.469197178e+01f, 1.930322388e+03f, 1.480593777e+01f,
+1.945128296e+03f, 1.491950226e+01f, 1.960047852e+03f, 1.503263187e+01f, 1.975080444e+03f, 1.514924049e+01f,
+1.990229736e+03f, 1.526411247e+01f, 2.005493896e+03f, 1.538251686e+01f, 2.020876343e+03f, 1.550050354e+01f,
+2.036376831e+03f, 1.561803913e+01f, 2.051994873e+03f, 1.573918915e+01f, 2.067734131e+03f, 1.585991192e+01f,
+2.083593994e+03f, 1.598017216e+01f, 2.099574219e+03f, 1.610413170e+01f, 2.115678223e+03f, 1.622624397e+01f,
+2.131904541e+03f, 1.635211182e+01f, 2.148256592e+03f, 1.647753525e+01f, 2.164734131e+03f, 1.660247803e+01f,
+2.181336670e+03f, 1.673126411e+01f, 2.198067871e+03f, 1.685813332e+01f, 2.214926025e+03f, 1.698890114e+01f,
+2.231915039e+03f, 1.711920929e+01f, 2.249034180e+03f, 1.724901962e+01f, 2.266283203e+03f, 1.738282013e+01f,
+2.283666016e+03f, 1.751614952e+01f, 2.301182129e+03f, 1.764896965e+01f, 2.318831055e+03f, 1.778587341e+01f,
+2.336616943e+03f, 1.792073822e+01f, 2.354537842e+03f, 1.805974960e+01f, 2.372597412e+03f, 1.819827080e+01f,
+2.390795898e+03f, 1.833626366e+01f, 2.409132080e+03f, 1.847849846e+01f, 2.427610596e+03f, 1.861861420e+01f,
+2.446229248e+03f, 1.876304054e+01f, 2.464992188e+03f, 1.890695572e+01f, 2.483899170e+03f, 1.905032158e+01f,
+2.502949463e+03f, 1.919642830e+01f, 2.522145996e+03f, 1.934533691e+01f, 2.541491211e+03f, 1.949202538e+01f,
+2.560983154e+03f, 1.964322662e+01f, 2.580626465e+03f, 1.979389381e+01f, 2.600420410e+03f, 1.994398308e+01f,
+2.620364258e+03f, 2.009869003e+01f, 2.640463135e+03f, 2.025285149e+01f, 2.660715820e+03f, 2.040642166e+01f,
+2.681122314e+03f, 2.056471443e+01f, 2.701687012e+03f, 2.072065163e+01f, 2.722407715e+03f, 2.088138199e+01f,
+2.743289062e+03f, 2.104154587e+01f, 2.764330566e+03f, 2.120109749e+01f, 2.785531738e+03f, 2.136555481e+01f,
+2.806897217e+03f, 2.152943230e+01f, 2.828426758e+03f, 2.169268417e+01f, 2.850119385e+03f, 2.186095428e+01f,
+2.871980469e+03f, 2.202672005e+01f, 2.894007080e+03f, 2.219758224e+01f, 2.916204590e+03f, 2.236784172e+01f,
+2.938572510e+03f, 2.253744888e+01f, 2.961109863e+03f, 2.271227264e+01f, 2.983822266e+03f, 2.288449287e+01f,
+3.006706787e+03f, 2.306200981e+01f, 3.029768799e+03f, 2.323889923e+01f, 3.053007568e+03f, 2.341511154e+01f,
+3.076422607e+03f, 2.359674454e+01f, 3.100019531e+03f, 2.377773476e+01f, 3.123797119e+03f, 2.395803452e+01f,
+3.147755127e+03f, 2.414387894e+01f, 3.171899170e+03f, 2.432695389e+01f, 3.196226074e+03f, 2.451565933e+01f,
+3.220741699e+03f, 2.470369911e+01f, 3.245445312e+03f, 2.489101791e+01f, 3.270336426e+03f, 2.508409882e+01f,
+3.295420654e+03f, 2.527430344e+01f, 3.320694824e+03f, 2.547035789e+01f, 3.346165283e+03f, 2.566571999e+01f,
+3.371830811e+03f, 2.586033440e+01f, 3.397691162e+03f, 2.606093407e+01f, 3.423752197e+03f, 2.626082611e+01f,
+3.450012939e+03f, 2.645995522e+01f, 3.476472900e+03f, 2.666520500e+01f, 3.503138184e+03f, 2.686739922e+01f,
+3.530005615e+03f, 2.707581139e+01f, 3.557081299e+03f, 2.728348732e+01f, 3.584364990e+03f, 2.749036980e+01f,
+3.611855225e+03f, 2.770361328e+01f, 3.639558838e+03f, 2.791610527e+01f, 3.667474854e+03f, 2.812778282e+01f,
+3.695602783e+03f, 2.834597206e+01f, 3.723948730e+03f, 2.856091118e+01f, 3.752509521e+03f, 2.878245926e+01f,
+3.781291992e+03f, 2.900322533e+01f, 3.810295410e+03f, 2.922314835e+01f, 3.839518555e+03f, 2.944983292e+01f,
+3.868968262e+03f, 2.967314148e+01f, 3.898641357e+03f, 2.990331650e+01f, 3.928544678e+03f, 3.013268089e+01f,
+3.958677490e+03f, 3.036116791e+01f, 3.989038574e+03f, 3.059667969e+01f, 4.019635254e+03f, 3.083136368e+01f,
+4.050466553e+03f, 3.106514740e+01f, 4.081531738e+03f, 3.130611992e+01f, 4.112837891e+03f, 3.154350471e+01f,
+4.144381348e+03f, 3.178818893e+01f, 4.176169434e+03f, 3.203200912e+01f, 4.208201660e+03f, 3.227489853e+01f,
+4.240476562e+03f, 3.252525711e+01f, 4.273001953e+03f, 3.277188492e+01f, 4.305773438e+03f, 3.302610016e+01f,
+4.338799805e+03f, 3.327941513e+01f, 4.372079102e+03f, 3.353176117e+01f, 4.405610840e+03f, 3.379187012e+01f,
+4.439402832e+03f, 3.405105972e+01f, 4.473454102e+03f, 3.430925751e+01f, 4.507763184e+03f, 3.457539749e+01f,
+4.542338379e+03f, 3.483757019e+01f, 4.577176270e+03f, 3.510780716e+01f, 4.612283691e+03f, 3.537709045e+01f,
+4.647661133e+03f, 3.564534378e+01f, 4.683306152e+03f, 3.592184448e+01f, 4.719228027e+03f, 3.619737244e+01f,
+4.755425781e+03f, 3.647184753e+01f, 4.791897461e+03f, 3.675476074e+01f, 4.828652344e+03f, 3.703345871e+01f,
+4.865685547e+03f, 3.732072830e+01f, 4.903006348e+03f, 3.760698700e+01f, 4.940613281e+03f, 3.789214706e+01f,
+4.978505371e+03f, 3.818607712e+01f, 5.016691406e+03f, 3.847563171e+01f, 5.055166992e+03f, 3.877408981e+01f,
+5.093941406e+03f, 3.907149124e+01f, 5.133012695e+03f, 3.936775970e+01f, 5.172380371e+03f, 3.967313766e+01f,
+5.212053711e+03f, 3.997743607e+01f, 5.252031250e+03f, 4.028057480e+01f, 5.292311523e+03f, 4.059303284e+01f,
+5.332904785e+03f, 4.090083694e+01f, 5.373805664e+03f, 4.121810532e+01f, 5.415023438e+03f, 4.153425598e+01f,
+5.456558105e+03f, 4.184919739e+01f, 5.498407227e+03f, 4.217382431e+01f, 5.540581055e+03f, 4.249361420e+01f,
+5.583074707e+03f, 4.282323837e+01f, 5.625897949e+03f, 4.315169907e+01f, 5.669049316e+03f, 4.347890472e+01f,
+5.712528320e+03f, 4.381617355e+01f, 5.756344727e+03f, 4.415225220e+01f, 5.800496582e+03f, 4.448704529e+01f,
+5.844983887e+03f, 4.483213043e+01f, 5.889815918e+03f, 4.517208099e+01f, 5.934988281e+03f, 4.552248001e+01f,
+5.980510742e+03f, 4.587164688e+01f, 6.026382324e+03f, 4.621947861e+01f, 6.072601562e+03f, 4.657800293e+01f,
+6.119179688e+03f, 4.693119049e+01f, 6.166110840e+03f, 4.729523468e+01f, 6.213406250e+03f, 4.765800095e+01f,
+6.261063965e+03f, 4.801937485e+01f, 6.309083496e+03f, 4.839186478e+01f, 6.357475098e+03f, 4.876303864e+01f,
+6.406238281e+03f, 4.913279343e+01f, 6.455371094e+03f, 4.951391602e+01f, 6.504885254e+03f, 4.988936615e+01f,
+6.554774414e+03f, 5.027635956e+01f, 6.605050781e+03f, 5.066198730e+01f, 6.655712891e+03f, 5.104614258e+01f,
+6.706758789e+03f, 5.144210815e+01f, 6.758201172e+03f, 5.183668137e+01f, 6.810037598e+03f, 5.222974014e+01f,
+6.862267578e+03f, 5.263488770e+01f, 6.914902344e+03f, 5.303400421e+01f, 6.967936523e+03f, 5.344538879e+01f,
+7.021381836e+03f, 5.385532761e+01f, 7.075237305e+03f, 5.426369476e+01f, 7.129500977e+03f, 5.468461990e+01f,
+7.184185547e+03f, 5.509927368e+01f, 7.239284668e+03f, 5.552668381e+01f, 7.294811523e+03f, 5.595258331e+01f,
+7.350764160e+03f, 5.637685394e+01f, 7.407140625e+03f, 5.681417084e+01f, 7.463955078e+03f, 5.724994659e+01f,
+7.521205078e+03f, 5.768405533e+01f, 7.578889160e+03f, 5.813151169e+01f, 7.637020508e+03f, 5.857230377e+01f,
+7.695592773e+03f, 5.902665329e+01f, 7.754619629e+03f, 5.947939682e+01f, 7.814098633e+03f, 5.993041229e+01f,
+7.874029297e+03f, 6.039529419e+01f, 7.934424316e+03f, 6.085325241e+01f, 7.995277832e+03f, 6.132529449e+01f,
+8.056603027e+03f, 6.179566956e+01f, 8.118398926e+03f, 6.226424789e+01f, 8.180663086e+03f, 6.274723053e+01f,
+8.243410156e+03f, 6.322851562e+01f, 8.306638672e+03f, 6.370795822e+01f, 8.370346680e+03f, 6.420214081e+01f,
+8.434548828e+03f, 6.468896484e+01f, 8.499238281e+03f, 6.519075775e+01f, 8.564428711e+03f, 6.569078827e+01f,
+8.630119141e+03f, 6.618889618e+01f, 8.696308594e+03f, 6.670233154e+01f, 8.763010742e+03f, 6.721395111e+01f,
+8.830224609e+03f, 6.772360992e+01f, 8.897948242e+03f, 6.824894714e+01f, 8.966197266e+03f, 6.876645660e+01f,
+9.034963867e+03f, 6.929988098e+01f, 9.104263672e+03f, 6.983142090e+01f, 9.174094727e+03f, 7.036093140e+01f,
+9.244456055e+03f, 7.090672302e+01f, 9.315362305e+03f, 7.144438934e+01f, 9.386806641e+03f, 7.199858093e+01f,
+9.458805664e+03f, 7.255082703e+01f, 9.531356445e+03f, 7.310095978e+01f, 9.604457031e+03f, 7.366800690e+01f,
+9.678125000e+03f, 7.423304749e+01f, 9.752358398e+03f, 7.479593658e+01f, 9.827154297e+03f, 7.537612915e+01f,
+9.902530273e+03f, 7.594768524e+01f, 9.978478516e+03f, 7.653681183e+01f, 1.005501465e+04f, 7.712386322e+01f,
+1.013213867e+04f, 7.770867157e+01f, 1.020984766e+04f, 7.831146240e+01f, 1.028815918e+04f, 7.890527344e+01f,
+1.036706445e+04f, 7.951734161e+01f, 1.044658105e+04f, 8.012725830e+01f, 1.052670898e+04f, 8.073483276e+01f,
+1.060744336e+04f, 8.136109924e+01f, 1.068880469e+04f, 8.198515320e+01f, 1.077079004e+04f, 8.260681915e+01f,
+1.085339648e+04f, 8.324760437e+01f, 1.093664453e+04f, 8.387884521e+01f, 1.102052344e+04f, 8.452949524e+01f,
+1.110505273e+04f, 8.517785645e+01f, 1.119023047e+04f, 8.582373047e+01f, 1.127605371e+04f, 8.648947144e+01f,
+1.136254395e+04f, 8.714528656e+01f, 1.144968848e+04f, 8.782128143e+01f, 1.153750977e+04f, 8.849488831e+01f,
+1.162600488e+04f, 8.916591644e+01f, 1.171517090e+04f, 8.985757446e+01f, 1.180502832e+04f, 9.054679871e+01f,
+1.189557520e+04f, 9.123339081e+01f, 1.198680859e+04f, 9.194109344e+01f, 1.207875000e+04f, 9.263825226e+01f,
+1.217138770e+04f, 9.335684967e+01f, 1.226474512e+04f, 9.407291412e+01f, 1.235881836e+04f, 9.478623962e+01f,
+1.245360449e+04f, 9.552149963e+01f, 1.254912598e+04f, 9.625416565e+01f, 1.264537988e+04f, 9.698403168e+01f,
+1.274236426e+04f, 9.773634338e+01f, 1.284010059e+04f, 9.847744751e+01f, 1.293857715e+04f, 9.924134064e+01f,
+1.303781934e+04f, 1.000025406e+02f, 1.313782129e+04f, 1.007608261e+02f, 1.323858203e+04f, 1.015424271e+02f,
+1.334012500e+04f, 1.023123932e+02f, 1.344243750e+04f, 1.031060333e+02f, 1.354554297e+04f, 1.038968811e+02f,
+1.364944043e+04f, 1.046846924e+02f, 1.375412500e+04f, 1.054967346e+02f, 1.385962109e+04f, 1.063059158e+02f,
+1.396592773e+04f, 1.071119995e+02f, 1.407303906e+04f, 1.079428711e+02f, 1.418098242e+04f, 1.087613678e+02f,
+1.428974316e+04f, 1.096050339e+02f, 1.439934863e+04f, 1.104457245e+02f, 1.450979395e+04f, 1.112832031e+02f,
+1.462107715e+04f, 1.121464310e+02f, 1.473322363e+04f, 1.129968033e+02f, 1.484622070e+04f, 1.138733215e+02f,
+1.496009375e+04f, 1.147467499e+02f, 1.507484082e+04f, 1.156168365e+02f, 1.519045801e+04f, 1.165136871e+02f,
+1.530697168e+04f, 1.174073639e+02f, 1.542437891e+04f, 1.182976303e+02f, 1.554267676e+04f, 1.192152710e+02f,
+1.566189160e+04f, 1.201192398e+02f, 1.578201074e+04f, 1.210510101e+02f, 1.590306152e+04f, 1.219794922e+02f,
+1.602504102e+04f, 1.229044266e+02f, 1.614794629e+04f, 1.238577957e+02f, 1.627180371e+04f, 1.248078079e+02f,
+1.639661133e+04f, 1.257541885e+02f, 1.652236523e+04f, 1.267296677e+02f, 1.664909570e+04f, 1.276906204e+02f,
+1.677678516e+04f, 1.286811218e+02f, 1.690546680e+04f, 1.296681366e+02f, 1.703513477e+04f, 1.306513672e+02f,
+1.716578711e+04f, 1.316648254e+02f, 1.729745117e+04f, 1.326632080e+02f, 1.743011523e+04f, 1.336922760e+02f,
+1.756380664e+04f, 1.347177277e+02f, 1.769852539e+04f, 1.357392426e+02f, 1.783426367e+04f, 1.367921753e+02f,
+1.797105664e+04f, 1.378414001e+02f, 1.810889648e+04f, 1.388866119e+02f, 1.824778320e+04f, 1.399639587e+02f,
+1.838774805e+04f, 1.410252533e+02f, 1.852877344e+04f, 1.421192017e+02f, 1.867089258e+04f, 1.432092743e+02f,
+1.881410156e+04f, 1.442951813e+02f, 1.895839648e+04f, 1.454144897e+02f, 1.910381055e+04f, 1.465171204e+02f,
+1.925032812e+04f, 1.476536560e+02f, 1.939798242e+04f, 1.487861938e+02f, 1.954676758e+04f, 1.499143829e+02f,
+1.969668359e+04f, 1.510772858e+02f, 1.984775977e+04f, 1.522360687e+02f, 1.999999609e+04f, 1.533904266e+02f
+};
+
+static const float db2GainTable[66] = {
+9.999999747e-05f, 4.330125739e-05f, 1.433012512e-04f, 6.205124373e-05f, 2.053525095e-04f, 8.892021287e-05f,
+2.942727297e-04f, 1.274237875e-04f, 4.216965172e-04f, 1.825998916e-04f, 6.042963942e-04f, 2.616683196e-04f,
+8.659646846e-04f, 3.749736061e-04f, 1.240938320e-03f, 5.373418680e-04f, 1.778280246e-03f, 7.700176793e-04f,
+2.548297867e-03f, 1.103444956e-03f, 3.651742823e-03f, 1.581250574e-03f, 5.232993513e-03f, 2.265951829e-03f,
+7.498945575e-03f, 3.247137647e-03f, 1.074608322e-02f, 4.653188866e-03f, 1.539927162e-02f, 6.668078247e-03f,
+2.206735127e-02f, 9.555440396e-03f, 3.162278980e-02f, 1.369306538e-02f, 4.531585798e-02f, 1.962233521e-02f,
+6.493819505e-02f, 2.811905369e-02f, 9.305724502e-02f, 4.029495642e-02f, 1.333522052e-01f, 5.774319917e-02f,
+1.910953969e-01f, 8.274671435e-02f, 2.738421261e-01f, 1.185770780e-01f, 3.924191892e-01f, 1.699224412e-01f,
+5.623416305e-01f, 2.435009927e-01f, 8.058426380e-01f, 3.489399850e-01f, 1.154782653e+00f, 5.000354052e-01f,
+1.654818058e+00f, 7.165570259e-01f, 2.371375084e+00f, 1.026835203e+00f, 3.398210287e+00f, 1.471467733e+00f,
+4.869678020e+00f, 2.108632565e+00f, 6.978310585e+00f, 3.021696091e+00f, 1.000000668e+01f, 4.330128670e+00f
+};
+
+static const float tanh5Table[514] = {
+-9.999092221e-01f, 7.377500424e-06f, -9.999018312e-01f, 7.976918823e-06f, -9.998938441e-01f, 8.625033843e-06f,
+-9.998852015e-01f, 9.325801329e-06f, -9.998759031e-01f, 1.008349773e-05f, -9.998658299e-01f, 1.090274691e-05f,
+-9.998549223e-01f, 1.178854563e-05f, -9.998431206e-01f, 1.274630085e-05f, -9.998303652e-01f, 1.378185425e-05f,
+-9.998165965e-01f, 1.490152408e-05f, -9.998016953e-01f, 1.611213884e-05f, -9.997856021e-01f, 1.742108543e-05f,
+-9.997681379e-01f, 1.883634286e-05f, -9.997493029e-01f, 2.036654223e-05f, -9.997289777e-01f, 2.202101678e-05f,
+-9.997069240e-01f, 2.380985097e-05f, -9.996831417e-01f, 2.574394784e-05f, -9.996573925e-01f, 2.783509990e-05f,
+-9.996295571e-01f, 3.009604734e-05f, -9.995994568e-01f, 3.254056719e-05f, -9.995669127e-01f, 3.518355152e-05f,
+-9.995317459e-01f, 3.804109656e-05f, -9.994936585e-01f, 4.113060277e-05f, -9.994525313e-01f, 4.447088213e-05f,
+-9.994080663e-01f, 4.808226004e-05f, -9.993600249e-01f, 5.198671715e-05f, -9.993079901e-01f, 5.620800221e-05f,
+-9.992517829e-01f, 6.077178477e-05f, -9.991910458e-01f, 6.570581172e-05f, -9.991253018e-01f, 7.104006363e-05f,
+-9.990543127e-01f, 7.680694398e-05f, -9.989774823e-01f, 8.304146468e-05f, -9.988944530e-01f, 8.978146798e-05f,
+-9.988046885e-01f, 9.706783749e-05f, -9.987075925e-01f, 1.049447528e-04f, -9.986026287e-01f, 1.134599297e-04f,
+-9.984892011e-01f, 1.226649474e-04f, -9.983665347e-01f, 1.326154888e-04f, -9.982339144e-01f, 1.433717262e-04f,
+-9.980905652e-01f, 1.549986482e-04f, -9.979355335e-01f, 1.675664389e-04f, -9.977679849e-01f, 1.811508992e-04f,
+-9.975868464e-01f, 1.958338689e-04f, -9.973909855e-01f, 2.117036929e-04f, -9.971792698e-01f, 2.288557880e-04f,
+-9.969504476e-01f, 2.473930945e-04f, -9.967030287e-01f, 2.674267744e-04f, -9.964355826e-01f, 2.890766773e-04f,
+-9.961465597e-01f, 3.124722280e-04f, -9.958340526e-01f, 3.377529792e-04f, -9.954963326e-01f, 3.650694562e-04f,
+-9.951312542e-01f, 3.945839417e-04f, -9.947366714e-01f, 4.264713789e-04f, -9.943102002e-01f, 4.609203606e-04f,
+-9.938492775e-01f, 4.981340608e-04f, -9.933511019e-01f, 5.383313983e-04f, -9.928128123e-01f, 5.817479105e-04f,
+-9.922310710e-01f, 6.286374410e-04f, -9.916024208e-01f, 6.792729255e-04f, -9.909231663e-01f, 7.339479635e-04f,
+-9.901891947e-01f, 7.929783314e-04f, -9.893962145e-01f, 8.567032637e-04f, -9.885395169e-01f, 9.254873148e-04f,
+-9.876140356e-01f, 9.997215820e-04f, -9.866142869e-01f, 1.079825801e-03f, -9.855344892e-01f, 1.166249975e-03f,
+-9.843682051e-01f, 1.259476296e-03f, -9.831087589e-01f, 1.360020950e-03f, -9.817487001e-01f, 1.468435861e-03f,
+-9.802802801e-01f, 1.585311024e-03f, -9.786949754e-01f, 1.711276476e-03f, -9.769837260e-01f, 1.847003587e-03f,
+-9.751366973e-01f, 1.993207727e-03f, -9.731435180e-01f, 2.150649903e-03f, -9.709928632e-01f, 2.320138039e-03f,
+-9.686726928e-01f, 2.502529183e-03f, -9.661701918e-01f, 2.698730212e-03f, -9.634714723e-01f, 2.909699455e-03f,
+-9.605617523e-01f, 3.136447398e-03f, -9.574252963e-01f, 3.380036214e-03f, -9.540452361e-01f, 3.641580464e-03f,
+-9.504036903e-01f, 3.922245931e-03f, -9.464814067e-01f, 4.223247524e-03f, -9.422581792e-01f, 4.545846954e-03f,
+-9.377123117e-01f, 4.891350400e-03f, -9.328209758e-01f, 5.261100363e-03f, -9.275599122e-01f, 5.656473804e-03f,
+-9.219034314e-01f, 6.078870501e-03f, -9.158245325e-01f, 6.529705133e-03f, -9.092948437e-01f, 7.010396104e-03f,
+-9.022844434e-01f, 7.522349246e-03f, -8.947620988e-01f, 8.066943847e-03f, -8.866951466e-01f, 8.645511232e-03f,
+-8.780496120e-01f, 9.259313345e-03f, -8.687903285e-01f, 9.909517132e-03f, -8.588808179e-01f, 1.059716754e-02f,
+-8.482836485e-01f, 1.132315211e-02f, -8.369604945e-01f, 1.208816748e-02f, -8.248723149e-01f, 1.289268024e-02f,
+-8.119796515e-01f, 1.373688597e-02f, -7.982427478e-01f, 1.462066360e-02f, -7.836220860e-01f, 1.554352697e-02f,
+-7.680785656e-01f, 1.650458016e-02f, -7.515739799e-01f, 1.750246435e-02f, -7.340714931e-01f, 1.853531040e-02f,
+-7.155362368e-01f, 1.960069314e-02f, -6.959354877e-01f, 2.069558948e-02f, -6.752399206e-01f, 2.181633934e-02f,
+-6.534236073e-01f, 2.295861021e-02f, -6.304649711e-01f, 2.411738597e-02f, -6.063476205e-01f, 2.528695576e-02f,
+-5.810606480e-01f, 2.646091580e-02f, -5.545997024e-01f, 2.763219550e-02f, -5.269675255e-01f, 2.879310027e-02f,
+-4.981744289e-01f, 2.993537299e-02f, -4.682390392e-01f, 3.105026856e-02f, -4.371887743e-01f, 3.212866932e-02f,
+-4.050601125e-01f, 3.316120431e-02f, -3.718989193e-01f, 3.413838893e-02f, -3.377605081e-01f, 3.505079076e-02f,
+-3.027097285e-01f, 3.588920087e-02f, -2.668205202e-01f, 3.664481640e-02f, -2.301757038e-01f, 3.730941936e-02f,
+-1.928662956e-01f, 3.787556291e-02f, -1.549907327e-01f, 3.833674267e-02f, -1.166539863e-01f, 3.868754581e-02f,
+-7.796644419e-02f, 3.892379627e-02f, -3.904264420e-02f, 3.904264420e-02f, 0.000000000e+00f, 3.904264420e-02f,
+3.904264420e-02f, 3.892379627e-02f, 7.796644419e-02f, 3.868754581e-02f, 1.166539863e-01f, 3.833674267e-02f,
+1.549907327e-01f, 3.787556291e-02f, 1.928662956e-01f, 3.730941936e-02f, 2.301757038e-01f, 3.664481640e-02f,
+2.668205202e-01f, 3.588920087e-02f, 3.027097285e-01f, 3.505079076e-02f, 3.377605081e-01f, 3.413838893e-02f,
+3.718989193e-01f, 3.316120431e-02f, 4.050601125e-01f, 3.212866932e-02f, 4.371887743e-01f, 3.105026856e-02f,
+4.682390392e-01f, 2.993537299e-02f, 4.981744289e-01f, 2.879310027e-02f, 5.269675255e-01f, 2.763219550e-02f,
+5.545997024e-01f, 2.646091580e-02f, 5.810606480e-01f, 2.528695576e-02f, 6.063476205e-01f, 2.411738597e-02f,
+6.304649711e-01f, 2.295861021e-02f, 6.534236073e-01f, 2.181633934e-02f, 6.752399206e-01f, 2.069558948e-02f,
+6.959354877e-01f, 1.960069314e-02f, 7.155362368e-01f, 1.853531040e-02f, 7.340714931e-01f, 1.750246435e-02f,
+7.515739799e-01f, 1.650458016e-02f, 7.680785656e-01f, 1.554352697e-02f, 7.836220860e-01f, 1.462066360e-02f,
+7.982427478e-01f, 1.373688597e-02f, 8.119796515e-01f, 1.289268024e-02f, 8.248723149e-01f, 1.208816748e-02f,
+8.369604945e-01f, 1.132315211e-02f, 8.482836485e-01f, 1.059716754e-02f, 8.588808179e-01f, 9.909517132e-03f,
+8.687903285e-01f, 9.259313345e-03f, 8.780496120e-01f, 8.645511232e-03f, 8.866951466e-01f, 8.066943847e-03f,
+8.947620988e-01f, 7.522349246e-03f, 9.022844434e-01f, 7.010396104e-03f, 9.092948437e-01f, 6.529705133e-03f,
+9.158245325e-01f, 6.078870501e-03f, 9.219034314e-01f, 5.656473804e-03f, 9.275599122e-01f, 5.261100363e-03f,
+9.328209758e-01f, 4.891350400e-03f, 9.377123117e-01f, 4.545846954e-03f, 9.422581792e-01f, 4.223247524e-03f,
+9.464814067e-01f, 3.922245931e-03f, 9.504036903e-01f, 3.641580464e-03f, 9.540452361e-01f, 3.380036214e-03f,
+9.574252963e-01f, 3.136447398e-03f, 9.605617523e-01f, 2.909699455e-03f, 9.634714723e-01f, 2.698730212e-03f,
+9.661701918e-01f, 2.502529183e-03f, 9.686726928e-01f, 2.320138039e-03f, 9.709928632e-01f, 2.150649903e-03f,
+9.731435180e-01f, 1.993207727e-03f, 9.751366973e-01f, 1.847003587e-03f, 9.769837260e-01f, 1.711276476e-03f,
+9.786949754e-01f, 1.585311024e-03f, 9.802802801e-01f, 1.468435861e-03f, 9.817487001e-01f, 1.360020950e-03f,
+9.831087589e-01f, 1.259476296e-03f, 9.843682051e-01f, 1.166249975e-03f, 9.855344892e-01f, 1.079825801e-03f,
+9.866142869e-01f, 9.997215820e-04f, 9.876140356e-01f, 9.254873148e-04f, 9.885395169e-01f, 8.567032637e-04f,
+9.893962145e-01f, 7.929783314e-04f, 9.901891947e-01f, 7.339479635e-04f, 9.909231663e-01f, 6.792729255e-04f,
+9.916024208e-01f, 6.286374410e-04f, 9.922310710e-01f, 5.817479105e-04f, 9.928128123e-01f, 5.383313983e-04f,
+9.933511019e-01f, 4.981340608e-04f, 9.938492775e-01f, 4.609203606e-04f, 9.943102002e-01f, 4.264713789e-04f,
+9.947366714e-01f, 3.945839417e-04f, 9.951312542e-01f, 3.650694562e-04f, 9.954963326e-01f, 3.377529792e-04f,
+9.958340526e-01f, 3.124722280e-04f, 9.961465597e-01f, 2.890766773e-04f, 9.964355826e-01f, 2.674267744e-04f,
+9.967030287e-01f, 2.473930945e-04f, 9.969504476e-01f, 2.288557880e-04f, 9.971792698e-01f, 2.117036929e-04f,
+9.973909855e-01f, 1.958338689e-04f, 9.975868464e-01f, 1.811508992e-04f, 9.977679849e-01f, 1.675664389e-04f,
+9.979355335e-01f, 1.549986482e-04f, 9.980905652e-01f, 1.433717262e-04f, 9.982339144e-01f, 1.326154888e-04f,
+9.983665347e-01f, 1.226649474e-04f, 9.984892011e-01f, 1.134599297e-04f, 9.986026287e-01f, 1.049447528e-04f,
+9.987075925e-01f, 9.706783749e-05f, 9.988046885e-01f, 8.978146798e-05f, 9.988944530e-01f, 8.304146468e-05f,
+9.989774823e-01f, 7.680694398e-05f, 9.990543127e-01f, 7.104006363e-05f, 9.991253018e-01f, 6.570581172e-05f,
+9.991910458e-01f, 6.077178477e-05f, 9.992517829e-01f, 5.620800221e-05f, 9.993079901e-01f, 5.198671715e-05f,
+9.993600249e-01f, 4.808226004e-05f, 9.994080663e-01f, 4.447088213e-05f, 9.994525313e-01f, 4.113060277e-05f,
+9.994936585e-01f, 3.804109656e-05f, 9.995317459e-01f, 3.518355152e-05f, 9.995669127e-01f, 3.254056719e-05f,
+9.995994568e-01f, 3.009604734e-05f, 9.996295571e-01f, 2.783509990e-05f, 9.996573925e-01f, 2.574394784e-05f,
+9.996831417e-01f, 2.380985097e-05f, 9.997069240e-01f, 2.202101678e-05f, 9.997289777e-01f, 2.036654223e-05f,
+9.997493029e-01f, 1.883634286e-05f, 9.997681379e-01f, 1.742108543e-05f, 9.997856021e-01f, 1.611213884e-05f,
+9.998016953e-01f, 1.490152408e-05f, 9.998165965e-01f, 1.378185425e-05f, 9.998303652e-01f, 1.274630085e-05f,
+9.998431206e-01f, 1.178854563e-05f, 9.998549223e-01f, 1.090274691e-05f, 9.998658299e-01f, 1.008349773e-05f,
+9.998759031e-01f, 9.325801329e-06f, 9.998852015e-01f, 8.625033843e-06f, 9.998938441e-01f, 7.976918823e-06f,
+9.999018312e-01f, 7.377500424e-06f, 9.999092221e-01f, 6.823121112e-06f
+};
+
+static const float minBLEPTable[2052] = {
+8.574154344e-05f, 8.095137309e-05f, 1.666929165e-04f, 7.546659617e-05f, 2.421595127e-04f, 6.935348210e-05f,
+3.115129948e-04f, 6.269392907e-05f, 3.742069239e-04f, 5.559256533e-05f, 4.297994892e-04f, 4.813491250e-05f,
+4.779344017e-04f, 4.042478395e-05f, 5.183591857e-04f, 3.256252967e-05f, 5.509217153e-04f, 2.466421574e-05f,
+5.755859311e-04f, 1.682667062e-05f, 5.924126017e-04f, 9.179115295e-06f, 6.015917170e-04f, 1.830689143e-06f,
+6.034224061e-04f, -5.101785064e-06f, 5.983206211e-04f, -1.149525633e-05f, 5.868253647e-04f, -1.722673187e-05f,
+5.695986329e-04f, -2.217048313e-05f, 5.474281497e-04f, -2.619979205e-05f, 5.212283577e-04f, -2.918468090e-05f,
+4.920436768e-04f, -3.098993329e-05f, 4.610537435e-04f, -3.148271935e-05f, 4.295710241e-04f, -3.051431850e-05f,
+3.990567056e-04f, -2.794311149e-05f, 3.711135942e-04f, -2.361624502e-05f, 3.474973491e-04f, -1.737035927e-05f,
+3.301269899e-04f, -9.040697478e-06f, 3.210862924e-04f, 1.549022272e-06f, 3.226353147e-04f, 1.458852785e-05f,
+3.372238425e-04f, 3.027298953e-05f, 3.674968320e-04f, 4.881786299e-05f, 4.163146950e-04f, 7.044017548e-05f,
+4.867548705e-04f, 9.538367158e-05f, 5.821385421e-04f, 1.239033299e-04f, 7.060418720e-04f, 1.562706893e-04f,
+8.623125614e-04f, 1.927757985e-04f, 1.055088360e-03f, 2.337259939e-04f, 1.288814354e-03f, 2.794525353e-04f,
+1.568266889e-03f, 3.303048434e-04f, 1.898571732e-03f, 3.866477637e-04f, 2.285219496e-03f, 4.488765262e-04f,
+2.734096022e-03f, 5.174013786e-04f, 3.251497401e-03f, 5.926536396e-04f, 3.844151041e-03f, 6.750903558e-04f,
+4.519241396e-03f, 7.651802152e-04f, 5.284421612e-03f, 8.634170517e-04f, 6.147838663e-03f, 9.703091346e-04f,
+7.118147798e-03f, 1.086382195e-03f, 8.204529993e-03f, 1.212173142e-03f, 9.416703135e-03f, 1.348237507e-03f,
+1.076494064e-02f, 1.495130360e-03f, 1.226007100e-02f, 1.653424464e-03f, 1.391349547e-02f, 1.823684201e-03f,
+1.573717967e-02f, 2.006476745e-03f, 1.774365641e-02f, 2.202369273e-03f, 1.994602568e-02f, 2.411924303e-03f,
+2.235794999e-02f, 2.635674551e-03f, 2.499362454e-02f, 2.874147147e-03f, 2.786777169e-02f, 3.127841279e-03f,
+3.099561296e-02f, 3.397239372e-03f, 3.439285234e-02f, 3.682769835e-03f, 3.807562217e-02f, 3.984838724e-03f,
+4.206046090e-02f, 4.303790629e-03f, 4.636425152e-02f, 4.639934748e-03f, 5.100418627e-02f, 4.993513227e-03f,
+5.599769950e-02f, 5.364708602e-03f, 6.136240810e-02f, 5.753614008e-03f, 6.711602211e-02f, 6.160281599e-03f,
+7.327630371e-02f, 6.584666669e-03f, 7.986097038e-02f, 7.026605308e-03f, 8.688757569e-02f, 7.485903800e-03f,
+9.437347949e-02f, 7.962189615e-03f, 1.023356691e-01f, 8.455075324e-03f, 1.107907444e-01f, 8.963994682e-03f,
+1.197547391e-01f, 9.488306940e-03f, 1.292430460e-01f, 1.002721488e-02f, 1.392702609e-01f, 1.057988405e-02f,
+1.498501450e-01f, 1.114526391e-02f, 1.609954089e-01f, 1.172222197e-02f, 1.727176309e-01f, 1.230953634e-02f,
+1.850271672e-01f, 1.290577650e-02f, 1.979329437e-01f, 1.350946724e-02f, 2.114424109e-01f, 1.411899924e-02f,
+2.255614102e-01f, 1.473258436e-02f, 2.402939945e-01f, 1.534835994e-02f, 2.556423545e-01f, 1.596435905e-02f,
+2.716067135e-01f, 1.657846570e-02f, 2.881851792e-01f, 1.718854904e-02f, 3.053737283e-01f, 1.779228449e-02f,
+3.231660128e-01f, 1.838725805e-02f, 3.415532708e-01f, 1.897105575e-02f, 3.605243266e-01f, 1.954108477e-02f,
+3.800654113e-01f, 2.009484172e-02f, 4.001602530e-01f, 2.062967420e-02f, 4.207899272e-01f, 2.114287019e-02f,
+4.419327974e-01f, 2.163174748e-02f, 4.635645449e-01f, 2.209359407e-02f, 4.856581390e-01f, 2.252569795e-02f,
+5.081838369e-01f, 2.292549610e-02f, 5.311093330e-01f, 2.329009771e-02f, 5.543994308e-01f, 2.361714840e-02f,
+5.780165792e-01f, 2.390402555e-02f, 6.019206047e-01f, 2.414828539e-02f, 6.260688901e-01f, 2.434754372e-02f,
+6.504164338e-01f, 2.449971437e-02f, 6.749161482e-01f, 2.460253239e-02f, 6.995186806e-01f, 2.465420961e-02f,
+7.241728902e-01f, 2.465283871e-02f, 7.488257289e-01f, 2.459704876e-02f, 7.734227777e-01f, 2.448511124e-02f,
+7.979078889e-01f, 2.431625128e-02f, 8.222241402e-01f, 2.408921719e-02f, 8.463133574e-01f, 2.380347252e-02f,
+8.701168299e-01f, 2.345842123e-02f, 8.935752511e-01f, 2.305406332e-02f, 9.166293144e-01f, 2.259027958e-02f,
+9.392195940e-01f, 2.206754684e-02f, 9.612871408e-01f, 2.148646116e-02f, 9.827736020e-01f, 2.084797621e-02f,
+1.003621578e+00f, 2.015340328e-02f, 1.023774981e+00f, 1.940417290e-02f, 1.043179154e+00f, 1.860201359e-02f,
+1.061781168e+00f, 1.774942875e-02f, 1.079530597e+00f, 1.684844494e-02f, 1.096379042e+00f, 1.590216160e-02f,
+1.112281203e+00f, 1.491308212e-02f, 1.127194285e+00f, 1.388466358e-02f, 1.141078949e+00f, 1.282072067e-02f,
+1.153899670e+00f, 1.172459126e-02f, 1.165624261e+00f, 1.060044765e-02f, 1.176224709e+00f, 9.452462196e-03f,
+1.185677171e+00f, 8.285164833e-03f, 1.193962336e+00f, 7.102966309e-03f, 1.201065302e+00f, 5.910515785e-03f,
+1.206975818e+00f, 4.713058472e-03f, 1.211688876e+00f, 3.515005112e-03f, 1.215203881e+00f, 2.321839333e-03f,
+1.217525721e+00f, 1.138329506e-03f, 1.218664050e+00f, -3.015995026e-05f, 1.218633890e+00f, -1.178741455e-03f,
+1.217455149e+00f, -2.302050591e-03f, 1.215153098e+00f, -3.395318985e-03f, 1.211757779e+00f, -4.453897476e-03f,
+1.207303882e+00f, -5.472540855e-03f, 1.201831341e+00f, -6.446599960e-03f, 1.195384741e+00f, -7.372140884e-03f,
+1.188012600e+00f, -8.244276047e-03f, 1.179768324e+00f, -9.059906006e-03f, 1.170708418e+00f, -9.814143181e-03f,
+1.160894275e+00f, -1.050460339e-02f, 1.150389671e+00f, -1.112759113e-02f, 1.139262080e+00f, -1.168048382e-02f,
+1.127581596e+00f, -1.216113567e-02f, 1.115420461e+00f, -1.256692410e-02f, 1.102853537e+00f, -1.289677620e-02f,
+1.089956760e+00f, -1.314938068e-02f, 1.076807380e+00f, -1.332354546e-02f, 1.063483834e+00f, -1.341927052e-02f,
+1.050064564e+00f, -1.343667507e-02f, 1.036627889e+00f, -1.337599754e-02f, 1.023251891e+00f, -1.323819160e-02f,
+1.010013700e+00f, -1.302504539e-02f, 9.969886541e-01f, -1.273798943e-02f, 9.842506647e-01f, -1.237940788e-02f,
+9.718712568e-01f, -1.195204258e-02f, 9.599192142e-01f, -1.145881414e-02f, 9.484604001e-01f, -1.090335846e-02f,
+9.375570416e-01f, -1.028949022e-02f, 9.272675514e-01f, -9.621262550e-03f, 9.176462889e-01f, -8.903324604e-03f,
+9.087429643e-01f, -8.140444756e-03f, 9.006025195e-01f, -7.337570190e-03f, 8.932649493e-01f, -6.500065327e-03f,
+8.867648840e-01f, -5.633652210e-03f, 8.811312318e-01f, -4.743576050e-03f, 8.763876557e-01f, -3.836035728e-03f,
+8.725516200e-01f, -2.916693687e-03f, 8.696349263e-01f, -1.991569996e-03f, 8.676433563e-01f, -1.066625118e-03f,
+8.665767312e-01f, -1.479387283e-04f, 8.664287925e-01f, 7.589459419e-04f, 8.671877384e-01f, 1.647830009e-03f,
+8.688355684e-01f, 2.513349056e-03f, 8.713489175e-01f, 3.349900246e-03f, 8.746988177e-01f, 4.152297974e-03f,
+8.788511157e-01f, 4.915475845e-03f, 8.837665915e-01f, 5.634784698e-03f, 8.894013762e-01f, 6.305694580e-03f,
+8.957070708e-01f, 6.924331188e-03f, 9.026314020e-01f, 7.486760616e-03f, 9.101181626e-01f, 7.990002632e-03f,
+9.181081653e-01f, 8.430898190e-03f, 9.265390635e-01f, 8.807241917e-03f, 9.353463054e-01f, 9.116828442e-03f,
+9.444631338e-01f, 9.358346462e-03f, 9.538214803e-01f, 9.530782700e-03f, 9.633522630e-01f, 9.633600712e-03f,
+9.729858637e-01f, 9.666681290e-03f, 9.826525450e-01f, 9.630441666e-03f, 9.922829866e-01f, 9.526014328e-03f,
+1.001809001e+00f, 9.354472160e-03f, 1.011163473e+00f, 9.118318558e-03f, 1.020281792e+00f, 8.819103241e-03f,
+1.029100895e+00f, 8.460164070e-03f, 1.037561059e+00f, 8.044600487e-03f, 1.045605659e+00f, 7.575631142e-03f,
+1.053181291e+00f, 7.057428360e-03f, 1.060238719e+00f, 6.494641304e-03f, 1.066733360e+00f, 5.891084671e-03f,
+1.072624445e+00f, 5.252122879e-03f, 1.077876568e+00f, 4.582643509e-03f, 1.082459211e+00f, 3.887772560e-03f,
+1.086346984e+00f, 3.173232079e-03f, 1.089520216e+00f, 2.444267273e-03f, 1.091964483e+00f, 1.706361771e-03f,
+1.093670845e+00f, 9.654760361e-04f, 1.094636321e+00f, 2.267360687e-04f, 1.094863057e+00f, -5.038976669e-04f,
+1.094359159e+00f, -1.221299171e-03f, 1.093137860e+00f, -1.920223236e-03f, 1.091217637e+00f, -2.595186234e-03f,
+1.088622451e+00f, -3.241658211e-03f, 1.085380793e+00f, -3.854870796e-03f, 1.081525922e+00f, -4.430770874e-03f,
+1.077095151e+00f, -4.964709282e-03f, 1.072130442e+00f, -5.453824997e-03f, 1.066676617e+00f, -5.894064903e-03f,
+1.060782552e+00f, -6.283044815e-03f, 1.054499507e+00f, -6.618022919e-03f, 1.047881484e+00f, -6.897211075e-03f,
+1.040984273e+00f, -7.118940353e-03f, 1.033865333e+00f, -7.281780243e-03f, 1.026583552e+00f, -7.385730743e-03f,
+1.019197822e+00f, -7.429838181e-03f, 1.011767983e+00f, -7.415056229e-03f, 1.004352927e+00f, -7.341742516e-03f,
+9.970111847e-01f, -7.211208344e-03f, 9.897999763e-01f, -7.025122643e-03f, 9.827748537e-01f, -6.785631180e-03f,
+9.759892225e-01f, -6.494939327e-03f, 9.694942832e-01f, -6.156146526e-03f, 9.633381367e-01f, -5.772411823e-03f,
+9.575657248e-01f, -5.347371101e-03f, 9.522183537e-01f, -4.884719849e-03f, 9.473336339e-01f, -4.388689995e-03f,
+9.429449439e-01f, -3.863573074e-03f, 9.390813708e-01f, -3.313958645e-03f, 9.357674122e-01f, -2.744495869e-03f,
+9.330229163e-01f, -2.160191536e-03f, 9.308627248e-01f, -1.565635204e-03f, 9.292970896e-01f, -9.659528732e-04f,
+9.283311367e-01f, -3.662109375e-04f, 9.279649258e-01f, 2.289414406e-04f, 9.281938672e-01f, 8.146762848e-04f,
+9.290085435e-01f, 1.386046410e-03f, 9.303945899e-01f, 1.938939095e-03f, 9.323335290e-01f, 2.468645573e-03f,
+9.348021746e-01f, 2.971172333e-03f, 9.377733469e-01f, 3.442883492e-03f, 9.412162304e-01f, 3.879964352e-03f,
+9.450961947e-01f, 4.279315472e-03f, 9.493755102e-01f, 4.638075829e-03f, 9.540135860e-01f, 4.953742027e-03f,
+9.589673281e-01f, 5.223989487e-03f, 9.641913176e-01f, 5.447268486e-03f, 9.696385860e-01f, 5.622386932e-03f,
+9.752609730e-01f, 5.747973919e-03f, 9.810089469e-01f, 5.823969841e-03f, 9.868329167e-01f, 5.850136280e-03f,
+9.926830530e-01f, 5.826830864e-03f, 9.985098839e-01f, 5.754947662e-03f, 1.004264832e+00f, 5.635380745e-03f,
+1.009900212e+00f, 5.469918251e-03f, 1.015370131e+00f, 5.260348320e-03f, 1.020630479e+00f, 5.009055138e-03f,
+1.025639534e+00f, 4.718661308e-03f, 1.030358195e+00f, 4.392027855e-03f, 1.034750223e+00f, 4.032254219e-03f,
+1.038782477e+00f, 3.642916679e-03f, 1.042425394e+00f, 3.227710724e-03f, 1.045653105e+00f, 2.790451050e-03f,
+1.048443556e+00f, 2.334952354e-03f, 1.050778508e+00f, 1.865506172e-03f, 1.052644014e+00f, 1.386404037e-03f,
+1.054030418e+00f, 9.013414383e-04f, 1.054931760e+00f, 4.152059555e-04f, 1.055346966e+00f, -6.806850433e-05f,
+1.055278897e+00f, -5.445480347e-04f, 1.054734349e+00f, -1.010060310e-03f, 1.053724289e+00f, -1.460671425e-03f,
+1.052263618e+00f, -1.892566681e-03f, 1.050371051e+00f, -2.302765846e-03f, 1.048068285e+00f, -2.687335014e-03f,
+1.045380950e+00f, -3.043651581e-03f, 1.042337298e+00f, -3.368854523e-03f, 1.038968444e+00f, -3.660321236e-03f,
+1.035308123e+00f, -3.916263580e-03f, 1.031391859e+00f, -4.134774208e-03f, 1.027257085e+00f, -4.314184189e-03f,
+1.022942901e+00f, -4.453778267e-03f, 1.018489122e+00f, -4.552483559e-03f, 1.013936639e+00f, -4.610300064e-03f,
+1.009326339e+00f, -4.626750946e-03f, 1.004699588e+00f, -4.602670670e-03f, 1.000096917e+00f, -4.538655281e-03f,
+9.955582619e-01f, -4.435598850e-03f, 9.911226630e-01f, -4.294931889e-03f, 9.868277311e-01f, -4.118561745e-03f,
+9.827091694e-01f, -3.908276558e-03f, 9.788008928e-01f, -3.666579723e-03f, 9.751343131e-01f, -3.395676613e-03f,
+9.717386365e-01f, -3.098726273e-03f, 9.686399102e-01f, -2.778232098e-03f, 9.658616781e-01f, -2.437829971e-03f,
+9.634238482e-01f, -2.080380917e-03f, 9.613434672e-01f, -1.709520817e-03f, 9.596339464e-01f, -1.328587532e-03f,
+9.583053589e-01f, -9.411573410e-04f, 9.573642015e-01f, -5.507469177e-04f, 9.568134546e-01f, -1.608133316e-04f,
+9.566526413e-01f, 2.250671387e-04f, 9.568777084e-01f, 6.035566330e-04f, 9.574812651e-01f, 9.714365005e-04f,
+9.584527016e-01f, 1.325488091e-03f, 9.597781897e-01f, 1.662671566e-03f, 9.614408612e-01f, 1.980364323e-03f,
+9.634212255e-01f, 2.275764942e-03f, 9.656969905e-01f, 2.546727657e-03f, 9.682437181e-01f, 2.790927887e-03f,
+9.710346460e-01f, 3.006756306e-03f, 9.740414023e-01f, 3.192484379e-03f, 9.772338867e-01f, 3.346920013e-03f,
+9.805808067e-01f, 3.469109535e-03f, 9.840499163e-01f, 3.558278084e-03f, 9.876081944e-01f, 3.614127636e-03f,
+9.912223220e-01f, 3.636777401e-03f, 9.948590994e-01f, 3.626108170e-03f, 9.984852076e-01f, 3.583073616e-03f,
+1.002068281e+00f, 3.508210182e-03f, 1.005576491e+00f, 3.402590752e-03f, 1.008979082e+00f, 3.268003464e-03f,
+1.012247086e+00f, 3.105759621e-03f, 1.015352845e+00f, 2.917647362e-03f, 1.018270493e+00f, 2.705931664e-03f,
+1.020976424e+00f, 2.472639084e-03f, 1.023449063e+00f, 2.220392227e-03f, 1.025669456e+00f, 1.951813698e-03f,
+1.027621269e+00f, 1.669406891e-03f, 1.029290676e+00f, 1.376032829e-03f, 1.030666709e+00f, 1.074314117e-03f,
+1.031741023e+00f, 7.674694061e-04f, 1.032508492e+00f, 4.582405090e-04f, 1.032966733e+00f, 1.492500305e-04f,
+1.033115983e+00f, -1.561641693e-04f, 1.032959819e+00f, -4.559755325e-04f, 1.032503843e+00f, -7.466077805e-04f,
+1.031757236e+00f, -1.026391983e-03f, 1.030730844e+00f, -1.292467117e-03f, 1.029438376e+00f, -1.542687416e-03f,
+1.027895689e+00f, -1.774668694e-03f, 1.026121020e+00f, -1.987218857e-03f, 1.024133801e+00f, -2.178072929e-03f,
+1.021955729e+00f, -2.346038818e-03f, 1.019609690e+00f, -2.490043640e-03f, 1.017119646e+00f, -2.608537674e-03f,
+1.014511108e+00f, -2.701520920e-03f, 1.011809587e+00f, -2.768039703e-03f, 1.009041548e+00f, -2.808094025e-03f,
+1.006233454e+00f, -2.821683884e-03f, 1.003411770e+00f, -2.808928490e-03f, 1.000602841e+00f, -2.770364285e-03f,
+9.978324771e-01f, -2.707004547e-03f, 9.951254725e-01f, -2.619564533e-03f, 9.925059080e-01f, -2.509236336e-03f,
+9.899966717e-01f, -2.377450466e-03f, 9.876192212e-01f, -2.225697041e-03f, 9.853935242e-01f, -2.055883408e-03f,
+9.833376408e-01f, -1.869618893e-03f, 9.814680219e-01f, -1.668930054e-03f, 9.797990918e-01f, -1.456081867e-03f,
+9.783430099e-01f, -1.233041286e-03f, 9.771099687e-01f, -1.002252102e-03f, 9.761077166e-01f, -7.656812668e-04f,
+9.753420353e-01f, -5.260705948e-04f, 9.748159647e-01f, -2.852082253e-04f, 9.745307565e-01f, -4.577636719e-05f,
+9.744849801e-01f, 1.901984215e-04f, 9.746751785e-01f, 4.205107689e-04f, 9.750956893e-01f, 6.431937218e-04f,
+9.757388830e-01f, 8.561611176e-04f, 9.765950441e-01f, 1.057684422e-03f, 9.776527286e-01f, 1.245796680e-03f,
+9.788985252e-01f, 1.419305801e-03f, 9.803178310e-01f, 1.576662064e-03f, 9.818944931e-01f, 1.716494560e-03f,
+9.836109877e-01f, 1.837968826e-03f, 9.854489565e-01f, 1.940250397e-03f, 9.873892069e-01f, 2.022504807e-03f,
+9.894117117e-01f, 2.084493637e-03f, 9.914962053e-01f, 2.125680447e-03f, 9.936218858e-01f, 2.146482468e-03f,
+9.957683682e-01f, 2.146542072e-03f, 9.979149103e-01f, 2.126455307e-03f, 1.000041366e+00f, 2.086639404e-03f,
+1.002128005e+00f, 2.028107643e-03f, 1.004156113e+00f, 1.951336861e-03f, 1.006107450e+00f, 1.857399940e-03f,
+1.007964849e+00f, 1.747608185e-03f, 1.009712458e+00f, 1.623511314e-03f, 1.011335969e+00f, 1.485824585e-03f,
+1.012821794e+00f, 1.336812973e-03f, 1.014158607e+00f, 1.177787781e-03f, 1.015336394e+00f, 1.010179520e-03f,
+1.016346574e+00f, 8.361339569e-04f, 1.017182708e+00f, 6.572008133e-04f, 1.017839909e+00f, 4.752874374e-04f,
+1.018315196e+00f, 2.919435501e-04f, 1.018607140e+00f, 1.093149185e-04f, 1.018716455e+00f, -7.116794586e-05f,
+1.018645287e+00f, -2.478361130e-04f, 1.018397450e+00f, -4.190206528e-04f, 1.017978430e+00f, -5.830526352e-04f,
+1.017395377e+00f, -7.385015488e-04f, 1.016656876e+00f, -8.841753006e-04f, 1.015772700e+00f, -1.018881798e-03f,
+1.014753819e+00f, -1.141428947e-03f, 1.013612390e+00f, -1.250743866e-03f, 1.012361646e+00f, -1.346230507e-03f,
+1.011015415e+00f, -1.427173615e-03f, 1.009588242e+00f, -1.492857933e-03f, 1.008095384e+00f, -1.543164253e-03f,
+1.006552219e+00f, -1.577973366e-03f, 1.004974246e+00f, -1.596927643e-03f, 1.003377318e+00f, -1.600384712e-03f,
+1.001776934e+00f, -1.588225365e-03f, 1.000188708e+00f, -1.561284065e-03f, 9.986274242e-01f, -1.519918442e-03f,
+9.971075058e-01f, -1.464724541e-03f, 9.956427813e-01f, -1.396536827e-03f, 9.942462444e-01f, -1.316368580e-03f,
+9.929298759e-01f, -1.224994659e-03f, 9.917048812e-01f, -1.123607159e-03f, 9.905812740e-01f, -1.013457775e-03f,
+9.895678163e-01f, -8.956789970e-04f, 9.886721373e-01f, -7.714033127e-04f, 9.879007339e-01f, -6.422996521e-04f,
+9.872584343e-01f, -5.094408989e-04f, 9.867489934e-01f, -3.741979599e-04f, 9.863747954e-01f, -2.380609512e-04f,
+9.861367345e-01f, -1.022815704e-04f, 9.860344529e-01f, 3.188848495e-05f, 9.860663414e-01f, 1.630187035e-04f,
+9.862293601e-01f, 2.900958061e-04f, 9.865194559e-01f, 4.119277000e-04f, 9.869313836e-01f, 5.272030830e-04f,
+9.874585867e-01f, 6.352663040e-04f, 9.880938530e-01f, 7.349252701e-04f, 9.888287783e-01f, 8.255243301e-04f,
+9.896543026e-01f, 9.064078331e-04f, 9.905607104e-01f, 9.768605232e-04f, 9.915375710e-01f, 1.036405563e-03f,
+9.925739765e-01f, 1.084744930e-03f, 9.936587214e-01f, 1.121580601e-03f, 9.947803020e-01f, 1.146793365e-03f,
+9.959270954e-01f, 1.160442829e-03f, 9.970875382e-01f, 1.162469387e-03f, 9.982500076e-01f, 1.153230667e-03f,
+9.994032383e-01f, 1.132965088e-03f, 1.000536203e+00f, 1.101970673e-03f, 1.001638174e+00f, 1.061201096e-03f,
+1.002699375e+00f, 1.010656357e-03f, 1.003710032e+00f, 9.515285492e-04f, 1.004661560e+00f, 8.842945099e-04f,
+1.005545855e+00f, 8.099079132e-04f, 1.006355762e+00f, 7.290840149e-04f, 1.007084846e+00f, 6.427764893e-04f,
+1.007727623e+00f, 5.522966385e-04f, 1.008279920e+00f, 4.581212997e-04f, 1.008738041e+00f, 3.614425659e-04f,
+1.009099483e+00f, 2.634525299e-04f, 1.009362936e+00f, 1.647472382e-04f, 1.009527683e+00f, 6.675720215e-05f,
+1.009594440e+00f, -2.992153168e-05f, 1.009564519e+00f, -1.242160797e-04f, 1.009440303e+00f, -2.151727676e-04f,
+1.009225130e+00f, -3.023147583e-04f, 1.008922815e+00f, -3.844499588e-04f, 1.008538365e+00f, -4.609823227e-04f,
+1.008077383e+00f, -5.313158035e-04f, 1.007546067e+00f, -5.949735641e-04f, 1.006951094e+00f, -6.513595581e-04f,
+1.006299734e+00f, -7.002353668e-04f, 1.005599499e+00f, -7.411241531e-04f, 1.004858375e+00f, -7.737874985e-04f,
+1.004084587e+00f, -7.979869843e-04f, 1.003286600e+00f, -8.139610291e-04f, 1.002472639e+00f, -8.214712143e-04f,
+1.001651168e+00f, -8.207559586e-04f, 1.000830412e+00f, -8.120536804e-04f, 1.000018358e+00f, -7.955431938e-04f,
+9.992228150e-01f, -7.714033127e-04f, 9.984514117e-01f, -7.402896881e-04f, 9.977111220e-01f, -7.025003433e-04f,
+9.970086217e-01f, -6.587505341e-04f, 9.963498712e-01f, -6.093978882e-04f, 9.957404733e-01f, -5.551576614e-04f,
+9.951853156e-01f, -4.966855049e-04f, 9.946886301e-01f, -4.346370697e-04f, 9.942539930e-01f, -3.696680069e-04f,
+9.938843250e-01f, -3.025531769e-04f, 9.935817719e-01f, -2.340078354e-04f, 9.933477640e-01f, -1.647472382e-04f,
+9.931830168e-01f, -9.530782700e-05f, 9.930877090e-01f, -2.676248550e-05f, 9.930609465e-01f, 4.059076309e-05f,
+9.931015372e-01f, 1.059770584e-04f, 9.932075143e-01f, 1.686811447e-04f, 9.933761954e-01f, 2.284049988e-04f,
+9.936046004e-01f, 2.843141556e-04f, 9.938889146e-01f, 3.360509872e-04f, 9.942249656e-01f, 3.833770752e-04f,
+9.946083426e-01f, 4.256963730e-04f, 9.950340390e-01f, 4.627108574e-04f, 9.954967499e-01f, 4.943609238e-04f,
+9.959911108e-01f, 5.202889442e-04f, 9.965113997e-01f, 5.404949188e-04f, 9.970518947e-01f, 5.547404289e-04f,
+9.976066351e-01f, 5.632042885e-04f, 9.981698394e-01f, 5.658268929e-04f, 9.987356663e-01f, 5.629062653e-04f,
+9.992985725e-01f, 5.544424057e-04f, 9.998530149e-01f, 5.407333374e-04f, 1.000393748e+00f, 5.218982697e-04f,
+1.000915647e+00f, 4.986524582e-04f, 1.001414299e+00f, 4.708766937e-04f, 1.001885176e+00f, 4.394054413e-04f,
+1.002324581e+00f, 4.042387009e-04f, 1.002728820e+00f, 3.663301468e-04f, 1.003095150e+00f, 3.256797791e-04f,
+1.003420830e+00f, 2.831220627e-04f, 1.003703952e+00f, 2.390146255e-04f, 1.003942966e+00f, 1.940727234e-04f,
+1.004137039e+00f, 1.484155655e-04f, 1.004285455e+00f, 1.028776169e-04f, 1.004388332e+00f, 5.781650543e-05f,
+1.004446149e+00f, 1.382827759e-05f, 1.004459977e+00f, -2.849102020e-05f, 1.004431486e+00f, -6.902217865e-05f,
+1.004362464e+00f, -1.074075699e-04f, 1.004255056e+00f, -1.426935196e-04f, 1.004112363e+00f, -1.751184464e-04f,
+1.003937244e+00f, -2.038478851e-04f, 1.003733397e+00f, -2.291202545e-04f, 1.003504276e+00f, -2.504587173e-04f,
+1.003253818e+00f, -2.676248550e-04f, 1.002986193e+00f, -2.802610397e-04f, 1.002705932e+00f, -2.887248993e-04f,
+1.002417207e+00f, -2.926588058e-04f, 1.002124548e+00f, -2.920627594e-04f, 1.001832485e+00f, -2.870559692e-04f,
+1.001545429e+00f, -2.776384354e-04f, 1.001267791e+00f, -2.638101578e-04f, 1.001003981e+00f, -2.458095551e-04f,
+1.000758171e+00f, -2.238750458e-04f, 1.000534296e+00f, -1.981258392e-04f, 1.000336170e+00f, -1.686811447e-04f,
+1.000167489e+00f, -1.361370087e-04f, 1.000031352e+00f, -1.005530357e-04f, 9.999307990e-01f, -6.228685379e-05f,
+9.998685122e-01f, -2.157688141e-05f, 9.998469353e-01f, 2.110004425e-05f, 9.998680353e-01f, 6.532669067e-05f,
+9.999333620e-01f, 1.108646393e-04f, 1.000044227e+00f, 1.574754715e-04f, 1.000201702e+00f, 2.044439316e-04f,
+1.000406146e+00f, 2.515316010e-04f, 1.000657678e+00f, 2.986192703e-04f, 1.000956297e+00f, 3.449916840e-04f,
+1.001301289e+00f, 3.905296326e-04f, 1.001691818e+00f, 4.346370697e-04f, 1.002126455e+00f, 4.774332047e-04f,
+1.002603889e+00f, 5.183219910e-04f, 1.003122211e+00f, 5.569458008e-04f, 1.003679156e+00f, 5.933046341e-04f,
+1.004272461e+00f, 6.269216537e-04f, 1.004899383e+00f, 6.576776505e-04f, 1.005557060e+00f, 6.854534149e-04f,
+1.006242514e+00f, 7.101297379e-04f, 1.006952643e+00f, 7.312297821e-04f, 1.007683873e+00f, 7.489919662e-04f,
+1.008432865e+00f, 7.631778717e-04f, 1.009196043e+00f, 7.739067078e-04f, 1.009969950e+00f, 7.808208466e-04f,
+1.010750771e+00f, 7.840394974e-04f, 1.011534810e+00f, 7.838010788e-04f, 1.012318611e+00f, 7.796287537e-04f,
+1.013098240e+00f, 7.721185684e-04f, 1.013870358e+00f, 7.609128952e-04f, 1.014631271e+00f, 7.463693619e-04f,
+1.015377641e+00f, 7.284879684e-04f, 1.016106129e+00f, 7.072687149e-04f, 1.016813397e+00f, 6.829500198e-04f,
+1.017496347e+00f, 6.556510925e-04f, 1.018151999e+00f, 6.254911423e-04f, 1.018777490e+00f, 5.927085876e-04f,
+1.019370198e+00f, 5.573034286e-04f, 1.019927502e+00f, 5.193948746e-04f, 1.020446897e+00f, 4.795789719e-04f,
+1.020926476e+00f, 4.374980927e-04f, 1.021363974e+00f, 3.936290741e-04f, 1.021757603e+00f, 3.478527069e-04f,
+1.022105455e+00f, 3.007650375e-04f, 1.022406220e+00f, 2.522468567e-04f, 1.022658467e+00f, 2.022981644e-04f,
+1.022860765e+00f, 1.515150070e-04f, 1.023012280e+00f, 9.989738464e-05f, 1.023112178e+00f, 4.744529724e-05f,
+1.023159623e+00f, -5.602836609e-06f, 1.023154020e+00f, -5.900859833e-05f, 1.023095012e+00f, -1.126527786e-04f,
+1.022982359e+00f, -1.664161682e-04f, 1.022815943e+00f, -2.200603485e-04f, 1.022595882e+00f, -2.735853195e-04f,
+1.022322297e+00f, -3.266334534e-04f, 1.021995664e+00f, -3.793239594e-04f, 1.021616340e+00f, -4.311800003e-04f,
+1.021185160e+00f, -4.823207855e-04f, 1.020702839e+00f, -5.325078964e-04f, 1.020170331e+00f, -5.816221237e-04f,
+1.019588709e+00f, -6.293058395e-04f, 1.018959403e+00f, -6.755590439e-04f, 1.018283844e+00f, -7.205009460e-04f,
+1.017563343e+00f, -7.632970810e-04f, 1.016800046e+00f, -8.046627045e-04f, 1.015995383e+00f, -8.435249329e-04f,
+1.015151858e+00f, -8.803606033e-04f, 1.014271498e+00f, -9.148120880e-04f, 1.013356686e+00f, -9.464025497e-04f,
+1.012410283e+00f, -9.757280350e-04f, 1.011434555e+00f, -1.001954079e-03f, 1.010432601e+00f, -1.025080681e-03f,
+1.009407520e+00f, -1.045227051e-03f, 1.008362293e+00f, -1.061558723e-03f, 1.007300735e+00f, -1.075029373e-03f,
+1.006225705e+00f, -1.084446907e-03f, 1.005141258e+00f, -1.090288162e-03f, 1.004050970e+00f, -1.092195511e-03f,
+1.002958775e+00f, -1.090168953e-03f, 1.001868606e+00f, -1.084208488e-03f, 1.000784397e+00f, -1.073896885e-03f,
+9.997105002e-01f, -1.059532166e-03f, 9.986509681e-01f, -1.040935516e-03f, 9.976100326e-01f, -1.018166542e-03f,
+9.965918660e-01f, -9.910464287e-04f, 9.956008196e-01f, -9.598135948e-04f, 9.946410060e-01f, -9.243488312e-04f,
+9.937166572e-01f, -8.848905563e-04f, 9.928317666e-01f, -8.412599564e-04f, 9.919905066e-01f, -7.938742638e-04f,
+9.911966324e-01f, -7.428526878e-04f, 9.904537797e-01f, -6.881356239e-04f, 9.897656441e-01f, -6.301403046e-04f,
+9.891355038e-01f, -5.689859390e-04f, 9.885665178e-01f, -5.050897598e-04f, 9.880614281e-01f, -4.384517670e-04f,
+9.876229763e-01f, -3.696084023e-04f, 9.872533679e-01f, -2.987980843e-04f, 9.869545698e-01f, -2.263784409e-04f,
+9.867281914e-01f, -1.527070999e-04f, 9.865754843e-01f, -7.814168930e-05f, 9.864973426e-01f, -3.159046173e-06f,
+9.864941835e-01f, 7.188320160e-05f, 9.865660667e-01f, 1.465678215e-04f, 9.867126346e-01f, 2.204775810e-04f,
+9.869331121e-01f, 2.931952477e-04f, 9.872263074e-01f, 3.641247749e-04f, 9.875904322e-01f, 4.330277443e-04f,
+9.880234599e-01f, 4.994273186e-04f, 9.885228872e-01f, 5.628466606e-04f, 9.890857339e-01f, 6.229281425e-04f,
+9.897086620e-01f, 6.791949272e-04f, 9.903878570e-01f, 7.314085960e-04f, 9.911192656e-01f, 7.790923119e-04f,
+9.918983579e-01f, 8.219480515e-04f, 9.927203059e-01f, 8.596777916e-04f, 9.935799837e-01f, 8.919239044e-04f,
+9.944719076e-01f, 9.185671806e-04f, 9.953904748e-01f, 9.394884109e-04f, 9.963299632e-01f, 9.542107582e-04f,
+9.972841740e-01f, 9.628534317e-04f, 9.982470274e-01f, 9.652376175e-04f, 9.992122650e-01f, 9.613037109e-04f,
+1.000173569e+00f, 9.510517120e-04f, 1.001124620e+00f, 9.346008301e-04f, 1.002059221e+00f, 9.119510651e-04f,
+1.002971172e+00f, 8.833408356e-04f, 1.003854513e+00f, 8.486509323e-04f, 1.004703164e+00f, 8.085966110e-04f,
+1.005511761e+00f, 7.629394531e-04f, 1.006274700e+00f, 7.123947144e-04f, 1.006987095e+00f, 6.569623947e-04f,
+1.007644057e+00f, 5.970001221e-04f, 1.008241057e+00f, 5.334615707e-04f, 1.008774519e+00f, 4.661083221e-04f,
+1.009240627e+00f, 3.958940506e-04f, 1.009636521e+00f, 3.231763840e-04f, 1.009959698e+00f, 2.483129501e-04f,
+1.010208011e+00f, 1.718997955e-04f, 1.010379910e+00f, 9.477138519e-05f, 1.010474682e+00f, 1.716613770e-05f,
+1.010491848e+00f, -6.020069122e-05f, 1.010431647e+00f, -1.367330551e-04f, 1.010294914e+00f, -2.119541168e-04f,
+1.010082960e+00f, -2.855062485e-04f, 1.009797454e+00f, -3.563165665e-04f, 1.009441137e+00f, -4.241466522e-04f,
+1.009016991e+00f, -4.887580872e-04f, 1.008528233e+00f, -5.493164062e-04f, 1.007978916e+00f, -6.053447723e-04f,
+1.007373571e+00f, -6.567239761e-04f, 1.006716847e+00f, -7.028579712e-04f, 1.006013989e+00f, -7.433891296e-04f,
+1.005270600e+00f, -7.780790329e-04f, 1.004492521e+00f, -8.066892624e-04f, 1.003685832e+00f, -8.291006088e-04f,
+1.002856731e+00f, -8.449554443e-04f, 1.002011776e+00f, -8.541345596e-04f, 1.001157641e+00f, -8.568763733e-04f,
+1.000300765e+00f, -8.529424667e-04f, 9.994478226e-01f, -8.425116539e-04f, 9.986053109e-01f, -8.254647255e-04f,
+9.977798462e-01f, -8.021593094e-04f, 9.969776869e-01f, -7.727742195e-04f, 9.962049127e-01f, -7.375478745e-04f,
+9.954673648e-01f, -6.967186928e-04f, 9.947706461e-01f, -6.507039070e-04f, 9.941199422e-01f, -5.998611450e-04f,
+9.935200810e-01f, -5.446672440e-04f, 9.929754138e-01f, -4.854202271e-04f, 9.924899936e-01f, -4.228353500e-04f,
+9.920671582e-01f, -3.572702408e-04f, 9.917098880e-01f, -2.893209457e-04f, 9.914205670e-01f, -2.194643021e-04f,
+9.912011027e-01f, -1.485347748e-04f, 9.910525680e-01f, -7.671117783e-05f, 9.909758568e-01f, -4.947185516e-06f,
+9.909709096e-01f, 6.639957428e-05f, 9.910373092e-01f, 1.366734505e-04f, 9.911739826e-01f, 2.053380013e-04f,
+9.913793206e-01f, 2.717375755e-04f, 9.916510582e-01f, 3.354549408e-04f, 9.919865131e-01f, 3.958940506e-04f,
+9.923824072e-01f, 4.526972771e-04f, 9.928351045e-01f, 5.053877831e-04f, 9.933404922e-01f, 5.533695221e-04f,
+9.938938618e-01f, 5.965232849e-04f, 9.944903851e-01f, 6.343126297e-04f, 9.951246977e-01f, 6.666779518e-04f,
+9.957913756e-01f, 6.931424141e-04f, 9.964845181e-01f, 7.137656212e-04f, 9.971982837e-01f, 7.281899452e-04f,
+9.979264736e-01f, 7.364749908e-04f, 9.986629486e-01f, 7.385015488e-04f, 9.994014502e-01f, 7.344484329e-04f,
+1.000135899e+00f, 7.240772247e-04f, 1.000859976e+00f, 7.081031799e-04f, 1.001568079e+00f, 6.858110428e-04f,
+1.002253890e+00f, 6.583929062e-04f, 1.002912283e+00f, 6.254911423e-04f, 1.003537774e+00f, 5.875825882e-04f,
+1.004125357e+00f, 5.449056625e-04f, 1.004670262e+00f, 4.982948303e-04f, 1.005168557e+00f, 4.477500916e-04f,
+1.005616307e+00f, 3.937482834e-04f, 1.006010056e+00f, 3.370046616e-04f, 1.006347060e+00f, 2.778768539e-04f,
+1.006624937e+00f, 2.169609070e-04f, 1.006841898e+00f, 1.546144485e-04f, 1.006996512e+00f, 9.179115295e-05f,
+1.007088304e+00f, 2.849102020e-05f, 1.007116795e+00f, -3.433227539e-05f, 1.007082462e+00f, -9.632110596e-05f,
+1.006986141e+00f, -1.568794250e-04f, 1.006829262e+00f, -2.154111862e-04f, 1.006613851e+00f, -2.716779709e-04f,
+1.006342173e+00f, -3.249645233e-04f, 1.006017208e+00f, -3.749132156e-04f, 1.005642295e+00f, -4.211664200e-04f,
+1.005221128e+00f, -4.633665085e-04f, 1.004757762e+00f, -5.009174347e-04f, 1.004256845e+00f, -5.341768265e-04f,
+1.003722668e+00f, -5.618333817e-04f, 1.003160834e+00f, -5.848407745e-04f, 1.002575994e+00f, -6.022453308e-04f,
+1.001973748e+00f, -6.142854691e-04f, 1.001359463e+00f, -6.209611893e-04f, 1.000738502e+00f, -6.217956543e-04f,
+1.000116706e+00f, -6.174445152e-04f, 9.994992614e-01f, -6.076693535e-04f, 9.988915920e-01f, -5.925893784e-04f,
+9.982990026e-01f, -5.724430084e-04f, 9.977265596e-01f, -5.475282669e-04f, 9.971790314e-01f, -5.180239677e-04f,
+9.966610074e-01f, -4.842281342e-04f, 9.961767793e-01f, -4.464387894e-04f, 9.957303405e-01f, -4.052519798e-04f,
+9.953250885e-01f, -3.607869148e-04f, 9.949643016e-01f, -3.136396408e-04f, 9.946506619e-01f, -2.642273903e-04f,
+9.943864346e-01f, -2.130270004e-04f, 9.941734076e-01f, -1.603364944e-04f, 9.940130711e-01f, -1.069903374e-04f,
+9.939060807e-01f, -5.310773849e-05f, 9.938529730e-01f, 5.364418030e-07f, 9.938535094e-01f, 5.370378494e-05f,
+9.939072132e-01f, 1.056790352e-04f, 9.940128922e-01f, 1.561641693e-04f, 9.941690564e-01f, 2.048015594e-04f,
+9.943738580e-01f, 2.509355545e-04f, 9.946247935e-01f, 2.942681313e-04f, 9.949190617e-01f, 3.345608711e-04f,
+9.952536225e-01f, 3.713369370e-04f, 9.956249595e-01f, 4.043579102e-04f, 9.960293174e-01f, 4.333257675e-04f,
+9.964626431e-01f, 4.581212997e-04f, 9.969207644e-01f, 4.783868790e-04f, 9.973991513e-01f, 4.941821098e-04f,
+9.978933334e-01f, 5.053281784e-04f, 9.983986616e-01f, 5.117058754e-04f, 9.989103675e-01f, 5.133152008e-04f,
+9.994236827e-01f, 5.103945732e-04f, 9.999340773e-01f, 5.028247833e-04f, 1.000436902e+00f, 4.906654358e-04f,
+1.000927567e+00f, 4.742145538e-04f, 1.001401782e+00f, 4.537105560e-04f, 1.001855493e+00f, 4.293918610e-04f,
+1.002284884e+00f, 4.012584686e-04f, 1.002686143e+00f, 3.699064255e-04f, 1.003056049e+00f, 3.355741501e-04f,
+1.003391623e+00f, 2.985000610e-04f, 1.003690124e+00f, 2.592802048e-04f, 1.003949404e+00f, 2.180337906e-04f,
+1.004167438e+00f, 1.753568649e-04f, 1.004342794e+00f, 1.316070557e-04f, 1.004474401e+00f, 8.714199066e-05f,
+1.004561543e+00f, 4.255771637e-05f, 1.004604101e+00f, -2.026557922e-06f, 1.004602075e+00f, -4.601478577e-05f,
+1.004556060e+00f, -8.893013000e-05f, 1.004467130e+00f, -1.305341721e-04f, 1.004336596e+00f, -1.703500748e-04f,
+1.004166245e+00f, -2.081394196e-04f, 1.003958106e+00f, -2.434253693e-04f, 1.003714681e+00f, -2.760887146e-04f,
+1.003438592e+00f, -3.057718277e-04f, 1.003132820e+00f, -3.322362900e-04f, 1.002800584e+00f, -3.552436829e-04f,
+1.002445340e+00f, -3.747940063e-04f, 1.002070546e+00f, -3.902912140e-04f, 1.001680255e+00f, -4.023313522e-04f,
+1.001277924e+00f, -4.101991653e-04f, 1.000867724e+00f, -4.142522812e-04f, 1.000453472e+00f, -4.143714905e-04f,
+1.000039101e+00f, -4.106760025e-04f, 9.996284246e-01f, -4.031658173e-04f, 9.992252588e-01f, -3.919005394e-04f,
+9.988333583e-01f, -3.772377968e-04f, 9.984561205e-01f, -3.592371941e-04f, 9.980968833e-01f, -3.381371498e-04f,
+9.977587461e-01f, -3.140568733e-04f, 9.974446893e-01f, -2.874732018e-04f, 9.971572161e-01f, -2.585053444e-04f,
+9.968987107e-01f, -2.275109291e-04f, 9.966711998e-01f, -1.948475838e-04f, 9.964763522e-01f, -1.608133316e-04f,
+9.963155389e-01f, -1.256465912e-04f, 9.961898923e-01f, -8.988380432e-05f, 9.961000085e-01f, -5.382299423e-05f,
+9.960461855e-01f, -1.764297485e-05f, 9.960285425e-01f, 1.811981201e-05f, 9.960466623e-01f, 5.322694778e-05f,
+9.960998893e-01f, 8.726119995e-05f, 9.961871505e-01f, 1.201033592e-04f, 9.963072538e-01f, 1.512765884e-04f,
+9.964585304e-01f, 1.806020737e-04f, 9.966391325e-01f, 2.076625824e-04f, 9.968467951e-01f, 2.325177193e-04f,
+9.970793128e-01f, 2.546906471e-04f, 9.973340034e-01f, 2.743005753e-04f, 9.976083040e-01f, 2.907514572e-04f,
+9.978990555e-01f, 3.044009209e-04f, 9.982034564e-01f, 3.149509430e-04f, 9.985184073e-01f, 3.222823143e-04f,
+9.988406897e-01f, 3.263950348e-04f, 9.991670847e-01f, 3.275275230e-04f, 9.994946122e-01f, 3.252625465e-04f,
+9.998198748e-01f, 3.201961517e-04f, 1.000140071e+00f, 3.119707108e-04f, 1.000452042e+00f, 3.008842468e-04f,
+1.000752926e+00f, 2.871751785e-04f, 1.001040101e+00f, 2.710819244e-04f, 1.001311183e+00f, 2.522468567e-04f,
+1.001563430e+00f, 2.317428589e-04f, 1.001795173e+00f, 2.088546753e-04f, 1.002004027e+00f, 1.847743988e-04f,
+1.002188802e+00f, 1.590251923e-04f, 1.002347827e+00f, 1.323223114e-04f, 1.002480149e+00f, 1.046657562e-04f,
+1.002584815e+00f, 7.653236389e-05f, 1.002661347e+00f, 4.792213440e-05f, 1.002709270e+00f, 1.943111420e-05f,
+1.002728701e+00f, -8.821487427e-06f, 1.002719879e+00f, -3.635883331e-05f, 1.002683520e+00f, -6.353855133e-05f,
+1.002619982e+00f, -8.904933929e-05f, 1.002530932e+00f, -1.138448715e-04f, 1.002417088e+00f, -1.369714737e-04f,
+1.002280116e+00f, -1.583099365e-04f, 1.002121806e+00f, -1.777410507e-04f, 1.001944065e+00f, -1.953840256e-04f,
+1.001748681e+00f, -2.104043961e-04f, 1.001538277e+00f, -2.236366272e-04f, 1.001314640e+00f, -2.342462540e-04f,
+1.001080394e+00f, -2.424716949e-04f, 1.000837922e+00f, -2.480745316e-04f, 1.000589848e+00f, -2.512931824e-04f,
+1.000338554e+00f, -2.520084381e-04f, 1.000086546e+00f, -2.503395081e-04f, 9.998362064e-01f, -2.461075783e-04f,
+9.995900989e-01f, -2.397298813e-04f, 9.993503690e-01f, -2.309679985e-04f, 9.991194010e-01f, -2.201795578e-04f,
+9.988992214e-01f, -2.074837685e-04f, 9.986917377e-01f, -1.928806305e-04f, 9.984988570e-01f, -1.767277718e-04f,
+9.983221292e-01f, -1.591444016e-04f, 9.981629848e-01f, -1.403093338e-04f, 9.980226755e-01f, -1.203417778e-04f,
+9.979023337e-01f, -9.959936142e-05f, 9.978027344e-01f, -7.832050323e-05f, 9.977244139e-01f, -5.656480789e-05f,
+9.976678491e-01f, -3.468990326e-05f, 9.976331592e-01f, -1.287460327e-05f, 9.976202846e-01f, 8.761882782e-06f,
+9.976290464e-01f, 2.986192703e-05f, 9.976589084e-01f, 5.024671555e-05f, 9.977091551e-01f, 6.985664368e-05f,
+9.977790117e-01f, 8.845329285e-05f, 9.978674650e-01f, 1.057982445e-04f, 9.979732633e-01f, 1.217722893e-04f,
+9.980950356e-01f, 1.361966133e-04f, 9.982312322e-01f, 1.491308212e-04f, 9.983803630e-01f, 1.603364944e-04f,
+9.985406995e-01f, 1.697540283e-04f, 9.987104535e-01f, 1.773238182e-04f, 9.988877773e-01f, 1.829862595e-04f,
+9.990707636e-01f, 1.867413521e-04f, 9.992575049e-01f, 1.885890961e-04f, 9.994460940e-01f, 1.885890961e-04f,
+9.996346831e-01f, 1.866817474e-04f, 9.998213649e-01f, 1.829266548e-04f, 1.000004292e+00f, 1.775026321e-04f,
+1.000181794e+00f, 1.704692841e-04f, 1.000352263e+00f, 1.617670059e-04f, 1.000514030e+00f, 1.516342163e-04f,
+1.000665665e+00f, 1.404285431e-04f, 1.000806093e+00f, 1.276731491e-04f, 1.000933766e+00f, 1.142024994e-04f,
+1.001047969e+00f, 9.965896606e-05f, 1.001147628e+00f, 8.451938629e-05f, 1.001232147e+00f, 6.890296936e-05f,
+1.001301050e+00f, 5.280971527e-05f, 1.001353860e+00f, 3.635883331e-05f, 1.001390219e+00f, 2.014636993e-05f,
+1.001410365e+00f, 4.053115845e-06f, 1.001414418e+00f, -1.215934753e-05f, 1.001402259e+00f, -2.753734589e-05f,
+1.001374722e+00f, -4.231929779e-05f, 1.001332402e+00f, -5.674362183e-05f, 1.001275659e+00f, -6.985664368e-05f,
+1.001205802e+00f, -8.237361908e-05f, 1.001123428e+00f, -9.369850159e-05f, 1.001029730e+00f, -1.035928726e-04f,
+1.000926137e+00f, -1.127719879e-04f, 1.000813365e+00f, -1.202821732e-04f, 1.000693083e+00f, -1.264810562e-04f,
+1.000566602e+00f, -1.313686371e-04f, 1.000435233e+00f, -1.347064972e-04f, 1.000300527e+00f, -1.367330551e-04f,
+1.000163794e+00f, -1.373291016e-04f, 1.000026464e+00f, -1.365542412e-04f, 9.998899102e-01f, -1.344084740e-04f,
+9.997555017e-01f, -1.308917999e-04f, 9.996246099e-01f, -1.262426376e-04f, 9.994983673e-01f, -1.204013824e-04f,
+9.993779659e-01f, -1.134276390e-04f, 9.992645383e-01f, -1.055002213e-04f, 9.991590381e-01f, -9.655952454e-05f,
+9.990624785e-01f, -8.702278137e-05f, 9.989754558e-01f, -7.671117783e-05f, 9.988987446e-01f, -6.586313248e-05f,
+9.988328815e-01f, -5.453824997e-05f, 9.987783432e-01f, -4.303455353e-05f, 9.987353086e-01f, -3.117322922e-05f,
+9.987041354e-01f, -1.943111420e-05f, 9.986847043e-01f, -7.569789886e-06f, 9.986771345e-01f, 3.993511200e-06f,
+9.986811280e-01f, 1.531839371e-05f, 9.986964464e-01f, 2.610683441e-05f, 9.987225533e-01f, 3.659725189e-05f,
+9.987591505e-01f, 4.631280899e-05f, 9.988054633e-01f, 5.543231964e-05f, 9.988608956e-01f, 6.377696991e-05f,
+9.989246726e-01f, 7.128715515e-05f, 9.989959598e-01f, 7.790327072e-05f, 9.990738630e-01f, 8.356571198e-05f,
+9.991574287e-01f, 8.833408356e-05f, 9.992457628e-01f, 9.191036224e-05f, 9.993376732e-01f, 9.471178055e-05f,
+9.994323850e-01f, 9.620189667e-05f, 9.995285869e-01f, 9.697675705e-05f, 9.996255636e-01f, 9.649991989e-05f,
+9.997220635e-01f, 9.524822235e-05f, 9.998173118e-01f, 9.292364120e-05f, 9.999102354e-01f, 8.976459503e-05f,
+1.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f
+};
+
+static const float normalInverseTable[4098] = {
+-3.487104177e+00f, 3.054502010e-01f, -3.181653976e+00f, 1.510253400e-01f, -3.030628681e+00f, 1.030874029e-01f,
+-2.927541256e+00f, 7.904396206e-02f, -2.848497152e+00f, 6.446132809e-02f, -2.784035921e+00f, 5.462684482e-02f,
+-2.729408979e+00f, 4.752488434e-02f, -2.681884050e+00f, 4.214419425e-02f, -2.639739990e+00f, 3.791999817e-02f,
+-2.601819992e+00f, 3.451143578e-02f, -2.567308426e+00f, 3.170028329e-02f, -2.535608292e+00f, 2.934020944e-02f,
+-2.506268024e+00f, 2.732931636e-02f, -2.478938818e+00f, 2.559442818e-02f, -2.453344345e+00f, 2.408159710e-02f,
+-2.429262638e+00f, 2.275015973e-02f, -2.406512499e+00f, 2.156887017e-02f, -2.384943724e+00f, 2.051331662e-02f,
+-2.364430428e+00f, 1.956413873e-02f, -2.344866276e+00f, 1.870578341e-02f, -2.326160431e+00f, 1.792560890e-02f,
+-2.308234692e+00f, 1.721323282e-02f, -2.291021585e+00f, 1.656004414e-02f, -2.274461508e+00f, 1.595884375e-02f,
+-2.258502722e+00f, 1.540355943e-02f, -2.243099213e+00f, 1.488903910e-02f, -2.228209972e+00f, 1.441087667e-02f,
+-2.213799238e+00f, 1.396528631e-02f, -2.199833870e+00f, 1.354899164e-02f, -2.186285019e+00f, 1.315914746e-02f,
+-2.173125744e+00f, 1.279326528e-02f, -2.160332441e+00f, 1.244916394e-02f, -2.147883415e+00f, 1.212492026e-02f,
+-2.135758400e+00f, 1.181883272e-02f, -2.123939514e+00f, 1.152939163e-02f, -2.112410307e+00f, 1.125525031e-02f,
+-2.101155043e+00f, 1.099520456e-02f, -2.090159655e+00f, 1.074817497e-02f, -2.079411507e+00f, 1.051319018e-02f,
+-2.068898439e+00f, 1.028937381e-02f, -2.058609009e+00f, 1.007593423e-02f, -2.048533201e+00f, 9.872152470e-03f,
+-2.038661003e+00f, 9.677374735e-03f, -2.028983593e+00f, 9.491005912e-03f, -2.019492626e+00f, 9.312503971e-03f,
+-2.010179996e+00f, 9.141370654e-03f, -2.001038790e+00f, 8.977150545e-03f, -1.992061496e+00f, 8.819424547e-03f,
+-1.983242154e+00f, 8.667808957e-03f, -1.974574327e+00f, 8.521949872e-03f, -1.966052294e+00f, 8.381512016e-03f,
+-1.957670808e+00f, 8.246202022e-03f, -1.949424624e+00f, 8.115734905e-03f, -1.941308856e+00f, 7.989848964e-03f,
+-1.933319092e+00f, 7.868303917e-03f, -1.925450802e+00f, 7.750873920e-03f, -1.917699814e+00f, 7.637349889e-03f,
+-1.910062551e+00f, 7.527535781e-03f, -1.902534962e+00f, 7.421249524e-03f, -1.895113707e+00f, 7.318320684e-03f,
+-1.887795448e+00f, 7.218589541e-03f, -1.880576849e+00f, 7.121905684e-03f, -1.873454928e+00f, 7.028129883e-03f,
+-1.866426826e+00f, 6.937129889e-03f, -1.859489679e+00f, 6.848781370e-03f, -1.852640867e+00f, 6.762968376e-03f,
+-1.845877886e+00f, 6.679581013e-03f, -1.839198351e+00f, 6.598515902e-03f, -1.832599759e+00f, 6.519675255e-03f,
+-1.826080084e+00f, 6.442967337e-03f, -1.819637179e+00f, 6.368304603e-03f, -1.813268900e+00f, 6.295605097e-03f,
+-1.806973219e+00f, 6.224790122e-03f, -1.800748467e+00f, 6.155787036e-03f, -1.794592738e+00f, 6.088525057e-03f,
+-1.788504124e+00f, 6.022938062e-03f, -1.782481194e+00f, 5.958962720e-03f, -1.776522279e+00f, 5.896539427e-03f,
+-1.770625710e+00f, 5.835611373e-03f, -1.764790058e+00f, 5.776124075e-03f, -1.759014010e+00f, 5.718026776e-03f,
+-1.753295898e+00f, 5.661269184e-03f, -1.747634649e+00f, 5.605805665e-03f, -1.742028832e+00f, 5.551590584e-03f,
+-1.736477256e+00f, 5.498582497e-03f, -1.730978727e+00f, 5.446739960e-03f, -1.725531936e+00f, 5.396024790e-03f,
+-1.720135927e+00f, 5.346399266e-03f, -1.714789510e+00f, 5.297828466e-03f, -1.709491730e+00f, 5.250277929e-03f,
+-1.704241395e+00f, 5.203715991e-03f, -1.699037671e+00f, 5.158110987e-03f, -1.693879604e+00f, 5.113433115e-03f,
+-1.688766122e+00f, 5.069653969e-03f, -1.683696508e+00f, 5.026746541e-03f, -1.678669810e+00f, 4.984683823e-03f,
+-1.673685074e+00f, 4.943441134e-03f, -1.668741703e+00f, 4.902994260e-03f, -1.663838625e+00f, 4.863319919e-03f,
+-1.658975363e+00f, 4.824395757e-03f, -1.654150963e+00f, 4.786199890e-03f, -1.649364710e+00f, 4.748712294e-03f,
+-1.644616008e+00f, 4.711912945e-03f, -1.639904141e+00f, 4.675782286e-03f, -1.635228276e+00f, 4.640302155e-03f,
+-1.630588055e+00f, 4.605454858e-03f, -1.625982523e+00f, 4.571223632e-03f, -1.621411324e+00f, 4.537591245e-03f,
+-1.616873741e+00f, 4.504542332e-03f, -1.612369180e+00f, 4.472061526e-03f, -1.607897162e+00f, 4.440133926e-03f,
+-1.603456974e+00f, 4.408745561e-03f, -1.599048257e+00f, 4.377881996e-03f, -1.594670415e+00f, 4.347530194e-03f,
+-1.590322852e+00f, 4.317677580e-03f, -1.586005211e+00f, 4.288311582e-03f, -1.581716895e+00f, 4.259420093e-03f,
+-1.577457428e+00f, 4.230991937e-03f, -1.573226452e+00f, 4.203015007e-03f, -1.569023490e+00f, 4.175479058e-03f,
+-1.564847946e+00f, 4.148373380e-03f, -1.560699582e+00f, 4.121687729e-03f, -1.556577921e+00f, 4.095412791e-03f,
+-1.552482486e+00f, 4.069538321e-03f, -1.548412919e+00f, 4.044055007e-03f, -1.544368863e+00f, 4.018954467e-03f,
+-1.540349960e+00f, 3.994227387e-03f, -1.536355734e+00f, 3.969866317e-03f, -1.532385826e+00f, 3.945861943e-03f,
+-1.528439999e+00f, 3.922206815e-03f, -1.524517775e+00f, 3.898893250e-03f, -1.520618916e+00f, 3.875913797e-03f,
+-1.516742945e+00f, 3.853261238e-03f, -1.512889743e+00f, 3.830928588e-03f, -1.509058833e+00f, 3.808908630e-03f,
+-1.505249858e+00f, 3.787195310e-03f, -1.501462698e+00f, 3.765781643e-03f, -1.497696877e+00f, 3.744661575e-03f,
+-1.493952274e+00f, 3.723829053e-03f, -1.490228415e+00f, 3.703278257e-03f, -1.486525178e+00f, 3.683003131e-03f,
+-1.482842088e+00f, 3.662998322e-03f, -1.479179144e+00f, 3.643258009e-03f, -1.475535870e+00f, 3.623777535e-03f,
+-1.471912146e+00f, 3.604551079e-03f, -1.468307495e+00f, 3.585573984e-03f, -1.464721918e+00f, 3.566841362e-03f,
+-1.461155176e+00f, 3.548348323e-03f, -1.457606792e+00f, 3.530090209e-03f, -1.454076648e+00f, 3.512062598e-03f,
+-1.450564623e+00f, 3.494261065e-03f, -1.447070360e+00f, 3.476681421e-03f, -1.443593740e+00f, 3.459319239e-03f,
+-1.440134406e+00f, 3.442170797e-03f, -1.436692238e+00f, 3.425231669e-03f, -1.433266997e+00f, 3.408498364e-03f,
+-1.429858446e+00f, 3.391966922e-03f, -1.426466465e+00f, 3.375633853e-03f, -1.423090816e+00f, 3.359495196e-03f,
+-1.419731379e+00f, 3.343547927e-03f, -1.416387796e+00f, 3.327788319e-03f, -1.413060069e+00f, 3.312212881e-03f,
+-1.409747839e+00f, 3.296818817e-03f, -1.406450987e+00f, 3.281602403e-03f, -1.403169394e+00f, 3.266561078e-03f,
+-1.399902821e+00f, 3.251691349e-03f, -1.396651149e+00f, 3.236990655e-03f, -1.393414140e+00f, 3.222455736e-03f,
+-1.390191674e+00f, 3.208084032e-03f, -1.386983633e+00f, 3.193872748e-03f, -1.383789778e+00f, 3.179818857e-03f,
+-1.380609870e+00f, 3.165920265e-03f, -1.377444029e+00f, 3.152173944e-03f, -1.374291778e+00f, 3.138577566e-03f,
+-1.371153235e+00f, 3.125128569e-03f, -1.368028164e+00f, 3.111824626e-03f, -1.364916325e+00f, 3.098663408e-03f,
+-1.361817598e+00f, 3.085642587e-03f, -1.358731985e+00f, 3.072759602e-03f, -1.355659246e+00f, 3.060012823e-03f,
+-1.352599263e+00f, 3.047399689e-03f, -1.349551797e+00f, 3.034918103e-03f, -1.346516848e+00f, 3.022566205e-03f,
+-1.343494296e+00f, 3.010341665e-03f, -1.340484023e+00f, 2.998242853e-03f, -1.337485790e+00f, 2.986267442e-03f,
+-1.334499478e+00f, 2.974414034e-03f, -1.331525087e+00f, 2.962680301e-03f, -1.328562379e+00f, 2.951064380e-03f,
+-1.325611353e+00f, 2.939564874e-03f, -1.322671771e+00f, 2.928179922e-03f, -1.319743633e+00f, 2.916907659e-03f,
+-1.316826701e+00f, 2.905746456e-03f, -1.313920975e+00f, 2.894694684e-03f, -1.311026216e+00f, 2.883750712e-03f,
+-1.308142543e+00f, 2.872913145e-03f, -1.305269599e+00f, 2.862180118e-03f, -1.302407384e+00f, 2.851550234e-03f,
+-1.299555898e+00f, 2.841022098e-03f, -1.296714783e+00f, 2.830594080e-03f, -1.293884277e+00f, 2.820265014e-03f,
+-1.291063905e+00f, 2.810033271e-03f, -1.288253903e+00f, 2.799897455e-03f, -1.285454035e+00f, 2.789856400e-03f,
+-1.282664180e+00f, 2.779908478e-03f, -1.279884219e+00f, 2.770052757e-03f, -1.277114153e+00f, 2.760287840e-03f,
+-1.274353981e+00f, 2.750612330e-03f, -1.271603346e+00f, 2.741024829e-03f, -1.268862247e+00f, 2.731524641e-03f,
+-1.266130805e+00f, 2.722110366e-03f, -1.263408661e+00f, 2.712780610e-03f, -1.260695815e+00f, 2.703534672e-03f,
+-1.257992387e+00f, 2.694370924e-03f, -1.255298018e+00f, 2.685288666e-03f, -1.252612710e+00f, 2.676286502e-03f,
+-1.249936342e+00f, 2.667363733e-03f, -1.247269034e+00f, 2.658518963e-03f, -1.244610548e+00f, 2.649751492e-03f,
+-1.241960764e+00f, 2.641059924e-03f, -1.239319682e+00f, 2.632443560e-03f, -1.236687303e+00f, 2.623901470e-03f,
+-1.234063387e+00f, 2.615432488e-03f, -1.231447935e+00f, 2.607035916e-03f, -1.228840828e+00f, 2.598710591e-03f,
+-1.226242185e+00f, 2.590455581e-03f, -1.223651767e+00f, 2.582270186e-03f, -1.221069455e+00f, 2.574153710e-03f,
+-1.218495250e+00f, 2.566104755e-03f, -1.215929151e+00f, 2.558122855e-03f, -1.213371038e+00f, 2.550207078e-03f,
+-1.210820913e+00f, 2.542356728e-03f, -1.208278537e+00f, 2.534570871e-03f, -1.205743909e+00f, 2.526848577e-03f,
+-1.203217030e+00f, 2.519189380e-03f, -1.200697899e+00f, 2.511592349e-03f, -1.198186278e+00f, 2.504056785e-03f,
+-1.195682287e+00f, 2.496581757e-03f, -1.193185687e+00f, 2.489166800e-03f, -1.190696478e+00f, 2.481811214e-03f,
+-1.188214660e+00f, 2.474514069e-03f, -1.185740113e+00f, 2.467274666e-03f, -1.183272839e+00f, 2.460092539e-03f,
+-1.180812836e+00f, 2.452966757e-03f, -1.178359866e+00f, 2.445897087e-03f, -1.175913930e+00f, 2.438882366e-03f,
+-1.173475027e+00f, 2.431922359e-03f, -1.171043158e+00f, 2.425016137e-03f, -1.168618083e+00f, 2.418163233e-03f,
+-1.166199923e+00f, 2.411362948e-03f, -1.163788557e+00f, 2.404614817e-03f, -1.161383986e+00f, 2.397918142e-03f,
+-1.158986092e+00f, 2.391272457e-03f, -1.156594753e+00f, 2.384677064e-03f, -1.154210091e+00f, 2.378131496e-03f,
+-1.151831985e+00f, 2.371635055e-03f, -1.149460316e+00f, 2.365187276e-03f, -1.147095203e+00f, 2.358787693e-03f,
+-1.144736409e+00f, 2.352435607e-03f, -1.142383933e+00f, 2.346130786e-03f, -1.140037775e+00f, 2.339872299e-03f,
+-1.137697935e+00f, 2.333659912e-03f, -1.135364294e+00f, 2.327493159e-03f, -1.133036733e+00f, 2.321371343e-03f,
+-1.130715370e+00f, 2.315293998e-03f, -1.128400087e+00f, 2.309260890e-03f, -1.126090884e+00f, 2.303271322e-03f,
+-1.123787522e+00f, 2.297325060e-03f, -1.121490240e+00f, 2.291421406e-03f, -1.119198799e+00f, 2.285559895e-03f,
+-1.116913319e+00f, 2.279740293e-03f, -1.114633560e+00f, 2.273961902e-03f, -1.112359524e+00f, 2.268224489e-03f,
+-1.110091329e+00f, 2.262527589e-03f, -1.107828856e+00f, 2.256870735e-03f, -1.105571985e+00f, 2.251253463e-03f,
+-1.103320718e+00f, 2.245675540e-03f, -1.101075053e+00f, 2.240136499e-03f, -1.098834872e+00f, 2.234635875e-03f,
+-1.096600294e+00f, 2.229173202e-03f, -1.094371080e+00f, 2.223748248e-03f, -1.092147350e+00f, 2.218360780e-03f,
+-1.089928985e+00f, 2.213009866e-03f, -1.087715983e+00f, 2.207695739e-03f, -1.085508227e+00f, 2.202417701e-03f,
+-1.083305836e+00f, 2.197175520e-03f, -1.081108689e+00f, 2.191968728e-03f, -1.078916669e+00f, 2.186797094e-03f,
+-1.076729894e+00f, 2.181660151e-03f, -1.074548244e+00f, 2.176557668e-03f, -1.072371721e+00f, 2.171489177e-03f,
+-1.070200205e+00f, 2.166454447e-03f, -1.068033695e+00f, 2.161453245e-03f, -1.065872312e+00f, 2.156484872e-03f,
+-1.063715816e+00f, 2.151549561e-03f, -1.061564207e+00f, 2.146646613e-03f, -1.059417605e+00f, 2.141775796e-03f,
+-1.057275772e+00f, 2.136936877e-03f, -1.055138946e+00f, 2.132129390e-03f, -1.053006768e+00f, 2.127353102e-03f,
+-1.050879359e+00f, 2.122607781e-03f, -1.048756838e+00f, 2.117893193e-03f, -1.046638846e+00f, 2.113208873e-03f,
+-1.044525743e+00f, 2.108554589e-03f, -1.042417169e+00f, 2.103930106e-03f, -1.040313244e+00f, 2.099335194e-03f,
+-1.038213849e+00f, 2.094769618e-03f, -1.036119103e+00f, 2.090232912e-03f, -1.034028888e+00f, 2.085724846e-03f,
+-1.031943202e+00f, 2.081245417e-03f, -1.029861927e+00f, 2.076793928e-03f, -1.027785063e+00f, 2.072370378e-03f,
+-1.025712729e+00f, 2.067974536e-03f, -1.023644805e+00f, 2.063606167e-03f, -1.021581173e+00f, 2.059265040e-03f,
+-1.019521952e+00f, 2.054950688e-03f, -1.017466903e+00f, 2.050663112e-03f, -1.015416265e+00f, 2.046401845e-03f,
+-1.013369918e+00f, 2.042166889e-03f, -1.011327744e+00f, 2.037958009e-03f, -1.009289742e+00f, 2.033774741e-03f,
+-1.007256031e+00f, 2.029616851e-03f, -1.005226374e+00f, 2.025484573e-03f, -1.003200889e+00f, 2.021377208e-03f,
+-1.001179457e+00f, 2.017294522e-03f, -9.991621971e-01f, 2.013236750e-03f, -9.971489906e-01f, 2.009203192e-03f,
+-9.951397777e-01f, 2.005193848e-03f, -9.931345582e-01f, 2.001208719e-03f, -9.911333919e-01f, 1.997247105e-03f,
+-9.891360998e-01f, 1.993309241e-03f, -9.871428013e-01f, 1.989394892e-03f, -9.851534367e-01f, 1.985503593e-03f,
+-9.831678867e-01f, 1.981635112e-03f, -9.811862707e-01f, 1.977789681e-03f, -9.792084694e-01f, 1.973966835e-03f,
+-9.772345424e-01f, 1.970166340e-03f, -9.752643704e-01f, 1.966387965e-03f, -9.732979536e-01f, 1.962631708e-03f,
+-9.713353515e-01f, 1.958897337e-03f, -9.693764448e-01f, 1.955184620e-03f, -9.674212337e-01f, 1.951493323e-03f,
+-9.654697776e-01f, 1.947823446e-03f, -9.635219574e-01f, 1.944174641e-03f, -9.615777731e-01f, 1.940546907e-03f,
+-9.596372247e-01f, 1.936939894e-03f, -9.577002525e-01f, 1.933353487e-03f, -9.557669163e-01f, 1.929787570e-03f,
+-9.538371563e-01f, 1.926241908e-03f, -9.519109130e-01f, 1.922716387e-03f, -9.499881864e-01f, 1.919210772e-03f,
+-9.480689764e-01f, 1.915725064e-03f, -9.461532235e-01f, 1.912258915e-03f, -9.442409873e-01f, 1.908812323e-03f,
+-9.423321486e-01f, 1.905385056e-03f, -9.404267669e-01f, 1.901976881e-03f, -9.385247827e-01f, 1.898587798e-03f,
+-9.366261959e-01f, 1.895217691e-03f, -9.347310066e-01f, 1.891866210e-03f, -9.328391552e-01f, 1.888533239e-03f,
+-9.309505820e-01f, 1.885218779e-03f, -9.290654063e-01f, 1.881922595e-03f, -9.271834493e-01f, 1.878644573e-03f,
+-9.253048301e-01f, 1.875384594e-03f, -9.234294295e-01f, 1.872142428e-03f, -9.215573072e-01f, 1.868917956e-03f,
+-9.196883440e-01f, 1.865711180e-03f, -9.178226590e-01f, 1.862521749e-03f, -9.159601331e-01f, 1.859349781e-03f,
+-9.141007662e-01f, 1.856194925e-03f, -9.122446179e-01f, 1.853057067e-03f, -9.103915095e-01f, 1.849936205e-03f,
+-9.085416198e-01f, 1.846832223e-03f, -9.066947699e-01f, 1.843744772e-03f, -9.048510194e-01f, 1.840673969e-03f,
+-9.030103683e-01f, 1.837619580e-03f, -9.011726975e-01f, 1.834581490e-03f, -8.993381262e-01f, 1.831559581e-03f,
+-8.975065947e-01f, 1.828553737e-03f, -8.956780434e-01f, 1.825563842e-03f, -8.938524723e-01f, 1.822589780e-03f,
+-8.920298815e-01f, 1.819631434e-03f, -8.902102709e-01f, 1.816688571e-03f, -8.883935809e-01f, 1.813761308e-03f,
+-8.865798116e-01f, 1.810849411e-03f, -8.847689629e-01f, 1.807952765e-03f, -8.829609752e-01f, 1.805071137e-03f,
+-8.811559081e-01f, 1.802204642e-03f, -8.793537021e-01f, 1.799353166e-03f, -8.775543571e-01f, 1.796516357e-03f,
+-8.757578731e-01f, 1.793694333e-03f, -8.739641309e-01f, 1.790886861e-03f, -8.721732497e-01f, 1.788093941e-03f,
+-8.703851700e-01f, 1.785315340e-03f, -8.685998321e-01f, 1.782551175e-03f, -8.668172956e-01f, 1.779801096e-03f,
+-8.650375009e-01f, 1.777065103e-03f, -8.632604480e-01f, 1.774343196e-03f, -8.614860773e-01f, 1.771635027e-03f,
+-8.597144485e-01f, 1.768940827e-03f, -8.579455018e-01f, 1.766260248e-03f, -8.561792374e-01f, 1.763593289e-03f,
+-8.544156551e-01f, 1.760939835e-03f, -8.526547551e-01f, 1.758299768e-03f, -8.508964181e-01f, 1.755672973e-03f,
+-8.491407633e-01f, 1.753059565e-03f, -8.473876715e-01f, 1.750459196e-03f, -8.456372619e-01f, 1.747871866e-03f,
+-8.438893557e-01f, 1.745297574e-03f, -8.421440721e-01f, 1.742736087e-03f, -8.404013515e-01f, 1.740187407e-03f,
+-8.386611342e-01f, 1.737651415e-03f, -8.369234800e-01f, 1.735128113e-03f, -8.351883888e-01f, 1.732617267e-03f,
+-8.334557414e-01f, 1.730118878e-03f, -8.317256570e-01f, 1.727632829e-03f, -8.299980164e-01f, 1.725159003e-03f,
+-8.282728195e-01f, 1.722697401e-03f, -8.265501261e-01f, 1.720248023e-03f, -8.248298764e-01f, 1.717810519e-03f,
+-8.231120706e-01f, 1.715385122e-03f, -8.213967085e-01f, 1.712971483e-03f, -8.196837306e-01f, 1.710569719e-03f,
+-8.179731369e-01f, 1.708179596e-03f, -8.162649870e-01f, 1.705801114e-03f, -8.145591617e-01f, 1.703434275e-03f,
+-8.128557205e-01f, 1.701078843e-03f, -8.111546636e-01f, 1.698734937e-03f, -8.094559312e-01f, 1.696402207e-03f,
+-8.077595234e-01f, 1.694080885e-03f, -8.060654402e-01f, 1.691770740e-03f, -8.043736815e-01f, 1.689471654e-03f,
+-8.026841879e-01f, 1.687183627e-03f, -8.009970188e-01f, 1.684906543e-03f, -7.993121147e-01f, 1.682640519e-03f,
+-7.976294756e-01f, 1.680385205e-03f, -7.959491014e-01f, 1.678140718e-03f, -7.942709327e-01f, 1.675906824e-03f,
+-7.925950289e-01f, 1.673683641e-03f, -7.909213305e-01f, 1.671471051e-03f, -7.892498970e-01f, 1.669268939e-03f,
+-7.875806093e-01f, 1.667077304e-03f, -7.859135270e-01f, 1.664895914e-03f, -7.842486501e-01f, 1.662724884e-03f,
+-7.825859189e-01f, 1.660564216e-03f, -7.809253335e-01f, 1.658413559e-03f, -7.792669535e-01f, 1.656273031e-03f,
+-7.776106596e-01f, 1.654142630e-03f, -7.759565115e-01f, 1.652022242e-03f, -7.743045092e-01f, 1.649911748e-03f,
+-7.726545930e-01f, 1.647811034e-03f, -7.710067630e-01f, 1.645720215e-03f, -7.693610787e-01f, 1.643639058e-03f,
+-7.677174211e-01f, 1.641567680e-03f, -7.660758495e-01f, 1.639505848e-03f, -7.644363642e-01f, 1.637453679e-03f,
+-7.627989054e-01f, 1.635410939e-03f, -7.611634731e-01f, 1.633377746e-03f, -7.595301270e-01f, 1.631353865e-03f,
+-7.578987479e-01f, 1.629339298e-03f, -7.562693954e-01f, 1.627334044e-03f, -7.546420693e-01f, 1.625338104e-03f,
+-7.530167103e-01f, 1.623351243e-03f, -7.513933778e-01f, 1.621373580e-03f, -7.497720122e-01f, 1.619404880e-03f,
+-7.481526136e-01f, 1.617445261e-03f, -7.465351820e-01f, 1.615494606e-03f, -7.449196577e-01f, 1.613552799e-03f,
+-7.433061004e-01f, 1.611619839e-03f, -7.416945100e-01f, 1.609695726e-03f, -7.400847673e-01f, 1.607780345e-03f,
+-7.384769917e-01f, 1.605873695e-03f, -7.368711233e-01f, 1.603975659e-03f, -7.352671623e-01f, 1.602086239e-03f,
+-7.336651087e-01f, 1.600205433e-03f, -7.320649028e-01f, 1.598333009e-03f, -7.304665446e-01f, 1.596469083e-03f,
+-7.288700938e-01f, 1.594613539e-03f, -7.272754312e-01f, 1.592766377e-03f, -7.256826758e-01f, 1.590927597e-03f,
+-7.240917683e-01f, 1.589096966e-03f, -7.225026488e-01f, 1.587274601e-03f, -7.209153771e-01f, 1.585460384e-03f,
+-7.193299532e-01f, 1.583654201e-03f, -7.177462578e-01f, 1.581856166e-03f, -7.161644101e-01f, 1.580066164e-03f,
+-7.145843506e-01f, 1.578284195e-03f, -7.130060792e-01f, 1.576510025e-03f, -7.114295363e-01f, 1.574743888e-03f,
+-7.098548412e-01f, 1.572985551e-03f, -7.082818151e-01f, 1.571235014e-03f, -7.067105770e-01f, 1.569492160e-03f,
+-7.051411271e-01f, 1.567757106e-03f, -7.035733461e-01f, 1.566029736e-03f, -7.020072937e-01f, 1.564310049e-03f,
+-7.004430294e-01f, 1.562597812e-03f, -6.988804340e-01f, 1.560893259e-03f, -6.973195076e-01f, 1.559196156e-03f,
+-6.957603097e-01f, 1.557506504e-03f, -6.942028403e-01f, 1.555824303e-03f, -6.926469803e-01f, 1.554149552e-03f,
+-6.910928488e-01f, 1.552482019e-03f, -6.895403862e-01f, 1.550821937e-03f, -6.879895329e-01f, 1.549168956e-03f,
+-6.864403486e-01f, 1.547523309e-03f, -6.848928332e-01f, 1.545884879e-03f, -6.833469868e-01f, 1.544253551e-03f,
+-6.818026900e-01f, 1.542629325e-03f, -6.802600622e-01f, 1.541012200e-03f, -6.787190437e-01f, 1.539402176e-03f,
+-6.771796346e-01f, 1.537799137e-03f, -6.756418347e-01f, 1.536202966e-03f, -6.741056442e-01f, 1.534613781e-03f,
+-6.725710630e-01f, 1.533031464e-03f, -6.710380316e-01f, 1.531456015e-03f, -6.695065498e-01f, 1.529887435e-03f,
+-6.679766774e-01f, 1.528325607e-03f, -6.664483547e-01f, 1.526770531e-03f, -6.649215817e-01f, 1.525222091e-03f,
+-6.633963585e-01f, 1.523680403e-03f, -6.618726850e-01f, 1.522145350e-03f, -6.603505015e-01f, 1.520616934e-03f,
+-6.588299274e-01f, 1.519095036e-03f, -6.573108435e-01f, 1.517579658e-03f, -6.557932496e-01f, 1.516070915e-03f,
+-6.542771459e-01f, 1.514568459e-03f, -6.527625918e-01f, 1.513072639e-03f, -6.512495279e-01f, 1.511583105e-03f,
+-6.497379541e-01f, 1.510099974e-03f, -6.482278705e-01f, 1.508623245e-03f, -6.467192173e-01f, 1.507152803e-03f,
+-6.452120543e-01f, 1.505688531e-03f, -6.437063813e-01f, 1.504230662e-03f, -6.422021389e-01f, 1.502778963e-03f,
+-6.406993866e-01f, 1.501333434e-03f, -6.391980052e-01f, 1.499894075e-03f, -6.376981139e-01f, 1.498460770e-03f,
+-6.361996531e-01f, 1.497033634e-03f, -6.347026229e-01f, 1.495612552e-03f, -6.332070231e-01f, 1.494197524e-03f,
+-6.317128539e-01f, 1.492788433e-03f, -6.302200556e-01f, 1.491385396e-03f, -6.287286878e-01f, 1.489988179e-03f,
+-6.272386909e-01f, 1.488597016e-03f, -6.257500648e-01f, 1.487211674e-03f, -6.242628694e-01f, 1.485832268e-03f,
+-6.227770448e-01f, 1.484458568e-03f, -6.212925911e-01f, 1.483090804e-03f, -6.198095083e-01f, 1.481728745e-03f,
+-6.183277369e-01f, 1.480372390e-03f, -6.168473959e-01f, 1.479021856e-03f, -6.153683662e-01f, 1.477676909e-03f,
+-6.138907075e-01f, 1.476337668e-03f, -6.124143600e-01f, 1.475004130e-03f, -6.109393239e-01f, 1.473676064e-03f,
+-6.094656587e-01f, 1.472353702e-03f, -6.079933047e-01f, 1.471036812e-03f, -6.065222621e-01f, 1.469725510e-03f,
+-6.050525308e-01f, 1.468419679e-03f, -6.035841107e-01f, 1.467119437e-03f, -6.021170020e-01f, 1.465824549e-03f,
+-6.006512046e-01f, 1.464535017e-03f, -5.991866589e-01f, 1.463251072e-03f, -5.977234244e-01f, 1.461972366e-03f,
+-5.962614417e-01f, 1.460699015e-03f, -5.948007107e-01f, 1.459431020e-03f, -5.933412910e-01f, 1.458168379e-03f,
+-5.918831229e-01f, 1.456910977e-03f, -5.904262066e-01f, 1.455658814e-03f, -5.889705420e-01f, 1.454411889e-03f,
+-5.875161290e-01f, 1.453170087e-03f, -5.860629678e-01f, 1.451933640e-03f, -5.846110582e-01f, 1.450702199e-03f,
+-5.831603408e-01f, 1.449475996e-03f, -5.817108750e-01f, 1.448254799e-03f, -5.802626014e-01f, 1.447038841e-03f,
+-5.788155794e-01f, 1.445827773e-03f, -5.773697495e-01f, 1.444621827e-03f, -5.759251118e-01f, 1.443421002e-03f,
+-5.744817257e-01f, 1.442225068e-03f, -5.730394721e-01f, 1.441034139e-03f, -5.715984702e-01f, 1.439848100e-03f,
+-5.701586008e-01f, 1.438667066e-03f, -5.687199235e-01f, 1.437490922e-03f, -5.672824383e-01f, 1.436319668e-03f,
+-5.658461452e-01f, 1.435153186e-03f, -5.644109845e-01f, 1.433991711e-03f, -5.629769564e-01f, 1.432834892e-03f,
+-5.615441203e-01f, 1.431682962e-03f, -5.601124763e-01f, 1.430535805e-03f, -5.586819053e-01f, 1.429393422e-03f,
+-5.572525263e-01f, 1.428255811e-03f, -5.558242798e-01f, 1.427122857e-03f, -5.543971658e-01f, 1.425994677e-03f,
+-5.529711246e-01f, 1.424871036e-03f, -5.515462756e-01f, 1.423752168e-03f, -5.501224995e-01f, 1.422637841e-03f,
+-5.486999154e-01f, 1.421528286e-03f, -5.472783446e-01f, 1.420423156e-03f, -5.458579659e-01f, 1.419322682e-03f,
+-5.444386005e-01f, 1.418226864e-03f, -5.430203676e-01f, 1.417135471e-03f, -5.416032672e-01f, 1.416048617e-03f,
+-5.401871800e-01f, 1.414966187e-03f, -5.387722254e-01f, 1.413888414e-03f, -5.373583436e-01f, 1.412814949e-03f,
+-5.359455347e-01f, 1.411746023e-03f, -5.345337987e-01f, 1.410681405e-03f, -5.331231356e-01f, 1.409621327e-03f,
+-5.317134857e-01f, 1.408565557e-03f, -5.303049088e-01f, 1.407514210e-03f, -5.288974047e-01f, 1.406467170e-03f,
+-5.274909139e-01f, 1.405424555e-03f, -5.260854959e-01f, 1.404386130e-03f, -5.246811509e-01f, 1.403352129e-03f,
+-5.232777596e-01f, 1.402322319e-03f, -5.218754411e-01f, 1.401296817e-03f, -5.204741359e-01f, 1.400275505e-03f,
+-5.190739036e-01f, 1.399258501e-03f, -5.176746249e-01f, 1.398245571e-03f, -5.162763596e-01f, 1.397236949e-03f,
+-5.148791671e-01f, 1.396232517e-03f, -5.134829283e-01f, 1.395232277e-03f, -5.120877028e-01f, 1.394236111e-03f,
+-5.106934309e-01f, 1.393244020e-03f, -5.093001723e-01f, 1.392256119e-03f, -5.079079270e-01f, 1.391272293e-03f,
+-5.065166950e-01f, 1.390292542e-03f, -5.051263571e-01f, 1.389316865e-03f, -5.037370324e-01f, 1.388345263e-03f,
+-5.023487210e-01f, 1.387377619e-03f, -5.009613633e-01f, 1.386414049e-03f, -4.995749295e-01f, 1.385454438e-03f,
+-4.981894791e-01f, 1.384498901e-03f, -4.968049824e-01f, 1.383547205e-03f, -4.954214096e-01f, 1.382599468e-03f,
+-4.940388203e-01f, 1.381655806e-03f, -4.926571548e-01f, 1.380715985e-03f, -4.912764430e-01f, 1.379780006e-03f,
+-4.898966849e-01f, 1.378847985e-03f, -4.885178208e-01f, 1.377919805e-03f, -4.871399105e-01f, 1.376995584e-03f,
+-4.857628942e-01f, 1.376075088e-03f, -4.843868315e-01f, 1.375158434e-03f, -4.830116630e-01f, 1.374245621e-03f,
+-4.816374183e-01f, 1.373336650e-03f, -4.802640975e-01f, 1.372431521e-03f, -4.788916707e-01f, 1.371530001e-03f,
+-4.775201380e-01f, 1.370632323e-03f, -4.761494994e-01f, 1.369738486e-03f, -4.747797549e-01f, 1.368848258e-03f,
+-4.734109044e-01f, 1.367961755e-03f, -4.720429480e-01f, 1.367078978e-03f, -4.706758559e-01f, 1.366199926e-03f,
+-4.693096578e-01f, 1.365324482e-03f, -4.679443538e-01f, 1.364452764e-03f, -4.665798843e-01f, 1.363584655e-03f,
+-4.652163088e-01f, 1.362720155e-03f, -4.638535976e-01f, 1.361859380e-03f, -4.624917209e-01f, 1.361002098e-03f,
+-4.611307383e-01f, 1.360148541e-03f, -4.597705901e-01f, 1.359298476e-03f, -4.584112763e-01f, 1.358452020e-03f,
+-4.570528269e-01f, 1.357609057e-03f, -4.556952119e-01f, 1.356769702e-03f, -4.543384612e-01f, 1.355933840e-03f,
+-4.529825151e-01f, 1.355101587e-03f, -4.516274035e-01f, 1.354272710e-03f, -4.502731264e-01f, 1.353447442e-03f,
+-4.489196837e-01f, 1.352625550e-03f, -4.475670755e-01f, 1.351807150e-03f, -4.462152719e-01f, 1.350992243e-03f,
+-4.448642731e-01f, 1.350180828e-03f, -4.435140789e-01f, 1.349372789e-03f, -4.421647191e-01f, 1.348568127e-03f,
+-4.408161342e-01f, 1.347766956e-03f, -4.394683838e-01f, 1.346969162e-03f, -4.381214082e-01f, 1.346174744e-03f,
+-4.367752373e-01f, 1.345383585e-03f, -4.354298413e-01f, 1.344595919e-03f, -4.340852499e-01f, 1.343811629e-03f,
+-4.327414334e-01f, 1.343030599e-03f, -4.313984215e-01f, 1.342252945e-03f, -4.300561547e-01f, 1.341478550e-03f,
+-4.287146926e-01f, 1.340707531e-03f, -4.273739755e-01f, 1.339939772e-03f, -4.260340333e-01f, 1.339175273e-03f,
+-4.246948659e-01f, 1.338414033e-03f, -4.233564436e-01f, 1.337656053e-03f, -4.220187962e-01f, 1.336901449e-03f,
+-4.206818938e-01f, 1.336149988e-03f, -4.193457365e-01f, 1.335401670e-03f, -4.180103242e-01f, 1.334656728e-03f,
+-4.166756868e-01f, 1.333914814e-03f, -4.153417647e-01f, 1.333176275e-03f, -4.140085876e-01f, 1.332440763e-03f,
+-4.126761556e-01f, 1.331708510e-03f, -4.113444388e-01f, 1.330979401e-03f, -4.100134671e-01f, 1.330253552e-03f,
+-4.086832106e-01f, 1.329530729e-03f, -4.073536694e-01f, 1.328811049e-03f, -4.060248733e-01f, 1.328094513e-03f,
+-4.046967626e-01f, 1.327381004e-03f, -4.033693969e-01f, 1.326670754e-03f, -4.020427167e-01f, 1.325963414e-03f,
+-4.007167518e-01f, 1.325259334e-03f, -3.993915021e-01f, 1.324558165e-03f, -3.980669379e-01f, 1.323860255e-03f,
+-3.967430890e-01f, 1.323165256e-03f, -3.954199255e-01f, 1.322473283e-03f, -3.940974474e-01f, 1.321784453e-03f,
+-3.927756548e-01f, 1.321098534e-03f, -3.914545476e-01f, 1.320415642e-03f, -3.901341259e-01f, 1.319735893e-03f,
+-3.888143897e-01f, 1.319058938e-03f, -3.874953389e-01f, 1.318385126e-03f, -3.861769736e-01f, 1.317714225e-03f,
+-3.848592341e-01f, 1.317046350e-03f, -3.835422099e-01f, 1.316381386e-03f, -3.822258115e-01f, 1.315719332e-03f,
+-3.809100986e-01f, 1.315060304e-03f, -3.795950413e-01f, 1.314404188e-03f, -3.782806396e-01f, 1.313750865e-03f,
+-3.769668937e-01f, 1.313100569e-03f, -3.756537735e-01f, 1.312453183e-03f, -3.743413389e-01f, 1.311808708e-03f,
+-3.730295300e-01f, 1.311167143e-03f, -3.717183471e-01f, 1.310528372e-03f, -3.704078197e-01f, 1.309892512e-03f,
+-3.690979183e-01f, 1.309259562e-03f, -3.677886724e-01f, 1.308629406e-03f, -3.664800525e-01f, 1.308002044e-03f,
+-3.651720285e-01f, 1.307377592e-03f, -3.638646603e-01f, 1.306755934e-03f, -3.625579178e-01f, 1.306137186e-03f,
+-3.612517715e-01f, 1.305521117e-03f, -3.599462509e-01f, 1.304907957e-03f, -3.586413562e-01f, 1.304297592e-03f,
+-3.573370576e-01f, 1.303689904e-03f, -3.560333550e-01f, 1.303085126e-03f, -3.547302783e-01f, 1.302483026e-03f,
+-3.534277976e-01f, 1.301883720e-03f, -3.521259129e-01f, 1.301287208e-03f, -3.508246243e-01f, 1.300693373e-03f,
+-3.495239317e-01f, 1.300102333e-03f, -3.482238054e-01f, 1.299513970e-03f, -3.469243050e-01f, 1.298928401e-03f,
+-3.456253707e-01f, 1.298345509e-03f, -3.443270326e-01f, 1.297765295e-03f, -3.430292606e-01f, 1.297187875e-03f,
+-3.417320848e-01f, 1.296613133e-03f, -3.404354751e-01f, 1.296041068e-03f, -3.391394317e-01f, 1.295471564e-03f,
+-3.378439546e-01f, 1.294904854e-03f, -3.365490437e-01f, 1.294340822e-03f, -3.352546990e-01f, 1.293779351e-03f,
+-3.339609206e-01f, 1.293220557e-03f, -3.326677084e-01f, 1.292664441e-03f, -3.313750327e-01f, 1.292111003e-03f,
+-3.300829232e-01f, 1.291560126e-03f, -3.287913799e-01f, 1.291011926e-03f, -3.275003731e-01f, 1.290466287e-03f,
+-3.262099028e-01f, 1.289923326e-03f, -3.249199688e-01f, 1.289382926e-03f, -3.236306012e-01f, 1.288845087e-03f,
+-3.223417401e-01f, 1.288309810e-03f, -3.210534453e-01f, 1.287777210e-03f, -3.197656572e-01f, 1.287247171e-03f,
+-3.184784055e-01f, 1.286719576e-03f, -3.171916902e-01f, 1.286194660e-03f, -3.159054816e-01f, 1.285672304e-03f,
+-3.146198094e-01f, 1.285152393e-03f, -3.133346736e-01f, 1.284635160e-03f, -3.120500445e-01f, 1.284120372e-03f,
+-3.107659221e-01f, 1.283608144e-03f, -3.094823062e-01f, 1.283098478e-03f, -3.081991971e-01f, 1.282591256e-03f,
+-3.069166243e-01f, 1.282086479e-03f, -3.056345284e-01f, 1.281584380e-03f, -3.043529391e-01f, 1.281084609e-03f,
+-3.030718565e-01f, 1.280587399e-03f, -3.017912805e-01f, 1.280092751e-03f, -3.005111814e-01f, 1.279600430e-03f,
+-2.992315888e-01f, 1.279110671e-03f, -2.979524732e-01f, 1.278623473e-03f, -2.966738343e-01f, 1.278138603e-03f,
+-2.953957021e-01f, 1.277656178e-03f, -2.941180468e-01f, 1.277176198e-03f, -2.928408682e-01f, 1.276698778e-03f,
+-2.915641665e-01f, 1.276223687e-03f, -2.902879417e-01f, 1.275751041e-03f, -2.890121937e-01f, 1.275280840e-03f,
+-2.877369225e-01f, 1.274813083e-03f, -2.864620984e-01f, 1.274347655e-03f, -2.851877511e-01f, 1.273884671e-03f,
+-2.839138806e-01f, 1.273424132e-03f, -2.826404572e-01f, 1.272966038e-03f, -2.813674808e-01f, 1.272510272e-03f,
+-2.800949812e-01f, 1.272056834e-03f, -2.788229287e-01f, 1.271605841e-03f, -2.775513232e-01f, 1.271157176e-03f,
+-2.762801647e-01f, 1.270710956e-03f, -2.750094533e-01f, 1.270266948e-03f, -2.737391889e-01f, 1.269825501e-03f,
+-2.724693418e-01f, 1.269386266e-03f, -2.711999714e-01f, 1.268949476e-03f, -2.699310184e-01f, 1.268514898e-03f,
+-2.686625123e-01f, 1.268082764e-03f, -2.673944235e-01f, 1.267652959e-03f, -2.661267519e-01f, 1.267225365e-03f,
+-2.648595273e-01f, 1.266800216e-03f, -2.635927498e-01f, 1.266377396e-03f, -2.623263597e-01f, 1.265956787e-03f,
+-2.610604167e-01f, 1.265538507e-03f, -2.597948611e-01f, 1.265122555e-03f, -2.585297525e-01f, 1.264708932e-03f,
+-2.572650313e-01f, 1.264297636e-03f, -2.560007274e-01f, 1.263888553e-03f, -2.547368407e-01f, 1.263481681e-03f,
+-2.534733713e-01f, 1.263077254e-03f, -2.522102892e-01f, 1.262674923e-03f, -2.509476244e-01f, 1.262275036e-03f,
+-2.496853471e-01f, 1.261877245e-03f, -2.484234571e-01f, 1.261481899e-03f, -2.471619844e-01f, 1.261088648e-03f,
+-2.459008992e-01f, 1.260697725e-03f, -2.446402013e-01f, 1.260309014e-03f, -2.433798909e-01f, 1.259922516e-03f,
+-2.421199679e-01f, 1.259538345e-03f, -2.408604175e-01f, 1.259156270e-03f, -2.396012694e-01f, 1.258776523e-03f,
+-2.383424938e-01f, 1.258398988e-03f, -2.370840907e-01f, 1.258023665e-03f, -2.358260751e-01f, 1.257650554e-03f,
+-2.345684171e-01f, 1.257279655e-03f, -2.333111316e-01f, 1.256910968e-03f, -2.320542336e-01f, 1.256544492e-03f,
+-2.307976782e-01f, 1.256180229e-03f, -2.295415103e-01f, 1.255818061e-03f, -2.282856852e-01f, 1.255458104e-03f,
+-2.270302325e-01f, 1.255100360e-03f, -2.257751226e-01f, 1.254744828e-03f, -2.245203853e-01f, 1.254391507e-03f,
+-2.232659906e-01f, 1.254040282e-03f, -2.220119536e-01f, 1.253691153e-03f, -2.207582593e-01f, 1.253344351e-03f,
+-2.195049077e-01f, 1.252999646e-03f, -2.182519138e-01f, 1.252657035e-03f, -2.169992626e-01f, 1.252316637e-03f,
+-2.157469392e-01f, 1.251978334e-03f, -2.144949585e-01f, 1.251642243e-03f, -2.132433206e-01f, 1.251308247e-03f,
+-2.119920105e-01f, 1.250976464e-03f, -2.107410431e-01f, 1.250646776e-03f, -2.094903886e-01f, 1.250319183e-03f,
+-2.082400769e-01f, 1.249993686e-03f, -2.069900781e-01f, 1.249670400e-03f, -2.057404071e-01f, 1.249349094e-03f,
+-2.044910640e-01f, 1.249030000e-03f, -2.032420337e-01f, 1.248713001e-03f, -2.019933164e-01f, 1.248398097e-03f,
+-2.007449120e-01f, 1.248085406e-03f, -1.994968355e-01f, 1.247774693e-03f, -1.982490569e-01f, 1.247466076e-03f,
+-1.970015913e-01f, 1.247159555e-03f, -1.957544237e-01f, 1.246855245e-03f, -1.945075691e-01f, 1.246552914e-03f,
+-1.932610273e-01f, 1.246252679e-03f, -1.920147687e-01f, 1.245954540e-03f, -1.907688081e-01f, 1.245658379e-03f,
+-1.895231605e-01f, 1.245364430e-03f, -1.882777959e-01f, 1.245072461e-03f, -1.870327145e-01f, 1.244782587e-03f,
+-1.857879311e-01f, 1.244494808e-03f, -1.845434457e-01f, 1.244209008e-03f, -1.832992285e-01f, 1.243925304e-03f,
+-1.820553094e-01f, 1.243643695e-03f, -1.808116585e-01f, 1.243364066e-03f, -1.795683056e-01f, 1.243086532e-03f,
+-1.783252060e-01f, 1.242811093e-03f, -1.770824045e-01f, 1.242537634e-03f, -1.758398712e-01f, 1.242266153e-03f,
+-1.745975912e-01f, 1.241996768e-03f, -1.733555943e-01f, 1.241729478e-03f, -1.721138656e-01f, 1.241464168e-03f,
+-1.708724052e-01f, 1.241200836e-03f, -1.696312129e-01f, 1.240939600e-03f, -1.683902740e-01f, 1.240680343e-03f,
+-1.671495885e-01f, 1.240423066e-03f, -1.659091711e-01f, 1.240167883e-03f, -1.646689922e-01f, 1.239914680e-03f,
+-1.634290814e-01f, 1.239663456e-03f, -1.621894240e-01f, 1.239414210e-03f, -1.609500051e-01f, 1.239167061e-03f,
+-1.597108394e-01f, 1.238921890e-03f, -1.584719121e-01f, 1.238678698e-03f, -1.572332382e-01f, 1.238437486e-03f,
+-1.559948027e-01f, 1.238198252e-03f, -1.547566056e-01f, 1.237960998e-03f, -1.535186470e-01f, 1.237725839e-03f,
+-1.522809118e-01f, 1.237492543e-03f, -1.510434151e-01f, 1.237261225e-03f, -1.498061568e-01f, 1.237032004e-03f,
+-1.485691220e-01f, 1.236804645e-03f, -1.473323256e-01f, 1.236579381e-03f, -1.460957378e-01f, 1.236355980e-03f,
+-1.448593885e-01f, 1.236134558e-03f, -1.436232477e-01f, 1.235915232e-03f, -1.423873454e-01f, 1.235697768e-03f,
+-1.411516368e-01f, 1.235482283e-03f, -1.399161518e-01f, 1.235268661e-03f, -1.386808902e-01f, 1.235057134e-03f,
+-1.374458373e-01f, 1.234847470e-03f, -1.362109780e-01f, 1.234639902e-03f, -1.349763423e-01f, 1.234434079e-03f,
+-1.337419152e-01f, 1.234230353e-03f, -1.325076818e-01f, 1.234028605e-03f, -1.312736571e-01f, 1.233828720e-03f,
+-1.300398260e-01f, 1.233630697e-03f, -1.288061887e-01f, 1.233434770e-03f, -1.275727600e-01f, 1.233240706e-03f,
+-1.263395101e-01f, 1.233048621e-03f, -1.251064688e-01f, 1.232858398e-03f, -1.238736138e-01f, 1.232670154e-03f,
+-1.226409376e-01f, 1.232483773e-03f, -1.214084551e-01f, 1.232299372e-03f, -1.201761588e-01f, 1.232116949e-03f,
+-1.189440414e-01f, 1.231936389e-03f, -1.177121028e-01f, 1.231757808e-03f, -1.164803430e-01f, 1.231581089e-03f,
+-1.152487621e-01f, 1.231406350e-03f, -1.140173599e-01f, 1.231233473e-03f, -1.127861217e-01f, 1.231062459e-03f,
+-1.115550622e-01f, 1.230893424e-03f, -1.103241667e-01f, 1.230726368e-03f, -1.090934426e-01f, 1.230561058e-03f,
+-1.078628823e-01f, 1.230397727e-03f, -1.066324860e-01f, 1.230236376e-03f, -1.054022461e-01f, 1.230076887e-03f,
+-1.041721702e-01f, 1.229919260e-03f, -1.029422507e-01f, 1.229763613e-03f, -1.017124876e-01f, 1.229609712e-03f,
+-1.004828811e-01f, 1.229457906e-03f, -9.925342351e-02f, 1.229307847e-03f, -9.802411497e-02f, 1.229159767e-03f,
+-9.679495543e-02f, 1.229013549e-03f, -9.556593746e-02f, 1.228869194e-03f, -9.433706850e-02f, 1.228726702e-03f,
+-9.310834110e-02f, 1.228586189e-03f, -9.187975526e-02f, 1.228447538e-03f, -9.065131098e-02f, 1.228310750e-03f,
+-8.942300081e-02f, 1.228175825e-03f, -8.819482476e-02f, 1.228042762e-03f, -8.696678281e-02f, 1.227911678e-03f,
+-8.573886752e-02f, 1.227782457e-03f, -8.451108634e-02f, 1.227654982e-03f, -8.328343183e-02f, 1.227529487e-03f,
+-8.205590397e-02f, 1.227405854e-03f, -8.082849532e-02f, 1.227284083e-03f, -7.960121334e-02f, 1.227164292e-03f,
+-7.837405056e-02f, 1.227046247e-03f, -7.714699954e-02f, 1.226930064e-03f, -7.592006773e-02f, 1.226815861e-03f,
+-7.469325513e-02f, 1.226703404e-03f, -7.346655428e-02f, 1.226592809e-03f, -7.223995775e-02f, 1.226484193e-03f,
+-7.101347297e-02f, 1.226377324e-03f, -6.978709996e-02f, 1.226272434e-03f, -6.856082380e-02f, 1.226169290e-03f,
+-6.733465195e-02f, 1.226068125e-03f, -6.610858440e-02f, 1.225968706e-03f, -6.488262117e-02f, 1.225871267e-03f,
+-6.365674734e-02f, 1.225775573e-03f, -6.243097037e-02f, 1.225681743e-03f, -6.120529026e-02f, 1.225589775e-03f,
+-5.997969955e-02f, 1.225499786e-03f, -5.875420198e-02f, 1.225411543e-03f, -5.752879009e-02f, 1.225325163e-03f,
+-5.630346388e-02f, 1.225240645e-03f, -5.507822335e-02f, 1.225157874e-03f, -5.385306478e-02f, 1.225077081e-03f,
+-5.262798816e-02f, 1.224998152e-03f, -5.140298977e-02f, 1.224920969e-03f, -5.017806962e-02f, 1.224845648e-03f,
+-4.895322397e-02f, 1.224772306e-03f, -4.772845283e-02f, 1.224700711e-03f, -4.650374874e-02f, 1.224630862e-03f,
+-4.527911916e-02f, 1.224562991e-03f, -4.405455664e-02f, 1.224496984e-03f, -4.283006117e-02f, 1.224432723e-03f,
+-4.160562530e-02f, 1.224370324e-03f, -4.038125649e-02f, 1.224309788e-03f, -3.915694728e-02f, 1.224251115e-03f,
+-3.793269396e-02f, 1.224194304e-03f, -3.670850024e-02f, 1.224139240e-03f, -3.548436239e-02f, 1.224086154e-03f,
+-3.426027671e-02f, 1.224034815e-03f, -3.303623945e-02f, 1.223985222e-03f, -3.181225434e-02f, 1.223937608e-03f,
+-3.058831766e-02f, 1.223891741e-03f, -2.936442569e-02f, 1.223847852e-03f, -2.814057842e-02f, 1.223805710e-03f,
+-2.691677399e-02f, 1.223765314e-03f, -2.569300681e-02f, 1.223726897e-03f, -2.446928062e-02f, 1.223690226e-03f,
+-2.324558981e-02f, 1.223655418e-03f, -2.202193439e-02f, 1.223622472e-03f, -2.079831250e-02f, 1.223591273e-03f,
+-1.957472228e-02f, 1.223562052e-03f, -1.835115999e-02f, 1.223534578e-03f, -1.712762564e-02f, 1.223508851e-03f,
+-1.590411551e-02f, 1.223485102e-03f, -1.468063053e-02f, 1.223463099e-03f, -1.345716789e-02f, 1.223442960e-03f,
+-1.223372482e-02f, 1.223424682e-03f, -1.101030037e-02f, 1.223408151e-03f, -9.786891751e-03f, 1.223393483e-03f,
+-8.563498035e-03f, 1.223380677e-03f, -7.340117823e-03f, 1.223369734e-03f, -6.116747856e-03f, 1.223360538e-03f,
+-4.893387202e-03f, 1.223353203e-03f, -3.670034232e-03f, 1.223347732e-03f, -2.446686383e-03f, 1.223344123e-03f,
+-1.223342260e-03f, 1.223342260e-03f, 0.000000000e+00f, 1.223342260e-03f, 1.223342260e-03f, 1.223344123e-03f,
+2.446686383e-03f, 1.223347732e-03f, 3.670034232e-03f, 1.223353203e-03f, 4.893387202e-03f, 1.223360538e-03f,
+6.116747856e-03f, 1.223369734e-03f, 7.340117823e-03f, 1.223380677e-03f, 8.563498035e-03f, 1.223393483e-03f,
+9.786891751e-03f, 1.223408151e-03f, 1.101030037e-02f, 1.223424682e-03f, 1.223372482e-02f, 1.223442960e-03f,
+1.345716789e-02f, 1.223463099e-03f, 1.468063053e-02f, 1.223485102e-03f, 1.590411551e-02f, 1.223508851e-03f,
+1.712762564e-02f, 1.223534578e-03f, 1.835115999e-02f, 1.223562052e-03f, 1.957472228e-02f, 1.223591273e-03f,
+2.079831250e-02f, 1.223622472e-03f, 2.202193439e-02f, 1.223655418e-03f, 2.324558981e-02f, 1.223690226e-03f,
+2.446928062e-02f, 1.223726897e-03f, 2.569300681e-02f, 1.223765314e-03f, 2.691677399e-02f, 1.223805710e-03f,
+2.814057842e-02f, 1.223847852e-03f, 2.936442569e-02f, 1.223891741e-03f, 3.058831766e-02f, 1.223937608e-03f,
+3.181225434e-02f, 1.223985222e-03f, 3.303623945e-02f, 1.224034815e-03f, 3.426027671e-02f, 1.224086154e-03f,
+3.548436239e-02f, 1.224139240e-03f, 3.670850024e-02f, 1.224194304e-03f, 3.793269396e-02f, 1.224251115e-03f,
+3.915694728e-02f, 1.224309788e-03f, 4.038125649e-02f, 1.224370324e-03f, 4.160562530e-02f, 1.224432723e-03f,
+4.283006117e-02f, 1.224496984e-03f, 4.405455664e-02f, 1.224562991e-03f, 4.527911916e-02f, 1.224630862e-03f,
+4.650374874e-02f, 1.224700711e-03f, 4.772845283e-02f, 1.224772306e-03f, 4.895322397e-02f, 1.224845648e-03f,
+5.017806962e-02f, 1.224920969e-03f, 5.140298977e-02f, 1.224998152e-03f, 5.262798816e-02f, 1.225077081e-03f,
+5.385306478e-02f, 1.225157874e-03f, 5.507822335e-02f, 1.225240645e-03f, 5.630346388e-02f, 1.225325163e-03f,
+5.752879009e-02f, 1.225411543e-03f, 5.875420198e-02f, 1.225499786e-03f, 5.997969955e-02f, 1.225589775e-03f,
+6.120529026e-02f, 1.225681743e-03f, 6.243097037e-02f, 1.225775573e-03f, 6.365674734e-02f, 1.225871267e-03f,
+6.488262117e-02f, 1.225968706e-03f, 6.610858440e-02f, 1.226068125e-03f, 6.733465195e-02f, 1.226169290e-03f,
+6.856082380e-02f, 1.226272434e-03f, 6.978709996e-02f, 1.226377324e-03f, 7.101347297e-02f, 1.226484193e-03f,
+7.223995775e-02f, 1.226592809e-03f, 7.346655428e-02f, 1.226703404e-03f, 7.469325513e-02f, 1.226815861e-03f,
+7.592006773e-02f, 1.226930064e-03f, 7.714699954e-02f, 1.227046247e-03f, 7.837405056e-02f, 1.227164292e-03f,
+7.960121334e-02f, 1.227284083e-03f, 8.082849532e-02f, 1.227405854e-03f, 8.205590397e-02f, 1.227529487e-03f,
+8.328343183e-02f, 1.227654982e-03f, 8.451108634e-02f, 1.227782457e-03f, 8.573886752e-02f, 1.227911678e-03f,
+8.696678281e-02f, 1.228042762e-03f, 8.819482476e-02f, 1.228175825e-03f, 8.942300081e-02f, 1.228310750e-03f,
+9.065131098e-02f, 1.228447538e-03f, 9.187975526e-02f, 1.228586189e-03f, 9.310834110e-02f, 1.228726702e-03f,
+9.433706850e-02f, 1.228869194e-03f, 9.556593746e-02f, 1.229013549e-03f, 9.679495543e-02f, 1.229159767e-03f,
+9.802411497e-02f, 1.229307847e-03f, 9.925342351e-02f, 1.229457906e-03f, 1.004828811e-01f, 1.229609712e-03f,
+1.017124876e-01f, 1.229763613e-03f, 1.029422507e-01f, 1.229919260e-03f, 1.041721702e-01f, 1.230076887e-03f,
+1.054022461e-01f, 1.230236376e-03f, 1.066324860e-01f, 1.230397727e-03f, 1.078628823e-01f, 1.230561058e-03f,
+1.090934426e-01f, 1.230726368e-03f, 1.103241667e-01f, 1.230893424e-03f, 1.115550622e-01f, 1.231062459e-03f,
+1.127861217e-01f, 1.231233473e-03f, 1.140173599e-01f, 1.231406350e-03f, 1.152487621e-01f, 1.231581089e-03f,
+1.164803430e-01f, 1.231757808e-03f, 1.177121028e-01f, 1.231936389e-03f, 1.189440414e-01f, 1.232116949e-03f,
+1.201761588e-01f, 1.232299372e-03f, 1.214084551e-01f, 1.232483773e-03f, 1.226409376e-01f, 1.232670154e-03f,
+1.238736138e-01f, 1.232858398e-03f, 1.251064688e-01f, 1.233048621e-03f, 1.263395101e-01f, 1.233240706e-03f,
+1.275727600e-01f, 1.233434770e-03f, 1.288061887e-01f, 1.233630697e-03f, 1.300398260e-01f, 1.233828720e-03f,
+1.312736571e-01f, 1.234028605e-03f, 1.325076818e-01f, 1.234230353e-03f, 1.337419152e-01f, 1.234434079e-03f,
+1.349763423e-01f, 1.234639902e-03f, 1.362109780e-01f, 1.234847470e-03f, 1.374458373e-01f, 1.235057134e-03f,
+1.386808902e-01f, 1.235268661e-03f, 1.399161518e-01f, 1.235482283e-03f, 1.411516368e-01f, 1.235697768e-03f,
+1.423873454e-01f, 1.235915232e-03f, 1.436232477e-01f, 1.236134558e-03f, 1.448593885e-01f, 1.236355980e-03f,
+1.460957378e-01f, 1.236579381e-03f, 1.473323256e-01f, 1.236804645e-03f, 1.485691220e-01f, 1.237032004e-03f,
+1.498061568e-01f, 1.237261225e-03f, 1.510434151e-01f, 1.237492543e-03f, 1.522809118e-01f, 1.237725839e-03f,
+1.535186470e-01f, 1.237960998e-03f, 1.547566056e-01f, 1.238198252e-03f, 1.559948027e-01f, 1.238437486e-03f,
+1.572332382e-01f, 1.238678698e-03f, 1.584719121e-01f, 1.238921890e-03f, 1.597108394e-01f, 1.239167061e-03f,
+1.609500051e-01f, 1.239414210e-03f, 1.621894240e-01f, 1.239663456e-03f, 1.634290814e-01f, 1.239914680e-03f,
+1.646689922e-01f, 1.240167883e-03f, 1.659091711e-01f, 1.240423066e-03f, 1.671495885e-01f, 1.240680343e-03f,
+1.683902740e-01f, 1.240939600e-03f, 1.696312129e-01f, 1.241200836e-03f, 1.708724052e-01f, 1.241464168e-03f,
+1.721138656e-01f, 1.241729478e-03f, 1.733555943e-01f, 1.241996768e-03f, 1.745975912e-01f, 1.242266153e-03f,
+1.758398712e-01f, 1.242537634e-03f, 1.770824045e-01f, 1.242811093e-03f, 1.783252060e-01f, 1.243086532e-03f,
+1.795683056e-01f, 1.243364066e-03f, 1.808116585e-01f, 1.243643695e-03f, 1.820553094e-01f, 1.243925304e-03f,
+1.832992285e-01f, 1.244209008e-03f, 1.845434457e-01f, 1.244494808e-03f, 1.857879311e-01f, 1.244782587e-03f,
+1.870327145e-01f, 1.245072461e-03f, 1.882777959e-01f, 1.245364430e-03f, 1.895231605e-01f, 1.245658379e-03f,
+1.907688081e-01f, 1.245954540e-03f, 1.920147687e-01f, 1.246252679e-03f, 1.932610273e-01f, 1.246552914e-03f,
+1.945075691e-01f, 1.246855245e-03f, 1.957544237e-01f, 1.247159555e-03f, 1.970015913e-01f, 1.247466076e-03f,
+1.982490569e-01f, 1.247774693e-03f, 1.994968355e-01f, 1.248085406e-03f, 2.007449120e-01f, 1.248398097e-03f,
+2.019933164e-01f, 1.248713001e-03f, 2.032420337e-01f, 1.249030000e-03f, 2.044910640e-01f, 1.249349094e-03f,
+2.057404071e-01f, 1.249670400e-03f, 2.069900781e-01f, 1.249993686e-03f, 2.082400769e-01f, 1.250319183e-03f,
+2.094903886e-01f, 1.250646776e-03f, 2.107410431e-01f, 1.250976464e-03f, 2.119920105e-01f, 1.251308247e-03f,
+2.132433206e-01f, 1.251642243e-03f, 2.144949585e-01f, 1.251978334e-03f, 2.157469392e-01f, 1.252316637e-03f,
+2.169992626e-01f, 1.252657035e-03f, 2.182519138e-01f, 1.252999646e-03f, 2.195049077e-01f, 1.253344351e-03f,
+2.207582593e-01f, 1.253691153e-03f, 2.220119536e-01f, 1.254040282e-03f, 2.232659906e-01f, 1.254391507e-03f,
+2.245203853e-01f, 1.254744828e-03f, 2.257751226e-01f, 1.255100360e-03f, 2.270302325e-01f, 1.255458104e-03f,
+2.282856852e-01f, 1.255818061e-03f, 2.295415103e-01f, 1.256180229e-03f, 2.307976782e-01f, 1.256544492e-03f,
+2.320542336e-01f, 1.256910968e-03f, 2.333111316e-01f, 1.257279655e-03f, 2.345684171e-01f, 1.257650554e-03f,
+2.358260751e-01f, 1.258023665e-03f, 2.370840907e-01f, 1.258398988e-03f, 2.383424938e-01f, 1.258776523e-03f,
+2.396012694e-01f, 1.259156270e-03f, 2.408604175e-01f, 1.259538345e-03f, 2.421199679e-01f, 1.259922516e-03f,
+2.433798909e-01f, 1.260309014e-03f, 2.446402013e-01f, 1.260697725e-03f, 2.459008992e-01f, 1.261088648e-03f,
+2.471619844e-01f, 1.261481899e-03f, 2.484234571e-01f, 1.261877245e-03f, 2.496853471e-01f, 1.262275036e-03f,
+2.509476244e-01f, 1.262674923e-03f, 2.522102892e-01f, 1.263077254e-03f, 2.534733713e-01f, 1.263481681e-03f,
+2.547368407e-01f, 1.263888553e-03f, 2.560007274e-01f, 1.264297636e-03f, 2.572650313e-01f, 1.264708932e-03f,
+2.585297525e-01f, 1.265122555e-03f, 2.597948611e-01f, 1.265538507e-03f, 2.610604167e-01f, 1.265956787e-03f,
+2.623263597e-01f, 1.266377396e-03f, 2.635927498e-01f, 1.266800216e-03f, 2.648595273e-01f, 1.267225365e-03f,
+2.661267519e-01f, 1.267652959e-03f, 2.673944235e-01f, 1.268082764e-03f, 2.686625123e-01f, 1.268514898e-03f,
+2.699310184e-01f, 1.268949476e-03f, 2.711999714e-01f, 1.269386266e-03f, 2.724693418e-01f, 1.269825501e-03f,
+2.737391889e-01f, 1.270266948e-03f, 2.750094533e-01f, 1.270710956e-03f, 2.762801647e-01f, 1.271157176e-03f,
+2.775513232e-01f, 1.271605841e-03f, 2.788229287e-01f, 1.272056834e-03f, 2.800949812e-01f, 1.272510272e-03f,
+2.813674808e-01f, 1.272966038e-03f, 2.826404572e-01f, 1.273424132e-03f, 2.839138806e-01f, 1.273884671e-03f,
+2.851877511e-01f, 1.274347655e-03f, 2.864620984e-01f, 1.274813083e-03f, 2.877369225e-01f, 1.275280840e-03f,
+2.890121937e-01f, 1.275751041e-03f, 2.902879417e-01f, 1.276223687e-03f, 2.915641665e-01f, 1.276698778e-03f,
+2.928408682e-01f, 1.277176198e-03f, 2.941180468e-01f, 1.277656178e-03f, 2.953957021e-01f, 1.278138603e-03f,
+2.966738343e-01f, 1.278623473e-03f, 2.979524732e-01f, 1.279110671e-03f, 2.992315888e-01f, 1.279600430e-03f,
+3.005111814e-01f, 1.280092751e-03f, 3.017912805e-01f, 1.280587399e-03f, 3.030718565e-01f, 1.281084609e-03f,
+3.043529391e-01f, 1.281584380e-03f, 3.056345284e-01f, 1.282086479e-03f, 3.069166243e-01f, 1.282591256e-03f,
+3.081991971e-01f, 1.283098478e-03f, 3.094823062e-01f, 1.283608144e-03f, 3.107659221e-01f, 1.284120372e-03f,
+3.120500445e-01f, 1.284635160e-03f, 3.133346736e-01f, 1.285152393e-03f, 3.146198094e-01f, 1.285672304e-03f,
+3.159054816e-01f, 1.286194660e-03f, 3.171916902e-01f, 1.286719576e-03f, 3.184784055e-01f, 1.287247171e-03f,
+3.197656572e-01f, 1.287777210e-03f, 3.210534453e-01f, 1.288309810e-03f, 3.223417401e-01f, 1.288845087e-03f,
+3.236306012e-01f, 1.289382926e-03f, 3.249199688e-01f, 1.289923326e-03f, 3.262099028e-01f, 1.290466287e-03f,
+3.275003731e-01f, 1.291011926e-03f, 3.287913799e-01f, 1.291560126e-03f, 3.300829232e-01f, 1.292111003e-03f,
+3.313750327e-01f, 1.292664441e-03f, 3.326677084e-01f, 1.293220557e-03f, 3.339609206e-01f, 1.293779351e-03f,
+3.352546990e-01f, 1.294340822e-03f, 3.365490437e-01f, 1.294904854e-03f, 3.378439546e-01f, 1.295471564e-03f,
+3.391394317e-01f, 1.296041068e-03f, 3.404354751e-01f, 1.296613133e-03f, 3.417320848e-01f, 1.297187875e-03f,
+3.430292606e-01f, 1.297765295e-03f, 3.443270326e-01f, 1.298345509e-03f, 3.456253707e-01f, 1.298928401e-03f,
+3.469243050e-01f, 1.299513970e-03f, 3.482238054e-01f, 1.300102333e-03f, 3.495239317e-01f, 1.300693373e-03f,
+3.508246243e-01f, 1.301287208e-03f, 3.521259129e-01f, 1.301883720e-03f, 3.534277976e-01f, 1.302483026e-03f,
+3.547302783e-01f, 1.303085126e-03f, 3.560333550e-01f, 1.303689904e-03f, 3.573370576e-01f, 1.304297592e-03f,
+3.586413562e-01f, 1.304907957e-03f, 3.599462509e-01f, 1.305521117e-03f, 3.612517715e-01f, 1.306137186e-03f,
+3.625579178e-01f, 1.306755934e-03f, 3.638646603e-01f, 1.307377592e-03f, 3.651720285e-01f, 1.308002044e-03f,
+3.664800525e-01f, 1.308629406e-03f, 3.677886724e-01f, 1.309259562e-03f, 3.690979183e-01f, 1.309892512e-03f,
+3.704078197e-01f, 1.310528372e-03f, 3.717183471e-01f, 1.311167143e-03f, 3.730295300e-01f, 1.311808708e-03f,
+3.743413389e-01f, 1.312453183e-03f, 3.756537735e-01f, 1.313100569e-03f, 3.769668937e-01f, 1.313750865e-03f,
+3.782806396e-01f, 1.314404188e-03f, 3.795950413e-01f, 1.315060304e-03f, 3.809100986e-01f, 1.315719332e-03f,
+3.822258115e-01f, 1.316381386e-03f, 3.835422099e-01f, 1.317046350e-03f, 3.848592341e-01f, 1.317714225e-03f,
+3.861769736e-01f, 1.318385126e-03f, 3.874953389e-01f, 1.319058938e-03f, 3.888143897e-01f, 1.319735893e-03f,
+3.901341259e-01f, 1.320415642e-03f, 3.914545476e-01f, 1.321098534e-03f, 3.927756548e-01f, 1.321784453e-03f,
+3.940974474e-01f, 1.322473283e-03f, 3.954199255e-01f, 1.323165256e-03f, 3.967430890e-01f, 1.323860255e-03f,
+3.980669379e-01f, 1.324558165e-03f, 3.993915021e-01f, 1.325259334e-03f, 4.007167518e-01f, 1.325963414e-03f,
+4.020427167e-01f, 1.326670754e-03f, 4.033693969e-01f, 1.327381004e-03f, 4.046967626e-01f, 1.328094513e-03f,
+4.060248733e-01f, 1.328811049e-03f, 4.073536694e-01f, 1.329530729e-03f, 4.086832106e-01f, 1.330253552e-03f,
+4.100134671e-01f, 1.330979401e-03f, 4.113444388e-01f, 1.331708510e-03f, 4.126761556e-01f, 1.332440763e-03f,
+4.140085876e-01f, 1.333176275e-03f, 4.153417647e-01f, 1.333914814e-03f, 4.166756868e-01f, 1.334656728e-03f,
+4.180103242e-01f, 1.335401670e-03f, 4.193457365e-01f, 1.336149988e-03f, 4.206818938e-01f, 1.336901449e-03f,
+4.220187962e-01f, 1.337656053e-03f, 4.233564436e-01f, 1.338414033e-03f, 4.246948659e-01f, 1.339175273e-03f,
+4.260340333e-01f, 1.339939772e-03f, 4.273739755e-01f, 1.340707531e-03f, 4.287146926e-01f, 1.341478550e-03f,
+4.300561547e-01f, 1.342252945e-03f, 4.313984215e-01f, 1.343030599e-03f, 4.327414334e-01f, 1.343811629e-03f,
+4.340852499e-01f, 1.344595919e-03f, 4.354298413e-01f, 1.345383585e-03f, 4.367752373e-01f, 1.346174744e-03f,
+4.381214082e-01f, 1.346969162e-03f, 4.394683838e-01f, 1.347766956e-03f, 4.408161342e-01f, 1.348568127e-03f,
+4.421647191e-01f, 1.349372789e-03f, 4.435140789e-01f, 1.350180828e-03f, 4.448642731e-01f, 1.350992243e-03f,
+4.462152719e-01f, 1.351807150e-03f, 4.475670755e-01f, 1.352625550e-03f, 4.489196837e-01f, 1.353447442e-03f,
+4.502731264e-01f, 1.354272710e-03f, 4.516274035e-01f, 1.355101587e-03f, 4.529825151e-01f, 1.355933840e-03f,
+4.543384612e-01f, 1.356769702e-03f, 4.556952119e-01f, 1.357609057e-03f, 4.570528269e-01f, 1.358452020e-03f,
+4.584112763e-01f, 1.359298476e-03f, 4.597705901e-01f, 1.360148541e-03f, 4.611307383e-01f, 1.361002098e-03f,
+4.624917209e-01f, 1.361859380e-03f, 4.638535976e-01f, 1.362720155e-03f, 4.652163088e-01f, 1.363584655e-03f,
+4.665798843e-01f, 1.364452764e-03f, 4.679443538e-01f, 1.365324482e-03f, 4.693096578e-01f, 1.366199926e-03f,
+4.706758559e-01f, 1.367078978e-03f, 4.720429480e-01f, 1.367961755e-03f, 4.734109044e-01f, 1.368848258e-03f,
+4.747797549e-01f, 1.369738486e-03f, 4.761494994e-01f, 1.370632323e-03f, 4.775201380e-01f, 1.371530001e-03f,
+4.788916707e-01f, 1.372431521e-03f, 4.802640975e-01f, 1.373336650e-03f, 4.816374183e-01f, 1.374245621e-03f,
+4.830116630e-01f, 1.375158434e-03f, 4.843868315e-01f, 1.376075088e-03f, 4.857628942e-01f, 1.376995584e-03f,
+4.871399105e-01f, 1.377919805e-03f, 4.885178208e-01f, 1.378847985e-03f, 4.898966849e-01f, 1.379780006e-03f,
+4.912764430e-01f, 1.380715985e-03f, 4.926571548e-01f, 1.381655806e-03f, 4.940388203e-01f, 1.382599468e-03f,
+4.954214096e-01f, 1.383547205e-03f, 4.968049824e-01f, 1.384498901e-03f, 4.981894791e-01f, 1.385454438e-03f,
+4.995749295e-01f, 1.386414049e-03f, 5.009613633e-01f, 1.387377619e-03f, 5.023487210e-01f, 1.388345263e-03f,
+5.037370324e-01f, 1.389316865e-03f, 5.051263571e-01f, 1.390292542e-03f, 5.065166950e-01f, 1.391272293e-03f,
+5.079079270e-01f, 1.392256119e-03f, 5.093001723e-01f, 1.393244020e-03f, 5.106934309e-01f, 1.394236111e-03f,
+5.120877028e-01f, 1.395232277e-03f, 5.134829283e-01f, 1.396232517e-03f, 5.148791671e-01f, 1.397236949e-03f,
+5.162763596e-01f, 1.398245571e-03f, 5.176746249e-01f, 1.399258501e-03f, 5.190739036e-01f, 1.400275505e-03f,
+5.204741359e-01f, 1.401296817e-03f, 5.218754411e-01f, 1.402322319e-03f, 5.232777596e-01f, 1.403352129e-03f,
+5.246811509e-01f, 1.404386130e-03f, 5.260854959e-01f, 1.405424555e-03f, 5.274909139e-01f, 1.406467170e-03f,
+5.288974047e-01f, 1.407514210e-03f, 5.303049088e-01f, 1.408565557e-03f, 5.317134857e-01f, 1.409621327e-03f,
+5.331231356e-01f, 1.410681405e-03f, 5.345337987e-01f, 1.411746023e-03f, 5.359455347e-01f, 1.412814949e-03f,
+5.373583436e-01f, 1.413888414e-03f, 5.387722254e-01f, 1.414966187e-03f, 5.401871800e-01f, 1.416048617e-03f,
+5.416032672e-01f, 1.417135471e-03f, 5.430203676e-01f, 1.418226864e-03f, 5.444386005e-01f, 1.419322682e-03f,
+5.458579659e-01f, 1.420423156e-03f, 5.472783446e-01f, 1.421528286e-03f, 5.486999154e-01f, 1.422637841e-03f,
+5.501224995e-01f, 1.423752168e-03f, 5.515462756e-01f, 1.424871036e-03f, 5.529711246e-01f, 1.425994677e-03f,
+5.543971658e-01f, 1.427122857e-03f, 5.558242798e-01f, 1.428255811e-03f, 5.572525263e-01f, 1.429393422e-03f,
+5.586819053e-01f, 1.430535805e-03f, 5.601124763e-01f, 1.431682962e-03f, 5.615441203e-01f, 1.432834892e-03f,
+5.629769564e-01f, 1.433991711e-03f, 5.644109845e-01f, 1.435153186e-03f, 5.658461452e-01f, 1.436319668e-03f,
+5.672824383e-01f, 1.437490922e-03f, 5.687199235e-01f, 1.438667066e-03f, 5.701586008e-01f, 1.439848100e-03f,
+5.715984702e-01f, 1.441034139e-03f, 5.730394721e-01f, 1.442225068e-03f, 5.744817257e-01f, 1.443421002e-03f,
+5.759251118e-01f, 1.444621827e-03f, 5.773697495e-01f, 1.445827773e-03f, 5.788155794e-01f, 1.447038841e-03f,
+5.802626014e-01f, 1.448254799e-03f, 5.817108750e-01f, 1.449475996e-03f, 5.831603408e-01f, 1.450702199e-03f,
+5.846110582e-01f, 1.451933640e-03f, 5.860629678e-01f, 1.453170087e-03f, 5.875161290e-01f, 1.454411889e-03f,
+5.889705420e-01f, 1.455658814e-03f, 5.904262066e-01f, 1.456910977e-03f, 5.918831229e-01f, 1.458168379e-03f,
+5.933412910e-01f, 1.459431020e-03f, 5.948007107e-01f, 1.460699015e-03f, 5.962614417e-01f, 1.461972366e-03f,
+5.977234244e-01f, 1.463251072e-03f, 5.991866589e-01f, 1.464535017e-03f, 6.006512046e-01f, 1.465824549e-03f,
+6.021170020e-01f, 1.467119437e-03f, 6.035841107e-01f, 1.468419679e-03f, 6.050525308e-01f, 1.469725510e-03f,
+6.065222621e-01f, 1.471036812e-03f, 6.079933047e-01f, 1.472353702e-03f, 6.094656587e-01f, 1.473676064e-03f,
+6.109393239e-01f, 1.475004130e-03f, 6.124143600e-01f, 1.476337668e-03f, 6.138907075e-01f, 1.477676909e-03f,
+6.153683662e-01f, 1.479021856e-03f, 6.168473959e-01f, 1.480372390e-03f, 6.183277369e-01f, 1.481728745e-03f,
+6.198095083e-01f, 1.483090804e-03f, 6.212925911e-01f, 1.484458568e-03f, 6.227770448e-01f, 1.485832268e-03f,
+6.242628694e-01f, 1.487211674e-03f, 6.257500648e-01f, 1.488597016e-03f, 6.272386909e-01f, 1.489988179e-03f,
+6.287286878e-01f, 1.491385396e-03f, 6.302200556e-01f, 1.492788433e-03f, 6.317128539e-01f, 1.494197524e-03f,
+6.332070231e-01f, 1.495612552e-03f, 6.347026229e-01f, 1.497033634e-03f, 6.361996531e-01f, 1.498460770e-03f,
+6.376981139e-01f, 1.499894075e-03f, 6.391980052e-01f, 1.501333434e-03f, 6.406993866e-01f, 1.502778963e-03f,
+6.422021389e-01f, 1.504230662e-03f, 6.437063813e-01f, 1.505688531e-03f, 6.452120543e-01f, 1.507152803e-03f,
+6.467192173e-01f, 1.508623245e-03f, 6.482278705e-01f, 1.510099974e-03f, 6.497379541e-01f, 1.511583105e-03f,
+6.512495279e-01f, 1.513072639e-03f, 6.527625918e-01f, 1.514568459e-03f, 6.542771459e-01f, 1.516070915e-03f,
+6.557932496e-01f, 1.517579658e-03f, 6.573108435e-01f, 1.519095036e-03f, 6.588299274e-01f, 1.520616934e-03f,
+6.603505015e-01f, 1.522145350e-03f, 6.618726850e-01f, 1.523680403e-03f, 6.633963585e-01f, 1.525222091e-03f,
+6.649215817e-01f, 1.526770531e-03f, 6.664483547e-01f, 1.528325607e-03f, 6.679766774e-01f, 1.529887435e-03f,
+6.695065498e-01f, 1.531456015e-03f, 6.710380316e-01f, 1.533031464e-03f, 6.725710630e-01f, 1.534613781e-03f,
+6.741056442e-01f, 1.536202966e-03f, 6.756418347e-01f, 1.537799137e-03f, 6.771796346e-01f, 1.539402176e-03f,
+6.787190437e-01f, 1.541012200e-03f, 6.802600622e-01f, 1.542629325e-03f, 6.818026900e-01f, 1.544253551e-03f,
+6.833469868e-01f, 1.545884879e-03f, 6.848928332e-01f, 1.547523309e-03f, 6.864403486e-01f, 1.549168956e-03f,
+6.879895329e-01f, 1.550821937e-03f, 6.895403862e-01f, 1.552482019e-03f, 6.910928488e-01f, 1.554149552e-03f,
+6.926469803e-01f, 1.555824303e-03f, 6.942028403e-01f, 1.557506504e-03f, 6.957603097e-01f, 1.559196156e-03f,
+6.973195076e-01f, 1.560893259e-03f, 6.988804340e-01f, 1.562597812e-03f, 7.004430294e-01f, 1.564310049e-03f,
+7.020072937e-01f, 1.566029736e-03f, 7.035733461e-01f, 1.567757106e-03f, 7.051411271e-01f, 1.569492160e-03f,
+7.067105770e-01f, 1.571235014e-03f, 7.082818151e-01f, 1.572985551e-03f, 7.098548412e-01f, 1.574743888e-03f,
+7.114295363e-01f, 1.576510025e-03f, 7.130060792e-01f, 1.578284195e-03f, 7.145843506e-01f, 1.580066164e-03f,
+7.161644101e-01f, 1.581856166e-03f, 7.177462578e-01f, 1.583654201e-03f, 7.193299532e-01f, 1.585460384e-03f,
+7.209153771e-01f, 1.587274601e-03f, 7.225026488e-01f, 1.589096966e-03f, 7.240917683e-01f, 1.590927597e-03f,
+7.256826758e-01f, 1.592766377e-03f, 7.272754312e-01f, 1.594613539e-03f, 7.288700938e-01f, 1.596469083e-03f,
+7.304665446e-01f, 1.598333009e-03f, 7.320649028e-01f, 1.600205433e-03f, 7.336651087e-01f, 1.602086239e-03f,
+7.352671623e-01f, 1.603975659e-03f, 7.368711233e-01f, 1.605873695e-03f, 7.384769917e-01f, 1.607780345e-03f,
+7.400847673e-01f, 1.609695726e-03f, 7.416945100e-01f, 1.611619839e-03f, 7.433061004e-01f, 1.613552799e-03f,
+7.449196577e-01f, 1.615494606e-03f, 7.465351820e-01f, 1.617445261e-03f, 7.481526136e-01f, 1.619404880e-03f,
+7.497720122e-01f, 1.621373580e-03f, 7.513933778e-01f, 1.623351243e-03f, 7.530167103e-01f, 1.625338104e-03f,
+7.546420693e-01f, 1.627334044e-03f, 7.562693954e-01f, 1.629339298e-03f, 7.578987479e-01f, 1.631353865e-03f,
+7.595301270e-01f, 1.633377746e-03f, 7.611634731e-01f, 1.635410939e-03f, 7.627989054e-01f, 1.637453679e-03f,
+7.644363642e-01f, 1.639505848e-03f, 7.660758495e-01f, 1.641567680e-03f, 7.677174211e-01f, 1.643639058e-03f,
+7.693610787e-01f, 1.645720215e-03f, 7.710067630e-01f, 1.647811034e-03f, 7.726545930e-01f, 1.649911748e-03f,
+7.743045092e-01f, 1.652022242e-03f, 7.759565115e-01f, 1.654142630e-03f, 7.776106596e-01f, 1.656273031e-03f,
+7.792669535e-01f, 1.658413559e-03f, 7.809253335e-01f, 1.660564216e-03f, 7.825859189e-01f, 1.662724884e-03f,
+7.842486501e-01f, 1.664895914e-03f, 7.859135270e-01f, 1.667077304e-03f, 7.875806093e-01f, 1.669268939e-03f,
+7.892498970e-01f, 1.671471051e-03f, 7.909213305e-01f, 1.673683641e-03f, 7.925950289e-01f, 1.675906824e-03f,
+7.942709327e-01f, 1.678140718e-03f, 7.959491014e-01f, 1.680385205e-03f, 7.976294756e-01f, 1.682640519e-03f,
+7.993121147e-01f, 1.684906543e-03f, 8.009970188e-01f, 1.687183627e-03f, 8.026841879e-01f, 1.689471654e-03f,
+8.043736815e-01f, 1.691770740e-03f, 8.060654402e-01f, 1.694080885e-03f, 8.077595234e-01f, 1.696402207e-03f,
+8.094559312e-01f, 1.698734937e-03f, 8.111546636e-01f, 1.701078843e-03f, 8.128557205e-01f, 1.703434275e-03f,
+8.145591617e-01f, 1.705801114e-03f, 8.162649870e-01f, 1.708179596e-03f, 8.179731369e-01f, 1.710569719e-03f,
+8.196837306e-01f, 1.712971483e-03f, 8.213967085e-01f, 1.715385122e-03f, 8.231120706e-01f, 1.717810519e-03f,
+8.248298764e-01f, 1.720248023e-03f, 8.265501261e-01f, 1.722697401e-03f, 8.282728195e-01f, 1.725159003e-03f,
+8.299980164e-01f, 1.727632829e-03f, 8.317256570e-01f, 1.730118878e-03f, 8.334557414e-01f, 1.732617267e-03f,
+8.351883888e-01f, 1.735128113e-03f, 8.369234800e-01f, 1.737651415e-03f, 8.386611342e-01f, 1.740187407e-03f,
+8.404013515e-01f, 1.742736087e-03f, 8.421440721e-01f, 1.745297574e-03f, 8.438893557e-01f, 1.747871866e-03f,
+8.456372619e-01f, 1.750459196e-03f, 8.473876715e-01f, 1.753059565e-03f, 8.491407633e-01f, 1.755672973e-03f,
+8.508964181e-01f, 1.758299768e-03f, 8.526547551e-01f, 1.760939835e-03f, 8.544156551e-01f, 1.763593289e-03f,
+8.561792374e-01f, 1.766260248e-03f, 8.579455018e-01f, 1.768940827e-03f, 8.597144485e-01f, 1.771635027e-03f,
+8.614860773e-01f, 1.774343196e-03f, 8.632604480e-01f, 1.777065103e-03f, 8.650375009e-01f, 1.779801096e-03f,
+8.668172956e-01f, 1.782551175e-03f, 8.685998321e-01f, 1.785315340e-03f, 8.703851700e-01f, 1.788093941e-03f,
+8.721732497e-01f, 1.790886861e-03f, 8.739641309e-01f, 1.793694333e-03f, 8.757578731e-01f, 1.796516357e-03f,
+8.775543571e-01f, 1.799353166e-03f, 8.793537021e-01f, 1.802204642e-03f, 8.811559081e-01f, 1.805071137e-03f,
+8.829609752e-01f, 1.807952765e-03f, 8.847689629e-01f, 1.810849411e-03f, 8.865798116e-01f, 1.813761308e-03f,
+8.883935809e-01f, 1.816688571e-03f, 8.902102709e-01f, 1.819631434e-03f, 8.920298815e-01f, 1.822589780e-03f,
+8.938524723e-01f, 1.825563842e-03f, 8.956780434e-01f, 1.828553737e-03f, 8.975065947e-01f, 1.831559581e-03f,
+8.993381262e-01f, 1.834581490e-03f, 9.011726975e-01f, 1.837619580e-03f, 9.030103683e-01f, 1.840673969e-03f,
+9.048510194e-01f, 1.843744772e-03f, 9.066947699e-01f, 1.846832223e-03f, 9.085416198e-01f, 1.849936205e-03f,
+9.103915095e-01f, 1.853057067e-03f, 9.122446179e-01f, 1.856194925e-03f, 9.141007662e-01f, 1.859349781e-03f,
+9.159601331e-01f, 1.862521749e-03f, 9.178226590e-01f, 1.865711180e-03f, 9.196883440e-01f, 1.868917956e-03f,
+9.215573072e-01f, 1.872142428e-03f, 9.234294295e-01f, 1.875384594e-03f, 9.253048301e-01f, 1.878644573e-03f,
+9.271834493e-01f, 1.881922595e-03f, 9.290654063e-01f, 1.885218779e-03f, 9.309505820e-01f, 1.888533239e-03f,
+9.328391552e-01f, 1.891866210e-03f, 9.347310066e-01f, 1.895217691e-03f, 9.366261959e-01f, 1.898587798e-03f,
+9.385247827e-01f, 1.901976881e-03f, 9.404267669e-01f, 1.905385056e-03f, 9.423321486e-01f, 1.908812323e-03f,
+9.442409873e-01f, 1.912258915e-03f, 9.461532235e-01f, 1.915725064e-03f, 9.480689764e-01f, 1.919210772e-03f,
+9.499881864e-01f, 1.922716387e-03f, 9.519109130e-01f, 1.926241908e-03f, 9.538371563e-01f, 1.929787570e-03f,
+9.557669163e-01f, 1.933353487e-03f, 9.577002525e-01f, 1.936939894e-03f, 9.596372247e-01f, 1.940546907e-03f,
+9.615777731e-01f, 1.944174641e-03f, 9.635219574e-01f, 1.947823446e-03f, 9.654697776e-01f, 1.951493323e-03f,
+9.674212337e-01f, 1.955184620e-03f, 9.693764448e-01f, 1.958897337e-03f, 9.713353515e-01f, 1.962631708e-03f,
+9.732979536e-01f, 1.966387965e-03f, 9.752643704e-01f, 1.970166340e-03f, 9.772345424e-01f, 1.973966835e-03f,
+9.792084694e-01f, 1.977789681e-03f, 9.811862707e-01f, 1.981635112e-03f, 9.831678867e-01f, 1.985503593e-03f,
+9.851534367e-01f, 1.989394892e-03f, 9.871428013e-01f, 1.993309241e-03f, 9.891360998e-01f, 1.997247105e-03f,
+9.911333919e-01f, 2.001208719e-03f, 9.931345582e-01f, 2.005193848e-03f, 9.951397777e-01f, 2.009203192e-03f,
+9.971489906e-01f, 2.013236750e-03f, 9.991621971e-01f, 2.017294522e-03f, 1.001179457e+00f, 2.021377208e-03f,
+1.003200889e+00f, 2.025484573e-03f, 1.005226374e+00f, 2.029616851e-03f, 1.007256031e+00f, 2.033774741e-03f,
+1.009289742e+00f, 2.037958009e-03f, 1.011327744e+00f, 2.042166889e-03f, 1.013369918e+00f, 2.046401845e-03f,
+1.015416265e+00f, 2.050663112e-03f, 1.017466903e+00f, 2.054950688e-03f, 1.019521952e+00f, 2.059265040e-03f,
+1.021581173e+00f, 2.063606167e-03f, 1.023644805e+00f, 2.067974536e-03f, 1.025712729e+00f, 2.072370378e-03f,
+1.027785063e+00f, 2.076793928e-03f, 1.029861927e+00f, 2.081245417e-03f, 1.031943202e+00f, 2.085724846e-03f,
+1.034028888e+00f, 2.090232912e-03f, 1.036119103e+00f, 2.094769618e-03f, 1.038213849e+00f, 2.099335194e-03f,
+1.040313244e+00f, 2.103930106e-03f, 1.042417169e+00f, 2.108554589e-03f, 1.044525743e+00f, 2.113208873e-03f,
+1.046638846e+00f, 2.117893193e-03f, 1.048756838e+00f, 2.122607781e-03f, 1.050879359e+00f, 2.127353102e-03f,
+1.053006768e+00f, 2.132129390e-03f, 1.055138946e+00f, 2.136936877e-03f, 1.057275772e+00f, 2.141775796e-03f,
+1.059417605e+00f, 2.146646613e-03f, 1.061564207e+00f, 2.151549561e-03f, 1.063715816e+00f, 2.156484872e-03f,
+1.065872312e+00f, 2.161453245e-03f, 1.068033695e+00f, 2.166454447e-03f, 1.070200205e+00f, 2.171489177e-03f,
+1.072371721e+00f, 2.176557668e-03f, 1.074548244e+00f, 2.181660151e-03f, 1.076729894e+00f, 2.186797094e-03f,
+1.078916669e+00f, 2.191968728e-03f, 1.081108689e+00f, 2.197175520e-03f, 1.083305836e+00f, 2.202417701e-03f,
+1.085508227e+00f, 2.207695739e-03f, 1.087715983e+00f, 2.213009866e-03f, 1.089928985e+00f, 2.218360780e-03f,
+1.092147350e+00f, 2.223748248e-03f, 1.094371080e+00f, 2.229173202e-03f, 1.096600294e+00f, 2.234635875e-03f,
+1.098834872e+00f, 2.240136499e-03f, 1.101075053e+00f, 2.245675540e-03f, 1.103320718e+00f, 2.251253463e-03f,
+1.105571985e+00f, 2.256870735e-03f, 1.107828856e+00f, 2.262527589e-03f, 1.110091329e+00f, 2.268224489e-03f,
+1.112359524e+00f, 2.273961902e-03f, 1.114633560e+00f, 2.279740293e-03f, 1.116913319e+00f, 2.285559895e-03f,
+1.119198799e+00f, 2.291421406e-03f, 1.121490240e+00f, 2.297325060e-03f, 1.123787522e+00f, 2.303271322e-03f,
+1.126090884e+00f, 2.309260890e-03f, 1.128400087e+00f, 2.315293998e-03f, 1.130715370e+00f, 2.321371343e-03f,
+1.133036733e+00f, 2.327493159e-03f, 1.135364294e+00f, 2.333659912e-03f, 1.137697935e+00f, 2.339872299e-03f,
+1.140037775e+00f, 2.346130786e-03f, 1.142383933e+00f, 2.352435607e-03f, 1.144736409e+00f, 2.358787693e-03f,
+1.147095203e+00f, 2.365187276e-03f, 1.149460316e+00f, 2.371635055e-03f, 1.151831985e+00f, 2.378131496e-03f,
+1.154210091e+00f, 2.384677064e-03f, 1.156594753e+00f, 2.391272457e-03f, 1.158986092e+00f, 2.397918142e-03f,
+1.161383986e+00f, 2.404614817e-03f, 1.163788557e+00f, 2.411362948e-03f, 1.166199923e+00f, 2.418163233e-03f,
+1.168618083e+00f, 2.425016137e-03f, 1.171043158e+00f, 2.431922359e-03f, 1.173475027e+00f, 2.438882366e-03f,
+1.175913930e+00f, 2.445897087e-03f, 1.178359866e+00f, 2.452966757e-03f, 1.180812836e+00f, 2.460092539e-03f,
+1.183272839e+00f, 2.467274666e-03f, 1.185740113e+00f, 2.474514069e-03f, 1.188214660e+00f, 2.481811214e-03f,
+1.190696478e+00f, 2.489166800e-03f, 1.193185687e+00f, 2.496581757e-03f, 1.195682287e+00f, 2.504056785e-03f,
+1.198186278e+00f, 2.511592349e-03f, 1.200697899e+00f, 2.519189380e-03f, 1.203217030e+00f, 2.526848577e-03f,
+1.205743909e+00f, 2.534570871e-03f, 1.208278537e+00f, 2.542356728e-03f, 1.210820913e+00f, 2.550207078e-03f,
+1.213371038e+00f, 2.558122855e-03f, 1.215929151e+00f, 2.566104755e-03f, 1.218495250e+00f, 2.574153710e-03f,
+1.221069455e+00f, 2.582270186e-03f, 1.223651767e+00f, 2.590455581e-03f, 1.226242185e+00f, 2.598710591e-03f,
+1.228840828e+00f, 2.607035916e-03f, 1.231447935e+00f, 2.615432488e-03f, 1.234063387e+00f, 2.623901470e-03f,
+1.236687303e+00f, 2.632443560e-03f, 1.239319682e+00f, 2.641059924e-03f, 1.241960764e+00f, 2.649751492e-03f,
+1.244610548e+00f, 2.658518963e-03f, 1.247269034e+00f, 2.667363733e-03f, 1.249936342e+00f, 2.676286502e-03f,
+1.252612710e+00f, 2.685288666e-03f, 1.255298018e+00f, 2.694370924e-03f, 1.257992387e+00f, 2.703534672e-03f,
+1.260695815e+00f, 2.712780610e-03f, 1.263408661e+00f, 2.722110366e-03f, 1.266130805e+00f, 2.731524641e-03f,
+1.268862247e+00f, 2.741024829e-03f, 1.271603346e+00f, 2.750612330e-03f, 1.274353981e+00f, 2.760287840e-03f,
+1.277114153e+00f, 2.770052757e-03f, 1.279884219e+00f, 2.779908478e-03f, 1.282664180e+00f, 2.789856400e-03f,
+1.285454035e+00f, 2.799897455e-03f, 1.288253903e+00f, 2.810033271e-03f, 1.291063905e+00f, 2.820265014e-03f,
+1.293884277e+00f, 2.830594080e-03f, 1.296714783e+00f, 2.841022098e-03f, 1.299555898e+00f, 2.851550234e-03f,
+1.302407384e+00f, 2.862180118e-03f, 1.305269599e+00f, 2.872913145e-03f, 1.308142543e+00f, 2.883750712e-03f,
+1.311026216e+00f, 2.894694684e-03f, 1.313920975e+00f, 2.905746456e-03f, 1.316826701e+00f, 2.916907659e-03f,
+1.319743633e+00f, 2.928179922e-03f, 1.322671771e+00f, 2.939564874e-03f, 1.325611353e+00f, 2.951064380e-03f,
+1.328562379e+00f, 2.962680301e-03f, 1.331525087e+00f, 2.974414034e-03f, 1.334499478e+00f, 2.986267442e-03f,
+1.337485790e+00f, 2.998242853e-03f, 1.340484023e+00f, 3.010341665e-03f, 1.343494296e+00f, 3.022566205e-03f,
+1.346516848e+00f, 3.034918103e-03f, 1.349551797e+00f, 3.047399689e-03f, 1.352599263e+00f, 3.060012823e-03f,
+1.355659246e+00f, 3.072759602e-03f, 1.358731985e+00f, 3.085642587e-03f, 1.361817598e+00f, 3.098663408e-03f,
+1.364916325e+00f, 3.111824626e-03f, 1.368028164e+00f, 3.125128569e-03f, 1.371153235e+00f, 3.138577566e-03f,
+1.374291778e+00f, 3.152173944e-03f, 1.377444029e+00f, 3.165920265e-03f, 1.380609870e+00f, 3.179818857e-03f,
+1.383789778e+00f, 3.193872748e-03f, 1.386983633e+00f, 3.208084032e-03f, 1.390191674e+00f, 3.222455736e-03f,
+1.393414140e+00f, 3.236990655e-03f, 1.396651149e+00f, 3.251691349e-03f, 1.399902821e+00f, 3.266561078e-03f,
+1.403169394e+00f, 3.281602403e-03f, 1.406450987e+00f, 3.296818817e-03f, 1.409747839e+00f, 3.312212881e-03f,
+1.413060069e+00f, 3.327788319e-03f, 1.416387796e+00f, 3.343547927e-03f, 1.419731379e+00f, 3.359495196e-03f,
+1.423090816e+00f, 3.375633853e-03f, 1.426466465e+00f, 3.391966922e-03f, 1.429858446e+00f, 3.408498364e-03f,
+1.433266997e+00f, 3.425231669e-03f, 1.436692238e+00f, 3.442170797e-03f, 1.440134406e+00f, 3.459319239e-03f,
+1.443593740e+00f, 3.476681421e-03f, 1.447070360e+00f, 3.494261065e-03f, 1.450564623e+00f, 3.512062598e-03f,
+1.454076648e+00f, 3.530090209e-03f, 1.457606792e+00f, 3.548348323e-03f, 1.461155176e+00f, 3.566841362e-03f,
+1.464721918e+00f, 3.585573984e-03f, 1.468307495e+00f, 3.604551079e-03f, 1.471912146e+00f, 3.623777535e-03f,
+1.475535870e+00f, 3.643258009e-03f, 1.479179144e+00f, 3.662998322e-03f, 1.482842088e+00f, 3.683003131e-03f,
+1.486525178e+00f, 3.703278257e-03f, 1.490228415e+00f, 3.723829053e-03f, 1.493952274e+00f, 3.744661575e-03f,
+1.497696877e+00f, 3.765781643e-03f, 1.501462698e+00f, 3.787195310e-03f, 1.505249858e+00f, 3.808908630e-03f,
+1.509058833e+00f, 3.830928588e-03f, 1.512889743e+00f, 3.853261238e-03f, 1.516742945e+00f, 3.875913797e-03f,
+1.520618916e+00f, 3.898893250e-03f, 1.524517775e+00f, 3.922206815e-03f, 1.528439999e+00f, 3.945861943e-03f,
+1.532385826e+00f, 3.969866317e-03f, 1.536355734e+00f, 3.994227387e-03f, 1.540349960e+00f, 4.018954467e-03f,
+1.544368863e+00f, 4.044055007e-03f, 1.548412919e+00f, 4.069538321e-03f, 1.552482486e+00f, 4.095412791e-03f,
+1.556577921e+00f, 4.121687729e-03f, 1.560699582e+00f, 4.148373380e-03f, 1.564847946e+00f, 4.175479058e-03f,
+1.569023490e+00f, 4.203015007e-03f, 1.573226452e+00f, 4.230991937e-03f, 1.577457428e+00f, 4.259420093e-03f,
+1.581716895e+00f, 4.288311582e-03f, 1.586005211e+00f, 4.317677580e-03f, 1.590322852e+00f, 4.347530194e-03f,
+1.594670415e+00f, 4.377881996e-03f, 1.599048257e+00f, 4.408745561e-03f, 1.603456974e+00f, 4.440133926e-03f,
+1.607897162e+00f, 4.472061526e-03f, 1.612369180e+00f, 4.504542332e-03f, 1.616873741e+00f, 4.537591245e-03f,
+1.621411324e+00f, 4.571223632e-03f, 1.625982523e+00f, 4.605454858e-03f, 1.630588055e+00f, 4.640302155e-03f,
+1.635228276e+00f, 4.675782286e-03f, 1.639904141e+00f, 4.711912945e-03f, 1.644616008e+00f, 4.748712294e-03f,
+1.649364710e+00f, 4.786199890e-03f, 1.654150963e+00f, 4.824395757e-03f, 1.658975363e+00f, 4.863319919e-03f,
+1.663838625e+00f, 4.902994260e-03f, 1.668741703e+00f, 4.943441134e-03f, 1.673685074e+00f, 4.984683823e-03f,
+1.678669810e+00f, 5.026746541e-03f, 1.683696508e+00f, 5.069653969e-03f, 1.688766122e+00f, 5.113433115e-03f,
+1.693879604e+00f, 5.158110987e-03f, 1.699037671e+00f, 5.203715991e-03f, 1.704241395e+00f, 5.250277929e-03f,
+1.709491730e+00f, 5.297828466e-03f, 1.714789510e+00f, 5.346399266e-03f, 1.720135927e+00f, 5.396024790e-03f,
+1.725531936e+00f, 5.446739960e-03f, 1.730978727e+00f, 5.498582497e-03f, 1.736477256e+00f, 5.551590584e-03f,
+1.742028832e+00f, 5.605805665e-03f, 1.747634649e+00f, 5.661269184e-03f, 1.753295898e+00f, 5.718026776e-03f,
+1.759014010e+00f, 5.776124075e-03f, 1.764790058e+00f, 5.835611373e-03f, 1.770625710e+00f, 5.896539427e-03f,
+1.776522279e+00f, 5.958962720e-03f, 1.782481194e+00f, 6.022938062e-03f, 1.788504124e+00f, 6.088525057e-03f,
+1.794592738e+00f, 6.155787036e-03f, 1.800748467e+00f, 6.224790122e-03f, 1.806973219e+00f, 6.295605097e-03f,
+1.813268900e+00f, 6.368304603e-03f, 1.819637179e+00f, 6.442967337e-03f, 1.826080084e+00f, 6.519675255e-03f,
+1.832599759e+00f, 6.598515902e-03f, 1.839198351e+00f, 6.679581013e-03f, 1.845877886e+00f, 6.762968376e-03f,
+1.852640867e+00f, 6.848781370e-03f, 1.859489679e+00f, 6.937129889e-03f, 1.866426826e+00f, 7.028129883e-03f,
+1.873454928e+00f, 7.121905684e-03f, 1.880576849e+00f, 7.218589541e-03f, 1.887795448e+00f, 7.318320684e-03f,
+1.895113707e+00f, 7.421249524e-03f, 1.902534962e+00f, 7.527535781e-03f, 1.910062551e+00f, 7.637349889e-03f,
+1.917699814e+00f, 7.750873920e-03f, 1.925450802e+00f, 7.868303917e-03f, 1.933319092e+00f, 7.989848964e-03f,
+1.941308856e+00f, 8.115734905e-03f, 1.949424624e+00f, 8.246202022e-03f, 1.957670808e+00f, 8.381512016e-03f,
+1.966052294e+00f, 8.521949872e-03f, 1.974574327e+00f, 8.667808957e-03f, 1.983242154e+00f, 8.819424547e-03f,
+1.992061496e+00f, 8.977150545e-03f, 2.001038790e+00f, 9.141370654e-03f, 2.010179996e+00f, 9.312503971e-03f,
+2.019492626e+00f, 9.491005912e-03f, 2.028983593e+00f, 9.677374735e-03f, 2.038661003e+00f, 9.872152470e-03f,
+2.048533201e+00f, 1.007593423e-02f, 2.058609009e+00f, 1.028937381e-02f, 2.068898439e+00f, 1.051319018e-02f,
+2.079411507e+00f, 1.074817497e-02f, 2.090159655e+00f, 1.099520456e-02f, 2.101155043e+00f, 1.125525031e-02f,
+2.112410307e+00f, 1.152939163e-02f, 2.123939514e+00f, 1.181883272e-02f, 2.135758400e+00f, 1.212492026e-02f,
+2.147883415e+00f, 1.244916394e-02f, 2.160332441e+00f, 1.279326528e-02f, 2.173125744e+00f, 1.315914746e-02f,
+2.186285019e+00f, 1.354899164e-02f, 2.199833870e+00f, 1.396528631e-02f, 2.213799238e+00f, 1.441087667e-02f,
+2.228209972e+00f, 1.488903910e-02f, 2.243099213e+00f, 1.540355943e-02f, 2.258502722e+00f, 1.595884375e-02f,
+2.274461508e+00f, 1.656004414e-02f, 2.291021585e+00f, 1.721323282e-02f, 2.308234692e+00f, 1.792560890e-02f,
+2.326160431e+00f, 1.870578341e-02f, 2.344866276e+00f, 1.956413873e-02f, 2.364430428e+00f, 2.051331662e-02f,
+2.384943724e+00f, 2.156887017e-02f, 2.406512499e+00f, 2.275015973e-02f, 2.429262638e+00f, 2.408159710e-02f,
+2.453344345e+00f, 2.559442818e-02f, 2.478938818e+00f, 2.732931636e-02f, 2.506268024e+00f, 2.934020944e-02f,
+2.535608292e+00f, 3.170028329e-02f, 2.567308426e+00f, 3.451143578e-02f, 2.601819992e+00f, 3.791999817e-02f,
+2.639739990e+00f, 4.214419425e-02f, 2.681884050e+00f, 4.752488434e-02f, 2.729408979e+00f, 5.462684482e-02f,
+2.784035921e+00f, 6.446132809e-02f, 2.848497152e+00f, 7.904396206e-02f, 2.927541256e+00f, 1.030874029e-01f,
+3.030628681e+00f, 1.510253400e-01f, 3.181653976e+00f, 3.054502010e-01f, 3.487104177e+00f, 0.000000000e+00f
+};
+
+extern const PrecomputedTable precomputedTables[] = {
+    {32, 1.600000000e+01f, 1.600000000e+01f, -1.000000000e+00f, 1.000000000e+00f, bipolarAudioTaperTable},
+    {32, 3.200000000e+01f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f, audioTaperTable},
+    {32, 3.200000000e+01f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f, audioTaper18Table},
+    {512, 5.120000000e+02f, -0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f, sinTable},
+    {16, 8.000000000e+00f, 8.000000000e+00f, -1.000000000e+00f, 1.000000000e+00f, mixerPanLTable},
+    {16, 8.000000000e+00f, 8.000000000e+00f, -1.000000000e+00f, 1.000000000e+00f, mixerPanRTable},
+    {256, 1.926592064e+01f, -3.853184128e+01f, 2.000000000e+00f, 1.528771210e+01f, exp2Table},
+    {256, 3.349095154e+01f, -3.349095154e+01f, 1.000000000e+00f, 8.643856049e+00f, exp2ExLowTable},
+    {512, 9.071811676e+01f, -7.841543579e+02f, 8.643856049e+00f, 1.428771210e+01f, exp2ExHighTable},
+    {32, 3.199999928e-01f, 2.559999847e+01f, -8.000000000e+01f, 2.000000000e+01f, db2GainTable},
+    {256, 2.560000038e+01f, 1.280000000e+02f, -5.000000000e+00f, 5.000000000e+00f, tanh5Table},
+    {1025, 1.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 1.024000000e+03f, minBLEPTable},
+    {2048, 2.049000488e+03f, -5.002442598e-01f, 2.441406250e-04f, 9.997558594e-01f, normalInverseTable}
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <assert.h>
+#include <emmintrin.h>
+#include <xmmintrin.h>
+
+/**
+ * SSE version of Poly<T, 10>.
+ * Runs four waveshapers at once, one in each lane. Every lane
+ * has its own harmonic gains and input gain.
+ *
+ * Poly expands every Chebyshev polynomial into powers of x. Here the weighted
+ * sum is evaluated with Clenshaw's recurrence instead, which is three
+ * operations per harmonic. The DC correction only depends on the gains,
+ * so it is only re-calculated when they change, not every sample.
+ *
+ * Output is the same as Poly, within float precision.
+ */
+class PolySimd
+{
+public:
+    static const int order = 10;
+
+    PolySimd();
+
+    /**
+     * x is the (already gained) input, -1..1
+     */
+    __m128 run(__m128 x);
+
+    void setGain(int index, __m128 value)
+    {
+        assert(index >= 0 && index < order);
+        gains[index] = value;
+        dcDirty = true;
+    }
+
+    /**
+     * The gain that was applied to the input.
+     * Same as the inputGain passed to Poly::run
+     */
+    void setInputGain(__m128 value)
+    {
+        inputGain = value;
+        dcDirty = true;
+    }
+
+    /**
+     * SSE version of AudioMath::fold, for limiting the input.
+     */
+    static __m128 fold(__m128);
+
+private:
+    __m128 gains[order];
+    __m128 inputGain;
+
+    /**
+     * Everything that gets subtracted from the sum to remove the DC.
+     */
+    __m128 dcOffset;
+    bool dcDirty = true;
+
+    void calcDC();
+};
+
+inline PolySimd::PolySimd()
+{
+    for (int i = 0; i < order; ++i) {
+        gains[i] = _mm_setzero_ps();
+    }
+    inputGain = _mm_setzero_ps();
+    dcOffset = _mm_setzero_ps();
+}
+
+inline __m128 PolySimd::run(__m128 x)
+{
+    if (dcDirty) {
+        calcDC();
+    }
+
+    // sum of gains[i] * T(i + 1, x), by Clenshaw.
+    // b(n) = c(n) + 2x * b(n + 1) - b(n + 2)
+    const __m128 twoX = _mm_add_ps(x, x);
+    __m128 b1 = _mm_setzero_ps();
+    __m128 b2 = _mm_setzero_ps();
+    for (int i = order - 1; i >= 0; --i) {
+        const __m128 b0 = _mm_sub_ps(_mm_add_ps(gains[i], _mm_mul_ps(twoX, b1)), b2);
+        b2 = b1;
+        b1 = b0;
+    }
+
+    // no T(0) term
+    const __m128 sum = _mm_sub_ps(_mm_mul_ps(x, b1), b2);
+    return _mm_sub_ps(sum, dcOffset);
+}
+
+inline void PolySimd::calcDC()
+{
+    // same as Poly::calcDC
+    const float W2 = 2.0f / 4.0f;
+    const float W4 = W2 * 3.0f / 4.0f;
+    const float W6 = W4 * 5.0f / 6.0f;
+    const float W8 = W6 * 7.0f / 8.0f;
+    const float W10 = W8 * 9.0f / 10.0f;
+
+    const __m128 e2 = _mm_mul_ps(inputGain, inputGain);
+    const __m128 e4 = _mm_mul_ps(e2, e2);
+    const __m128 e6 = _mm_mul_ps(e4, e2);
+    const __m128 e8 = _mm_mul_ps(e6, e2);
+    const __m128 e10 = _mm_mul_ps(e8, e2);
+
+    const __m128 sinEnergy2 = _mm_mul_ps(e2, _mm_set_ps1(W2));
+    const __m128 sinEnergy4 = _mm_mul_ps(e4, _mm_set_ps1(W4));
+    const __m128 sinEnergy6 = _mm_mul_ps(e6, _mm_set_ps1(W6));
+    const __m128 sinEnergy8 = _mm_mul_ps(e8, _mm_set_ps1(W8));
+    const __m128 sinEnergy10 = _mm_mul_ps(e10, _mm_set_ps1(W10));
+
+    auto term = [](float k, __m128 x) {
+        return _mm_mul_ps(_mm_set_ps1(k), x);
+    };
+
+    // Poly leaves out the constant term of the even polynomials,
+    // T(n, 0), and subtracts its own DC instead. Clenshaw gives us the
+    // whole polynomial, so for even harmonics we take out T(n, 0) + dc.
+    __m128 dc[order / 2];
+    dc[0] = _mm_sub_ps(term(2, sinEnergy2), _mm_set_ps1(1));
+    dc[1] = _mm_add_ps(_mm_sub_ps(term(8, sinEnergy4), term(8, sinEnergy2)), _mm_set_ps1(1));
+    dc[2] = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(term(32, sinEnergy6), term(48, sinEnergy4)),
+        term(18, sinEnergy2)), _mm_set_ps1(1));
+    dc[3] = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(term(128, sinEnergy8), term(256, sinEnergy6)),
+        term(160, sinEnergy4)), term(32, sinEnergy2)), _mm_set_ps1(1));
+    dc[4] = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_sub_ps(term(512, sinEnergy10), term(1280, sinEnergy8)),
+        term(1120, sinEnergy6)), term(400, sinEnergy4)), term(50, sinEnergy2)), _mm_set_ps1(1));
+
+    dcOffset = _mm_setzero_ps();
+    for (int i = 0; i < order / 2; ++i) {
+        // gains[1] is the first even harmonic
+        dcOffset = _mm_add_ps(dcOffset, _mm_mul_ps(gains[2 * i + 1], dc[i]));
+    }
+    dcDirty = false;
+}
+
+inline __m128 PolySimd::fold(__m128 x)
+{
+    const __m128 signBit = _mm_set_ps1(-0.f);
+    const __m128 bias = _mm_or_ps(_mm_and_ps(x, signBit), _mm_set_ps1(1));
+    const __m128i phase = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(x, bias), _mm_set_ps1(.5f)));
+
+    // move the low bit of phase up to the sign bit. Set for odd phase.
+    const __m128 isOdd = _mm_castsi128_ps(_mm_slli_epi32(phase, 31));
+    const __m128 folded = _mm_sub_ps(x, _mm_mul_ps(_mm_set_ps1(2), _mm_cvtepi32_ps(phase)));
+
+    // odd phases get inverted.
+    return _mm_xor_ps(folded, isOdd);
+}
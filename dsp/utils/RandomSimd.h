@@ -0,0 +1,181 @@
+#pragma once
+
+#include "LookupTable.h"
+#include "ObjectCache.h"
+
+#include <emmintrin.h>
+#include <memory>
+#include <stdint.h>
+#include <xmmintrin.h>
+
+/**
+ * Fast random numbers, four at a time.
+ *
+ * Runs four xoshiro128+ generators, one in each SSE lane. Each lane is
+ * seeded separately, so they are independent streams. xoshiro128+ only uses
+ * adds, shifts and xors, and its upper bits are very good, which is all
+ * we use to make floats.
+ *
+ * Normal numbers come from running uniform ones through the inverse normal
+ * CDF, from a lookup table. The tails get cut off at about 3.5 sigma,
+ * which is fine for noise.
+ *
+ * Each instance has its own state, so unlike AudioMath::random() or a shared
+ * std::default_random_engine, instances may be used from different threads.
+ * Make them on the UI thread, since the constructor gets the lookup table.
+ */
+class RandomSimd
+{
+public:
+    RandomSimd(uint32_t seed = 57)
+    {
+        setSeed(seed);
+    }
+
+    /**
+     * Re-starts the sequence.
+     */
+    void setSeed(uint32_t seed);
+
+    /**
+     * 32 random bits in each lane.
+     */
+    __m128i next();
+
+    /**
+     * Uniform 0..1 (never exactly 1) in each lane.
+     */
+    __m128 uniform4();
+
+    /**
+     * Normal, mean zero, standard deviation one, in each lane.
+     */
+    __m128 normal4();
+
+    /**
+     * Fill a block with n random numbers.
+     */
+    void fillUniform(float* out, int n);
+    void fillNormal(float* out, int n);
+
+    /**
+     * One number at a time. These use up a whole
+     * SSE call every fourth time they are called.
+     */
+    float uniform();
+    float normal();
+
+private:
+    __m128i s0;
+    __m128i s1;
+    __m128i s2;
+    __m128i s3;
+
+    float uniformBuffer[4];
+    float normalBuffer[4];
+    int uniformIndex = 4;
+    int normalIndex = 4;
+
+    std::shared_ptr<LookupTableParams<float>> normalInverse = ObjectCache<float>::getNormalInverse();
+
+    static uint64_t splitMix64(uint64_t& state);
+};
+
+inline uint64_t RandomSimd::splitMix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+inline void RandomSimd::setSeed(uint32_t seed)
+{
+    // xoshiro needs a state that isn't all zero, and one that isn't
+    // correlated with its neighbors, so spread the seed out with splitmix.
+    // s[word][lane]
+    uint32_t s[4][4];
+    uint64_t state = seed;
+    for (int word = 0; word < 4; ++word) {
+        for (int lane = 0; lane < 4; lane += 2) {
+            const uint64_t x = splitMix64(state);
+            s[word][lane] = uint32_t(x);
+            s[word][lane + 1] = uint32_t(x >> 32);
+        }
+    }
+    s0 = _mm_loadu_si128((const __m128i*) s[0]);
+    s1 = _mm_loadu_si128((const __m128i*) s[1]);
+    s2 = _mm_loadu_si128((const __m128i*) s[2]);
+    s3 = _mm_loadu_si128((const __m128i*) s[3]);
+    uniformIndex = 4;
+    normalIndex = 4;
+}
+
+inline __m128i RandomSimd::next()
+{
+    const __m128i result = _mm_add_epi32(s0, s3);
+    const __m128i t = _mm_slli_epi32(s1, 9);
+
+    s2 = _mm_xor_si128(s2, s0);
+    s3 = _mm_xor_si128(s3, s1);
+    s1 = _mm_xor_si128(s1, s2);
+    s0 = _mm_xor_si128(s0, s3);
+    s2 = _mm_xor_si128(s2, t);
+
+    // rotate left 11. SSE2 doesn't have a rotate
+    s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 32 - 11));
+    return result;
+}
+
+inline __m128 RandomSimd::uniform4()
+{
+    // put the top 23 bits in the mantissa of a float between 1 and 2
+    const __m128i mantissa = _mm_srli_epi32(next(), 9);
+    const __m128 oneToTwo = _mm_castsi128_ps(_mm_or_si128(mantissa, _mm_set1_epi32(0x3f800000)));
+    return _mm_sub_ps(oneToTwo, _mm_set_ps1(1.f));
+}
+
+inline __m128 RandomSimd::normal4()
+{
+    return LookupTable<float>::lookup4(*normalInverse, uniform4());
+}
+
+inline void RandomSimd::fillUniform(float* out, int n)
+{
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, uniform4());
+    }
+    for (; i < n; ++i) {
+        out[i] = uniform();
+    }
+}
+
+inline void RandomSimd::fillNormal(float* out, int n)
+{
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, normal4());
+    }
+    for (; i < n; ++i) {
+        out[i] = normal();
+    }
+}
+
+inline float RandomSimd::uniform()
+{
+    if (uniformIndex >= 4) {
+        _mm_storeu_ps(uniformBuffer, uniform4());
+        uniformIndex = 0;
+    }
+    return uniformBuffer[uniformIndex++];
+}
+
+inline float RandomSimd::normal()
+{
+    if (normalIndex >= 4) {
+        _mm_storeu_ps(normalBuffer, normal4());
+        normalIndex = 0;
+    }
+    return normalBuffer[normalIndex++];
+}
@@ -11,6 +11,24 @@ public:
     virtual void setGate(int voice, bool gate) = 0;
     virtual void setCV(int voice, float pitch) = 0;
     virtual void onLockFailed() = 0;
+
+    /**
+     * The player calls these, so that each track can go to its own outputs.
+     * Hosts with only one set of outputs don't need to override them,
+     * and will only hear the first track.
+     */
+    virtual void setTrackGate(int track, int voice, bool gate)
+    {
+        if (track == 0) {
+            setGate(voice, gate);
+        }
+    }
+    virtual void setTrackCV(int track, int voice, float pitch)
+    {
+        if (track == 0) {
+            setCV(voice, pitch);
+        }
+    }
     virtual ~IMidiPlayerHost() = default;
 };
 
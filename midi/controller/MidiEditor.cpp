@@ -15,7 +15,7 @@
 
 #include <assert.h>
 
-extern int _mdb;
+extern std::atomic<int> _mdb;
 
 MidiEditor::MidiEditor(std::shared_ptr<MidiSequencer> seq) :
     m_seq(seq)
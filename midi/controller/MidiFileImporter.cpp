@@ -0,0 +1,80 @@
+#include "MidiFileImporter.h"
+#include "MidiFileProxy.h"
+#include "MidiSong.h"
+#include "ThreadPool.h"
+#include "ThreadSharedState.h"
+
+#include <assert.h>
+
+class MidiImportMessage : public ThreadMessage
+{
+public:
+    MidiImportMessage() : ThreadMessage(Type::MIDI_FILE)
+    {
+    }
+    std::string filename;
+
+    /**
+     * Filled in by the worker.
+     */
+    MidiSongPtr song;
+};
+
+class MidiImportHandler : public ThreadPoolHandler
+{
+public:
+    ThreadMessage* handleMessage(ThreadMessage* msg) override
+    {
+        if (msg->type != ThreadMessage::Type::MIDI_FILE) {
+            assert(false);
+            return msg;
+        }
+        MidiImportMessage* importMessage = static_cast<MidiImportMessage*>(msg);
+
+        // The fast reader handles all the files we write, and almost everything else.
+        // If it can't, smf may still be able to.
+        importMessage->song = MidiFileProxy::loadNotes(importMessage->filename);
+        if (!importMessage->song) {
+            importMessage->song = MidiFileProxy::load(importMessage->filename);
+        }
+        return importMessage;
+    }
+};
+
+MidiFileImporter::MidiFileImporter() : message(new MidiImportMessage())
+{
+}
+
+MidiFileImporter::~MidiFileImporter()
+{
+}
+
+bool MidiFileImporter::startImport(const std::string& filename)
+{
+    if (busy) {
+        return false;
+    }
+    if (!client) {
+        std::unique_ptr<ThreadPoolHandler> handler(new MidiImportHandler());
+        client.reset(new ThreadPoolClient(std::move(handler), 1));
+    }
+
+    message->filename = filename;
+    message->song.reset();
+    busy = client->sendMessage(message.get());
+    assert(busy);
+    return busy;
+}
+
+bool MidiFileImporter::poll(MidiSongPtr& song, std::string& filename)
+{
+    if (!busy || !client->getMessage()) {
+        return false;
+    }
+    busy = false;
+
+    // worker is done with the message, so it's ours again
+    song = std::move(message->song);
+    filename = message->filename;
+    return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+class MidiImportMessage;
+class MidiSong;
+class ThreadPoolClient;
+
+using MidiSongPtr = std::shared_ptr<MidiSong>;
+
+/**
+ * Loads MIDI files on a worker thread from the shared ThreadPool,
+ * so that big files don't freeze the UI while they load.
+ *
+ * All of the APIs are meant to be called from the UI thread.
+ * The song comes back from poll() fully built, so it can be handed to
+ * the sequencer in one piece (SequencerModule::postNewSong).
+ */
+class MidiFileImporter
+{
+public:
+    MidiFileImporter();
+    ~MidiFileImporter();
+
+    /**
+     * Returns false if we are still busy with the last one.
+     */
+    bool startImport(const std::string& filename);
+
+    /**
+     * Returns true once when an import finishes, and fills in the song
+     * and the filename it came from. song will be null if the file could not be loaded.
+     */
+    bool poll(MidiSongPtr& song, std::string& filename);
+
+    bool isBusy() const
+    {
+        return busy;
+    }
+
+    const MidiFileImporter& operator= (const MidiFileImporter&) = delete;
+    MidiFileImporter(const MidiFileImporter&) = delete;
+private:
+    /**
+     * Declared before client, so the client is gone
+     * before we delete a message that may be in play.
+     */
+    std::unique_ptr<MidiImportMessage> message;
+
+    /**
+     * Made on the first import, so that we don't hold on to
+     * the pool if no one ever loads a file.
+     */
+    std::unique_ptr<ThreadPoolClient> client;
+    bool busy = false;
+};
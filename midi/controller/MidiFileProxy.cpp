@@ -7,7 +7,11 @@
 
 //#include <direct.h>
 #include <iostream>
+#include <algorithm>
 #include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
 
 bool MidiFileProxy::save(MidiSongPtr song, const std::string& filePath)
 {
@@ -126,4 +130,271 @@ MidiTrackPtr MidiFileProxy::getFirst(MidiSongPtr song, smf::MidiFile& midiFile)
         }
     }
     return nullptr;
-}
\ No newline at end of file
+}
+
+/**
+ * Just enough of a Standard MIDI File parser to pull out the notes.
+ * Follows smf::MidiFile::read and linkNotePairs, so that we end up with
+ * the same notes as load(), without making a MidiEvent for every byte of the file.
+ */
+class SmfNoteReader
+{
+public:
+    SmfNoteReader(const uint8_t* d, size_t s) : data(d), size(s)
+    {
+    }
+
+    bool ok = true;
+    size_t pos = 0;
+
+    uint8_t getByte()
+    {
+        if (pos >= size) {
+            ok = false;
+            return 0;
+        }
+        return data[pos++];
+    }
+    uint32_t getBigEndian(int numBytes)
+    {
+        uint32_t ret = 0;
+        for (int i = 0; i < numBytes; ++i) {
+            ret = (ret << 8) | getByte();
+        }
+        return ret;
+    }
+    uint32_t getVarint()
+    {
+        uint32_t ret = 0;
+        for (int i = 0; i < 4; ++i) {
+            const uint8_t x = getByte();
+            ret = (ret << 7) | (x & 0x7f);
+            if (!(x & 0x80)) {
+                return ret;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+    bool match(const char* id)
+    {
+        for (int i = 0; i < 4; ++i) {
+            if (getByte() != uint8_t(id[i])) {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+    void skip(size_t n)
+    {
+        if (n > size - pos) {
+            ok = false;
+            pos = size;
+        } else {
+            pos += n;
+        }
+    }
+    bool atEnd() const
+    {
+        return pos >= size;
+    }
+
+    /**
+     * Reads one MTrk chunk. Any notes, and the end of the track, go into events.
+     * Returns false on bad data.
+     */
+    bool readTrack(double ppq, std::vector<MidiEventPtr>& events);
+
+private:
+    const uint8_t* const data;
+    const size_t size;
+
+    /**
+     * smf leaves notes with no note-off, or a note-off on the same tick,
+     * with zero duration. That isn't a valid note, so we make them at least a tick long.
+     */
+    static void setDuration(const MidiEventPtr& ev, uint32_t ticks, double ppq)
+    {
+        MidiNoteEvent* note = static_cast<MidiNoteEvent*>(ev.get());
+        note->duration = float(double(std::max(ticks, uint32_t(1))) / ppq);
+    }
+};
+
+bool SmfNoteReader::readTrack(double ppq, std::vector<MidiEventPtr>& events)
+{
+    if (!match("MTrk")) {
+        return false;
+    }
+    const uint32_t length = getBigEndian(4);
+    const size_t chunkEnd = pos + length;
+
+    // note-ons waiting for their note-off, by channel and key.
+    // Last on is paired with the first off, like linkNotePairs.
+    struct PendingNote
+    {
+        int index;
+        uint32_t tick;
+    };
+    std::vector<PendingNote> pending[16][128];
+
+    uint32_t tick = 0;
+    uint8_t runningStatus = 0;
+    bool foundEnd = false;
+    while (ok && !foundEnd && !atEnd()) {
+        tick += getVarint();
+        uint8_t status = getByte();
+        uint8_t data1 = 0;
+        if (status < 0x80) {
+            // running status. Meta and sysex don't use it, or change it.
+            if (!runningStatus) {
+                return false;
+            }
+            data1 = status;
+            status = runningStatus;
+        } else if (status < 0xf0) {
+            runningStatus = status;
+            data1 = getByte();
+        }
+
+        const int channel = status & 0x0f;
+        switch (status & 0xf0) {
+            case 0x80:
+            case 0x90:
+            {
+                const uint8_t velocity = getByte();
+                if ((data1 | velocity) & 0x80) {
+                    return false;
+                }
+                std::vector<PendingNote>& notes = pending[channel][data1];
+                if ((status & 0xf0) == 0x90 && velocity) {
+                    MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+                    note->startTime = float(double(tick) / ppq);
+                    note->pitchCV = PitchUtils::pitchToCV(0, data1);
+                    notes.push_back({ int(events.size()), tick });
+                    events.push_back(note);
+                } else if (!notes.empty()) {
+                    const PendingNote& on = notes.back();
+                    setDuration(events[on.index], tick - on.tick, ppq);
+                    notes.pop_back();
+                }
+            }
+            break;
+            case 0xa0:
+            case 0xb0:
+            case 0xe0:
+                getByte();
+                break;
+            case 0xc0:
+            case 0xd0:
+                break;
+            default:
+                if (status == 0xff) {
+                    const uint8_t type = getByte();
+                    skip(getVarint());
+                    if (type == 0x2f) {
+                        foundEnd = true;
+                    }
+                } else if (status == 0xf0 || status == 0xf7) {
+                    skip(getVarint());
+                } else {
+                    return false;
+                }
+        }
+    }
+    // like smf, we insist on an end of track
+    if (!ok || !foundEnd) {
+        return false;
+    }
+
+    // Notes that never got a note-off are held to the end of the track.
+    for (auto& channelNotes : pending) {
+        for (auto& notes : channelNotes) {
+            for (const PendingNote& on : notes) {
+                setDuration(events[on.index], tick - on.tick, ppq);
+            }
+        }
+    }
+
+    const float start = float(double(tick) / ppq);
+
+    // quantize end point to 1/16 note, same as getFirst
+    float startq = (float) TimeUtils::quantize(start, .25f, false);
+    if (startq < start) {
+        startq += .25f;
+    }
+    MidiEndEventPtr end = std::make_shared<MidiEndEvent>();
+    end->startTime = startq;
+    events.push_back(end);
+
+    // Many files in the wild have the wrong chunk length, so only trust it
+    // if there is another track right where it says.
+    if (chunkEnd + 4 <= size && !memcmp(data + chunkEnd, "MTrk", 4)) {
+        pos = chunkEnd;
+    }
+    return true;
+}
+
+MidiSongPtr MidiFileProxy::loadNotes(const std::string& filename)
+{
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (!file) {
+        return nullptr;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[64 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(file);
+    return parseNotes(data.data(), data.size());
+}
+
+MidiSongPtr MidiFileProxy::parseNotes(const uint8_t* data, size_t size)
+{
+    SmfNoteReader r(data, size);
+    if (!r.match("MThd") || r.getBigEndian(4) != 6) {
+        return nullptr;
+    }
+    const uint32_t format = r.getBigEndian(2);
+    const uint32_t numTracks = r.getBigEndian(2);
+    const uint32_t division = r.getBigEndian(2);
+    if (!r.ok || format > 1 || (format == 0 && numTracks != 1)) {
+        return nullptr;
+    }
+
+    int ppq = int(division);
+    if (division >= 0x8000) {
+        // SMPTE. Like smf, we call a second a quarter note.
+        const int framesPerSecond = 256 - int(division >> 8);
+        ppq = framesPerSecond * int(division & 0xff);
+    }
+    if (ppq <= 0) {
+        return nullptr;
+    }
+
+    // like getFirst, we only want the first track that has notes in it
+    std::vector<MidiEventPtr> events;
+    for (uint32_t i = 0; i < numTracks; ++i) {
+        events.clear();
+        if (!r.readTrack(ppq, events)) {
+            return nullptr;
+        }
+        if (events.size() > 1) {
+            break;
+        }
+    }
+    if (events.size() < 2) {
+        return nullptr;
+    }
+
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiTrackPtr track = std::make_shared<MidiTrack>(song->lock);
+    {
+        MidiLocker l(song->lock);
+        track->insertEvents(events);
+    }
+    song->addTrack(0, track);
+    song->assertValid();
+    return song;
+}
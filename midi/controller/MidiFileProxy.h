@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <stddef.h>
+#include <stdint.h>
 #include <string>
 
 namespace smf {
@@ -19,4 +21,13 @@ public:
     static MidiSongPtr load(const std::string& filename);
     static MidiTrackPtr getFirst(MidiSongPtr song, smf::MidiFile&);
     static bool save(MidiSongPtr song, const std::string& filePath);
-};
\ No newline at end of file
+
+    /**
+     * Makes the same song as load(), but reads the notes right out of the
+     * file instead of building a whole smf::MidiFile first.
+     * Much faster on big files, and safe to call from any thread.
+     * Returns nullptr if the file can't be parsed, or has no notes.
+     */
+    static MidiSongPtr loadNotes(const std::string& filename);
+    static MidiSongPtr parseNotes(const uint8_t* data, size_t size);
+};
@@ -30,6 +30,9 @@ void MidiLock::editorLock()
 
 void MidiLock::editorUnlock()
 {
+    if (editorLockLevel == 1 && editorUnlockHandler) {
+        editorUnlockHandler();
+    }
     if (--editorLockLevel == 0) {
         theLock = false;
     }
@@ -67,6 +70,11 @@ bool MidiLock::dataModelDirty()
     return ret;
 }
 
+void MidiLock::setEditorUnlockHandler(std::function<void()> handler)
+{
+    editorUnlockHandler = handler;
+}
+
 /***********************************************************************/
 
 
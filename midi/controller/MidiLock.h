@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
 
 class MidiLock;
@@ -26,10 +27,18 @@ public:
      */
     bool dataModelDirty();
 
+    /**
+     * Called on the UI thread when the editor releases its outermost lock,
+     * just before the player can take it again.
+     * MidiSong uses this to publish new snapshots of its tracks to the player.
+     */
+    void setEditorUnlockHandler(std::function<void()>);
+
 private:
     std::atomic<bool> theLock;
     std::atomic<int> editorLockLevel;
     std::atomic<bool> editorDidLock;
+    std::function<void()> editorUnlockHandler;
 
     bool tryLock();
 };
@@ -5,18 +5,21 @@
 #include "MidiSong.h"
 #include "TimeUtils.h"
 
+#include <algorithm>
+
 MidiPlayer2::MidiPlayer2(std::shared_ptr<IMidiPlayerHost> host, std::shared_ptr<MidiSong> song) :
     host(host),
-    song(song),
-    voiceAssigner(voices, 16),
-    track(song->getTrack(0))
+    song(song)
 {
-    for (int i = 0; i < 16; ++i) {
-        MidiVoice& vx = voices[i];
-        vx.setHost(host.get());
-        vx.setIndex(i);
+    isReset = true;
+    for (int t = 0; t < maxTracks; ++t) {
+        for (int i = 0; i < maxVoices; ++i) {
+            MidiVoice& vx = tracks[t].voices[i];
+            vx.setHost(host.get());
+            vx.setIndex(i);
+            vx.setTrack(t);
+        }
     }
-//    loopParams = nullptr;
 }
 
 void MidiPlayer2::setSong(std::shared_ptr<MidiSong> newSong)
@@ -24,8 +27,31 @@ void MidiPlayer2::setSong(std::shared_ptr<MidiSong> newSong)
     // Since these calls come in on the UI thread, the UI must have locked us before.
     assert(song->lock->locked());
     assert(newSong->lock->locked());
+
+    // we may still be playing snapshots from the old tracks,
+    // so don't let them go until we have moved on.
+    retiredSongs.push_back(song);
     song = newSong;
-    track = song->getTrack(0);
+    isReset = true;
+
+    for (auto it = retiredSongs.begin(); it != retiredSongs.end(); ) {
+        if (!isSongInUse(**it)) {
+            it = retiredSongs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool MidiPlayer2::isSongInUse(const MidiSong& oldSong) const
+{
+    for (int i = 0; i < maxTracks; ++i) {
+        const MidiTrack* track = tracks[i].track;
+        if (track && oldSong.trackExists(i) && oldSong.getTrackConst(i).get() == track) {
+            return true;
+        }
+    }
+    return false;
 }
 
 void MidiPlayer2::reset(bool clearGates)
@@ -36,28 +62,60 @@ void MidiPlayer2::reset(bool clearGates)
 
 void MidiPlayer2::setNumVoices(int voices)
 {
-    numVoices = voices;
-    voiceAssigner.setNumVoices(voices);
+    // this gets called every sample, so don't touch all the tracks unless we need to.
+    if (voices == numVoicesAllTracks) {
+        return;
+    }
+    for (int i = 0; i < maxTracks; ++i) {
+        setNumVoices(i, voices);
+    }
+    numVoicesAllTracks = voices;
+}
+
+void MidiPlayer2::setNumVoices(int track, int voices)
+{
+    assert(track >= 0 && track < maxTracks);
+    TrackPlayer& tp = tracks[track];
+    if (voices != tp.numVoices) {
+        // we only look for note offs in the voices we are using
+        scheduleDirty = true;
+    }
+    tp.numVoices = voices;
+    tp.voiceAssigner.setNumVoices(voices);
+    numVoicesAllTracks = -1;
 }
 
 void MidiPlayer2::setSampleCountForRetrigger(int samples)
 {
-    for (int i = 0; i < maxVoices; ++i) {
-        voices[i].setSampleCountForRetrigger(samples);
+    for (int t = 0; t < maxTracks; ++t) {
+        for (int i = 0; i < maxVoices; ++i) {
+            tracks[t].voices[i].setSampleCountForRetrigger(samples);
+        }
     }
 }
 
 void MidiPlayer2::updateSampleCount(int numElapsed)
 {
-    for (int i = 0; i < numVoices; ++i) {
-        voices[i].updateSampleCount(numElapsed);
+    for (int i = 0; i < numRetriggerVoices; ) {
+        MidiVoice* voice = retriggerVoices[i];
+        voice->updateSampleCount(numElapsed);
+        if (voice->state() != MidiVoice::State::ReTriggering) {
+            retriggerVoices[i] = retriggerVoices[--numRetriggerVoices];
+        } else {
+            ++i;
+        }
     }
 }
 
-
 double MidiPlayer2::getCurrentLoopIterationStart() const
 {
-    return currentLoopIterationStart;
+    return getCurrentLoopIterationStart(0);
+}
+
+double MidiPlayer2::getCurrentLoopIterationStart(int track) const
+{
+    assert(track >= 0 && track < maxTracks);
+    return tracks[track].currentLoopIterationStart;
 }
 
 float MidiPlayer2::getCurrentSubrangeLoopStart() const
@@ -83,95 +141,179 @@ void MidiPlayer2::updateToMetricTime(double metricTime, float quantizationInterv
 
     const bool acquiredLock = song->lock->playerTryLock();
     if (acquiredLock) {
-        if (song->lock->dataModelDirty()) {
-            reset(false);
+        // Edits no longer need a reset, they come to us as new snapshots.
+        song->lock->dataModelDirty();
+        const SubrangeLoop& newLoop = song->getSubrangeLoop();
+        if (newLoop != loop) {
+            loop = newLoop;
+            scheduleDirty = true;
         }
+        updateSnapshots();
         updateToMetricTimeInternal(metricTime, quantizationInterval);
         song->lock->playerUnlock();
     } else {
-        reset(false);
+        // The editor is busy, but the snapshots we have are still good,
+        // so keep playing them. Unless we are waiting for a reset, which needs the song.
         host->onLockFailed();
+        if (!isReset && numTracks) {
+            updateToMetricTimeInternal(metricTime, quantizationInterval);
+        }
     }
 }
 
+void MidiPlayer2::updateSnapshots()
+{
+    // Only look at the tracks if something was published.
+    const unsigned generation = song->getSnapshotGeneration();
+    if (!isReset && (generation == snapshotGeneration)) {
+        return;
+    }
+    snapshotGeneration = generation;
+
+    numTracks = std::min(song->getHighestTrackNumber() + 1, maxTracks);
+    for (int i = 0; i < maxTracks; ++i) {
+        TrackPlayer& tp = tracks[i];
+        tp.track = (i < numTracks && song->trackExists(i)) ? song->getTrack(i).get() : nullptr;
+        const MidiEventArray* newEvents = tp.track ? tp.track->acquireSnapshot() : nullptr;
+        if (newEvents != tp.events) {
+            seekSnapshot(tp, newEvents);
+            scheduleDirty = true;
+        }
+    }
+}
+
+void MidiPlayer2::seekSnapshot(TrackPlayer& tp, const MidiEventArray* newEvents)
+{
+    tp.events = newEvents;
+    if (isReset || !tp.events) {
+        // we will start over from the beginning anyway
+        tp.curEvent = 0;
+        return;
+    }
+
+    // Find the first event that we have not played yet. Start with a binary search,
+    // then step forward since playback compares quantized times.
+    const MidiEventArray& events = *tp.events;
+    const double trackTime = lastMetricTime - tp.currentLoopIterationStart;
+    const int last = events.size() - 1;            // the end event
+    int curEvent = events.seek(trackTime - lastQuantizationInterval);
+    while (curEvent < last) {
+        const double eventStart = TimeUtils::quantize(tp.currentLoopIterationStart + events[curEvent].startTime,
+            lastQuantizationInterval, true);
+        if (eventStart > lastMetricTime) {
+            break;
+        }
+        ++curEvent;
+    }
+    tp.curEvent = std::min(curEvent, last);
+}
+
 void MidiPlayer2::updateToMetricTimeInternal(double metricTime, float quantizationInterval)
 {
     metricTime = TimeUtils::quantize(metricTime, quantizationInterval, true);
-    // If we had a conflict and needed to reset, then
-    // start all over from beginning. Or, if reset initiated by user.
+    // Start all over from beginning if reset initiated by user, or by a new song.
     if (isReset) {
         // printf("\nupdatetometrictimeinternal  player proc reset\n");
-        curEvent = track->begin();
+        for (int i = 0; i < maxTracks; ++i) {
+            TrackPlayer& tp = tracks[i];
+            tp.curEvent = 0;
+            tp.voiceAssigner.reset();
+            tp.currentLoopIterationStart = 0;
+        }
         resetAllVoices(isResetGates);
-        voiceAssigner.reset();
         isReset = false;
         isResetGates = false;
-        currentLoopIterationStart = 0;
+        scheduleDirty = true;
     }
 
 
     // To implement loop start, we just push metric time up to where we want to start.
     // TODO: skip over initial stuff?
     
-    if (song->getSubrangeLoop().enabled) {
-   // if (loopParams && loopParams.load()->enabled) {
-        metricTime += song->getSubrangeLoop().startTime;
+    if (loop.enabled) {
+        metricTime += loop.startTime;
     }
-     // keep processing events until we are caught up
-    while (playOnce(metricTime, quantizationInterval)) {
 
+    // due times are quantized, so they change with the clock
+    if (scheduleDirty || (quantizationInterval != lastQuantizationInterval)) {
+        buildSchedule(quantizationInterval);
     }
+
+    // Take all the tracks that are due off the heap before playing any, so that
+    // each track plays once per call, even if it stays due.
+    int dueTracks[maxTracks];
+    int numDue = 0;
+    while (scheduleSize && (tracks[schedule[0]].dueTime <= metricTime)) {
+        dueTracks[numDue++] = popSchedule();
+    }
+
+    for (int i = 0; i < numDue; ++i) {
+        TrackPlayer& tp = tracks[dueTracks[i]];
+        // keep processing events until we are caught up
+        while (playOnce(tp, metricTime, quantizationInterval)) {
+
+        }
+        tp.dueTime = getDueTime(tp, quantizationInterval);
+        pushSchedule(dueTracks[i]);
+    }
+    lastMetricTime = metricTime;
+    lastQuantizationInterval = quantizationInterval;
 }
 
-bool MidiPlayer2::playOnce(double metricTime, float quantizeInterval)
+bool MidiPlayer2::playOnce(TrackPlayer& tp, double metricTime, float quantizeInterval)
 {
 #if defined(_MLOG) && 0
     printf("MidiPlayer::playOnce metrict=%.2f, quantizInt=%.2f\n", metricTime, quantizeInterval);
 #endif
     bool didSomething = false;
 
-    didSomething = pollForNoteOff(metricTime);
+    didSomething = pollForNoteOff(tp, metricTime);
     if (didSomething) {
         return true;
     }
 
+    assert(tp.events);
+    assert(tp.curEvent < tp.events->size());
+    const MidiEventArray::Record& event = (*tp.events)[tp.curEvent];
+
     // push the start time up by loop start, so that event t==loop start happens at start of loop
-    const double eventStartUnQuantized = (currentLoopIterationStart + curEvent->first);
+    const double eventStartUnQuantized = (tp.currentLoopIterationStart + event.startTime);
 
     // Treat loop end just like track end. loop back around
     // when we pass then end.
-    if (song->getSubrangeLoop().enabled) {
-        auto loopEnd = song->getSubrangeLoop().endTime + currentLoopIterationStart;
+    if (loop.enabled) {
+        auto loopEnd = loop.endTime + tp.currentLoopIterationStart;
         if (loopEnd <= metricTime) {
-            currentLoopIterationStart += (song->getSubrangeLoop().endTime - song->getSubrangeLoop().startTime);
-            curEvent = track->begin();
+            tp.currentLoopIterationStart += (loop.endTime - loop.startTime);
+            tp.curEvent = 0;
             return true;
         }
     }
 
     const double eventStart = TimeUtils::quantize(eventStartUnQuantized, quantizeInterval, true);
     if (eventStart <= metricTime) {
-        MidiEventPtr event = curEvent->second;
-        switch (event->type) {
+        switch (event.type) {
             case MidiEvent::Type::Note:
             {
-                MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(event);
-  
                 // find a voice to play
-                MidiVoice* voice = voiceAssigner.getNext(note->pitchCV);
+                MidiVoice* voice = tp.voiceAssigner.getNext(event.pitchCV);
                 assert(voice);
 
                 // play the note
-                const double durationQuantized = TimeUtils::quantize(note->duration, quantizeInterval, false);  
+                const double durationQuantized = TimeUtils::quantize(event.duration, quantizeInterval, false);  
                 double quantizedNoteEnd = TimeUtils::quantize(durationQuantized + eventStart, quantizeInterval, false);
-                voice->playNote(note->pitchCV, float(eventStart), float(quantizedNoteEnd));
-                ++curEvent;
+                voice->playNote(event.pitchCV, float(eventStart), float(quantizedNoteEnd));
+                if (voice->state() == MidiVoice::State::ReTriggering &&
+                    std::find(retriggerVoices, retriggerVoices + numRetriggerVoices, voice) == retriggerVoices + numRetriggerVoices) {
+                    retriggerVoices[numRetriggerVoices++] = voice;
+                }
+                ++tp.curEvent;
             }
             break;
             case MidiEvent::Type::End:
                 // for now, should loop.
-                currentLoopIterationStart += curEvent->first;
-                curEvent = track->begin();
+                tp.currentLoopIterationStart += event.startTime;
+                tp.curEvent = 0;
                 break;
             default:
                 assert(false);
@@ -181,11 +323,11 @@ bool MidiPlayer2::playOnce(double metricTime, float quantizeInterval)
     return didSomething;
 }
 
-bool MidiPlayer2::pollForNoteOff(double metricTime)
+bool MidiPlayer2::pollForNoteOff(TrackPlayer& tp, double metricTime)
 {
     bool didSomething = false;
-    for (int i = 0; i < numVoices; ++i) {
-        bool b = voices[i].updateToMetricTime(metricTime);
+    for (int i = 0; i < tp.numVoices; ++i) {
+        bool b = tp.voices[i].updateToMetricTime(metricTime);
         if (b) {
             didSomething = true;;
         }
@@ -195,7 +337,57 @@ bool MidiPlayer2::pollForNoteOff(double metricTime)
 
 void MidiPlayer2::resetAllVoices(bool clearGates)
 {
-    for (int i = 0; i < numVoices; ++i) {
-        voices[i].reset(clearGates);
+    for (int t = 0; t < maxTracks; ++t) {
+        TrackPlayer& tp = tracks[t];
+        for (int i = 0; i < tp.numVoices; ++i) {
+            tp.voices[i].reset(clearGates);
+        }
     }
-}
\ No newline at end of file
+    numRetriggerVoices = 0;
+}
+
+double MidiPlayer2::getDueTime(const TrackPlayer& tp, float quantizeInterval) const
+{
+    // Same tests as playOnce, but for when they will next be true.
+    assert(tp.events);
+    const MidiEventArray::Record& event = (*tp.events)[tp.curEvent];
+    double ret = TimeUtils::quantize(tp.currentLoopIterationStart + event.startTime, quantizeInterval, true);
+    if (loop.enabled) {
+        ret = std::min(ret, loop.endTime + tp.currentLoopIterationStart);
+    }
+    for (int i = 0; i < tp.numVoices; ++i) {
+        const double t = tp.voices[i].getNextEventTime();
+        if (t >= 0) {
+            ret = std::min(ret, t);
+        }
+    }
+    return ret;
+}
+
+void MidiPlayer2::buildSchedule(float quantizeInterval)
+{
+    scheduleSize = 0;
+    for (int i = 0; i < maxTracks; ++i) {
+        TrackPlayer& tp = tracks[i];
+        if (tp.events) {
+            tp.dueTime = getDueTime(tp, quantizeInterval);
+            schedule[scheduleSize++] = i;
+        }
+    }
+    std::make_heap(schedule, schedule + scheduleSize, ScheduleOrder{ tracks });
+    scheduleDirty = false;
+}
+
+void MidiPlayer2::pushSchedule(int trackIndex)
+{
+    assert(scheduleSize < maxTracks);
+    schedule[scheduleSize++] = trackIndex;
+    std::push_heap(schedule, schedule + scheduleSize, ScheduleOrder{ tracks });
+}
+
+int MidiPlayer2::popSchedule()
+{
+    assert(scheduleSize > 0);
+    std::pop_heap(schedule, schedule + scheduleSize, ScheduleOrder{ tracks });
+    return schedule[--scheduleSize];
+}
@@ -1,67 +1,192 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 class MidiSong;
 class IMidiPlayerHost;
 
+#include "MidiSong.h"
 #include "MidiTrack.h"
 #include "MidiVoice.h"
 #include "MidiVoiceAssigner.h"
 
+/**
+ * Plays all the tracks of a song at once.
+ *
+ * Each track has its own voices and voice assigner, and tells the host
+ * which track a voice belongs to, so hosts may send each track to its own outputs.
+ *
+ * The tracks are merged with a heap, ordered by the time each track next needs attention
+ * (its next event, note off, or loop end). So a call where nothing is due only looks at
+ * the top of the heap, no matter how many tracks there are.
+ * perfTest percent CPU: 1 track 0.16, 16 tracks 0.16, 16 single track players 2.8
+ */
 class MidiPlayer2
 {
 public:
+    static const int maxTracks = 16;
+    static const int maxVoices = 16;
+
     MidiPlayer2(std::shared_ptr<IMidiPlayerHost> host, std::shared_ptr<MidiSong> song);
     void setSong(std::shared_ptr<MidiSong> song);
 
     /**
      * Main "play something" function.
+     *
+     * Plays from immutable snapshots of the tracks. If the editor has published new
+     * snapshots we pick them up here, and carry on from the same metric time.
+     * If the editor holds the lock we keep playing the snapshots we already have.
      * @param metricTime is the current time where 1 = quarter note.
      * @param quantizationInterval is the amount of metric time in a clock. 
      * So, if the click is a sixteenth note clock, quantizationInterval will be .25
      */
     void updateToMetricTime(double metricTime, float quantizationInterval, bool running);
 
+    /**
+     * Sets the number of voices for all the tracks
+     */
     void setNumVoices(int voices);
+    void setNumVoices(int track, int voices);
 
     /**
      * resets all internal playback state.
      * @param clearGate will set the host's gate low, if true
      */
     void reset(bool clearGates);
+
+    /**
+     * The loop start of the first track. Each track loops at its own end.
+     */
     double getCurrentLoopIterationStart() const;
+    double getCurrentLoopIterationStart(int track) const;
     float getCurrentSubrangeLoopStart() const;
 
     void setSampleCountForRetrigger(int);
     void updateSampleCount(int numElapsed);
 
+    /**
+     * The number of tracks we played last time we had the song.
+     */
+    int getNumTracks() const
+    {
+        return numTracks;
+    }
+
 private:
     std::shared_ptr<IMidiPlayerHost> host;
     std::shared_ptr<MidiSong> song;
 
-    static const int maxVoices = 16;
-    MidiVoice voices[maxVoices];
-    MidiVoiceAssigner voiceAssigner;
-
-    /***************************************
+    /**
      * Variables  to play one track
      */
-    MidiTrack::const_iterator curEvent;
+    class TrackPlayer
+    {
+    public:
+        TrackPlayer() : voiceAssigner(voices, maxVoices)
+        {
+        }
+
+        MidiVoice voices[maxVoices];
+        MidiVoiceAssigner voiceAssigner;
+        int numVoices = 1;
+
+        /**
+         * The snapshot of the track we are playing, and
+         * the index of the next event to play in it.
+         */
+        const MidiEventArray* events = nullptr;
+        int curEvent = 0;
+        double currentLoopIterationStart = 0;
+
+        /**
+         * The track that events came from. Only touched with the song locked.
+         */
+        MidiTrack* track = nullptr;
+
+        /**
+         * When we next need to call playOnce. Key for the heap.
+         */
+        double dueTime = 0;
+    };
+
+    TrackPlayer tracks[maxTracks];
+    int numTracks = 0;
+
+    /**
+     * Heap of indexes into tracks, earliest dueTime at the front.
+     * Only tracks that have something to play are in it.
+     */
+    int schedule[maxTracks];
+    int scheduleSize = 0;
+    bool scheduleDirty = true;
 
     /**
-     * when starting, or when reset by lock contention
+     * Comparison for the heap. Puts the earliest due time at the front.
      */
-    bool isReset = true;
+    class ScheduleOrder
+    {
+    public:
+        const TrackPlayer* tracks;
+        bool operator()(int a, int b) const
+        {
+            return tracks[a].dueTime > tracks[b].dueTime;
+        }
+    };
+
+    /**
+     * The voices that are in the middle of a re-trigger,
+     * so that updateSampleCount doesn't have to look at all of them.
+     */
+    MidiVoice* retriggerVoices[maxTracks * maxVoices];
+    int numRetriggerVoices = 0;
+
+    /**
+     * Copy of the song's loop, taken while we hold the lock.
+     */
+    SubrangeLoop loop;
+
+    /**
+     * The last time we played up to, including the loop start offset.
+     * Lets us find our place again in a new snapshot.
+     */
+    double lastMetricTime = 0;
+    float lastQuantizationInterval = 1;
+
+    /**
+     * when starting, or when reset by the user or a new song
+     */
+    std::atomic<bool> isReset;
     bool isResetGates = false;
 
-    double currentLoopIterationStart = 0;
-    int numVoices=1;
+    /**
+     * The value of numVoices that all the assigners have, or -1 if they differ.
+     */
+    int numVoicesAllTracks = -1;
+
+    /**
+     * The song generation we last took snapshots from.
+     */
+    unsigned snapshotGeneration = 0;
 
-    std::shared_ptr<MidiTrack> track;
+    /**
+     * When the song changes, the old song is kept in retiredSongs until we stop
+     * using its tracks, so that the snapshots we are playing are never freed under us.
+     * Only touched with the song locked.
+     */
+    std::vector<std::shared_ptr<MidiSong>> retiredSongs;
 
+    void updateSnapshots();
+    void seekSnapshot(TrackPlayer&, const MidiEventArray* newEvents);
     void updateToMetricTimeInternal(double, float);
-    bool playOnce(double metricTime, float quantizeInterval);
-    bool pollForNoteOff(double metricTime);
+    bool playOnce(TrackPlayer&, double metricTime, float quantizeInterval);
+    bool pollForNoteOff(TrackPlayer&, double metricTime);
     void resetAllVoices(bool clearGates);
+
+    double getDueTime(const TrackPlayer&, float quantizeInterval) const;
+    void buildSchedule(float quantizeInterval);
+    void pushSchedule(int trackIndex);
+    int popSchedule();
+    bool isSongInUse(const MidiSong&) const;
 };
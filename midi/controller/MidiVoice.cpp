@@ -20,15 +20,20 @@ void MidiVoice::setIndex(int i)
     index = i;
 }
 
+void MidiVoice::setTrack(int t)
+{
+    track = t;
+}
+
 void MidiVoice::setGate(bool g)
 {
    // printf("mv::setGate(%d) %d\n ", index, g);
-    host->setGate(index, g);
+    host->setTrackGate(track, index, g);
 }
 
 void MidiVoice::setCV(float cv)
 {
-    host->setCV(index, cv);
+    host->setTrackCV(track, index, cv);
 }
 
 float MidiVoice::pitch() const
@@ -36,6 +41,12 @@ float MidiVoice::pitch() const
     return curPitch;
 }
 
+double MidiVoice::getNextEventTime() const
+{
+    // while re-triggering the note off time isn't set yet.
+    return (curState == State::ReTriggering) ? delayedNoteEndtime : noteOffTime;
+}
+
 void MidiVoice::_setState(State s)
 {
     curState = s;
@@ -25,6 +25,7 @@ public:
     enum class State {Idle, Playing, ReTriggering };
     void setHost(IMidiPlayerHost*);
     void setIndex(int);
+    void setTrack(int);
     void setSampleCountForRetrigger(int samples);
 
     /**
@@ -58,6 +59,12 @@ public:
     State state() const;
     float pitch() const;
 
+    /**
+     * The metric time when this voice next needs updateToMetricTime,
+     * or -1 if it has nothing scheduled.
+     */
+    double getNextEventTime() const;
+
     // these are only for debugging
     int _getIndex() const;
     void _setState(State);
@@ -86,6 +93,7 @@ private:
 
     State curState = State::Idle;
     int index = 0;
+    int track = 0;
 
     void setGate(bool);
     void setCV(float);
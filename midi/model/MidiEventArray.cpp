@@ -0,0 +1,76 @@
+#include "MidiEventArray.h"
+
+#include <algorithm>
+#include <assert.h>
+
+MidiEventArray::Record MidiEventArray::makeRecord(const MidiEvent& ev)
+{
+    Record ret;
+    ret.startTime = ev.startTime;
+    ret.type = ev.type;
+    ret.duration = 0;
+    ret.pitchCV = 0;
+    if (ev.type == MidiEvent::Type::Note) {
+        const MidiNoteEvent& note = static_cast<const MidiNoteEvent&>(ev);
+        ret.duration = note.duration;
+        ret.pitchCV = note.pitchCV;
+    }
+    return ret;
+}
+
+bool MidiEventArray::Record::matches(const MidiEvent& ev) const
+{
+    const Record other = makeRecord(ev);
+    return (type == other.type) &&
+        (startTime == other.startTime) &&
+        (duration == other.duration) &&
+        (pitchCV == other.pitchCV);
+}
+
+MidiEventArray::const_iterator MidiEventArray::lowerBound(MidiEvent::time_t time) const
+{
+    return std::lower_bound(records.begin(), records.end(), time, [](const Record& r, MidiEvent::time_t t) {
+        return r.startTime < t;
+        });
+}
+
+MidiEventArray::const_iterator MidiEventArray::upperBound(MidiEvent::time_t time) const
+{
+    return std::upper_bound(records.begin(), records.end(), time, [](MidiEvent::time_t t, const Record& r) {
+        return t < r.startTime;
+        });
+}
+
+void MidiEventArray::insert(const MidiEvent& ev)
+{
+    // after all the other events at this time, same as multimap::insert
+    const auto it = upperBound(ev.startTime);
+    records.insert(it, makeRecord(ev));
+}
+
+bool MidiEventArray::erase(const MidiEvent& ev)
+{
+    const auto last = upperBound(ev.startTime);
+    for (auto it = lowerBound(ev.startTime); it != last; ++it) {
+        if (it->matches(ev)) {
+            records.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void MidiEventArray::clear()
+{
+    records.clear();
+}
+
+int MidiEventArray::seek(MidiEvent::time_t time) const
+{
+    return int(lowerBound(time) - records.begin());
+}
+
+MidiEventArray::iterator_pair MidiEventArray::timeRange(MidiEvent::time_t start, MidiEvent::time_t end) const
+{
+    return iterator_pair(lowerBound(start), upperBound(end));
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "SqMidiEvent.h"
+
+/**
+ * Flat storage for the events in a MidiTrack.
+ *
+ * The events are kept in a sorted, contiguous vector of small plain records,
+ * so that the code that just reads notes (like playback) doesn't have to chase
+ * pointers through a map of polymorphic objects.
+ *
+ * The order is exactly the same as MidiTrack's multimap: sorted by start time,
+ * and events with the same start time are in the order they were inserted.
+ * So record [n] is the same event as the nth event in the track.
+ */
+class MidiEventArray
+{
+public:
+    class Record
+    {
+    public:
+        MidiEvent::time_t startTime;
+        float duration;         // only used for notes
+        float pitchCV;          // only used for notes
+        MidiEvent::Type type;
+
+        bool matches(const MidiEvent&) const;
+    };
+
+    using container = std::vector<Record>;
+    using const_iterator = container::const_iterator;
+    using iterator_pair = std::pair<const_iterator, const_iterator>;
+
+    static Record makeRecord(const MidiEvent&);
+
+    /**
+     * O(log n) to find the spot, then O(n) to move the rest down,
+     * which is a fast memmove for plain records.
+     */
+    void insert(const MidiEvent&);
+
+    /**
+     * removes the first record that matches ev.
+     * returns false if not found.
+     */
+    bool erase(const MidiEvent&);
+    void clear();
+    void reserve(int size)
+    {
+        records.reserve(size);
+    }
+
+    int size() const
+    {
+        return int(records.size());
+    }
+    const Record& operator[](int index) const
+    {
+        return records[index];
+    }
+    const_iterator begin() const
+    {
+        return records.begin();
+    }
+    const_iterator end() const
+    {
+        return records.end();
+    }
+
+    /**
+     * Returns the index of the first event at or after time.
+     * O(log n)
+     */
+    int seek(MidiEvent::time_t time) const;
+
+    /**
+     * Returns pair of iterators for all events  start <= t <= end
+     */
+    iterator_pair timeRange(MidiEvent::time_t start, MidiEvent::time_t end) const;
+
+private:
+    container records;
+
+    const_iterator lowerBound(MidiEvent::time_t time) const;
+    const_iterator upperBound(MidiEvent::time_t time) const;
+};
@@ -4,7 +4,7 @@
 #include "MidiSelectionModel.h"
 
 #include <assert.h>
-extern int _mdb;
+extern std::atomic<int> _mdb;
 MidiSelectionModel::MidiSelectionModel(IMidiPlayerAuditionHostPtr aud) : auditionHost(aud)
 {
     ++_mdb;
@@ -39,6 +39,7 @@ void MidiSelectionModel::select(std::shared_ptr<MidiEvent> event)
 {
     selection.clear();
     assert(selection.empty());
+    ++version;
     add(event);
 }
 void MidiSelectionModel::extendSelection(std::shared_ptr<MidiEvent> event)
@@ -56,6 +57,7 @@ void MidiSelectionModel::addToSelection(std::shared_ptr<MidiEvent> event, bool k
 
     if (!keepExisting) {
         selection.clear();
+        ++version;
     }
     add(event);
 }
@@ -66,6 +68,7 @@ void MidiSelectionModel::removeFromSelection(std::shared_ptr<MidiEvent> event)
     assert(it != selection.end());
     if (it != selection.end()) {
         selection.erase(it);
+        ++version;
     }
 }
 
@@ -82,6 +85,7 @@ MidiSelectionModel::const_iterator MidiSelectionModel::end() const
 void MidiSelectionModel::clear()
 {
     selection.clear();
+    ++version;
 }
 
 void MidiSelectionModel::add(MidiEventPtr evt)
@@ -97,6 +101,7 @@ void MidiSelectionModel::add(MidiEventPtr evt)
         auditionHost->auditionNote(note->pitchCV);
     }
     selection.insert(evt);
+    ++version;
 }
 
 bool MidiSelectionModel::isSelected(MidiEventPtr evt) const
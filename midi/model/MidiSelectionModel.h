@@ -72,6 +72,15 @@ public:
 
     IMidiPlayerAuditionHostPtr _testGetAudition();
 
+    /**
+     * Changes every time the selection does, so the
+     * UI can tell when it needs to re-draw.
+     */
+    unsigned getVersion() const
+    {
+        return version;
+    }
+
 private:
 
     void add(std::shared_ptr<MidiEvent>);
@@ -80,4 +89,5 @@ private:
 
     IMidiPlayerAuditionHostPtr auditionHost;
     bool auditionSuppressed = false;
+    unsigned version = 0;
 };
@@ -5,7 +5,7 @@
 #include "TimeUtils.h"
 #include "UndoRedoStack.h"
 
-int _mdb = 0;       // global instance counter
+std::atomic<int> _mdb(0);       // global instance counter
 
 MidiSequencer::MidiSequencer(MidiSongPtr sng, ISeqSettingsPtr setp, IMidiPlayerAuditionHostPtr auditionHost) :
     selection(std::make_shared<MidiSelectionModel>(auditionHost)),
@@ -7,9 +7,15 @@
 MidiSong::MidiSong() : lock(std::make_shared<MidiLock>())
 {
     ++_mdb;
+    snapshotGeneration = 0;
+    lock->setEditorUnlockHandler([this]() {
+        publishSnapshots();
+    });
 }
 MidiSong::~MidiSong()
 {
+    // tracks may outlive us, and they share the lock
+    lock->setEditorUnlockHandler(nullptr);
     --_mdb;
 }
 
@@ -38,6 +44,8 @@ void MidiSong::addTrack(int index, std::shared_ptr<MidiTrack> track)
     assert(!tracks[index]);         // can only create at empty loc
 
     tracks[index] = track;
+    track->publishSnapshot();
+    ++snapshotGeneration;
 }
 
 void MidiSong::createTrack(int index)
@@ -84,6 +92,16 @@ void MidiSong::assertValid() const
     }
 }
 
+void MidiSong::publishSnapshots()
+{
+    for (auto track : tracks) {
+        if (track) {
+            track->publishSnapshot();
+        }
+    }
+    ++snapshotGeneration;
+}
+
 const SubrangeLoop& MidiSong::getSubrangeLoop()
 {
     return loop;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MidiTrack.h"
+#include <atomic>
 #include <vector>
 #include <memory>
 
@@ -43,6 +44,21 @@ public:
    
     void assertValid() const;
 
+    /**
+     * Makes the current contents of all the tracks available to the player.
+     * Called automatically whenever the editor unlocks the song.
+     */
+    void publishSnapshots();
+
+    /**
+     * Changes every time snapshots are published, or a track is added.
+     * Lets the player skip looking at every track when nothing has changed.
+     */
+    unsigned getSnapshotGeneration() const
+    {
+        return snapshotGeneration;
+    }
+
     /**
      * returns -1 if no tracks exist
      */
@@ -62,5 +78,6 @@ public:
 private:
     std::vector<std::shared_ptr<MidiTrack>> tracks;
     SubrangeLoop loop;
+    std::atomic<unsigned> snapshotGeneration;
 };
 
@@ -8,7 +8,7 @@
 
 
 #ifdef _DEBUG
-int MidiEvent::_count = 0;
+std::atomic<int> MidiEvent::_count(0);
 #endif
 
 MidiTrack::MidiTrack(std::shared_ptr<MidiLock> l) : lock(l)
@@ -51,6 +51,11 @@ void MidiTrack::assertValid() const
         // Check for indexing errors
         assertEQ(it->first, it->second->startTime);
     }
+    assertEQ(flatEvents.size(), size());
+    int index = 0;
+    for (const_iterator it = begin(); it != end(); ++it, ++index) {
+        assert(flatEvents[index].matches(*it->second));
+    }
     assert(lastIsEnd);
     assertEQ(numEnds, 1);
     assertLE(lastEnd, totalDur);
@@ -61,6 +66,26 @@ void MidiTrack::insertEvent(MidiEventPtr evIn)
     assert(lock);
     assert(lock->locked());
     events.insert(std::pair<MidiEvent::time_t, MidiEventPtr>(evIn->startTime, evIn));
+    flatEvents.insert(*evIn);
+    snapshotStale = true;
+}
+
+void MidiTrack::insertEvents(const std::vector<MidiEventPtr>& evs)
+{
+    assert(lock);
+    assert(lock->locked());
+    flatEvents.reserve(flatEvents.size() + int(evs.size()));
+    for (const MidiEventPtr& ev : evs) {
+        // Events after all the others go at the end, so the hint
+        // saves searching the map.
+        if (events.empty() || (ev->startTime >= events.rbegin()->first)) {
+            events.emplace_hint(events.end(), ev->startTime, ev);
+        } else {
+            events.insert(std::pair<MidiEvent::time_t, MidiEventPtr>(ev->startTime, ev));
+        }
+        flatEvents.insert(*ev);
+    }
+    snapshotStale = true;
 }
 
 float MidiTrack::getLength() const
@@ -87,6 +112,10 @@ void MidiTrack::deleteEvent(const MidiEvent& evIn)
 
         if (*it->second == evIn) {
             events.erase(it);
+            const bool found = flatEvents.erase(evIn);
+            assert(found);
+            (void) found;
+            snapshotStale = true;
             return;
         }
     }
@@ -96,6 +125,21 @@ void MidiTrack::deleteEvent(const MidiEvent& evIn)
     assert(false);          // If you get here it means the event to be deleted was not in the track
 }
 
+void MidiTrack::publishSnapshot()
+{
+    if (snapshotStale) {
+        snapshot.publish(std::make_shared<const MidiEventArray>(flatEvents));
+        snapshotStale = false;
+    } else {
+        snapshot.collect();
+    }
+}
+
+const MidiEventArray* MidiTrack::acquireSnapshot()
+{
+    return snapshot.acquire();
+}
+
 void MidiTrack::setLength(float newTrackLength)
 {
     assert(lock);
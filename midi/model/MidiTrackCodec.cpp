@@ -0,0 +1,326 @@
+#include "MidiLock.h"
+#include "MidiTrack.h"
+#include "MidiTrackCodec.h"
+#include "PitchUtils.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <string.h>
+
+/**
+ * Each event starts with a byte of these flags.
+ */
+static const uint8_t flagEnd = 1;
+static const uint8_t flagRawStart = 2;
+static const uint8_t flagRawDuration = 4;
+static const uint8_t flagRawPitch = 8;
+
+class CodecWriter
+{
+public:
+    std::vector<uint8_t> data;
+
+    void putByte(uint8_t x)
+    {
+        data.push_back(x);
+    }
+    void putVarint(uint64_t x)
+    {
+        while (x >= 0x80) {
+            data.push_back(uint8_t(x | 0x80));
+            x >>= 7;
+        }
+        data.push_back(uint8_t(x));
+    }
+    void putSigned(int64_t x)
+    {
+        // zig-zag, so small negative numbers are small too
+        putVarint((uint64_t(x) << 1) ^ uint64_t(x >> 63));
+    }
+    void putFloat(float x)
+    {
+        uint32_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+        for (int i = 0; i < 4; ++i) {
+            data.push_back(uint8_t(bits >> (8 * i)));
+        }
+    }
+};
+
+class CodecReader
+{
+public:
+    CodecReader(const std::vector<uint8_t>& d) : data(d)
+    {
+    }
+
+    bool ok = true;
+
+    uint8_t getByte()
+    {
+        if (pos >= data.size()) {
+            ok = false;
+            return 0;
+        }
+        return data[pos++];
+    }
+    uint64_t getVarint()
+    {
+        uint64_t ret = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const uint8_t x = getByte();
+            ret |= uint64_t(x & 0x7f) << shift;
+            if (!(x & 0x80)) {
+                return ret;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+    int64_t getSigned()
+    {
+        const uint64_t x = getVarint();
+        return int64_t(x >> 1) ^ -int64_t(x & 1);
+    }
+    float getFloat()
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; ++i) {
+            bits |= uint32_t(getByte()) << (8 * i);
+        }
+        float ret;
+        memcpy(&ret, &bits, sizeof(ret));
+        return ret;
+    }
+    size_t remaining() const
+    {
+        return data.size() - pos;
+    }
+private:
+    const std::vector<uint8_t>& data;
+    size_t pos = 0;
+};
+
+static float ticksToTime(int64_t ticks)
+{
+    return float(double(ticks) / MidiTrackCodec::ticksPerQuarter);
+}
+
+/**
+ * If time is exactly on a tick, sets ticks and returns true.
+ */
+static bool timeToTicks(float time, int64_t& ticks)
+{
+    if (!std::isfinite(time) || std::abs(time) > 1e9) {
+        return false;
+    }
+    ticks = int64_t(std::round(double(time) * MidiTrackCodec::ticksPerQuarter));
+    return ticksToTime(ticks) == time;
+}
+
+static float semitoneToCV(int64_t semis)
+{
+    // floor, so that negative pitches are right
+    const int64_t octave = (semis >= 0) ? semis / 12 : -((11 - semis) / 12);
+    return PitchUtils::pitchToCV(int(octave), int(semis - octave * 12));
+}
+
+/**
+ * If cv is exactly on a semitone, sets semis and returns true.
+ */
+static bool cvToSemitone(float cv, int64_t& semis)
+{
+    if (!std::isfinite(cv) || std::abs(cv) > 1000) {
+        return false;
+    }
+    semis = PitchUtils::cvToSemitone(cv);
+    return semitoneToCV(semis) == cv;
+}
+
+std::string MidiTrackCodec::encode(const MidiTrack& track)
+{
+    const MidiEventArray& events = track.getFlatEvents();
+    CodecWriter w;
+    w.data.reserve(8 + events.size() * 4);
+    w.putVarint(version);
+    w.putVarint(ticksPerQuarter);
+    w.putVarint(events.size());
+
+    int64_t lastStart = 0;
+    int64_t lastPitch = 0;
+    for (const MidiEventArray::Record& event : events) {
+        assert(event.type == MidiEvent::Type::Note || event.type == MidiEvent::Type::End);
+        const bool isEnd = event.type == MidiEvent::Type::End;
+        int64_t start = 0, duration = 0, pitch = 0;
+        uint8_t flags = isEnd ? flagEnd : 0;
+        if (!timeToTicks(event.startTime, start)) {
+            flags |= flagRawStart;
+        }
+        if (!isEnd) {
+            if (!timeToTicks(event.duration, duration) || duration < 0) {
+                flags |= flagRawDuration;
+            }
+            if (!cvToSemitone(event.pitchCV, pitch)) {
+                flags |= flagRawPitch;
+            }
+        }
+
+        w.putByte(flags);
+        if (flags & flagRawStart) {
+            w.putFloat(event.startTime);
+        } else {
+            w.putSigned(start - lastStart);
+            lastStart = start;
+        }
+        if (!isEnd) {
+            if (flags & flagRawDuration) {
+                w.putFloat(event.duration);
+            } else {
+                w.putVarint(duration);
+            }
+            if (flags & flagRawPitch) {
+                w.putFloat(event.pitchCV);
+            } else {
+                w.putSigned(pitch - lastPitch);
+                lastPitch = pitch;
+            }
+        }
+    }
+    return toBase64(w.data);
+}
+
+MidiTrackPtr MidiTrackCodec::decode(const std::string& text, std::shared_ptr<MidiLock> lock)
+{
+    std::vector<uint8_t> data;
+    if (!fromBase64(text, data)) {
+        return nullptr;
+    }
+    CodecReader r(data);
+    const uint64_t dataVersion = r.getVarint();
+    const uint64_t dataTicksPerQuarter = r.getVarint();
+    const uint64_t count = r.getVarint();
+
+    // every event is at least two bytes, so a bigger count must be junk.
+    if (!r.ok || dataVersion < 1 || dataVersion > version ||
+        dataTicksPerQuarter != ticksPerQuarter || count > r.remaining() / 2) {
+        return nullptr;
+    }
+
+    std::vector<MidiEventPtr> events;
+    events.reserve(count);
+    int64_t lastStart = 0;
+    int64_t lastPitch = 0;
+    for (uint64_t i = 0; i < count && r.ok; ++i) {
+        const uint8_t flags = r.getByte();
+        float start;
+        if (flags & flagRawStart) {
+            start = r.getFloat();
+        } else {
+            lastStart += r.getSigned();
+            start = ticksToTime(lastStart);
+        }
+
+        if (flags & flagEnd) {
+            MidiEndEventPtr end = std::make_shared<MidiEndEvent>();
+            end->startTime = start;
+            events.push_back(end);
+        } else {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = start;
+            note->duration = (flags & flagRawDuration) ? r.getFloat() : ticksToTime(r.getVarint());
+            if (flags & flagRawPitch) {
+                note->pitchCV = r.getFloat();
+            } else {
+                lastPitch += r.getSigned();
+                note->pitchCV = semitoneToCV(lastPitch);
+            }
+            events.push_back(note);
+        }
+    }
+    if (!r.ok || r.remaining()) {
+        return nullptr;
+    }
+
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    track->insertEvents(events);
+    return track;
+}
+
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string MidiTrackCodec::toBase64(const std::vector<uint8_t>& data)
+{
+    std::string ret;
+    ret.reserve(((data.size() + 2) / 3) * 4);
+    for (size_t i = 0; i < data.size(); i += 3) {
+        const size_t n = std::min(data.size() - i, size_t(3));
+        uint32_t x = uint32_t(data[i]) << 16;
+        if (n > 1) {
+            x |= uint32_t(data[i + 1]) << 8;
+        }
+        if (n > 2) {
+            x |= data[i + 2];
+        }
+        ret.push_back(base64Chars[(x >> 18) & 63]);
+        ret.push_back(base64Chars[(x >> 12) & 63]);
+        ret.push_back((n > 1) ? base64Chars[(x >> 6) & 63] : '=');
+        ret.push_back((n > 2) ? base64Chars[x & 63] : '=');
+    }
+    return ret;
+}
+
+/**
+ * Maps characters back to their six bit values, or -1 if not base64.
+ */
+class Base64Table
+{
+public:
+    Base64Table()
+    {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = -1;
+        }
+        for (int i = 0; i < 64; ++i) {
+            values[uint8_t(base64Chars[i])] = int8_t(i);
+        }
+    }
+    int8_t values[256];
+};
+
+bool MidiTrackCodec::fromBase64(const std::string& text, std::vector<uint8_t>& data)
+{
+    static const Base64Table table;
+
+    data.clear();
+    if (text.size() % 4) {
+        return false;
+    }
+    const size_t pad = text.empty() ? 0 :
+        (text[text.size() - 1] == '=') + (text[text.size() - 2] == '=');
+    data.resize((text.size() / 4) * 3);
+
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(text.data());
+    uint8_t* out = data.data();
+    for (size_t i = 0; i < text.size(); i += 4) {
+        const bool last = (i + 4 == text.size());
+        uint32_t x = 0;
+        int check = 0;
+        for (int j = 0; j < 4; ++j) {
+            // padding decodes as zero
+            const int value = (last && j >= 4 - int(pad)) ? 0 : table.values[in[i + j]];
+            check |= value;
+            x = (x << 6) | uint32_t(value & 63);
+        }
+        // any -1 will have set the sign bit
+        if (check < 0) {
+            data.clear();
+            return false;
+        }
+        *out++ = uint8_t(x >> 16);
+        *out++ = uint8_t(x >> 8);
+        *out++ = uint8_t(x);
+    }
+    data.resize(data.size() - pad);
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class MidiLock;
+class MidiTrack;
+
+/**
+ * Compact text encoding of a MidiTrack, for saving in patches.
+ *
+ * Much smaller and faster than one JSON object per note. Times are
+ * stored as deltas in ticks, and pitches as deltas in semitones, both as varints.
+ * Values that don't land exactly on a tick or a semitone are stored as raw floats,
+ * so decode(encode(x)) always gives back exactly the same track.
+ *
+ * The binary data is base64 encoded, so it can go right into a JSON string.
+ * It starts with a version number, so old patches can still be read if the format changes.
+ */
+class MidiTrackCodec
+{
+public:
+    static const int version = 1;
+    static const int ticksPerQuarter = 3840;
+
+    static std::string encode(const MidiTrack&);
+
+    /**
+     * Returns nullptr if data is not a valid encoding, or is from
+     * a newer version than we know about.
+     * Lock must be held by the caller.
+     */
+    static std::shared_ptr<MidiTrack> decode(const std::string& data, std::shared_ptr<MidiLock>);
+
+    static std::string toBase64(const std::vector<uint8_t>&);
+
+    /**
+     * returns false if the string is not valid base64.
+     */
+    static bool fromBase64(const std::string&, std::vector<uint8_t>&);
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <stdint.h>
 #include <memory>
 #include <assert.h>
@@ -56,7 +57,7 @@ public:
 #endif
     }
 #ifdef _DEBUG
-    static int _count;      // for debugging - reference count
+    static std::atomic<int> _count;      // for debugging - reference count. Songs may be built on a worker thread.
 #endif
 
 protected:
@@ -6,7 +6,7 @@
 #include "NoteScreenScale.h"
 #include "TimeUtils.h"
 
-extern int _mdb;
+extern std::atomic<int> _mdb;
 
 MidiEditorContext::MidiEditorContext(MidiSongPtr song, ISeqSettingsPtr stt) : 
     _song(song),
@@ -0,0 +1,213 @@
+#include "ISeqSettings.h"
+#include "MidiEditorContext.h"
+#include "MidiSelectionModel.h"
+#include "MidiSequencer.h"
+#include "MidiSong.h"
+#include "NoteRenderCache.h"
+#include "NoteScreenScale.h"
+#include "PitchUtils.h"
+#include "TimeUtils.h"
+
+#include <unordered_set>
+
+bool NoteRenderCache::ViewKey::operator == (const ViewKey& other) const
+{
+    return startTime == other.startTime &&
+        endTime == other.endTime &&
+        pitchLow == other.pitchLow &&
+        pitchHigh == other.pitchHigh &&
+        width == other.width &&
+        height == other.height &&
+        scaler == other.scaler;
+}
+
+bool NoteRenderCache::GridKey::operator == (const GridKey& other) const
+{
+    return view == other.view &&
+        quarterNotesInGrid == other.quarterNotesInGrid &&
+        trackLength == other.trackLength;
+}
+
+bool NoteRenderCache::NotesKey::operator == (const NotesKey& other) const
+{
+    return view == other.view &&
+        song == other.song &&
+        track == other.track &&
+        songGeneration == other.songGeneration &&
+        selection == other.selection &&
+        selectionVersion == other.selectionVersion &&
+        hideSelection == other.hideSelection;
+}
+
+void NoteRenderCache::invalidate()
+{
+    valid = false;
+}
+
+void NoteRenderCache::update(MidiSequencer& seq, float width, float height, bool hideSelection)
+{
+    MidiEditorContext& context = *seq.context;
+    ViewKey view;
+    view.startTime = context.startTime();
+    view.endTime = context.endTime();
+    view.pitchLow = context.pitchLow();
+    view.pitchHigh = context.pitchHigh();
+    view.width = width;
+    view.height = height;
+    view.scaler = context.getScaler().get();
+    assert(view.scaler);
+
+    MidiTrackPtr track = context.getTrack();
+    GridKey grid;
+    grid.view = view;
+    grid.quarterNotesInGrid = context.settings()->getQuarterNotesInGrid();
+    grid.trackLength = track->getLength();
+
+    NotesKey notes;
+    notes.view = view;
+    notes.song = seq.song.get();
+    notes.track = track.get();
+    notes.songGeneration = seq.song->getSnapshotGeneration();
+    notes.selection = seq.selection.get();
+    notes.selectionVersion = seq.selection->getVersion();
+    notes.hideSelection = hideSelection;
+
+    if (!valid || !(backgroundKey == view)) {
+        backgroundKey = view;
+        buildBackground(seq, width, height);
+    }
+    if (!valid || !(gridKey == grid)) {
+        gridKey = grid;
+        buildGrid(seq, height, grid.trackLength);
+    }
+    if (!valid || !(notesKey == notes)) {
+        notesKey = notes;
+        buildNotes(seq, hideSelection);
+    }
+    valid = true;
+}
+
+void NoteRenderCache::buildBackground(MidiSequencer& seq, float width, float height)
+{
+    ++buildCount;
+    MidiEditorContext& context = *seq.context;
+    const NoteScreenScale& scaler = *context.getScaler();
+    std::vector<Rect>& accidentals = layer(Layer::AccidentalBackground);
+    std::vector<Rect>& cLines = layer(Layer::CLine);
+    accidentals.clear();
+    cLines.clear();
+
+    const int noteHeight = int(scaler.noteHeight());
+    for (float cv = context.pitchLow();
+        cv <= context.pitchHigh();
+        cv += PitchUtils::semitone) {
+
+        const float y = scaler.midiCvToY(cv);
+        if (PitchUtils::isAccidental(cv)) {
+            accidentals.push_back({ 0, y, width, float(noteHeight) });
+        }
+
+        if (PitchUtils::isC(cv)) {
+            float lineY = y + scaler.noteHeight();
+            if (lineY > (height - .5)) {
+                lineY = lineY - 2;  // make sure  bottom line draws. Should really
+                                    // re-design the visuals here
+            }
+            cLines.push_back({ 0, lineY, width, 1 });
+        }
+    }
+}
+
+void NoteRenderCache::buildGrid(MidiSequencer& seq, float height, float endTime)
+{
+    ++buildCount;
+    MidiEditorContext& context = *seq.context;
+    const NoteScreenScale& scaler = *context.getScaler();
+    layer(Layer::Grid).clear();
+    layer(Layer::GridBar).clear();
+    layer(Layer::GridEnd).clear();
+
+    const float endX = scaler.midiTimeToX(endTime);
+    bool drewEnd = false;
+
+    //assume two bars, quarter note grid
+    const float totalDuration = TimeUtils::bar2time(2);
+    float deltaDuration = context.settings()->getQuarterNotesInGrid();
+
+    // if grid lines are too close together, don't draw all.
+    const float dx = scaler.midiTimeTodX(deltaDuration);
+    if (dx < 22) {
+        deltaDuration *= 2;
+    }
+
+    const float y = scaler.getTopMargin();
+    const float width = 1;
+    const float lineHeight = height - y;
+
+    for (float relTime = 0; relTime <= totalDuration; relTime += deltaDuration) {
+        const float time = relTime + context.startTime();
+        const float x = scaler.midiTimeToX(time);
+
+        const bool isBar = (relTime == 0) ||
+            (relTime == TimeUtils::bar2time(1)) ||
+            (relTime == TimeUtils::bar2time(2));
+
+        Layer l = isBar ? Layer::GridBar : Layer::Grid;
+        if (x == endX) {
+            l = Layer::GridEnd;
+            drewEnd = true;
+        }
+        layer(l).push_back({ x, y, width, lineHeight });
+    }
+
+    if (!drewEnd &&
+        endTime >= context.startTime() &&
+        endTime < context.endTime()) {
+        layer(Layer::GridEnd).push_back({ endX, y, width, lineHeight });
+    }
+}
+
+void NoteRenderCache::buildNotes(MidiSequencer& seq, bool hideSelection)
+{
+    ++buildCount;
+    MidiEditorContext& context = *seq.context;
+    const NoteScreenScale& scaler = *context.getScaler();
+    std::vector<Rect>& normal = layer(Layer::Note);
+    std::vector<Rect>& selected = layer(Layer::SelectedNote);
+    normal.clear();
+    selected.clear();
+
+    // MidiSelectionModel::isSelected is a linear search, so
+    // with a big selection it's much faster to look them all up here.
+    std::unordered_set<const MidiEvent*> selection;
+    for (auto ev : *seq.selection) {
+        selection.insert(ev.get());
+    }
+
+    const float startTime = context.startTime();
+    const int noteHeight = int(scaler.noteHeight());
+
+    // Get all the events on the screen, and go back two bar so we get tied notes.
+    // getEvents already culls by pitch.
+    MidiEditorContext::iterator_pair it = context.getEvents(8.f);
+    for (; it.first != it.second; ++it.first) {
+        const MidiEvent* ev = (*it.first).second.get();
+        const MidiNoteEvent* note = static_cast<const MidiNoteEvent*>(ev);
+
+        // ended before the screen starts
+        if (note->startTime + note->duration < startTime) {
+            continue;
+        }
+
+        const bool isSelected = selection.find(ev) != selection.end();
+        if (isSelected && hideSelection) {
+            continue;
+        }
+        const Rect rect = {
+            scaler.midiTimeToX(*note),
+            scaler.midiPitchToY(*note),
+            scaler.midiTimeTodX(note->duration),
+            float(noteHeight) };
+        (isSelected ? selected : normal).push_back(rect);
+    }
+}
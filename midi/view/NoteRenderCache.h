@@ -0,0 +1,132 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class MidiSequencer;
+class MidiSong;
+class MidiTrack;
+class MidiSelectionModel;
+class NoteScreenScale;
+
+/**
+ * Holds the screen geometry for the note editor, so that
+ * NoteDisplay doesn't have to work it out again every frame.
+ *
+ * The geometry is split into layers, one per color, so that each
+ * layer can be drawn as a single path.
+ *
+ * Each part (background, grid, notes) is only re-built when something
+ * it depends on changes:
+ *      background: the viewport and screen size.
+ *      grid: the viewport, the grid setting and the track length.
+ *      notes: the viewport, the song (any edit), and the selection.
+ *
+ * Notes are culled to the viewport by time and pitch, so dense
+ * passages off screen cost nothing.
+ */
+class NoteRenderCache
+{
+public:
+    struct Rect
+    {
+        float x;
+        float y;
+        float width;
+        float height;
+    };
+
+    enum class Layer
+    {
+        AccidentalBackground,
+        CLine,
+        Grid,
+        GridBar,
+        GridEnd,
+        Note,
+        SelectedNote,
+        NUM_LAYERS
+    };
+
+    /**
+     * Bring the geometry up to date with the sequencer.
+     * width and height are the size of the editor on screen.
+     * If hideSelection, selected notes are left out (because something else is drawing them).
+     */
+    void update(MidiSequencer& seq, float width, float height, bool hideSelection);
+
+    const std::vector<Rect>& getRects(Layer layer) const
+    {
+        return layers[int(layer)];
+    }
+
+    /**
+     * Force everything to re-build next update.
+     */
+    void invalidate();
+
+    /**
+     * How many times a part has been re-built. For testing.
+     */
+    int _getBuildCount() const
+    {
+        return buildCount;
+    }
+
+private:
+    std::vector<Rect> layers[int(Layer::NUM_LAYERS)];
+
+    /**
+     * What the screen looks at. If any of this changes,
+     * everything has to move.
+     */
+    class ViewKey
+    {
+    public:
+        float startTime = 0;
+        float endTime = 0;
+        float pitchLow = 0;
+        float pitchHigh = 0;
+        float width = 0;
+        float height = 0;
+        const NoteScreenScale* scaler = nullptr;
+        bool operator == (const ViewKey&) const;
+    };
+
+    class GridKey
+    {
+    public:
+        ViewKey view;
+        float quarterNotesInGrid = 0;
+        float trackLength = 0;
+        bool operator == (const GridKey&) const;
+    };
+
+    class NotesKey
+    {
+    public:
+        ViewKey view;
+        const MidiSong* song = nullptr;
+        const MidiTrack* track = nullptr;
+        unsigned songGeneration = 0;
+        const MidiSelectionModel* selection = nullptr;
+        unsigned selectionVersion = 0;
+        bool hideSelection = false;
+        bool operator == (const NotesKey&) const;
+    };
+
+    bool valid = false;
+    ViewKey backgroundKey;
+    GridKey gridKey;
+    NotesKey notesKey;
+    int buildCount = 0;
+
+    void buildBackground(MidiSequencer&, float width, float height);
+    void buildGrid(MidiSequencer&, float height, float trackLength);
+    void buildNotes(MidiSequencer&, bool hideSelection);
+
+    std::vector<Rect>& layer(Layer l)
+    {
+        return layers[int(l)];
+    }
+};
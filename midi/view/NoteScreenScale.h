@@ -63,6 +63,14 @@ public:
     float yToMidiDeltaCVPitch(float) const;
 
     bool isPointInBounds(float x, float y) const;
+
+    /**
+     * y of the top of the note area.
+     */
+    float getTopMargin() const
+    {
+        return topMargin;
+    }
 private:
     /** These are the linear equation coefficients
      * for mapping from music time/pitch to screen
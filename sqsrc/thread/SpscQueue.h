@@ -0,0 +1,101 @@
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <vector>
+
+/**
+ * Lock-free queue for one producer thread and one consumer thread.
+ *
+ * Like SqRingBuffer, it never allocates or frees after construction,
+ * so either side may be the audio thread. But unlike SqRingBuffer, push and pop
+ * may be called at the same time from different threads.
+ *
+ * Producer calls push, consumer calls pop and empty.
+ * Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    SpscQueue(int capacity);
+    SpscQueue(const SpscQueue&) = delete;
+    const SpscQueue& operator= (const SpscQueue&) = delete;
+
+    /**
+     * Returns false if the queue is full.
+     */
+    bool push(const T&);
+
+    /**
+     * Returns false if the queue is empty.
+     */
+    bool pop(T&);
+
+    bool empty() const;
+    int capacity() const
+    {
+        return int(memory.size());
+    }
+
+private:
+    std::vector<T> memory;
+    const unsigned mask;
+
+    /**
+     * These count forever, and wrap. Index is count & mask.
+     * Only the producer writes inCount, only the consumer writes outCount.
+     */
+    std::atomic<unsigned> inCount;
+    std::atomic<unsigned> outCount;
+
+    static unsigned roundUp(int);
+};
+
+template <typename T>
+inline unsigned SpscQueue<T>::roundUp(int x)
+{
+    assert(x > 0);
+    unsigned ret = 1;
+    while (ret < unsigned(x)) {
+        ret <<= 1;
+    }
+    return ret;
+}
+
+template <typename T>
+inline SpscQueue<T>::SpscQueue(int size) : memory(roundUp(size)), mask(roundUp(size) - 1)
+{
+    inCount = 0;
+    outCount = 0;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::push(const T& value)
+{
+    const unsigned in = inCount.load(std::memory_order_relaxed);
+    if (in - outCount.load(std::memory_order_acquire) >= memory.size()) {
+        return false;
+    }
+    memory[in & mask] = value;
+    inCount.store(in + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::pop(T& value)
+{
+    const unsigned out = outCount.load(std::memory_order_relaxed);
+    if (out == inCount.load(std::memory_order_acquire)) {
+        return false;
+    }
+    value = memory[out & mask];
+    outCount.store(out + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::empty() const
+{
+    return outCount.load(std::memory_order_relaxed) == inCount.load(std::memory_order_acquire);
+}
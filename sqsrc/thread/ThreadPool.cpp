@@ -0,0 +1,192 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+
+std::atomic<int> ThreadPool::_instanceCount;
+
+ThreadPoolClient::ThreadPoolClient(std::unique_ptr<ThreadPoolHandler> h, int size) :
+    ThreadPoolClient(std::move(h), size, ThreadPool::getShared())
+{
+}
+
+ThreadPoolClient::ThreadPoolClient(std::unique_ptr<ThreadPoolHandler> h, int size, std::shared_ptr<ThreadPool> p) :
+    pool(p),
+    handler(std::move(h)),
+    requests(size),
+    replies(size),
+    queueSize(size)
+{
+    assert(pool);
+    assert(handler);
+    claimed = false;
+    pool->addClient(this);
+}
+
+ThreadPoolClient::~ThreadPoolClient()
+{
+    pool->removeClient(this);
+}
+
+bool ThreadPoolClient::sendMessage(ThreadMessage* msg)
+{
+    // If we don't limit this, the workers could have no room for replies.
+    if (inPlay >= queueSize) {
+        return false;
+    }
+    const bool pushed = requests.push(msg);
+    assert(pushed);
+    (void) pushed;
+    ++inPlay;
+    pool->wakeWorker();
+    return true;
+}
+
+ThreadMessage* ThreadPoolClient::getMessage()
+{
+    ThreadMessage* msg = nullptr;
+    if (replies.pop(msg)) {
+        --inPlay;
+        assert(inPlay >= 0);
+    }
+    return msg;
+}
+
+/***********************************************************************/
+
+ThreadPool::ThreadPool(int numWorkers)
+{
+    ++_instanceCount;
+    sleepingWorkers = 0;
+    if (numWorkers <= 0) {
+        // leave a core for the audio thread, and don't take over the machine
+        const int cores = int(std::thread::hardware_concurrency());
+        numWorkers = std::max(1, std::min(4, cores - 1));
+    }
+    for (int i = 0; i < numWorkers; ++i) {
+        workers.push_back(std::unique_ptr<std::thread>(new std::thread([this]() {
+            this->workerFunction();
+        })));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    assert(clients.empty());
+    {
+        std::unique_lock<std::mutex> guard(mutex);
+        stopRequested = true;
+        condition.notify_all();
+    }
+    for (auto& worker : workers) {
+        worker->join();
+    }
+    --_instanceCount;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::getShared()
+{
+    static std::weak_ptr<ThreadPool> shared;
+    static std::mutex sharedMutex;
+
+    std::unique_lock<std::mutex> guard(sharedMutex);
+    std::shared_ptr<ThreadPool> ret = shared.lock();
+    if (!ret) {
+        ret = std::make_shared<ThreadPool>();
+        shared = ret;
+    }
+    return ret;
+}
+
+void ThreadPool::addClient(ThreadPoolClient* client)
+{
+    std::unique_lock<std::mutex> guard(mutex);
+    clients.push_back(client);
+}
+
+void ThreadPool::removeClient(ThreadPoolClient* client)
+{
+    {
+        std::unique_lock<std::mutex> guard(mutex);
+        auto it = std::find(clients.begin(), clients.end(), client);
+        assert(it != clients.end());
+        clients.erase(it);
+    }
+
+    // Now no worker can find us, but one may still be working for us.
+    while (client->claimed) {
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::wakeWorker()
+{
+    // Called from the audio thread, so we can't take the mutex.
+    // Notify without it is legal, but may be missed by a worker that is
+    // just about to wait. The workers don't sleep long, to cover that.
+    if (sleepingWorkers > 0) {
+        condition.notify_one();
+    }
+}
+
+ThreadPoolClient* ThreadPool::claimClientWithWork()
+{
+    const size_t num = clients.size();
+    for (size_t i = 0; i < num; ++i) {
+        const size_t index = (nextClient + i) % num;
+        ThreadPoolClient* client = clients[index];
+        if (client->requests.empty()) {
+            continue;
+        }
+        bool expected = false;
+        if (client->claimed.compare_exchange_strong(expected, true)) {
+            // another worker may have taken the request before we claimed it
+            if (!client->requests.empty()) {
+                nextClient = index + 1;
+                return client;
+            }
+            client->claimed = false;
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::workerFunction()
+{
+    std::unique_lock<std::mutex> guard(mutex);
+    while (!stopRequested) {
+        ThreadPoolClient* client = claimClientWithWork();
+        if (!client) {
+            // Say we are going to sleep before looking one last time, so that a
+            // client that sends after we look will know to wake us.
+            ++sleepingWorkers;
+            client = claimClientWithWork();
+            if (!client) {
+                condition.wait_for(guard, std::chrono::milliseconds(2));
+            }
+            --sleepingWorkers;
+            if (!client) {
+                continue;
+            }
+        }
+
+        // do the work without the mutex, so that other workers
+        // and clients aren't held up.
+        guard.unlock();
+
+        // Take everything that was queued when we started. Not more, so
+        // that one busy client can't keep us from the others.
+        ThreadMessage* msg = nullptr;
+        for (int count = client->queueSize; count > 0 && client->requests.pop(msg); --count) {
+            ThreadMessage* reply = client->handler->handleMessage(msg);
+            assert(reply);
+            const bool pushed = client->replies.push(reply);
+            assert(pushed);
+            (void) pushed;
+        }
+
+        client->claimed = false;
+        guard.lock();
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SpscQueue.h"
+
+class ThreadMessage;
+class ThreadPool;
+class ThreadPoolClient;
+
+/**
+ * A pool of worker threads shared by all the modules that
+ * need to do work off of the audio thread.
+ *
+ * Unlike ThreadServer, modules do not own a thread. Instead each module makes a
+ * ThreadPoolClient, with a ThreadPoolHandler to do its work.
+ *
+ * Basics of the protocol (the same as ThreadSharedState, except for the first):
+ *      Many messages may be "in play" at a time, up to the client's queue size.
+ *      Client initiates all communication.
+ *      For every message sent client -> handler, the handler will send one back.
+ *      The message objects are owned by whoever created them.
+ *      Messages from one client are handled one at a time, in the order sent.
+ *          So a handler does not need to be thread safe.
+ *      Messages from different clients may be handled at the same time
+ *          on different worker threads.
+ */
+class ThreadPoolHandler
+{
+public:
+    virtual ~ThreadPoolHandler()
+    {
+    }
+
+    /**
+     * This is called on a worker thread, not the audio thread.
+     * Message is not const, as handler is allowed to modify it.
+     * Returns the reply for the client - usually the same message.
+     */
+    virtual ThreadMessage* handleMessage(ThreadMessage*) = 0;
+};
+
+/**
+ * This class is meant to be used directly (not sub-classed), like ThreadClient.
+ * All APIs are non-blocking (polled), so that they may be called
+ * from an audio render thread without fear of priority inversion.
+ * Constructor and destructor may block, so call them from the UI thread.
+ */
+class ThreadPoolClient
+{
+public:
+    ThreadPoolClient(std::unique_ptr<ThreadPoolHandler> handler, int queueSize = 4);
+    ThreadPoolClient(std::unique_ptr<ThreadPoolHandler> handler, int queueSize, std::shared_ptr<ThreadPool> pool);
+    ~ThreadPoolClient();
+
+    /**
+     * Poll to see if a message has come back from the handler.
+     * Will return null if no message waiting.
+     */
+    ThreadMessage* getMessage();
+
+    /**
+     * Try to send a message.
+     * Returns false if the client already has queueSize messages
+     * in play (sent, but reply not received yet).
+     */
+    bool sendMessage(ThreadMessage*);
+
+    const ThreadPoolClient& operator= (const ThreadPoolClient&) = delete;
+    ThreadPoolClient(const ThreadPoolClient&) = delete;
+private:
+    friend class ThreadPool;
+    std::shared_ptr<ThreadPool> pool;
+    std::unique_ptr<ThreadPoolHandler> handler;
+
+    SpscQueue<ThreadMessage*> requests;
+    SpscQueue<ThreadMessage*> replies;
+
+    /**
+     * Set while a worker is servicing us. Only the worker that set it
+     * may pop requests or push replies.
+     */
+    std::atomic<bool> claimed;
+
+    /**
+     * Messages sent but not received back. Only touched by the client.
+     */
+    int inPlay = 0;
+    const int queueSize;
+};
+
+class ThreadPool
+{
+public:
+    /**
+     * numWorkers == 0 picks a reasonable number for this machine.
+     */
+    ThreadPool(int numWorkers = 0);
+    ~ThreadPool();
+
+    const ThreadPool& operator= (const ThreadPool&) = delete;
+    ThreadPool(const ThreadPool&) = delete;
+
+    /**
+     * The pool shared by all modules. Like ObjectCache, it only stays
+     * alive as long as someone holds a reference.
+     */
+    static std::shared_ptr<ThreadPool> getShared();
+
+    int getNumWorkers() const
+    {
+        return int(workers.size());
+    }
+
+    static std::atomic<int> _instanceCount;
+private:
+    friend class ThreadPoolClient;
+
+    std::vector<std::unique_ptr<std::thread>> workers;
+    std::vector<ThreadPoolClient*> clients;
+
+    /**
+     * Protects clients, and the condition that the workers sleep on.
+     */
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopRequested = false;
+
+    /**
+     * So that clients only pay for a notify when someone is waiting.
+     */
+    std::atomic<int> sleepingWorkers;
+
+    /**
+     * Where the next worker starts looking for work, so that
+     * busy clients don't starve the others.
+     */
+    size_t nextClient = 0;
+
+    void addClient(ThreadPoolClient*);
+    void removeClient(ThreadPoolClient*);
+    void wakeWorker();
+
+    void workerFunction();
+    ThreadPoolClient* claimClientWithWork();
+};
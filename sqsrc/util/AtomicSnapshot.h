@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * RCU style hand-off of immutable snapshots from one writer thread
+ * (usually the UI) to one reader thread (usually audio).
+ *
+ * The writer publishes a new version whenever it likes. It never waits for the reader.
+ * The reader picks up the newest version with acquire(). It never blocks, allocates or frees.
+ *
+ * The reader marks the version it is using (a hazard pointer), and may keep using
+ * it until the next acquire() or release(), even after newer versions are published.
+ * Old versions are freed by the writer in publish() or collect(), once the reader
+ * has moved past them. So versions are never freed on the reader's thread.
+ */
+template <typename T>
+class AtomicSnapshot
+{
+public:
+    using Ptr = std::shared_ptr<const T>;
+
+    AtomicSnapshot();
+    AtomicSnapshot(const AtomicSnapshot&) = delete;
+    AtomicSnapshot& operator = (const AtomicSnapshot&) = delete;
+
+    /**
+     * writer: make a new version available to the reader.
+     */
+    void publish(Ptr);
+
+    /**
+     * writer: free any old versions that the reader is done with.
+     */
+    void collect();
+
+    /**
+     * writer: the last version published.
+     */
+    Ptr getPublished() const
+    {
+        return published;
+    }
+
+    /**
+     * reader: get the newest version, and mark it as in use.
+     * Returns nullptr if nothing has been published.
+     */
+    const T* acquire();
+
+    /**
+     * reader: done with the version from the last acquire().
+     */
+    void release();
+
+    int _retiredCount() const
+    {
+        return int(retired.size());
+    }
+private:
+    std::atomic<const T*> current;
+    std::atomic<const T*> inUse;
+
+    /**
+     * These are only touched by the writer.
+     */
+    Ptr published;
+    std::vector<Ptr> retired;
+};
+
+template <typename T>
+inline AtomicSnapshot<T>::AtomicSnapshot()
+{
+    current = nullptr;
+    inUse = nullptr;
+}
+
+template <typename T>
+inline void AtomicSnapshot<T>::publish(Ptr p)
+{
+    current = p.get();
+    if (published) {
+        retired.push_back(published);
+    }
+    published = p;
+    collect();
+}
+
+template <typename T>
+inline void AtomicSnapshot<T>::collect()
+{
+    // Once current has moved on, the reader can only get an old version
+    // by having marked it in use before we look here.
+    const T* busy = inUse;
+    retired.erase(std::remove_if(retired.begin(), retired.end(), [busy](const Ptr& p) {
+        return p.get() != busy;
+        }), retired.end());
+}
+
+template <typename T>
+inline const T* AtomicSnapshot<T>::acquire()
+{
+    const T* p;
+    do {
+        p = current;
+        inUse = p;
+        // If the writer published while we were doing this, it may
+        // not have seen our mark, so try again.
+    } while (p != current);
+    return p;
+}
+
+template <typename T>
+inline void AtomicSnapshot<T>::release()
+{
+    inUse = nullptr;
+}
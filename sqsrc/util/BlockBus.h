@@ -0,0 +1,275 @@
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <cstdint>
+#include <emmintrin.h>
+#include <xmmintrin.h>
+
+/**
+ * Block transfer of the mixer busses, for long chains of mixers.
+ *
+ * With the normal (per sample) bus every mixer adds its busses to the ones
+ * it got from the left, and passes the sum to the right through the expander
+ * message. VCV only hands messages over once per sample, so every mixer in the
+ * chain adds a sample of delay, and each mixer's audio arrives at the
+ * master with a different delay.
+ *
+ * With the block bus each expander writes its own busses into a slot of
+ * this shared object, one block at a time. At the start of each block the
+ * master sums all the slots that have a whole block in them, with SSE,
+ * and plays that back over the next block. So the audio from every expander
+ * is late by exactly blockSize samples, no matter how long the chain is.
+ *
+ * The slots are double buffered: expanders fill one half while the master
+ * reads the other. VCV finishes every module's process before it starts the
+ * next sample, so there are never readers and writers on the same half.
+ * This only works if all the modules agree on the frame number; BlockBusPort
+ * takes care of that by passing it along the chain.
+ *
+ * There is one of these, owned by the master, and expanders get it through
+ * SharedSoloStateOwner.
+ */
+class BlockBus
+{
+public:
+    static const int blockSize = 32;
+    static const int numBusses = 6;         // master, aux A, aux B. Stereo.
+    static const int frameStride = 8;       // busses padded to two SSE vectors
+    static const int maxSlots = 16;         // same as SharedSoloState::maxModules
+
+    /**
+     * Called by the master, from the audio thread.
+     * Expanders pick up the change at the start of their next block.
+     */
+    void setEnabled(bool b)
+    {
+        enabled.store(b, std::memory_order_relaxed);
+    }
+    bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Expander puts one frame of its busses into its slot.
+     * busses must have frameStride floats, the last two zero.
+     */
+    void write(int slot, uint32_t frame, const float* busses);
+
+    /**
+     * Master gets the sum of all the slots for one frame.
+     * The busses it returns came from frame - blockSize.
+     */
+    const float* read(uint32_t frame);
+
+    /**
+     * Number of slots that made it into the last block the master summed.
+     */
+    int getNumActive() const
+    {
+        return numActive;
+    }
+
+private:
+    class Slot
+    {
+    public:
+        float data[2][blockSize * frameStride] = {{0}};
+
+        // block number + 1 of the block being written and the last complete one.
+        // zero means none
+        uint32_t started = 0;
+        std::atomic<uint32_t> done = {0};
+    };
+
+    std::atomic<bool> enabled = {false};
+    Slot slots[maxSlots];
+
+    // only the master touches these
+    float sum[blockSize * frameStride] = {0};
+    int numActive = 0;
+
+    void sumBlock(uint32_t block);
+};
+
+inline void BlockBus::write(int slot, uint32_t frame, const float* busses)
+{
+    assert(slot > 0 && slot < maxSlots);
+    const uint32_t block = frame / blockSize;
+    const int pos = frame % blockSize;
+    Slot& s = slots[slot];
+
+    if (pos == 0) {
+        s.started = block + 1;
+    }
+
+    float* dest = s.data[block & 1] + pos * frameStride;
+    _mm_storeu_ps(dest, _mm_loadu_ps(busses));
+    _mm_storeu_ps(dest + 4, _mm_loadu_ps(busses + 4));
+
+    // only finish the block if we wrote all of it
+    if ((pos == blockSize - 1) && (s.started == block + 1)) {
+        s.done.store(block + 1, std::memory_order_relaxed);
+    }
+}
+
+inline const float* BlockBus::read(uint32_t frame)
+{
+    const int pos = frame % blockSize;
+    if (pos == 0) {
+        // unsigned math so this is still right when frame wraps
+        sumBlock((frame - blockSize) / blockSize);
+    }
+    return sum + pos * frameStride;
+}
+
+inline void BlockBus::sumBlock(uint32_t block)
+{
+    const int size = blockSize * frameStride;
+    numActive = 0;
+    for (int i = 0; i < size; ++i) {
+        sum[i] = 0;
+    }
+
+    for (int slot = 1; slot < maxSlots; ++slot) {
+        const Slot& s = slots[slot];
+        if (s.done.load(std::memory_order_relaxed) != block + 1) {
+            continue;
+        }
+        ++numActive;
+        const float* src = s.data[block & 1];
+        for (int i = 0; i < size; i += 8) {
+            const __m128 a = _mm_add_ps(_mm_loadu_ps(sum + i), _mm_loadu_ps(src + i));
+            const __m128 b = _mm_add_ps(_mm_loadu_ps(sum + i + 4), _mm_loadu_ps(src + i + 4));
+            _mm_storeu_ps(sum + i, a);
+            _mm_storeu_ps(sum + i + 4, b);
+        }
+    }
+}
+
+/**
+ * The per-module end of the mixer bus. MixerModule calls this every sample,
+ * and it decides where the composite gets its expansion input, and where
+ * its expansion output goes.
+ *
+ * It also keeps the frame number in step along the chain: each module
+ * takes the number from the one on its left and adds one. The message
+ * from the left is a sample old, so everyone ends up with the same number.
+ *
+ * buffers are the right expander messages (see CommChannels.h).
+ */
+class BlockBusPort
+{
+public:
+    /**
+     * Call before the mixer runs.
+     * @param fromLeft is the left module's right consumer message, or null.
+     * @param toRight is our right producer message, or null.
+     * @param bus is the shared bus, if we have one yet.
+     * @param moduleIndex is our index in SharedSoloState.
+     */
+    void prepare(const float* fromLeft, float* toRight, BlockBus* bus, int moduleIndex, bool isMaster);
+
+    /**
+     * Where the mixer should get its expansion input, and send its
+     * expansion output. Either may be null.
+     */
+    const float* getInput() const
+    {
+        return input;
+    }
+    float* getOutput() const
+    {
+        return output;
+    }
+
+    /**
+     * Call after the mixer runs.
+     */
+    void finish();
+
+    uint32_t getFrame() const
+    {
+        return frame;
+    }
+    bool isBlockMode() const
+    {
+        return blockMode;
+    }
+
+    static const int frameOffset = 9;           // where the frame number goes in the message
+
+private:
+    uint32_t frame = 0;
+    bool blockMode = false;
+
+    const float* fromLeft = nullptr;
+    float* toRight = nullptr;
+    BlockBus* bus = nullptr;
+    int moduleIndex = -1;
+
+    const float* input = nullptr;
+    float* output = nullptr;
+
+    float busses[BlockBus::frameStride] = {0};
+};
+
+inline void BlockBusPort::prepare(const float* left, float* right, BlockBus* b, int index, bool isMaster)
+{
+    fromLeft = left;
+    toRight = right;
+    bus = b;
+    moduleIndex = index;
+
+    if (fromLeft) {
+        frame = reinterpret_cast<const uint32_t*>(fromLeft)[frameOffset] + 1;
+    } else {
+        ++frame;
+    }
+    if (toRight) {
+        reinterpret_cast<uint32_t*>(toRight)[frameOffset] = frame;
+    }
+
+    // only turn on at a block boundary, so we never send half a block.
+    // but if we lose the bus we have to stop right away.
+    const bool canUseBus = !isMaster && bus && (moduleIndex > 0) && (moduleIndex < BlockBus::maxSlots);
+    if (!canUseBus) {
+        blockMode = false;
+    } else if ((frame % BlockBus::blockSize) == 0) {
+        blockMode = bus->isEnabled();
+    }
+
+    if (isMaster && bus) {
+        // master always listens to the block bus. slots that aren't
+        // in use don't get summed, so it costs almost nothing when off.
+        const float* blockSum = bus->read(frame);
+        for (int i = 0; i < BlockBus::numBusses; ++i) {
+            busses[i] = blockSum[i] + (fromLeft ? fromLeft[i] : 0);
+        }
+        input = busses;
+        output = nullptr;
+    } else if (blockMode) {
+        // the mixer only sends its own channels, and the ones from the left
+        // get passed through in finish (in case the left module isn't using
+        // the block bus yet).
+        input = nullptr;
+        output = busses;
+    } else {
+        input = fromLeft;
+        output = toRight;
+    }
+}
+
+inline void BlockBusPort::finish()
+{
+    if (!blockMode) {
+        return;
+    }
+    bus->write(moduleIndex, frame, busses);
+    if (toRight) {
+        for (int i = 0; i < BlockBus::numBusses; ++i) {
+            toRight[i] = fromLeft ? fromLeft[i] : 0;
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AtomicRingBuffer.h"
+#include "BlockBus.h"
 
 #include <cstdint>
 #include <atomic>
@@ -24,6 +25,10 @@
  *  buffer[5] = right aux B bus
  *  buffer[6] = commands id
  *  buffer[7, 8] = commands payload
+ *  buffer[9] = frame number, so the block bus can keep the modules in step
+ *
+ * When the block bus is on, expanders put their own busses in BlockBus instead,
+ * and only pass through what they get from the left.
  * 
  * going right to left, only commands are sent:
  *  buffer[0] = command id
@@ -31,9 +36,10 @@
  * 
  */
 
-const int comBufferSizeRight = 9;
+const int comBufferSizeRight = 10;
 const int comBufferRightCommandIdOffset = 6;
 const int comBufferRightCommandDataOffset = 7;
+const int comBufferRightFrameOffset = BlockBusPort::frameOffset;
 
 const int comBufferSizeLeft = 3;
 const int comBufferLeftCommandIdOffset = 0;
@@ -173,8 +179,10 @@ class SharedSoloStateOwner
 public:
     SharedSoloStateOwner() {
         state = std::make_shared<SharedSoloState>();
+        blockBus = std::make_shared<BlockBus>();
     }
     std::shared_ptr<SharedSoloState> state;
+    std::shared_ptr<BlockBus> blockBus;
 };
  
 class SharedSoloStateClient
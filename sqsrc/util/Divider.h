@@ -1,6 +1,7 @@
 #pragma once
 
 #include <assert.h>
+#include <algorithm>
 #include <functional>
 
 /**
@@ -29,6 +30,22 @@ public:
         }
     }
 
+    /**
+     * Block processing version of step().
+     * Does a step() for the first sample, then claims as many of the
+     * following samples as can go by without calling the lambda.
+     *
+     * returns the number of samples claimed (1..maxSamples).
+     */
+    int stepBlock(int maxSamples)
+    {
+        assert(maxSamples > 0);
+        step();
+        const int samples = std::min(maxSamples, counter);
+        counter -= (samples - 1);
+        return samples;
+    }
+
     int getDiv() const
     {
         return divisor;
@@ -0,0 +1,118 @@
+#include "DspTiming.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> DspTiming::enabled = {false};
+
+class DspTimingEntry
+{
+public:
+    const void* owner;
+    DspTimingStats* stats;
+};
+
+static std::mutex& getMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<DspTimingEntry>& getEntries()
+{
+    static std::vector<DspTimingEntry> entries;
+    return entries;
+}
+
+void DspTiming::setEnabled(bool b)
+{
+    if (b && !isEnabled()) {
+        // start fresh, so the numbers don't include the
+        // last time it was on
+        resetAll();
+    }
+    enabled.store(b, std::memory_order_relaxed);
+}
+
+void DspTiming::add(const void* owner, DspTimingStats* stats)
+{
+    assert(owner && stats);
+    std::lock_guard<std::mutex> lock(getMutex());
+    getEntries().push_back({owner, stats});
+}
+
+void DspTiming::remove(const void* owner)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    auto& entries = getEntries();
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [owner](const DspTimingEntry& e) {
+        return e.owner == owner;
+        }), entries.end());
+}
+
+bool DspTiming::read(const void* owner, DspTimingStats::Snapshot& out)
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    for (auto& e : getEntries()) {
+        if (e.owner == owner) {
+            out = e.stats->read();
+            return true;
+        }
+    }
+    return false;
+}
+
+void DspTiming::resetAll()
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    for (auto& e : getEntries()) {
+        e.stats->requestReset();
+    }
+}
+
+int DspTiming::size()
+{
+    std::lock_guard<std::mutex> lock(getMutex());
+    return int(getEntries().size());
+}
+
+void DspTiming::writeReport(FILE* out, float sampleRate, std::function<std::string(const void* owner)> getName)
+{
+    class Line
+    {
+    public:
+        const void* owner;
+        DspTimingStats::Snapshot data;
+    };
+    std::vector<Line> lines;
+    {
+        std::lock_guard<std::mutex> lock(getMutex());
+        for (auto& e : getEntries()) {
+            lines.push_back({e.owner, e.stats->read()});
+        }
+    }
+    std::sort(lines.begin(), lines.end(), [](const Line& a, const Line& b) {
+        return a.data.meanNs() > b.data.meanNs();
+        });
+
+    fprintf(out, "DSP time per sample at %.0f Hz%s\n", sampleRate, isEnabled() ? "" : " (timing is off)");
+    fprintf(out, "%-32s %12s %10s %10s %10s %10s %8s\n",
+        "module", "samples", "mean us", "median us", "99% us", "max us", "% cpu");
+    double totalPercent = 0;
+    for (auto& line : lines) {
+        const DspTimingStats::Snapshot& d = line.data;
+        const double percent = d.percentOfSample(sampleRate);
+        totalPercent += percent;
+        fprintf(out, "%-32s %12llu %10.3f %10.3f %10.3f %10.3f %8.3f\n",
+            getName(line.owner).c_str(),
+            (unsigned long long) d.count,
+            d.meanNs() * .001,
+            d.percentileNs(.5) * .001,
+            d.percentileNs(.99) * .001,
+            d.maxNs * .001,
+            percent);
+    }
+    fprintf(out, "total %.3f%% of one core\n", totalPercent);
+    fflush(out);
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+/**
+ * Timing statistics for code that runs on the audio thread.
+ *
+ * The audio thread is the only writer. It never locks, allocates or prints,
+ * it just bumps some atomic counters (relaxed, so on x86 they are plain
+ * loads and stores). Any other thread may read them at any time. A reading
+ * may be a sample or so out of sync between the counters, which doesn't
+ * matter for statistics.
+ *
+ * Times go into a histogram with one bucket per power of two nanoseconds,
+ * so we can get percentiles without keeping the individual times.
+ */
+class DspTimingStats
+{
+public:
+    /**
+     * Bucket i holds times from 2**i to 2**(i+1) - 1 nanoseconds.
+     * The last one also holds anything longer.
+     */
+    static const int numBuckets = 32;
+
+    class Snapshot
+    {
+    public:
+        uint64_t count = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        uint64_t buckets[numBuckets] = {0};
+
+        double meanNs() const;
+
+        /**
+         * Returns the upper edge of the bucket that holds
+         * the p'th percentile. p is 0..1.
+         */
+        double percentileNs(double p) const;
+
+        /**
+         * The average time, as a percent of the time
+         * between samples.
+         */
+        double percentOfSample(float sampleRate) const;
+    };
+
+    /**
+     * Audio thread only.
+     */
+    void record(uint64_t ns);
+
+    /**
+     * Any thread.
+     */
+    Snapshot read() const;
+
+    /**
+     * Any thread. The audio thread will clear everything
+     * the next time it records.
+     */
+    void requestReset()
+    {
+        resetRequested.store(true, std::memory_order_release);
+    }
+
+    static int getBucket(uint64_t ns);
+
+private:
+    std::atomic<uint64_t> count = {0};
+    std::atomic<uint64_t> totalNs = {0};
+    std::atomic<uint64_t> maxNs = {0};
+    std::atomic<uint64_t> buckets[numBuckets];
+    std::atomic<bool> resetRequested = {true};
+
+    static void bump(std::atomic<uint64_t>& x, uint64_t amount)
+    {
+        x.store(x.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Global switch, and a registry of every DspTimingStats so
+ * they can all be reported at once.
+ *
+ * Only isEnabled() may be called from the audio thread. Everything
+ * else takes a lock, and is for the UI or a worker thread.
+ */
+class DspTiming
+{
+public:
+    static bool isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    static void setEnabled(bool);
+
+    /**
+     * owner is any unique id, usually the module.
+     */
+    static void add(const void* owner, DspTimingStats*);
+    static void remove(const void* owner);
+
+    /**
+     * Returns false if owner isn't registered.
+     */
+    static bool read(const void* owner, DspTimingStats::Snapshot& out);
+
+    static void resetAll();
+    static int size();
+
+    /**
+     * Writes a line for every owner, busiest first.
+     * getName turns an owner into something readable.
+     */
+    static void writeReport(FILE*, float sampleRate, std::function<std::string(const void* owner)> getName);
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+/**
+ * Times its own lifetime, if timing is enabled.
+ * When it's not, this costs one relaxed load and a branch.
+ */
+class DspTimingScope
+{
+public:
+    DspTimingScope(DspTimingStats& s) :
+        stats(DspTiming::isEnabled() ? &s : nullptr)
+    {
+        if (stats) {
+            start = now();
+        }
+    }
+    ~DspTimingScope()
+    {
+        if (stats) {
+            stats->record(now() - start);
+        }
+    }
+private:
+    DspTimingStats* const stats;
+    uint64_t start = 0;
+
+    static uint64_t now()
+    {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+inline int DspTimingStats::getBucket(uint64_t ns)
+{
+    int bucket = 0;
+    while (ns > 1 && bucket < numBuckets - 1) {
+        ns >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+inline void DspTimingStats::record(uint64_t ns)
+{
+    if (resetRequested.load(std::memory_order_acquire)) {
+        count.store(0, std::memory_order_relaxed);
+        totalNs.store(0, std::memory_order_relaxed);
+        maxNs.store(0, std::memory_order_relaxed);
+        for (int i = 0; i < numBuckets; ++i) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+        resetRequested.store(false, std::memory_order_relaxed);
+    }
+    bump(buckets[getBucket(ns)], 1);
+    bump(totalNs, ns);
+    if (ns > maxNs.load(std::memory_order_relaxed)) {
+        maxNs.store(ns, std::memory_order_relaxed);
+    }
+    // count last, so a reader never sees more samples than times
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+inline DspTimingStats::Snapshot DspTimingStats::read() const
+{
+    Snapshot ret;
+    if (resetRequested.load(std::memory_order_acquire)) {
+        // nothing since the last reset
+        return ret;
+    }
+    ret.count = count.load(std::memory_order_acquire);
+    ret.totalNs = totalNs.load(std::memory_order_relaxed);
+    ret.maxNs = maxNs.load(std::memory_order_relaxed);
+    for (int i = 0; i < numBuckets; ++i) {
+        ret.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+    return ret;
+}
+
+inline double DspTimingStats::Snapshot::meanNs() const
+{
+    return count ? double(totalNs) / double(count) : 0;
+}
+
+inline double DspTimingStats::Snapshot::percentileNs(double p) const
+{
+    assert(p >= 0 && p <= 1);
+    uint64_t total = 0;
+    for (int i = 0; i < numBuckets; ++i) {
+        total += buckets[i];
+    }
+    if (!total) {
+        return 0;
+    }
+    const double target = p * double(total);
+    uint64_t sum = 0;
+    for (int i = 0; i < numBuckets; ++i) {
+        sum += buckets[i];
+        if (double(sum) >= target && buckets[i]) {
+            return double(uint64_t(1) << (i + 1));
+        }
+    }
+    return double(maxNs);
+}
+
+inline double DspTimingStats::Snapshot::percentOfSample(float sampleRate) const
+{
+    return meanNs() * 1e-9 * sampleRate * 100;
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <assert.h>
+#include <vector>
+
+/**
+ * Arguments for the block processing API, process(args, frames).
+ *
+ * With step() all the audio goes through the ports, one sample at a time.
+ * With process() the caller may supply a buffer of 'frames' samples for any
+ * channel of any port. Each buffer is contiguous: buffer[frame].
+ *
+ * Ports that don't have a buffer work like they do with step():
+ * An input without a buffer holds its port voltage for the whole block.
+ * Outputs are always written to the port, so after process() the ports hold
+ * the last frame of the block, same as if step() had been called 'frames' times.
+ */
+class SqProcessArgs
+{
+public:
+    static const int maxChannels = 16;
+
+    float sampleRate = 44100;
+    float sampleTime = 1.f / 44100;
+
+    void setInput(int id, int channel, const float* buffer);
+    void setOutput(int id, int channel, float* buffer);
+
+    /**
+     * return the buffer for a channel of a port, or nullptr if there isn't one.
+     */
+    const float* getInput(int id, int channel) const;
+    float* getOutput(int id, int channel) const;
+
+    /**
+     * Copies one frame of every input buffer into its port.
+     * Lets code that reads from the ports (like the control rate processing)
+     * see the correct values for that frame.
+     */
+    template <typename TPort>
+    void loadInputs(std::vector<TPort>& ports, int frame) const;
+
+    /**
+     * Copies one frame of the input buffers for a single port.
+     */
+    template <typename TPort>
+    void loadInput(std::vector<TPort>& ports, int id, int frame) const;
+
+    /**
+     * Copies one frame of every port into its output buffer.
+     */
+    template <typename TPort>
+    void saveOutputs(std::vector<TPort>& ports, int frame) const;
+
+    /**
+     * One channel of a port, looked up once for the whole block.
+     * A channel without a buffer refers to the port voltage itself, with
+     * a stride of zero. So inputs hold the port voltage for the whole block,
+     * and outputs leave the last sample in the port.
+     */
+    class Channel
+    {
+    public:
+        float* data;
+        int stride;
+        float& operator[](int frame) const
+        {
+            return data[frame * stride];
+        }
+    };
+
+    template <typename TPort>
+    Channel getInputChannel(TPort& port, int id, int channel) const;
+    template <typename TPort>
+    Channel getOutputChannel(TPort& port, int id, int channel) const;
+
+    /**
+     * Copies the last frame of every output buffer into its port,
+     * so that the ports look like they would after calling step().
+     */
+    template <typename TPort>
+    void finishOutputs(std::vector<TPort>& ports, int frames) const;
+
+private:
+    class Buffer
+    {
+    public:
+        int id;
+        int channel;
+        float* data;
+    };
+
+    /**
+     * Buffers indexed by id * maxChannels + channel, for quick lookup.
+     */
+    std::vector<const float*> inputTable;
+    std::vector<float*> outputTable;
+
+    /**
+     * Just the buffers we have, for quick iteration.
+     */
+    std::vector<Buffer> inputList;
+    std::vector<Buffer> outputList;
+
+    template <typename TData>
+    static void setBuffer(std::vector<TData*>& table, std::vector<Buffer>& list, int id, int channel, TData* buffer);
+};
+
+template <typename TData>
+inline void SqProcessArgs::setBuffer(std::vector<TData*>& table, std::vector<Buffer>& list, int id, int channel, TData* buffer)
+{
+    assert(id >= 0);
+    assert(channel >= 0 && channel < maxChannels);
+    const int index = id * maxChannels + channel;
+    if (int(table.size()) <= index) {
+        table.resize(index + 1, nullptr);
+    }
+    table[index] = buffer;
+
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        if (it->id == id && it->channel == channel) {
+            list.erase(it);
+            break;
+        }
+    }
+    if (buffer) {
+        list.push_back({id, channel, const_cast<float*>(buffer)});
+    }
+}
+
+inline void SqProcessArgs::setInput(int id, int channel, const float* buffer)
+{
+    setBuffer(inputTable, inputList, id, channel, buffer);
+}
+
+inline void SqProcessArgs::setOutput(int id, int channel, float* buffer)
+{
+    setBuffer(outputTable, outputList, id, channel, buffer);
+}
+
+inline const float* SqProcessArgs::getInput(int id, int channel) const
+{
+    const unsigned index = id * maxChannels + channel;
+    return (index < inputTable.size()) ? inputTable[index] : nullptr;
+}
+
+inline float* SqProcessArgs::getOutput(int id, int channel) const
+{
+    const unsigned index = id * maxChannels + channel;
+    return (index < outputTable.size()) ? outputTable[index] : nullptr;
+}
+
+template <typename TPort>
+inline void SqProcessArgs::loadInputs(std::vector<TPort>& ports, int frame) const
+{
+    for (const Buffer& buffer : inputList) {
+        ports[buffer.id].voltages[buffer.channel] = buffer.data[frame];
+    }
+}
+
+template <typename TPort>
+inline void SqProcessArgs::loadInput(std::vector<TPort>& ports, int id, int frame) const
+{
+    for (const Buffer& buffer : inputList) {
+        if (buffer.id == id) {
+            ports[id].voltages[buffer.channel] = buffer.data[frame];
+        }
+    }
+}
+
+template <typename TPort>
+inline void SqProcessArgs::saveOutputs(std::vector<TPort>& ports, int frame) const
+{
+    for (const Buffer& buffer : outputList) {
+        buffer.data[frame] = ports[buffer.id].voltages[buffer.channel];
+    }
+}
+
+template <typename TPort>
+inline SqProcessArgs::Channel SqProcessArgs::getInputChannel(TPort& port, int id, int channel) const
+{
+    const float* data = getInput(id, channel);
+    return data ?
+        Channel{const_cast<float*>(data), 1} :
+        Channel{port.voltages + channel, 0};
+}
+
+template <typename TPort>
+inline SqProcessArgs::Channel SqProcessArgs::getOutputChannel(TPort& port, int id, int channel) const
+{
+    float* data = getOutput(id, channel);
+    return data ?
+        Channel{data, 1} :
+        Channel{port.voltages + channel, 0};
+}
+
+template <typename TPort>
+inline void SqProcessArgs::finishOutputs(std::vector<TPort>& ports, int frames) const
+{
+    for (const Buffer& buffer : outputList) {
+        ports[buffer.id].voltages[buffer.channel] = buffer.data[frames - 1];
+    }
+}
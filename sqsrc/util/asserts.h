@@ -3,8 +3,9 @@
 #include "AudioMath.h"
 
 #include <assert.h>
+#include <atomic>
 #include <iostream>
-extern int _mdb;        // MIDI reverence count
+extern std::atomic<int> _mdb;        // MIDI reverence count
 
 /**
  * Our own little assert library, loosely inspired by Chai Assert.
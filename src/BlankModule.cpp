@@ -45,6 +45,7 @@ BlankModule::BlankModule()
 
 void BlankModule::step()
 {
+    DspTimingScope timing(blank->dspTiming);
     blank->step();
 }
 
@@ -106,6 +106,7 @@ void BootyModule::fromJson(json_t *rootJ)
 
 void BootyModule::step()
 {
+    DspTimingScope timing(shifter->dspTiming);
     shifter->step();
 }
 
@@ -57,6 +57,7 @@ CH10Module::CH10Module()
 
 void CH10Module::step()
 {
+    DspTimingScope timing(ch10->dspTiming);
     ch10->step();
 }
 
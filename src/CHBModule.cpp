@@ -55,6 +55,7 @@ CHBModule::CHBModule()
 
 void CHBModule::step()
 {
+    DspTimingScope timing(chb.dspTiming);
     chb.step();
 }
 
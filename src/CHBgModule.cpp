@@ -36,6 +36,7 @@ CHBgModule::CHBgModule()
 
 void CHBgModule::step()
 {
+    DspTimingScope timing(chb.dspTiming);
     chb.step();
 }
 
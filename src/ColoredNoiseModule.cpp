@@ -59,6 +59,7 @@ void ColoredNoiseModule::onSampleRateChange()
 
 void ColoredNoiseModule::step()
 {
+    DspTimingScope timing(noiseSource->dspTiming);
     noiseSource->step();
 }
  
@@ -33,6 +33,7 @@ DGModule::DGModule()
 
 void DGModule::step()
 {
+    DspTimingScope timing(dave.dspTiming);
     dave.step();
 }
 
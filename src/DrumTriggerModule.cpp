@@ -45,6 +45,7 @@ DrumTriggerModule::DrumTriggerModule()
 
 void DrumTriggerModule::step()
 {
+    DspTimingScope timing(drumTrigger->dspTiming);
     drumTrigger->step();
 }
 
@@ -50,6 +50,7 @@ EV3Module::EV3Module()
 
 void EV3Module::step()
 {
+    DspTimingScope timing(ev3->dspTiming);
     ev3->step();
 }
 
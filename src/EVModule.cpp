@@ -41,6 +41,7 @@ EVModule::EVModule()
 
 void EVModule::step()
 {
+    DspTimingScope timing(vco.dspTiming);
     vco.step();
 }
 
@@ -63,6 +63,7 @@ FiltModule::FiltModule()
 
 void FiltModule::step()
 {
+    DspTimingScope timing(filt->dspTiming);
     filt->step();
 }
 
@@ -73,7 +74,7 @@ void FiltModule::step()
 struct FiltWidget : ModuleWidget
 {
     FiltWidget(FiltModule *);
-    DECLARE_MANUAL("Stairway manual", "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/filter.md");
+    void appendContextMenu(Menu *menu) override;
 
     Label* addLabel(const Vec& v, const char* str, const NVGcolor& color = SqHelper::COLOR_BLACK)
     {
@@ -89,6 +90,8 @@ struct FiltWidget : ModuleWidget
     void addTrimmers(FiltModule *module, std::shared_ptr<IComposite> icomp);
     void addJacks(FiltModule *module, std::shared_ptr<IComposite> icomp);
 
+    FiltModule* filtModule = nullptr;
+
 #ifdef _TIME_DRAWING
     // Filt: avg = 160.360240, stddev = 32.932833 (us) Quota frac=0.962161
     void draw(const DrawArgs &args) override
@@ -99,6 +102,22 @@ struct FiltWidget : ModuleWidget
 #endif
 };
 
+void FiltWidget::appendContextMenu(Menu *menu)
+{
+    MenuLabel *spacerLabel = new MenuLabel();
+    menu->addChild(spacerLabel);
+
+    ManualMenuItem* manual = new ManualMenuItem(
+        "Stairway manual",
+        "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/filter.md");
+    menu->addChild(manual);
+
+    SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(filtModule, Comp::POLYPHASE_PARAM);
+    item->text = "Polyphase oversampling";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
+}
 
 /**
  * Widget constructor will describe my implementation structure and
@@ -109,6 +128,7 @@ struct FiltWidget : ModuleWidget
 FiltWidget::FiltWidget(FiltModule *module)
 {
     setModule(module);
+    filtModule = module;
 #else
 FiltWidget::FiltWidget(FiltModule *module) : ModuleWidget(module)
 {
@@ -69,6 +69,7 @@ FunVModule::FunVModule()
 
 void FunVModule::step()
 {
+    DspTimingScope timing(vco.dspTiming);
     vco.step();
 }
 
@@ -43,6 +43,7 @@ GMRModule::GMRModule()
 
 void GMRModule::step()
 {
+    DspTimingScope timing(gmr.dspTiming);
     gmr.step();
 }
 
@@ -53,6 +53,7 @@ GrayModule::GrayModule()
 
 void GrayModule::step()
 {
+    DspTimingScope timing(gray->dspTiming);
     gray->step();
 }
 
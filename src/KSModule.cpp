@@ -41,6 +41,7 @@ KSModule::KSModule()
 
 void KSModule::step()
 {
+    DspTimingScope timing(composite.dspTiming);
     composite.step();
 }
 
@@ -58,6 +58,7 @@ LFNBModule::LFNBModule()
 
 void LFNBModule::step()
 {
+    DspTimingScope timing(lfn.dspTiming);
     lfn.step();
 }
 
@@ -157,6 +158,8 @@ void LFNBWidget::appendContextMenu(Menu* theMenu)
         xlfnWidget);
     item->text = "Extra Low Frequency";
     theMenu->addChild(item);
+
+    SqMenuItem_DspTiming::append(theMenu, module);
 }
 #else
 inline Menu* LFNBWidget::createContextMenu()
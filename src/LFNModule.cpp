@@ -63,6 +63,7 @@ LFNModule::LFNModule()
 
 void LFNModule::step()
 {
+    DspTimingScope timing(lfn.dspTiming);
     lfn.step();
 }
 
@@ -103,9 +104,6 @@ struct LFNWidget : ModuleWidget
     void step() override
     {
         updater.update(*this);
-        if (module) {
-            module->lfn.pollForChangeOnUIThread();
-        } 
         ModuleWidget::step();
     }
 
@@ -169,6 +167,8 @@ void LFNWidget::appendContextMenu(Menu* theMenu)
         xlfnWidget);
     item->text = "Extra Low Frequency";
     theMenu->addChild(item);
+
+    SqMenuItem_DspTiming::append(theMenu, module);
 }
 #else
 inline Menu* LFNWidget::createContextMenu()
@@ -216,6 +216,9 @@ LFNWidget::LFNWidget(LFNModule *module) : ModuleWidget(module), module(module)
         Vec(10, knobY - 1 * knobDy),
         module,
         Comp::FREQ_RANGE_PARAM));
+    addInput(createInput<PJ301MPort>(
+        Vec(inputX, 22),
+        module, Comp::FREQ_RANGE_INPUT));
 
     for (int i = 0; i < 5; ++i) {
         addStage(i);
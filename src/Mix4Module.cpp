@@ -84,6 +84,7 @@ Mix4Module::Mix4Module()
 
 void Mix4Module::internalProcess()
 {
+    DspTimingScope timing(Mix4->dspTiming);
     Mix4->step();
 }
 
@@ -146,6 +147,16 @@ void Mix4Widget::appendContextMenu(Menu *menu)
     item = new SqMenuItem_BooleanParam2(mixModule, Comp::CV_MUTE_TOGGLE);
     item->text = "Mute CV toggles on/off";
     menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(mixModule, Comp::VOICE_PAN_PARAM);
+    item->text = "Pan poly voices";
+    menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(mixModule, Comp::VOICE_SPREAD_PARAM);
+    item->text = "Spread poly voices";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
 }
 
 static const float channelX = 21;
@@ -67,6 +67,7 @@ Mix8Module::Mix8Module()
 
 void Mix8Module::step()
 {
+    DspTimingScope timing(Mix8->dspTiming);
     Mix8->step();
 }
 
@@ -77,7 +78,7 @@ void Mix8Module::step()
 struct Mix8Widget : ModuleWidget
 {
     Mix8Widget(Mix8Module *);
-    DECLARE_MANUAL("Mixer-8 manual", "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/mix8.md");
+    void appendContextMenu(Menu *menu) override;
 
     Label* addLabel(const Vec& v, const char* str, const NVGcolor& color = SqHelper::COLOR_BLACK)
     {
@@ -110,6 +111,29 @@ struct Mix8Widget : ModuleWidget
 #endif
 };
 
+void Mix8Widget::appendContextMenu(Menu *menu)
+{
+    MenuLabel *spacerLabel = new MenuLabel();
+    menu->addChild(spacerLabel);
+
+    ManualMenuItem* manual = new ManualMenuItem(
+        "Mixer-8 manual",
+        "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/mix8.md");
+    menu->addChild(manual);
+
+    MenuLabel *spacerLabel2 = new MenuLabel();
+    menu->addChild(spacerLabel2);
+    SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(module, Comp::VOICE_PAN_PARAM);
+    item->text = "Pan poly voices";
+    menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(module, Comp::VOICE_SPREAD_PARAM);
+    item->text = "Spread poly voices";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
+}
+
 static const float channelX = 43;
 static const float dX = 34;
 static const float labelX = 0; 
@@ -38,6 +38,7 @@ public:
     int getNumGroups() const override { return Comp::numGroups; }
     int getMuteAllParam() const override { return Comp::ALL_CHANNELS_OFF_PARAM; }
     int getSolo0Param() const override { return Comp::SOLO0_PARAM; }
+    int getBlockBusParam() const override { return Comp::BLOCK_BUS_PARAM; }
     bool amMaster() override { return true; }
 protected:
     void setExternalInput(const float*) override;
@@ -79,6 +80,7 @@ MixMModule::MixMModule()
 
 void MixMModule::internalProcess()
 {
+    DspTimingScope timing(MixM->dspTiming);
     MixM->step();
 }
 
@@ -145,6 +147,20 @@ void MixMWidget::appendContextMenu(Menu *menu)
     item = new SqMenuItem_BooleanParam2(mixModule, Comp::CV_MUTE_TOGGLE);
     item->text = "Mute CV toggles on/off";
     menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(mixModule, Comp::BLOCK_BUS_PARAM);
+    item->text = "Block bus (long chains)";
+    menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(mixModule, Comp::VOICE_PAN_PARAM);
+    item->text = "Pan poly voices";
+    menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(mixModule, Comp::VOICE_SPREAD_PARAM);
+    item->text = "Spread poly voices";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
 }
 
 #ifdef _LABELS
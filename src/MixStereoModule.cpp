@@ -74,6 +74,7 @@ MixStereoModule::MixStereoModule()
 
 void MixStereoModule::internalProcess()
 {
+    DspTimingScope timing(MixStereo->dspTiming);
     MixStereo->step();
 }
 
@@ -142,6 +143,8 @@ void MixStereoWidget::appendContextMenu(Menu *menu)
     item = new SqMenuItem_BooleanParam2(mixModule, Comp::CV_MUTE_TOGGLE);
     item->text = "Mute CV toggles on/off";
     menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
 }
 
 static const float channelX = 21-2;
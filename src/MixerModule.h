@@ -76,6 +76,12 @@ public:
     virtual int getMuteAllParam() const = 0;
     virtual int getSolo0Param() const = 0;
 
+    /**
+     * Master module will override this to return the param
+     * that turns on the block bus.
+     */
+    virtual int getBlockBusParam() const { return -1; }
+
     void sendSoloChangedMessageOnAudioThread()
     {
         pleaseSendSoloChangedMessageOnAudioThread = true;
@@ -114,6 +120,9 @@ private:
     CommChannelReceive receiveRightChannel;
     CommChannelReceive receiveLeftChannel;
 
+    // moves the audio busses to the right, one sample or one block at a time.
+    BlockBusPort busPort;
+
     // This guy holds onto a shared solo state, and we pass weak pointers to
     // him to clients so they can work. Only allocated by master.
     std::shared_ptr<SharedSoloStateOwner> sharedSoloStateOwner;
@@ -127,6 +136,9 @@ private:
     // both masters and expanders hold onto these.
     std::shared_ptr<SharedSoloState> sharedSoloState;
 
+    // comes with the solo state. Expanders only use it once they have a module index.
+    std::shared_ptr<BlockBus> blockBus;
+
     bool pleaseSendSoloChangedMessageOnAudioThread = false;
 
     /**
@@ -183,6 +195,7 @@ inline void MixerModule::allocateSharedSoloState()
     assert(!sharedSoloStateOwner);
     sharedSoloStateOwner = std::make_shared<SharedSoloStateOwner>();
     sharedSoloState =  sharedSoloStateOwner->state; 
+    blockBus = sharedSoloStateOwner->blockBus;
     stateForClient = new SharedSoloStateClient(sharedSoloStateOwner);
    // initSoloState();        // master can do this right now, and only check once.
 }
@@ -205,6 +218,7 @@ inline void MixerModule::pollForNeedsSoloState(bool pairedRight)
     if ((moduleIndex >= 0) && !pairedRight) { 
         moduleIndex = -1;
         sharedSoloState.reset();
+        blockBus.reset();
     }
 }
 
@@ -275,10 +289,12 @@ inline void MixerModule::processMessageFromBus(const CommChannelMessage& msg, bo
                 // If then owner has been deleted, then bail
                 if (!owner) {
                     sharedSoloState.reset();
+                    blockBus.reset();
                     return;
                 }
 
                 sharedSoloState = owner->state;
+                blockBus = owner->blockBus;
                 moduleIndex = stateForClient->moduleNumber++;
                 initSoloState();        // make sure we have initialized.
             }
@@ -321,12 +337,6 @@ inline void MixerModule::process(const ProcessArgs &args)
     assert(rightExpander.producerMessage);
     assert(!pairedLeft || leftExpander.module->rightExpander.consumerMessage);
 
-    // set a channel to send data to the right (case #1, above)
-    setExternalOutput(pairedRight ? reinterpret_cast<float *>(rightExpander.producerMessage) : nullptr);
-    
-    // set a channel to rx data from the left (case #2, above)
-    setExternalInput(pairedLeft ? reinterpret_cast<float *>(leftExpander.module->rightExpander.consumerMessage) : nullptr);
-
     //pollForModulePing(pairedLeft);
     pollForNeedsSoloState(pairedRight);
 
@@ -391,8 +401,28 @@ inline void MixerModule::process(const ProcessArgs &args)
     }
   
     pleaseSendSoloChangedMessageOnAudioThread = false;
+
+    const int blockBusParam = getBlockBusParam();
+    if (amMaster() && blockBus && (blockBusParam >= 0)) {
+        blockBus->setEnabled(params[blockBusParam].value > .5f);
+    }
+
+    // set a channel to send data to the right (case #1, above)
+    // and a channel to rx data from the left (case #2, above).
+    // The bus port may send them through the block bus instead.
+    // This goes after the messages, since they can take away our block bus.
+    busPort.prepare(
+        pairedLeft ? reinterpret_cast<const float *>(leftExpander.module->rightExpander.consumerMessage) : nullptr,
+        pairedRight ? reinterpret_cast<float *>(rightExpander.producerMessage) : nullptr,
+        (moduleIndex >= 0) ? blockBus.get() : nullptr,
+        moduleIndex,
+        amMaster());
+    setExternalOutput(busPort.getOutput());
+    setExternalInput(busPort.getInput());
+
     // Do the audio processing, and handle the left and right audio buses
     internalProcess();
+    busPort.finish();
 
     if (pairedRight) {
         rightExpander.messageFlipRequested = true;
@@ -24,6 +24,7 @@
 #include "MidiSong.h"
 #include "../test/TestSettings.h"
 #include "TimeUtils.h"
+#include "MidiFileImporter.h"
 #include "MidiFileProxy.h"
 #include "SequencerModule.h"
 #include <osdialog.h>
@@ -73,11 +74,19 @@ struct SequencerWidget : ModuleWidget
         );
         midifileSave->text = "Save midi file";
         theMenu->addChild(midifileSave); 
+
+        SqMenuItem_DspTiming::append(theMenu, module);
     }
 
     void loadMidiFile();
     void saveMidiFile();
 
+    /**
+     * Loads midi files in the background. Finished songs are
+     * picked up in step().
+     */
+    MidiFileImporter midiImporter;
+
     /**
      * Helper to add a text label to this widget
      */
@@ -213,13 +222,10 @@ void SequencerWidget::loadMidiFile()
 		std::free(pathC);
 	});
 
-    MidiSongPtr song = MidiFileProxy::load(pathC);
-
-    std::string temp(pathC);
-    std::string fileFolder = rack::string::directory(temp);
-    if (song) {
-        _module->postNewSong(song, fileFolder);
-    }  
+    // big files can take a while, so don't make the UI wait.
+    if (!midiImporter.startImport(pathC)) {
+        WARN("still loading the last midi file, can't load %s", pathC);
+    }
 }
 
 void SequencerWidget::step()
@@ -241,6 +247,18 @@ void SequencerWidget::step()
         }
     }
 
+    // see if a midi file has finished loading
+    MidiSongPtr song;
+    std::string path;
+    if (_module && midiImporter.poll(song, path)) {
+        if (song) {
+            std::string fileFolder = rack::string::directory(path);
+            _module->postNewSong(song, fileFolder);
+        } else {
+            WARN("unable to load midi file %s", path.c_str());
+        }
+    }
+
     // give this guy a chance to do some processing on the UI thread.
     if (_module) {
 #ifdef _USERKB
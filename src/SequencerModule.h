@@ -27,6 +27,7 @@ public:
             seqComp->toggleRunStop();
             runStopRequested = false;
         }
+        DspTimingScope timing(seqComp->dspTiming);
         seqComp->step();
     }
     void onReset() override;
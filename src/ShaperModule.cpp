@@ -51,6 +51,7 @@ ShaperModule::ShaperModule()
 
 void ShaperModule::step()
 {
+    DspTimingScope timing(shaper.dspTiming);
     shaper.step();
 }
 
@@ -66,8 +67,7 @@ void ShaperModule::onSampleRateChange()
 struct ShaperWidget : ModuleWidget
 {
     ShaperWidget(ShaperModule *);
-
-    DECLARE_MANUAL("Shaper manual", "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/shaper.md");
+    void appendContextMenu(Menu *menu) override;
     /**
      * Helper to add a text label to this widget
      */
@@ -99,10 +99,28 @@ private:
     Label* shapeLabel=nullptr;
     Label* shapeLabel2=nullptr;
     ParamWidget* shapeParam = nullptr;
+    ShaperModule* shaperModule = nullptr;
     Shaper<WidgetComposite>::Shapes curShape = Shaper<WidgetComposite>::Shapes::Invalid;
     void addSelector(ShaperModule* module, std::shared_ptr<IComposite> icomp);
 };
 
+void ShaperWidget::appendContextMenu(Menu *menu)
+{
+    MenuLabel *spacerLabel = new MenuLabel();
+    menu->addChild(spacerLabel);
+
+    ManualMenuItem* manual = new ManualMenuItem(
+        "Shaper manual",
+        "https://github.com/squinkylabs/SquinkyVCV/blob/master/docs/shaper.md");
+    menu->addChild(manual);
+
+    SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(shaperModule, Comp::PARAM_POLYPHASE);
+    item->text = "Polyphase oversampling";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
+}
+
 void ShaperWidget::step()
 {
     ModuleWidget::step();
@@ -154,6 +172,7 @@ void ShaperWidget::addSelector(ShaperModule* module, std::shared_ptr<IComposite>
 ShaperWidget::ShaperWidget(ShaperModule* module)
 {
     setModule(module);
+    shaperModule = module;
 #else
 ShaperWidget::ShaperWidget(ShaperModule* module) :
     ModuleWidget(module)
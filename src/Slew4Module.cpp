@@ -62,6 +62,7 @@ Slew4Module::Slew4Module()
 
 void Slew4Module::step()
 {
+    DspTimingScope timing(slew->dspTiming);
     slew->step();
 }
 
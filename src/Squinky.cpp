@@ -2,6 +2,7 @@
 #include "Squinky.hpp"
 //#include "SqTime.h"
 #include "ctrl/SqHelper.h"
+#include "ObjectCache.h"
 
 
 // The plugin-wide instance of the Plugin class
@@ -108,7 +109,10 @@ void init (::rack::Plugin *p)
     p->addModel(modelDrumTriggerModule);
 #endif
 
-
+    // Make all the shared lookup tables now, and keep them for the life of the plugin,
+    // so that adding modules and loading patches doesn't have to make them.
+    ObjectCache<float>::warmUp(true);
+    ObjectCache<double>::warmUp(true);
 }
 
 const NVGcolor SqHelper::COLOR_WHITE = nvgRGB(0xff, 0xff, 0xff);
@@ -50,6 +50,7 @@ SuperModule::SuperModule()
 
 void SuperModule::step()
 {
+    DspTimingScope timing(super->dspTiming);
     super->step();
 }
 
@@ -118,6 +119,12 @@ void superWidget::appendContextMenu(Menu *menu)
     SqMenuItem_BooleanParam2 * item = new SqMenuItem_BooleanParam2(superModule, Comp::HARD_PAN_PARAM);
     item->text = "Hard Pan";
     menu->addChild(item);
+
+    item = new SqMenuItem_BooleanParam2(superModule, Comp::POLYPHASE_PARAM);
+    item->text = "Polyphase oversampling";
+    menu->addChild(item);
+
+    SqMenuItem_DspTiming::append(menu, module);
 }
 
 const float col1 = 40;
@@ -59,6 +59,7 @@ TremoloModule::TremoloModule()
 
 void TremoloModule::step()
 {
+    DspTimingScope timing(tremolo->dspTiming);
     tremolo->step();
 }
 
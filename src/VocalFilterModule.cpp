@@ -45,6 +45,7 @@ void VocalFilterModule::onSampleRateChange()
 
 void VocalFilterModule::step()
 {
+    DspTimingScope timing(vocalFilter.dspTiming);
     vocalFilter.step();
 }
 
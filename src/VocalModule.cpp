@@ -48,6 +48,7 @@ void VocalModule::onSampleRateChange()
 
 void VocalModule::step()
 {
+    DspTimingScope timing(animator->dspTiming);
     animator->step();
 }
 
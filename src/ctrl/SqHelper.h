@@ -122,4 +122,5 @@ public:
 	theMenu->addChild(spacerLabel); \
     ManualMenuItem* manual = new ManualMenuItem(TEXT, URL); \
     theMenu->addChild(manual);   \
+    SqMenuItem_DspTiming::append(theMenu, module); \
 }
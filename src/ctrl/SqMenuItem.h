@@ -2,6 +2,8 @@
 
 #include "rack.hpp"
 #include <functional>
+#include <sstream>
+#include "DspTiming.h"
 #include "SqHelper.h"
 #include "SqUI.h"
 
@@ -116,4 +118,88 @@ private:
         return ret;
     }
     ::rack::ParamWidget* const widget;
-};
\ No newline at end of file
+};
+
+
+/**
+ * The DSP timing items at the bottom of every module's context menu.
+ *
+ * "Measure DSP time" turns timing on or off for all our modules at once.
+ * While it's on, the menu shows how long this module's step takes, and
+ * the report has every module in the patch, busiest first.
+ */
+struct SqMenuItem_DspTiming
+{
+    static void append(::rack::ui::Menu* menu, ::rack::engine::Module* module)
+    {
+        if (!module) {
+            return;     // in the module browser
+        }
+        menu->addChild(new ::rack::ui::MenuLabel());
+
+        SqMenuItem* onOff = new SqMenuItem(
+            []() { return DspTiming::isEnabled(); },
+            []() { DspTiming::setEnabled(!DspTiming::isEnabled()); });
+        onOff->text = "Measure DSP time (all modules)";
+        menu->addChild(onOff);
+
+        if (!DspTiming::isEnabled()) {
+            return;
+        }
+
+        DspTimingStats::Snapshot data;
+        if (DspTiming::read(module, data) && data.count) {
+            const float sampleRate = SqHelper::engineGetSampleRate();
+            std::stringstream s;
+            s.precision(2);
+            s << std::fixed << "Mean " << data.meanNs() * .001 << " us, 99% " <<
+                data.percentileNs(.99) * .001 << " us, max " << data.maxNs * .001 << " us";
+            addLabel(menu, s.str());
+            s.str("");
+            s << data.percentOfSample(sampleRate) << "% of one core";
+            addLabel(menu, s.str());
+        }
+
+        SqMenuItem* reset = new SqMenuItem(
+            []() { return false; },
+            []() { DspTiming::resetAll(); });
+        reset->text = "Reset DSP time";
+        menu->addChild(reset);
+
+        SqMenuItem* save = new SqMenuItem(
+            []() { return false; },
+            []() { saveReport(); });
+        save->text = "Save DSP time report";
+        save->rightText = "";
+        menu->addChild(save);
+    }
+
+    /**
+     * Writes all the modules to squinkylabs-dsp-time.txt, in the Rack user folder.
+     */
+    static void saveReport()
+    {
+        const std::string path = ::rack::asset::user("squinkylabs-dsp-time.txt");
+        FILE* file = fopen(path.c_str(), "w");
+        if (!file) {
+            WARN("can't write %s", path.c_str());
+            return;
+        }
+        DspTiming::writeReport(file, SqHelper::engineGetSampleRate(), [](const void* owner) {
+            auto module = static_cast<const ::rack::engine::Module*>(owner);
+            std::stringstream s;
+            s << (module->model ? module->model->name : std::string("?")) << " " << module->id;
+            return s.str();
+        });
+        fclose(file);
+        INFO("wrote %s", path.c_str());
+    }
+
+private:
+    static void addLabel(::rack::ui::Menu* menu, const std::string& text)
+    {
+        ::rack::ui::MenuLabel* label = new ::rack::ui::MenuLabel();
+        label->text = text;
+        menu->addChild(label);
+    }
+};
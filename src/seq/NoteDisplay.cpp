@@ -55,6 +55,7 @@ NoteDisplay::NoteDisplay(
 
 void NoteDisplay::songUpdated()
 {
+    renderCache.invalidate();
     initEditContext();
     // re-associate seq and mouse manager
     mouseManager = std::make_shared<MouseManager>(sequencer); 
@@ -98,82 +99,35 @@ void NoteDisplay::step()
     OpaqueWidget::step();
 }
 
-void NoteDisplay::drawNotes(NVGcontext *vg)
+/**
+ * Draws all the rects as one path, so NanoVG only has to fill once.
+ */
+static void drawRects(NVGcontext *vg, NVGcolor color, const std::vector<NoteRenderCache::Rect>& rects)
 {
-    // Get all the events on the screen, and go back two bar so we get tied notes.
-    MidiEditorContext::iterator_pair it = sequencer->context->getEvents(8.f);
-    auto scaler = sequencer->context->getScaler();
-    assert(scaler);
-    const int noteHeight = scaler->noteHeight();
-    for (; it.first != it.second; ++it.first) {
-        auto temp = *(it.first);
-        MidiEventPtr evn = temp.second;
-        MidiNoteEventPtr ev = safe_cast<MidiNoteEvent>(evn);
-
-        const float x = scaler->midiTimeToX(*ev);
-        const float y = scaler->midiPitchToY(*ev);
-        const float width = scaler->midiTimeTodX(ev->duration);
-        const bool selected = sequencer->selection->isSelected(ev);
-        if (!selected || !mouseManager->willDrawSelection()) {
-            SqGfx::filledRect(
-                vg,
-                selected ? UIPrefs::SELECTED_NOTE_COLOR : UIPrefs::NOTE_COLOR,
-                x, y, width, noteHeight);
-        }
+    if (rects.empty()) {
+        return;
+    }
+    nvgFillColor(vg, color);
+    nvgBeginPath(vg);
+    for (const NoteRenderCache::Rect& r : rects) {
+        nvgRect(vg, r.x, r.y, r.width, r.height);
     }
+    nvgFill(vg);
 }
 
-void NoteDisplay::drawGrid(NVGcontext *vg)
+void NoteDisplay::drawNotes(NVGcontext *vg)
 {
-    auto scaler = sequencer->context->getScaler();
-    assert(scaler);
-
-    const float endTime =  sequencer->context->getTrack()->getLength();
-    const float endX = scaler->midiTimeToX(endTime);
-    bool drewEnd = false;
-
-    //assume two bars, quarter note grid
-    const float totalDuration = TimeUtils::bar2time(2);
-    float deltaDuration = sequencer->context->settings()->getQuarterNotesInGrid();
-
-    // if grid lines are too close together, don't draw all.
-    const float dx = scaler->midiTimeTodX(deltaDuration);
-    if (dx < 22) {
-        deltaDuration *= 2;
-    }
-
-    const float y = UIPrefs::topMarginNoteEdit;
-    const float width = 1;
-    const float height = this->box.size.y - y;
-
-    for (float relTime = 0; relTime <= totalDuration; relTime += deltaDuration) {
-        const float time = relTime + sequencer->context->startTime();
-        const float x = scaler->midiTimeToX(time);
-
-        const bool isBar = (relTime == 0) ||
-            (relTime == TimeUtils::bar2time(1)) ||
-            (relTime == TimeUtils::bar2time(2));
-
-        NVGcolor color = isBar ? UIPrefs::GRID_BAR_COLOR : UIPrefs::GRID_COLOR;
-        if (x == endX) {
-            color = UIPrefs::GRID_END_COLOR;
-            drewEnd = true;
-        }
-        SqGfx::filledRect(
-            vg,
-            color,
-            x, y, width, height);
-    }
+    using Layer = NoteRenderCache::Layer;
+    drawRects(vg, UIPrefs::NOTE_COLOR, renderCache.getRects(Layer::Note));
+    drawRects(vg, UIPrefs::SELECTED_NOTE_COLOR, renderCache.getRects(Layer::SelectedNote));
+}
 
-    if (!drewEnd &&
-        endTime >= sequencer->context->startTime() &&
-        endTime < sequencer->context->endTime()) {
-        const float  x = scaler->midiTimeToX(endTime);
-        SqGfx::filledRect(
-            vg,
-            UIPrefs::GRID_END_COLOR,
-            x, y, width, height);
-    }
+void NoteDisplay::drawGrid(NVGcontext *vg)
+{
+    using Layer = NoteRenderCache::Layer;
+    drawRects(vg, UIPrefs::GRID_COLOR, renderCache.getRects(Layer::Grid));
+    drawRects(vg, UIPrefs::GRID_BAR_COLOR, renderCache.getRects(Layer::GridBar));
+    drawRects(vg, UIPrefs::GRID_END_COLOR, renderCache.getRects(Layer::GridEnd));
 }
 
 void NoteDisplay::drawCursor(NVGcontext *vg)
@@ -207,6 +161,9 @@ void NoteDisplay::draw(const Widget::DrawArgs &args)
         return;
     }
 
+    // only does work if something has changed since last frame
+    renderCache.update(*sequencer, box.size.x, box.size.y, mouseManager->willDrawSelection());
+
     // let's clip everything to our window
     nvgScissor(vg, 0, 0, this->box.size.x, this->box.size.y);
     drawBackground(vg);
@@ -221,44 +178,10 @@ void NoteDisplay::draw(const Widget::DrawArgs &args)
 
 void NoteDisplay::drawBackground(NVGcontext *vg)
 {
-    auto scaler = sequencer->context->getScaler();
+    using Layer = NoteRenderCache::Layer;
     SqGfx::filledRect(vg, UIPrefs::NOTE_EDIT_BACKGROUND, 0, 0, box.size.x, box.size.y);
-    assert(scaler);
-    const int noteHeight = scaler->noteHeight();
-    const float width = box.size.x;
-    for (float cv = sequencer->context->pitchLow();
-        cv <= sequencer->context->pitchHigh();
-        cv += PitchUtils::semitone) {
-
-        const float y = scaler->midiCvToY(cv);
-
-        bool accidental = PitchUtils::isAccidental(cv);
-        if (accidental) {
-            SqGfx::filledRect(
-                vg,
-                UIPrefs::NOTE_EDIT_ACCIDENTAL_BACKGROUND,
-                0, y, width, noteHeight);
-        }
-    }
-
-    for (float cv = sequencer->context->pitchLow();
-        cv <= sequencer->context->pitchHigh();
-        cv += PitchUtils::semitone) {
-
-        float y = scaler->midiCvToY(cv) + scaler->noteHeight();
-        const bool isC = PitchUtils::isC(cv);
-        if (y > (box.size.y - .5)) {
-            y = y - 2;  // make sure  bottom line draws. Should really
-                        // re-design the visuals here
-        }
-        if (isC) {
-         //   const float y = scaler->midiCvToY(cv);
-            SqGfx::filledRect(
-                vg,
-                UIPrefs::GRID_CLINE_COLOR,
-                0, y, width, 1);
-        }
-    }
+    drawRects(vg, UIPrefs::NOTE_EDIT_ACCIDENTAL_BACKGROUND, renderCache.getRects(Layer::AccidentalBackground));
+    drawRects(vg, UIPrefs::GRID_CLINE_COLOR, renderCache.getRects(Layer::CLine));
 }
 
 void NoteDisplay::onUIThread(std::shared_ptr<Seq<WidgetComposite>> seqComp, MidiSequencerPtr sequencer)
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "MidiSequencer.h"
+#include "NoteRenderCache.h"
 #include "NoteScreenScale.h"
 #include "Seq.h"
 
@@ -52,6 +53,12 @@ private:
 
     std::shared_ptr<class MouseManager> mouseManager;
 
+    /**
+     * All the rects for the notes, grid, and background.
+     * Only re-calculated when something changes.
+     */
+    NoteRenderCache renderCache;
+
     void step() override;
 
 
@@ -1,6 +1,7 @@
 
 #include "MidiLock.h"
 #include "MidiSequencer.h"
+#include "MidiTrackCodec.h"
 #include "../SequencerModule.h"
 #include "SequencerSerializer.h"
 #include "SeqSettings.h"
@@ -29,13 +30,10 @@ json_t *SequencerSerializer::toJson(std::shared_ptr<MidiSong> sng)
 
 json_t *SequencerSerializer::toJson(std::shared_ptr<MidiTrack> tk)
 {
-    json_t* track = json_array();
-
-    for (auto ev_iter : *tk) {
-        MidiEventPtr ev = ev_iter.second;
-        json_array_append_new(track, toJson(ev));
-    }
-    return track;
+    // Saved as a compact string. Old patches have an array
+    // of events instead, which we can still read.
+    std::string data = MidiTrackCodec::encode(*tk);
+    return json_string(data.c_str());
 }
 
 json_t *SequencerSerializer::toJson(std::shared_ptr<MidiEvent> evt)
@@ -96,6 +94,14 @@ json_t* SequencerSerializer::toJson(std::shared_ptr<ISeqSettings> settings)
 /********************************************************/
 
 /*
+    Current format, track is encoded by MidiTrackCodec:
+    "data": {
+        "song": {
+          "tk0": "AYAeAwAAAQIG..."
+        }
+      },
+
+    Old format, one object per event:
     "data": {
         "song": {
           "tk0": [
@@ -197,15 +203,26 @@ MidiSongPtr SequencerSerializer::fromJsonSong(json_t *data)
 
 MidiTrackPtr SequencerSerializer::fromJsonTrack(json_t *data, int index, MidiLockPtr lock)
 {
-    // data here is the track array
-    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
-
-    size_t eventCount = json_array_size(data);
+    MidiTrackPtr track;
+    if (json_is_string(data)) {
+        track = MidiTrackCodec::decode(json_string_value(data), lock);
+    }
 
-    for (int i = 0; i< int(eventCount); ++i) {
-        json_t *eventJson = json_array_get(data, i);
-        MidiEventPtr event = fromJsonEvent(eventJson);
-        track->insertEvent(event);
+    if (!track) {
+        // data here is the track array
+        track = std::make_shared<MidiTrack>(lock);
+        size_t eventCount = json_array_size(data);
+        std::vector<MidiEventPtr> events;
+        events.reserve(eventCount);
+
+        for (int i = 0; i< int(eventCount); ++i) {
+            json_t *eventJson = json_array_get(data, i);
+            MidiEventPtr event = fromJsonEvent(eventJson);
+            if (event) {
+                events.push_back(event);
+            }
+        }
+        track->insertEvents(events);
     }
     if (0 == track->size()) {
         printf("bad track\n"); fflush(stdout);
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <assert.h>
+#include <map>
+#include <sstream>
+#include <stdlib.h>
+
+#include "Benchmark.h"
+#include "SqTime.h"
+
+double Benchmark::Result::percent() const
+{
+    return nsPerSample * 1e-9 * sampleRate * 100;
+}
+
+std::string Benchmark::Result::key() const
+{
+    std::stringstream s;
+    s << name << "," << int(sampleRate) << "," << blockSize << "," << (cold ? "cold" : "warm");
+    return s.str();
+}
+
+Benchmark::Benchmark(Factory overhead) : overhead(overhead)
+{
+}
+
+void Benchmark::add(const std::string& name, Factory factory)
+{
+    assert(name.find_first_of(",\"") == std::string::npos);
+    cases.push_back({name, factory});
+}
+
+std::vector<std::string> Benchmark::getNames() const
+{
+    std::vector<std::string> names;
+    for (auto& c : cases) {
+        names.push_back(c.name);
+    }
+    return names;
+}
+
+std::vector<double> Benchmark::measure(Factory factory, const Config& config, const Options& options)
+{
+    const int numInstances = config.cold ? options.coldInstances : 1;
+    std::vector<Block> instances;
+    for (int i = 0; i < numInstances; ++i) {
+        instances.push_back(factory(config));
+    }
+
+    // Big enough that it won't fit in any cache.
+    const size_t otherModulesSize = 64 * 1024 * 1024;
+    const size_t touch = config.cold ? options.coldMemoryPerInstance : 0;
+    assert(touch < otherModulesSize);
+    if (touch && otherModules.size() != otherModulesSize) {
+        otherModules.resize(otherModulesSize, 1);
+    }
+    size_t touchPos = 0;
+
+    float sink = 0;
+    auto runRounds = [&](int64_t rounds) {
+        const double t0 = SqTime::seconds();
+        for (int64_t round = 0; round < rounds; ++round) {
+            for (auto& instance : instances) {
+                sink += instance();
+
+                // one read per cache line
+                for (size_t i = 0; i < touch; i += 64) {
+                    sink += otherModules[touchPos + i];
+                }
+                touchPos += touch;
+                if (touchPos + touch > otherModulesSize) {
+                    touchPos = 0;
+                }
+            }
+        }
+        return SqTime::seconds() - t0;
+    };
+
+    // Find how many rounds make one trial. This also warms everything up.
+    const double trialTime = options.minTime / options.trials;
+    int64_t rounds = 1;
+    while (runRounds(rounds) < trialTime) {
+        rounds *= 2;
+    }
+
+    const double samplesPerTrial = double(rounds) * numInstances * config.blockSize;
+    std::vector<double> ret;
+    for (int i = 0; i < options.trials; ++i) {
+        ret.push_back(runRounds(rounds) * 1e9 / samplesPerTrial);
+    }
+
+    // The compiler has to believe we use the output
+    if (sink == 12345.f) {
+        printf("!");
+    }
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
+std::vector<Benchmark::Result> Benchmark::run(const Options& options, std::function<void(const Result&)> progress)
+{
+    assert(options.trials > 0);
+    std::vector<Result> results;
+    for (float sampleRate : options.sampleRates) {
+        for (int blockSize : options.blockSizes) {
+            for (bool cold : options.cacheModes) {
+                Config config;
+                config.sampleRate = sampleRate;
+                config.blockSize = blockSize;
+                config.cold = cold;
+
+                bool haveOverhead = false;
+                std::vector<double> overheadTimes;
+                for (auto& c : cases) {
+                    if (!options.filter.empty() && c.name.find(options.filter) == std::string::npos) {
+                        continue;
+                    }
+                    if (!haveOverhead) {
+                        overheadTimes = measure(overhead, config, options);
+                        haveOverhead = true;
+                    }
+                    const std::vector<double> times = measure(c.factory, config, options);
+
+                    Result result;
+                    result.name = c.name;
+                    result.sampleRate = sampleRate;
+                    result.blockSize = blockSize;
+                    result.cold = cold;
+                    result.nsPerSample = std::max(0.0, times.front() - overheadTimes.front());
+                    result.nsPerSampleMedian = std::max(0.0, times[times.size() / 2] - overheadTimes[times.size() / 2]);
+                    results.push_back(result);
+                    if (progress) {
+                        progress(result);
+                    }
+                }
+            }
+        }
+    }
+    return results;
+}
+
+void Benchmark::writeText(FILE* out, const std::vector<Result>& results)
+{
+    fprintf(out, "%-32s %6s %5s %5s %10s %10s %8s %9s\n",
+        "case", "rate", "block", "cache", "ns/sample", "median", "% cpu", "instances");
+    for (auto& r : results) {
+        const double percent = r.percent();
+        fprintf(out, "%-32s %6d %5d %5s %10.2f %10.2f %8.4f %9.1f\n",
+            r.name.c_str(), int(r.sampleRate), r.blockSize, r.cold ? "cold" : "warm",
+            r.nsPerSample, r.nsPerSampleMedian, percent,
+            percent > 0 ? 100 / percent : 0);
+    }
+    fflush(out);
+}
+
+void Benchmark::writeJSON(FILE* out, const std::vector<Result>& results)
+{
+    fprintf(out, "{\n  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        fprintf(out, "    {\"name\": \"%s\", \"sampleRate\": %d, \"blockSize\": %d, \"cache\": \"%s\", "
+            "\"nsPerSample\": %.3f, \"nsPerSampleMedian\": %.3f, \"percent\": %.5f}%s\n",
+            r.name.c_str(), int(r.sampleRate), r.blockSize, r.cold ? "cold" : "warm",
+            r.nsPerSample, r.nsPerSampleMedian, r.percent(),
+            (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    fflush(out);
+}
+
+void Benchmark::writeCSV(FILE* out, const std::vector<Result>& results)
+{
+    fprintf(out, "name,sampleRate,blockSize,cache,nsPerSample,nsPerSampleMedian,percent\n");
+    for (auto& r : results) {
+        fprintf(out, "%s,%d,%d,%s,%.3f,%.3f,%.5f\n",
+            r.name.c_str(), int(r.sampleRate), r.blockSize, r.cold ? "cold" : "warm",
+            r.nsPerSample, r.nsPerSampleMedian, r.percent());
+    }
+    fflush(out);
+}
+
+bool Benchmark::parse(const std::string& text, std::vector<Result>& results)
+{
+    const size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) {
+        return false;
+    }
+    return (text[first] == '{' || text[first] == '[') ?
+        parseJSON(text, results) :
+        parseCSV(text, results);
+}
+
+bool Benchmark::read(const std::string& path, std::vector<Result>& results)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::string text;
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, n);
+    }
+    fclose(file);
+    return parse(text, results);
+}
+
+/**
+ * Only understands what writeJSON writes: an array of flat
+ * objects whose values are strings or numbers.
+ */
+bool Benchmark::parseJSON(const std::string& text, std::vector<Result>& results)
+{
+    size_t pos = text.find('[');
+    if (pos == std::string::npos) {
+        return false;
+    }
+    for (;;) {
+        pos = text.find_first_of("{]", pos);
+        if (pos == std::string::npos) {
+            return false;
+        }
+        if (text[pos] == ']') {
+            return true;
+        }
+        const size_t end = text.find('}', pos);
+        if (end == std::string::npos) {
+            return false;
+        }
+
+        std::map<std::string, std::string> fields;
+        size_t p = pos + 1;
+        for (;;) {
+            const size_t keyStart = text.find('"', p);
+            if (keyStart == std::string::npos || keyStart > end) {
+                break;
+            }
+            const size_t keyEnd = text.find('"', keyStart + 1);
+            const size_t colon = text.find(':', keyEnd);
+            if (keyEnd == std::string::npos || colon == std::string::npos || colon > end) {
+                return false;
+            }
+            const size_t valueStart = text.find_first_not_of(" \t\r\n", colon + 1);
+            if (valueStart == std::string::npos) {
+                return false;
+            }
+            size_t valueEnd;
+            std::string value;
+            if (text[valueStart] == '"') {
+                valueEnd = text.find('"', valueStart + 1);
+                if (valueEnd == std::string::npos || valueEnd > end) {
+                    return false;
+                }
+                value = text.substr(valueStart + 1, valueEnd - valueStart - 1);
+                ++valueEnd;
+            } else {
+                valueEnd = text.find_first_of(",}", valueStart);
+                value = text.substr(valueStart, valueEnd - valueStart);
+            }
+            fields[text.substr(keyStart + 1, keyEnd - keyStart - 1)] = value;
+            p = valueEnd;
+        }
+
+        if (!fields.count("name") || !fields.count("sampleRate") || !fields.count("blockSize") ||
+            !fields.count("cache") || !fields.count("nsPerSample")) {
+            return false;
+        }
+        Result r;
+        r.name = fields["name"];
+        r.sampleRate = float(atof(fields["sampleRate"].c_str()));
+        r.blockSize = atoi(fields["blockSize"].c_str());
+        r.cold = fields["cache"] == "cold";
+        r.nsPerSample = atof(fields["nsPerSample"].c_str());
+        r.nsPerSampleMedian = fields.count("nsPerSampleMedian") ?
+            atof(fields["nsPerSampleMedian"].c_str()) :
+            r.nsPerSample;
+        results.push_back(r);
+        pos = end + 1;
+    }
+}
+
+bool Benchmark::parseCSV(const std::string& text, std::vector<Result>& results)
+{
+    std::stringstream s(text);
+    std::string line;
+    if (!std::getline(s, line) || line.find("name,") != 0) {
+        return false;
+    }
+    while (std::getline(s, line)) {
+        if (line.find_first_not_of(" \t\r\n") == std::string::npos) {
+            continue;
+        }
+        std::vector<std::string> fields;
+        std::stringstream lineStream(line);
+        std::string field;
+        while (std::getline(lineStream, field, ',')) {
+            fields.push_back(field);
+        }
+        if (fields.size() < 6) {
+            return false;
+        }
+        Result r;
+        r.name = fields[0];
+        r.sampleRate = float(atof(fields[1].c_str()));
+        r.blockSize = atoi(fields[2].c_str());
+        r.cold = fields[3] == "cold";
+        r.nsPerSample = atof(fields[4].c_str());
+        r.nsPerSampleMedian = atof(fields[5].c_str());
+        results.push_back(r);
+    }
+    return true;
+}
+
+int Benchmark::compare(FILE* out, const std::vector<Result>& baseline,
+    const std::vector<Result>& current, double thresholdPercent)
+{
+    std::map<std::string, const Result*> baselineByKey;
+    for (auto& r : baseline) {
+        baselineByKey[r.key()] = &r;
+    }
+
+    int regressions = 0;
+    int improvements = 0;
+    int added = 0;
+    fprintf(out, "%-32s %6s %5s %5s %10s %10s %8s\n",
+        "case", "rate", "block", "cache", "baseline", "current", "change");
+    for (auto& r : current) {
+        auto it = baselineByKey.find(r.key());
+        if (it == baselineByKey.end()) {
+            ++added;
+            fprintf(out, "%-32s %6d %5d %5s %10s %10.2f %8s new\n",
+                r.name.c_str(), int(r.sampleRate), r.blockSize, r.cold ? "cold" : "warm",
+                "", r.nsPerSample, "");
+            continue;
+        }
+        const Result& base = *it->second;
+        baselineByKey.erase(it);
+
+        const double change = (base.nsPerSample > 0) ?
+            100 * (r.nsPerSample - base.nsPerSample) / base.nsPerSample :
+            0;
+        const char* flag = "";
+        if (change > thresholdPercent) {
+            flag = " REGRESSION";
+            ++regressions;
+        } else if (change < -thresholdPercent) {
+            flag = " faster";
+            ++improvements;
+        }
+        fprintf(out, "%-32s %6d %5d %5s %10.2f %10.2f %+7.1f%%%s\n",
+            r.name.c_str(), int(r.sampleRate), r.blockSize, r.cold ? "cold" : "warm",
+            base.nsPerSample, r.nsPerSample, change, flag);
+    }
+
+    // anything left in the baseline wasn't run this time
+    for (auto& it : baselineByKey) {
+        const Result& base = *it.second;
+        fprintf(out, "%-32s %6d %5d %5s %10.2f %10s %8s missing\n",
+            base.name.c_str(), int(base.sampleRate), base.blockSize, base.cold ? "cold" : "warm",
+            base.nsPerSample, "", "");
+    }
+
+    fprintf(out, "\n%d regressions, %d faster, %d new, %d missing (threshold %.1f%%)\n",
+        regressions, improvements, added, int(baselineByKey.size()), thresholdPercent);
+    fflush(out);
+    return regressions;
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <functional>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+/**
+ * A suite of CPU benchmarks, with results that can be saved and compared.
+ *
+ * MeasureTime is handy for poking at one thing by hand, but it prints text,
+ * every test has to subtract its own overhead, and the CPU percentage assumes
+ * a 44.1k sample rate. Here every case is measured the same way, at any
+ * number of sample rates and block sizes, and the results are plain data
+ * that can be written as JSON or CSV, and compared against a baseline.
+ *
+ * Each case is a factory that makes one instance of the code under test,
+ * set up for a given sample rate and block size. The instance is a function
+ * that processes one block, and returns some output so the optimizer
+ * can't throw the work away.
+ *
+ * In the warm cache mode a single instance runs in a tight loop, so all of
+ * its code and data stay in the cache. That is the best case, and is what
+ * MeasureTime does. In the cold cache mode many instances run round robin,
+ * the way VCV runs all the modules in a patch, so each one has to share the
+ * cache with the others. Optionally we also read through a chunk of memory
+ * between each one, which stands in for even more modules.
+ *
+ * The cost of the loop itself (and of reading the memory) is measured
+ * with the overhead case, and subtracted.
+ */
+class Benchmark
+{
+public:
+    /**
+     * Processes one block, returns any output.
+     */
+    using Block = std::function<float()>;
+
+    class Config
+    {
+    public:
+        float sampleRate = 44100;
+        int blockSize = 1;
+        bool cold = false;
+    };
+
+    /**
+     * Makes one instance of a case, ready to run.
+     */
+    using Factory = std::function<Block(const Config&)>;
+
+    class Options
+    {
+    public:
+        std::vector<float> sampleRates = {44100};
+        std::vector<int> blockSizes = {1};
+        std::vector<bool> cacheModes = {false};     // true is cold
+
+        /**
+         * Only run cases with this in their name, if not empty.
+         */
+        std::string filter;
+
+        /**
+         * Seconds to measure each case, in each configuration.
+         */
+        double minTime = .5;
+
+        /**
+         * The time is split into this many trials.
+         * We report the best and the median.
+         */
+        int trials = 5;
+
+        int coldInstances = 32;
+
+        /**
+         * Bytes of other memory to read between each instance, in cold mode.
+         */
+        int coldMemoryPerInstance = 0;
+    };
+
+    class Result
+    {
+    public:
+        std::string name;
+        float sampleRate = 0;
+        int blockSize = 0;
+        bool cold = false;
+
+        /**
+         * Cost of one instance processing one sample,
+         * from the fastest trial, and the median trial.
+         */
+        double nsPerSample = 0;
+        double nsPerSampleMedian = 0;
+
+        /**
+         * Percent of one core used by one instance, running at sampleRate.
+         * From the fastest trial.
+         */
+        double percent() const;
+
+        /**
+         * Identifies the configuration, for comparing runs.
+         */
+        std::string key() const;
+    };
+
+    /**
+     * @param overhead is a case that does nothing but what the real cases
+     * do to feed their inputs. It is subtracted from all the results.
+     */
+    Benchmark(Factory overhead);
+
+    /**
+     * name may not have commas or quotes in it.
+     */
+    void add(const std::string& name, Factory factory);
+
+    std::vector<std::string> getNames() const;
+
+    /**
+     * Runs all the matching cases in all the configurations.
+     * Calls progress after each one, if it isn't null.
+     */
+    std::vector<Result> run(const Options&, std::function<void(const Result&)> progress);
+
+    static void writeText(FILE*, const std::vector<Result>&);
+    static void writeJSON(FILE*, const std::vector<Result>&);
+    static void writeCSV(FILE*, const std::vector<Result>&);
+
+    /**
+     * Reads results that were written as JSON or CSV.
+     * Returns false if they can't be parsed.
+     */
+    static bool parse(const std::string& text, std::vector<Result>& results);
+    static bool read(const std::string& path, std::vector<Result>& results);
+
+    /**
+     * Prints how current compares to baseline.
+     * A case is a regression if its best time got slower by more
+     * than thresholdPercent.
+     *
+     * Returns the number of regressions.
+     */
+    static int compare(FILE*, const std::vector<Result>& baseline,
+        const std::vector<Result>& current, double thresholdPercent);
+
+private:
+    class Case
+    {
+    public:
+        std::string name;
+        Factory factory;
+    };
+
+    std::vector<Case> cases;
+    Factory overhead;
+    std::vector<char> otherModules;
+
+    /**
+     * Returns the time per sample of each trial, in nanoseconds, sorted.
+     */
+    std::vector<double> measure(Factory, const Config&, const Options&);
+
+    static bool parseJSON(const std::string& text, std::vector<Result>& results);
+    static bool parseCSV(const std::string& text, std::vector<Result>& results);
+};
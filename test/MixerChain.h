@@ -0,0 +1,179 @@
+#pragma once
+
+#include "TestComposite.h"
+#include "BlockBus.h"
+#include "CommChannels.h"
+#include "Mix4.h"
+#include "MixM.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+/**
+ * A chain of Mix4 expanders feeding a MixM, with the busses going
+ * over expander messages the way VCV and MixerModule do it.
+ *
+ * Module 0 is the master, module 1 is the expander just to the left
+ * of it, and so on. Like VCV, each module's message to the right
+ * only shows up on the next sample.
+ */
+class MixerChain
+{
+public:
+    using Expander = Mix4<TestComposite>;
+    using Master = MixM<TestComposite>;
+
+    MixerChain(int numExpanders);
+
+    /**
+     * Master's setting.
+     */
+    void setBlockBus(bool b)
+    {
+        blockBusParam = b;
+    }
+
+    /**
+     * Leave an expander off the block bus, like one that
+     * hasn't got its module index yet.
+     */
+    void disconnectFromBus(int module)
+    {
+        nodes[module].index = -1;
+    }
+
+    /**
+     * If true, the modules are run in a different order every sample,
+     * which VCV is free to do.
+     */
+    void setShuffle(bool b)
+    {
+        shuffle = b;
+    }
+
+    void setInput(int module, float v);
+    float getOutput() const
+    {
+        return master->outputs[Master::LEFT_OUTPUT].getVoltage(0);
+    }
+
+    uint32_t getFrame(int module) const
+    {
+        return nodes[module].port.getFrame();
+    }
+    int numModules() const
+    {
+        return int(nodes.size());
+    }
+
+    void step();
+
+    std::shared_ptr<BlockBus> bus = std::make_shared<BlockBus>();
+    std::shared_ptr<Master> master;
+    std::vector<std::shared_ptr<Expander>> expanders;
+
+private:
+    class Node
+    {
+    public:
+        float flip[comBufferSizeRight] = {0};
+        float flop[comBufferSizeRight] = {0};
+        float* producer()
+        {
+            return flipped ? flop : flip;
+        }
+        float* consumer()
+        {
+            return flipped ? flip : flop;
+        }
+        bool flipped = false;
+        BlockBusPort port;
+        int index = 0;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> order;
+    bool blockBusParam = false;
+    bool shuffle = false;
+    uint32_t shuffleSeed = 1;
+
+    void stepModule(int module);
+};
+
+template <typename T>
+inline void setupChainMixer(T& mixer)
+{
+    mixer.init();
+    auto icomp = mixer.getDescription();
+    for (int i = 0; i < icomp->getNumParams(); ++i) {
+        mixer.params[i].value = icomp->getParam(i).def;
+    }
+    mixer._disableAntiPop();
+    mixer.inputs[T::AUDIO0_INPUT].channels = 1;
+    mixer.params[T::GAIN0_PARAM].value = 1;
+}
+
+inline MixerChain::MixerChain(int numExpanders) : nodes(numExpanders + 1)
+{
+    master = std::make_shared<Master>();
+    setupChainMixer(*master);
+    for (int i = 0; i < numExpanders; ++i) {
+        auto ex = std::make_shared<Expander>();
+        setupChainMixer(*ex);
+        expanders.push_back(ex);
+    }
+    for (int i = 0; i < numModules(); ++i) {
+        nodes[i].index = i;
+        order.push_back(i);
+    }
+}
+
+inline void MixerChain::setInput(int module, float v)
+{
+    if (module == 0) {
+        master->inputs[Master::AUDIO0_INPUT].setVoltage(v, 0);
+    } else {
+        expanders[module - 1]->inputs[Expander::AUDIO0_INPUT].setVoltage(v, 0);
+    }
+}
+
+inline void MixerChain::stepModule(int module)
+{
+    Node& node = nodes[module];
+    const bool hasLeft = module + 1 < numModules();
+    const float* fromLeft = hasLeft ? nodes[module + 1].consumer() : nullptr;
+    BlockBus* b = (node.index >= 0) ? bus.get() : nullptr;
+
+    if (module == 0) {
+        bus->setEnabled(blockBusParam);
+        node.port.prepare(fromLeft, nullptr, b, node.index, true);
+        master->setExpansionInputs(node.port.getInput());
+        master->step();
+    } else {
+        Expander& ex = *expanders[module - 1];
+        node.port.prepare(fromLeft, node.producer(), b, node.index, false);
+        ex.setExpansionInputs(node.port.getInput());
+        ex.setExpansionOutputs(node.port.getOutput());
+        ex.step();
+    }
+    node.port.finish();
+}
+
+inline void MixerChain::step()
+{
+    if (shuffle) {
+        for (int i = numModules() - 1; i > 0; --i) {
+            shuffleSeed = shuffleSeed * 1664525 + 1013904223;
+            std::swap(order[i], order[(shuffleSeed >> 16) % (i + 1)]);
+        }
+    }
+    for (int module : order) {
+        stepModule(module);
+    }
+
+    // now VCV flips all the messages
+    for (Node& node : nodes) {
+        node.flipped = !node.flipped;
+    }
+}
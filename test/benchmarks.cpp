@@ -0,0 +1,480 @@
+#include <memory>
+#include <sstream>
+#include <stdlib.h>
+#include <string>
+
+#include "Benchmark.h"
+#include "MeasureTime.h"
+#include "TestComposite.h"
+
+#include "CHB.h"
+#include "ColoredNoise.h"
+#include "DrumTrigger.h"
+#include "EV3.h"
+#include "Filt.h"
+#include "FrequencyShifter.h"
+#include "FunVCOComposite.h"
+#include "GMR.h"
+#include "LFN.h"
+#include "LFNB.h"
+#include "Mix4.h"
+#include "Mix8.h"
+#include "MixM.h"
+#include "MixStereo.h"
+#include "Shaper.h"
+#include "Slew4.h"
+#include "Super.h"
+#include "Tremolo.h"
+#include "VocalAnimator.h"
+#include "VocalFilter.h"
+
+/*
+ * The benchmark suite. See Benchmark.h for how things are measured,
+ * and docs/unit-test.md for how to run it.
+ */
+
+/**
+ * Makes a Block that runs a composite.
+ * Block size one calls step(), the way VCV does, bigger blocks use process().
+ *
+ * Every block gets fresh input from TestBuffers, even if there is no
+ * input port to put it in, so the overhead case costs the same.
+ */
+template <class TComp>
+static Benchmark::Block makeBlock(std::shared_ptr<TComp> comp, const Benchmark::Config& config,
+    int inputId, int outputId)
+{
+    const int blockSize = config.blockSize;
+    auto buffers = std::make_shared<std::vector<float>>(2 * blockSize);
+    auto args = std::make_shared<SqProcessArgs>();
+    args->sampleRate = config.sampleRate;
+    args->sampleTime = 1 / config.sampleRate;
+    if (inputId >= 0) {
+        args->setInput(inputId, 0, buffers->data());
+    }
+    args->setOutput(outputId, 0, buffers->data() + blockSize);
+
+    return [comp, buffers, args, blockSize, inputId, outputId]() {
+        float* input = buffers->data();
+        for (int i = 0; i < blockSize; ++i) {
+            input[i] = TestBuffers<float>::get();
+        }
+        if (blockSize == 1) {
+            if (inputId >= 0) {
+                comp->inputs[inputId].setVoltage(input[0], 0);
+            }
+            comp->step();
+            return comp->outputs[outputId].getVoltage(0);
+        }
+        comp->process(*args, blockSize);
+        return input[2 * blockSize - 1];
+    };
+}
+
+/**
+ * Adds a case that makes a TComp, sets the engine sample rate,
+ * and then calls setup to finish the job.
+ */
+template <class TComp>
+static void addComposite(Benchmark& suite, const std::string& name, int inputId, int outputId,
+    std::function<void(TComp&, float sampleRate)> setup)
+{
+    suite.add(name, [inputId, outputId, setup](const Benchmark::Config& config) {
+        auto comp = std::make_shared<TComp>();
+        comp->setEngineSampleRate(config.sampleRate);
+        setup(*comp, config.sampleRate);
+        return makeBlock(comp, config, inputId, outputId);
+    });
+}
+
+template <class TComp>
+static void setPolyInput(TComp& comp, int inputId, int channels)
+{
+    comp.inputs[inputId].channels = channels;
+    for (int i = 0; i < channels; ++i) {
+        comp.inputs[inputId].setVoltage(i * .1f, i);
+    }
+}
+
+static void addNoise(Benchmark& suite)
+{
+    using N = LFN<TestComposite>;
+    addComposite<N>(suite, "lfn", -1, N::OUTPUT, [](N& lfn, float sampleRate) {
+        lfn.setSampleTime(1 / sampleRate);
+        lfn.init();
+    });
+
+    using NB = LFNB<TestComposite>;
+    addComposite<NB>(suite, "lfnb", -1, NB::AUDIO0_OUTPUT, [](NB& lfn, float) {
+        lfn.onSampleRateChange();
+        lfn.init();
+    });
+
+    using C = ColoredNoise<TestComposite>;
+    addComposite<C>(suite, "colors", -1, C::AUDIO_OUTPUT, [](C& colors, float sampleRate) {
+        colors.setSampleRate(sampleRate);
+        colors.init();
+    });
+}
+
+static void addOscillators(Benchmark& suite)
+{
+    using C = CHB<TestComposite>;
+    for (int channels : {1, 16}) {
+        const std::string name = (channels == 1) ? "chb" : "chb poly 16";
+        addComposite<C>(suite, name, -1, C::MIX_OUTPUT, [channels](C& chb, float) {
+            chb.onSampleRateChange();
+            setPolyInput(chb, C::CV_INPUT, channels);
+            chb.outputs[C::MIX_OUTPUT].channels = channels;
+        });
+    }
+
+    using E = EV3<TestComposite>;
+    for (int channels : {1, 16}) {
+        const std::string name = (channels == 1) ? "ev3" : "ev3 poly 16";
+        addComposite<E>(suite, name, -1, E::MIX_OUTPUT, [channels](E& ev3, float) {
+            setPolyInput(ev3, E::CV1_INPUT, channels);
+            for (int i = 0; i < E::NUM_OUTPUTS; ++i) {
+                ev3.outputs[i].channels = 1;
+            }
+            ev3.params[E::MIX2_PARAM].value = 1;
+            ev3.params[E::SYNC2_PARAM].value = 1;
+        });
+    }
+
+    using F = FunVCOComposite<TestComposite>;
+    for (int channels : {1, 16}) {
+        const std::string name = (channels == 1) ? "funv saw" : "funv saw poly 16";
+        addComposite<F>(suite, name, -1, F::SAW_OUTPUT, [channels](F& fun, float sampleRate) {
+            fun.setSampleRate(sampleRate);
+            setPolyInput(fun, F::PITCH_INPUT, channels);
+            fun.outputs[F::SIN_OUTPUT].channels = 0;
+            fun.outputs[F::TRI_OUTPUT].channels = 0;
+            fun.outputs[F::SQR_OUTPUT].channels = 0;
+            fun.outputs[F::SAW_OUTPUT].channels = 1;
+        });
+    }
+
+    using S = Super<TestComposite>;
+    struct SuperCase
+    {
+        const char* name;
+        int channels;
+        int clean;
+        bool stereo;
+    };
+    const SuperCase superCases[] = {
+        {"super", 1, 0, false},
+        {"super stereo", 1, 0, true},
+        {"super clean 2", 1, 2, false},
+        {"super poly 16", 16, 0, false},
+        {"super poly 16 clean 2", 16, 2, false},
+    };
+    for (const SuperCase& sc : superCases) {
+        addComposite<S>(suite, sc.name, S::FM_INPUT, S::MAIN_OUTPUT_LEFT, [sc](S& super, float) {
+            super.params[S::CLEAN_PARAM].value = float(sc.clean);
+            setPolyInput(super, S::CV_INPUT, sc.channels);
+            super.outputs[S::MAIN_OUTPUT_LEFT].channels = 1;
+            super.outputs[S::MAIN_OUTPUT_RIGHT].channels = sc.stereo ? 1 : 0;
+        });
+    }
+
+    using G = GMR<TestComposite>;
+    addComposite<G>(suite, "gmr", -1, G::TRIGGER_OUTPUT, [](G& gmr, float sampleRate) {
+        gmr.setSampleRate(sampleRate);
+        gmr.init();
+    });
+}
+
+static void addProcessors(Benchmark& suite)
+{
+    using Sh = Shaper<TestComposite>;
+    struct ShaperCase
+    {
+        const char* name;
+        int oversample;
+        bool polyphase;
+    };
+    const ShaperCase shaperCases[] = {
+        {"shaper fw 16x", 0, false},
+        {"shaper fw 16x polyphase", 0, true},
+        {"shaper fw 4x", 1, false},
+        {"shaper fw 1x", 2, false},
+    };
+    for (const ShaperCase& sc : shaperCases) {
+        addComposite<Sh>(suite, sc.name, Sh::INPUT_AUDIO0, Sh::OUTPUT_AUDIO0, [sc](Sh& shaper, float) {
+            shaper.onSampleRateChange();
+            shaper.params[Sh::PARAM_SHAPE].value = (float) Sh::Shapes::FullWave;
+            shaper.params[Sh::PARAM_OVERSAMPLE].value = float(sc.oversample);
+            shaper.params[Sh::PARAM_POLYPHASE].value = sc.polyphase ? 1.f : 0.f;
+            shaper.inputs[Sh::INPUT_AUDIO0].channels = 1;
+            shaper.outputs[Sh::OUTPUT_AUDIO0].channels = 1;
+        });
+    }
+
+    using Fi = Filt<TestComposite>;
+    for (int channels : {1, 16}) {
+        const std::string name = (channels == 1) ? "filt" : "filt poly 16";
+        addComposite<Fi>(suite, name, Fi::L_AUDIO_INPUT, Fi::L_AUDIO_OUTPUT, [channels](Fi& filt, float) {
+            filt.init();
+            setPolyInput(filt, Fi::L_AUDIO_INPUT, channels);
+            filt.outputs[Fi::L_AUDIO_OUTPUT].channels = 1;
+        });
+    }
+
+    using VF = VocalFilter<TestComposite>;
+    for (int channels : {1, 16}) {
+        const std::string name = (channels == 1) ? "vocal filter" : "vocal filter poly 16";
+        addComposite<VF>(suite, name, VF::AUDIO_INPUT, VF::AUDIO_OUTPUT, [channels](VF& vf, float sampleRate) {
+            vf.setSampleRate(sampleRate);
+            vf.init();
+            setPolyInput(vf, VF::AUDIO_INPUT, channels);
+            vf.outputs[VF::AUDIO_OUTPUT].channels = 1;
+        });
+    }
+
+    using VA = VocalAnimator<TestComposite>;
+    addComposite<VA>(suite, "animator", VA::AUDIO_INPUT, VA::AUDIO_OUTPUT, [](VA& an, float sampleRate) {
+        an.setSampleRate(sampleRate);
+        an.init();
+    });
+
+    using FS = FrequencyShifter<TestComposite>;
+    addComposite<FS>(suite, "shifter", FS::AUDIO_INPUT, FS::SIN_OUTPUT, [](FS& fs, float sampleRate) {
+        fs.setSampleRate(sampleRate);
+        fs.init();
+    });
+
+    using T = Tremolo<TestComposite>;
+    addComposite<T>(suite, "tremolo", T::AUDIO_INPUT, T::AUDIO_OUTPUT, [](T& trem, float sampleRate) {
+        trem.setSampleRate(sampleRate);
+        trem.init();
+        trem.inputs[T::AUDIO_INPUT].channels = 1;
+        trem.outputs[T::AUDIO_OUTPUT].channels = 1;
+    });
+
+    using Sl = Slew4<TestComposite>;
+    addComposite<Sl>(suite, "slade", Sl::INPUT_TRIGGER0, Sl::OUTPUT0, [](Sl& slew, float) {
+        slew.onSampleRateChange();
+        slew.init();
+    });
+
+    using DT = DrumTrigger<TestComposite>;
+    addComposite<DT>(suite, "polygate", DT::CV_INPUT, DT::GATE0_OUTPUT, [](DT& dt, float) {
+        dt.init();
+        dt.inputs[DT::CV_INPUT].channels = 8;
+        dt.outputs[DT::GATE0_OUTPUT].channels = 8;
+    });
+}
+
+static void addMixers(Benchmark& suite)
+{
+    using M8 = Mix8<TestComposite>;
+    addComposite<M8>(suite, "mix8", M8::AUDIO0_INPUT, M8::LEFT_OUTPUT, [](M8& mix, float) {
+        mix.init();
+        mix.inputs[M8::AUDIO0_INPUT].channels = 1;
+        mix.outputs[M8::LEFT_OUTPUT].channels = 1;
+    });
+
+    using MM = MixM<TestComposite>;
+    addComposite<MM>(suite, "mixM", MM::AUDIO0_INPUT, MM::LEFT_OUTPUT, [](MM& mix, float) {
+        mix.init();
+        mix.onSampleRateChange();
+        mix.inputs[MM::AUDIO0_INPUT].channels = 1;
+        mix.outputs[MM::LEFT_OUTPUT].channels = 1;
+    });
+
+    using M4 = Mix4<TestComposite>;
+    addComposite<M4>(suite, "mix4", M4::AUDIO0_INPUT, M4::CHANNEL0_OUTPUT, [](M4& mix, float) {
+        mix.init();
+        mix.onSampleRateChange();
+        mix.inputs[M4::AUDIO0_INPUT].channels = 1;
+    });
+
+    using MS = MixStereo<TestComposite>;
+    addComposite<MS>(suite, "mix stereo", MS::AUDIO0_INPUT, MS::CHANNEL0_OUTPUT, [](MS& mix, float) {
+        mix.init();
+        mix.onSampleRateChange();
+        mix.inputs[MS::AUDIO0_INPUT].channels = 1;
+    });
+}
+
+/**
+ * What every case does besides the real work: feed the input.
+ */
+static Benchmark::Block makeOverhead(const Benchmark::Config& config)
+{
+    const int blockSize = config.blockSize;
+    auto buffer = std::make_shared<std::vector<float>>(blockSize);
+    return [buffer, blockSize]() {
+        float* input = buffer->data();
+        for (int i = 0; i < blockSize; ++i) {
+            input[i] = TestBuffers<float>::get();
+        }
+        return input[blockSize - 1];
+    };
+}
+
+template <typename T>
+static std::vector<T> parseList(const char* arg)
+{
+    std::vector<T> ret;
+    std::stringstream s(arg);
+    std::string item;
+    while (std::getline(s, item, ',')) {
+        ret.push_back(T(atof(item.c_str())));
+    }
+    return ret;
+}
+
+static void usage()
+{
+    printf("usage: --bench [options]\n");
+    printf("  --list                 print the names of the cases\n");
+    printf("  --filter <text>        only run cases with text in their name\n");
+    printf("  --rates <r1,r2..>      sample rates (default 44100)\n");
+    printf("  --blocks <b1,b2..>     block sizes (default 1, which uses step())\n");
+    printf("  --cache warm|cold|both cold runs many instances interleaved (default warm)\n");
+    printf("  --instances <n>        instances for cold cache (default 32)\n");
+    printf("  --evict <bytes>        memory to read between instances for cold cache (default 0)\n");
+    printf("  --time <seconds>       time per case (default .5)\n");
+    printf("  --trials <n>           trials per case (default 5)\n");
+    printf("  --format text|json|csv (default text)\n");
+    printf("  --out <file>           write results here instead of stdout\n");
+    printf("  --input <file>         don't run, read saved results instead\n");
+    printf("  --baseline <file>      compare against saved results\n");
+    printf("  --threshold <percent>  slow down that counts as a regression (default 10)\n");
+    printf("returns 1 if there are any regressions, 2 for bad arguments\n");
+}
+
+int benchmark(int argc, char** argv)
+{
+    Benchmark suite(makeOverhead);
+    addNoise(suite);
+    addOscillators(suite);
+    addProcessors(suite);
+    addMixers(suite);
+
+    Benchmark::Options options;
+    std::string format = "text";
+    std::string outPath;
+    std::string inputPath;
+    std::string baselinePath;
+    double threshold = 10;
+    for (int i = 0; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (arg == "--list") {
+            for (auto& name : suite.getNames()) {
+                printf("%s\n", name.c_str());
+            }
+            return 0;
+        }
+        if (!value) {
+            usage();
+            return 2;
+        }
+        ++i;
+        if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--rates") {
+            options.sampleRates = parseList<float>(value);
+        } else if (arg == "--blocks") {
+            options.blockSizes = parseList<int>(value);
+        } else if (arg == "--cache") {
+            const std::string cache = value;
+            if (cache == "warm") {
+                options.cacheModes = {false};
+            } else if (cache == "cold") {
+                options.cacheModes = {true};
+            } else if (cache == "both") {
+                options.cacheModes = {false, true};
+            } else {
+                usage();
+                return 2;
+            }
+        } else if (arg == "--instances") {
+            options.coldInstances = std::max(1, atoi(value));
+        } else if (arg == "--evict") {
+            options.coldMemoryPerInstance = std::max(0, atoi(value));
+        } else if (arg == "--time") {
+            options.minTime = atof(value);
+        } else if (arg == "--trials") {
+            options.trials = std::max(1, atoi(value));
+        } else if (arg == "--format") {
+            format = value;
+        } else if (arg == "--out") {
+            outPath = value;
+        } else if (arg == "--input") {
+            inputPath = value;
+        } else if (arg == "--baseline") {
+            baselinePath = value;
+        } else if (arg == "--threshold") {
+            threshold = atof(value);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if (format != "text" && format != "json" && format != "csv") {
+        usage();
+        return 2;
+    }
+    for (int blockSize : options.blockSizes) {
+        if (blockSize < 1) {
+            usage();
+            return 2;
+        }
+    }
+
+    std::vector<Benchmark::Result> results;
+    if (!inputPath.empty()) {
+        if (!Benchmark::read(inputPath, results)) {
+            fprintf(stderr, "can't read results from %s\n", inputPath.c_str());
+            return 2;
+        }
+    } else {
+#ifndef NDEBUG
+        fprintf(stderr, "warning: asserts are on, so everything will be slow\n");
+#endif
+        // progress goes to stderr, so stdout can be redirected to a file
+        results = suite.run(options, [](const Benchmark::Result& r) {
+            fprintf(stderr, "%s %d %d %s: %.2f ns\n", r.name.c_str(), int(r.sampleRate),
+                r.blockSize, r.cold ? "cold" : "warm", r.nsPerSample);
+        });
+    }
+
+    FILE* out = stdout;
+    if (!outPath.empty()) {
+        out = fopen(outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "can't write %s\n", outPath.c_str());
+            return 2;
+        }
+    }
+    if (format == "json") {
+        Benchmark::writeJSON(out, results);
+    } else if (format == "csv") {
+        Benchmark::writeCSV(out, results);
+    } else {
+        Benchmark::writeText(out, results);
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    if (!baselinePath.empty()) {
+        std::vector<Benchmark::Result> baseline;
+        if (!Benchmark::read(baselinePath, baseline)) {
+            fprintf(stderr, "can't read baseline from %s\n", baselinePath.c_str());
+            return 2;
+        }
+        // when the results are going to stdout, keep the comparison out of them
+        FILE* report = outPath.empty() && format != "text" ? stderr : stdout;
+        fprintf(report, "\n");
+        if (Benchmark::compare(report, baseline, results, threshold) > 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
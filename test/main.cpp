@@ -17,10 +17,11 @@ extern void testAudioMath();
 extern void initPerf();
 extern void perfTest();
 extern void perfTest2();
+extern int benchmark(int argc, char** argv);
 extern void testFrequencyShifter();
 extern void testStateVariable();
 extern void testVocalAnimator();
-extern void testObjectCache();
+extern void testObjectCache(bool doEmit);
 extern void testThread(bool exended);
 extern void testFFT();
 extern void testRingBuffer();
@@ -28,6 +29,13 @@ extern void testManagedPool();
 extern void testColoredNoise();
 extern void testFFTCrossFader();
 extern void testFinalLeaks();
+extern void testBenchmark();
+extern void testDspTiming();
+extern void testRandomSimd();
+extern void testLFN();
+extern void testBlockBus();
+extern void testMixStrips();
+extern void testMixPolyVoices();
 extern void testClockMult();
 extern void testTremolo();
 extern void testGateTrigger();
@@ -38,6 +46,7 @@ extern void testGMR();
 extern void testLowpassFilter();
 extern void testPoly();
 extern void testVCO();
+extern void testMinBLEPVCOSimd();
 extern void testFilterDesign();
 extern void testVCOAlias();
 extern void testSin();
@@ -47,6 +56,7 @@ extern void testSpline(bool emit);
 extern void testButterLookup();
 extern void testMidiDataModel();
 extern void testMidiSong();
+extern void testMidiTrackCodec();
 extern void testReplaceCommand();
 extern void testUndoRedo();
 extern void testMidiViewport();
@@ -59,6 +69,7 @@ extern void testIComposite();
 extern void testMidiEditor();
 extern void testMidiEditorNextPrev();
 extern void testNoteScreenScale();
+extern void testNoteRenderCache();
 extern void testMidiEditorCCP();
 extern void testMidiEditorSelection();
 extern void testSeqComposite();
@@ -78,6 +89,8 @@ extern void testAudition();
 extern void testStepRecordInput();
 extern void testMidiFile();
 extern void testNewSongDataDataCommand();
+extern void testSuper();
+extern void testBlockProcess();
 
 #if 0
 #include <sstream>
@@ -108,8 +121,10 @@ int main(int argc, char ** argv)
 {
    // xx();
     bool runPerf = false;
+    bool runBench = false;
     bool extended = false;
     bool runShaperGen = false;
+    bool runTableGen = false;
     bool cq = false;
     if (argc > 1) {
         std::string arg = argv[1];
@@ -117,8 +132,12 @@ int main(int argc, char ** argv)
             extended = true;
         } else if (arg == "--perf") {
             runPerf = true;
+        } else if (arg == "--bench") {
+            runBench = true;
         } else if (arg == "--shaper") {
             runShaperGen = true;
+        } else if (arg == "--tables") {
+            runTableGen = true;
         } else if (arg == "--calQ") {
             cq = true;
         } else {
@@ -140,11 +159,21 @@ int main(int argc, char ** argv)
         return 0;
     }
 
+    if (runTableGen) {
+        testObjectCache(true);
+        return 0;
+    }
+
     if (cq) {
         calQ();
         return 0;
     }
 
+    // before perf, since perf.exe always runs perf
+    if (runBench) {
+        return benchmark(argc - 2, argv + 2);
+    }
+
     if (runPerf) {
         initPerf();
         perfTest2();
@@ -163,6 +192,7 @@ int main(int argc, char ** argv)
     testFilteredIterator();
     testMidiDataModel();
     testMidiSong();
+    testMidiTrackCodec();
     testSeqClock();
     testMidiPlayer2();
     testReplaceCommand();
@@ -177,6 +207,7 @@ int main(int argc, char ** argv)
     testMidiEditor();
     testMidiEditorCCP();
     testNoteScreenScale();
+    testNoteRenderCache();
     testSeqComposite();
     testAudition();
 
@@ -185,7 +216,7 @@ int main(int argc, char ** argv)
 
     testManagedPool();
     testLookupTable();
-    testObjectCache();
+    testObjectCache(false);
     testMultiLag();
     testSlew4();   
     testMixHelper();
@@ -207,6 +238,7 @@ int main(int argc, char ** argv)
     testButterLookup();
    
     testVCO();
+    testMinBLEPVCOSimd();
    
    // testSin();
 
@@ -214,6 +246,13 @@ int main(int argc, char ** argv)
 
     testFFT();
     testAnalyzer();
+    testBenchmark();
+    testDspTiming();
+    testRandomSimd();
+    testLFN();
+    testBlockBus();
+    testMixStrips();
+    testMixPolyVoices();
     testRateConversion();
     testUtils();
     //testLowpassFilter();
@@ -228,6 +267,7 @@ int main(int argc, char ** argv)
     testFFTCrossFader();
     if (extended) {
         testThread(extended);
+        testVCOAlias();
     }
 
     
@@ -242,6 +282,8 @@ int main(int argc, char ** argv)
 
     testFrequencyShifter();
     testVocalAnimator();
+    testSuper();
+    testBlockProcess();
 #endif
 
 
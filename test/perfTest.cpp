@@ -2,15 +2,26 @@
 #include <time.h>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <sstream>
 
 #include "AudioMath.h"
 #include "BiquadParams.h"
 #include "BiquadFilter.h"
+#include "BiquadFilterSimd.h"
 #include "BiquadState.h"
+#include "ButterworthFilterDesigner.h"
 #include "ColoredNoise.h"
+#include "FFT.h"
 #include "FrequencyShifter.h"
+#include "HalfBandDecimator.h"
+#include "HalfBandUpsampler.h"
 #include "HilbertFilterDesigner.h"
+#include "IIRDecimator.h"
+#include "IIRUpsampler.h"
 #include "LookupTableFactory.h"
+#include "MinBLEPVCO.h"
+#include "MinBLEPVCOSimd.h"
 #include "TestComposite.h"
 #include "Tremolo.h"
 #include "VocalAnimator.h"
@@ -19,13 +30,29 @@
 #include "LFNB.h"
 #include "GMR.h"
 #include "CHB.h"
+#include "Filt.h"
 #include "FunVCOComposite.h"
-//#include "EV3.h"
+#include "EV3.h"
 #include "daveguide.h"
 #include "Shaper.h"
 #include "Super.h"
 #include "KSComposite.h"
+#include "Mix8.h"
+#include "MidiFile.h"
+#include "MidiFileProxy.h"
+#include "MidiLock.h"
+#include "MidiSelectionModel.h"
+#include "MidiSequencer.h"
+#include "MidiTrackCodec.h"
+#include "MixerChain.h"
+#include "MixM.h"
+#include "NoteRenderCache.h"
+#include "NoteScreenScale.h"
+#include "PitchUtils.h"
+#include "RandomSimd.h"
 #include "Seq.h"
+#include "TestAuditionHost.h"
+#include "TestSettings.h"
 
 extern double overheadInOut;
 extern double overheadOutOnly;
@@ -166,6 +193,156 @@ static void testShifter()
         }, 1);
 }
 
+/**
+ * Sixteen times oversampled, one sample at a time vs. block mode.
+ */
+static void testBiquadBlock()
+{
+    BiquadParams<float, 3> params;
+    ButterworthFilterDesigner<float>::designSixPoleLowpass(params, 1.f / 64);
+    BiquadState<float, 3> state;
+    float buffer[16];
+
+    MeasureTime<float>::run(overheadInOut, "biquad run x16", [&]() {
+        const float x = TestBuffers<float>::get();
+        float y = 0;
+        for (int i = 0; i < 16; ++i) {
+            y = BiquadFilter<float>::run(x, state, params);
+        }
+        return y;
+        }, 1);
+
+    MeasureTime<float>::run(overheadInOut, "biquad runBlock x16", [&]() {
+        const float x = TestBuffers<float>::get();
+        for (int i = 0; i < 16; ++i) {
+            buffer[i] = x;
+        }
+        return BiquadFilter<float>::runBlock(buffer, nullptr, 16, state, params);
+        }, 1);
+
+    IIRUpsampler up;
+    IIRDecimator dec;
+    up.setup(16);
+    dec.setup(16);
+    MeasureTime<float>::run(overheadInOut, "up/down sample x16", [&]() {
+        up.process(buffer, TestBuffers<float>::get());
+        return dec.process(buffer);
+        }, 1);
+}
+
+/**
+ * Four filters with different taps, scalar vs. SoA.
+ */
+static void testBiquadSimd()
+{
+    BiquadParams<float, 3> params[4];
+    BiquadState<float, 3> states[4];
+    BiquadParamsSimd<3> simdParams;
+    BiquadStateSimd<3> simdState;
+    for (int i = 0; i < 4; ++i) {
+        ButterworthFilterDesigner<float>::designSixPoleLowpass(params[i], .01f * (i + 1));
+        simdParams.setLane(i, params[i]);
+    }
+
+    MeasureTime<float>::run(overheadInOut, "biquad 4 scalar", [&]() {
+        const float x = TestBuffers<float>::get();
+        float y = 0;
+        for (int i = 0; i < 4; ++i) {
+            y += BiquadFilter<float>::run(x, states[i], params[i]);
+        }
+        return y;
+        }, 1);
+
+    MeasureTime<float>::run(overheadInOut, "biquad 4 simd", [&]() {
+        const __m128 y = BiquadFilterSimd::run(_mm_set_ps1(TestBuffers<float>::get()), simdState, simdParams);
+        return _mm_cvtss_f32(y);
+        }, 1);
+}
+
+static void testBiquads()
+{
+    testBiquadBlock();
+    testBiquadSimd();
+    testShifter();
+}
+
+/**
+ * The IIR and polyphase resamplers, up and then down.
+ */
+template <class Up, class Dec>
+static void testResampler(const char* name, int oversample)
+{
+    Up up;
+    Dec dec;
+    up.setup(oversample);
+    dec.setup(oversample);
+    float buffer[16];
+    MeasureTime<float>::run(overheadInOut, name, [&]() {
+        up.process(buffer, TestBuffers<float>::get());
+        return dec.process(buffer);
+        }, 1);
+}
+
+template <class Dec>
+static void testDecimatorSimd(const char* name)
+{
+    Dec dec;
+    dec.setup(16);
+    __m128 buffer[16];
+    MeasureTime<float>::run(overheadInOut, name, [&]() {
+        const __m128 x = _mm_set_ps1(TestBuffers<float>::get());
+        for (int i = 0; i < 16; ++i) {
+            buffer[i] = x;
+        }
+        return _mm_cvtss_f32(dec.process(buffer));
+        }, 1);
+}
+
+static void testShaperResampler(const char* name, bool polyphase)
+{
+    using Comp = Shaper<TestComposite>;
+    Comp shaper;
+    shaper.params[Comp::PARAM_OVERSAMPLE].value = 0;
+    shaper.params[Comp::PARAM_POLYPHASE].value = polyphase ? 1.f : 0.f;
+    shaper.params[Comp::PARAM_SHAPE].value = (float) Comp::Shapes::FullWave;
+    shaper.inputs[Comp::INPUT_AUDIO0].channels = 1;
+    shaper.outputs[Comp::OUTPUT_AUDIO0].channels = 1;
+
+    MeasureTime<float>::run(overheadInOut, name, [&shaper]() {
+        shaper.inputs[Comp::INPUT_AUDIO0].setVoltage(TestBuffers<float>::get(), 0);
+        shaper.step();
+        return shaper.outputs[Comp::OUTPUT_AUDIO0].getVoltage(0);
+        }, 1);
+}
+
+static void testSuperResampler(const char* name, bool polyphase)
+{
+    using Comp = Super<TestComposite>;
+    Comp super;
+    super.params[Comp::CLEAN_PARAM].value = 2;
+    super.params[Comp::POLYPHASE_PARAM].value = polyphase ? 1.f : 0.f;
+    super.outputs[Comp::MAIN_OUTPUT_LEFT].channels = 1;
+
+    MeasureTime<float>::run(overheadOutOnly, name, [&super]() {
+        super.step();
+        return super.outputs[Comp::MAIN_OUTPUT_LEFT].getVoltage(0);
+        }, 1);
+}
+
+static void testResamplers()
+{
+    testResampler<IIRUpsampler, IIRDecimator>("IIR up/down x4", 4);
+    testResampler<HalfBandUpsampler, HalfBandDecimator>("polyphase up/down x4", 4);
+    testResampler<IIRUpsampler, IIRDecimator>("IIR up/down x16", 16);
+    testResampler<HalfBandUpsampler, HalfBandDecimator>("polyphase up/down x16", 16);
+    testDecimatorSimd<IIRDecimatorSimd>("IIR decimate simd x16");
+    testDecimatorSimd<HalfBandDecimatorSimd>("polyphase decimate simd x16");
+    testShaperResampler("shaper fw 16X IIR", false);
+    testShaperResampler("shaper fw 16X polyphase", true);
+    testSuperResampler("super clean2 IIR", false);
+    testSuperResampler("super clean2 polyphase", true);
+}
+
 static void testAnimator()
 {
     Animator an;
@@ -199,6 +376,37 @@ static void testVocalFilter()
         }, 1);
 }
 
+template <class Comp>
+static void testVocalPoly(const char* name, int channels)
+{
+    Comp comp;
+
+    comp.setSampleRate(44100);
+    comp.init();
+    comp.inputs[Comp::AUDIO_INPUT].channels = channels;
+    comp.outputs[Comp::AUDIO_OUTPUT].channels = 1;
+
+    std::string fullName = std::string(name) + " poly " + std::to_string(channels);
+    MeasureTime<float>::run(overheadInOut, fullName.c_str(), [&comp, channels]() {
+        const float x = TestBuffers<float>::get();
+        for (int i = 0; i < channels; ++i) {
+            comp.inputs[Comp::AUDIO_INPUT].setVoltage(x, i);
+        }
+        comp.step();
+        return comp.outputs[Comp::AUDIO_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+static void testVocalPoly()
+{
+    testVocalFilter();
+    testAnimator();
+    testVocalPoly<VocFilter>("vocal filter", 4);
+    testVocalPoly<VocFilter>("vocal filter", 16);
+    testVocalPoly<Animator>("animator", 4);
+    testVocalPoly<Animator>("animator", 16);
+}
+
 static void testColors()
 {
     Colors co;
@@ -501,17 +709,155 @@ static void testCHBdef()
         }, 1);
 }
 
-#if 0
+static void testCHBPoly(int channels)
+{
+    using C = CHB<TestComposite>;
+    C chb;
+    chb.inputs[C::CV_INPUT].channels = channels;
+    chb.outputs[C::MIX_OUTPUT].channels = channels;
+    std::string name = "chb poly " + std::to_string(channels);
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&chb]() {
+        chb.step();
+        return chb.outputs[C::MIX_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+/**
+ * What poly costs if done the old way, one instance per voice
+ */
+static void testCHBMono16()
+{
+    using C = CHB<TestComposite>;
+    std::vector<std::unique_ptr<C>> chbs;
+    for (int i = 0; i < 16; ++i) {
+        chbs.push_back(std::unique_ptr<C>(new C()));
+    }
+    MeasureTime<float>::run(overheadOutOnly, "chb 16 mono", [&chbs]() {
+        float ret = 0;
+        for (auto& chb : chbs) {
+            chb->step();
+            ret += chb->outputs[C::MIX_OUTPUT].getVoltage(0);
+        }
+        return ret;
+        }, 1);
+}
+
+static void testCHBPoly()
+{
+    testCHBPoly(4);
+    testCHBPoly(16);
+    testCHBMono16();
+}
+
 static void testEV3()
 {
-    EV3<TestComposite> ev3;
+    using C = EV3<TestComposite>;
+    C ev3;
+    ev3.outputs[C::MIX_OUTPUT].channels = 1;
 
     MeasureTime<float>::run(overheadOutOnly, "ev3", [&ev3]() {
         ev3.step();
-        return ev3.outputs[EV3<TestComposite>::MIX_OUTPUT].value;
+        return ev3.outputs[C::MIX_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+static void testEV3Poly(int channels)
+{
+    using C = EV3<TestComposite>;
+    C ev3;
+    ev3.inputs[C::CV1_INPUT].channels = channels;
+    for (int i = 0; i < C::NUM_OUTPUTS; ++i) {
+        ev3.outputs[i].channels = 1;
+    }
+    ev3.params[C::MIX2_PARAM].value = 1;
+    ev3.params[C::SYNC2_PARAM].value = 1;
+    std::string name = "ev3 poly " + std::to_string(channels);
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&ev3]() {
+        ev3.step();
+        return ev3.outputs[C::MIX_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+/**
+ * What poly costs if done the old way, one instance per voice
+ */
+static void testEV3Mono16()
+{
+    using C = EV3<TestComposite>;
+    std::vector<std::unique_ptr<C>> ev3s;
+    for (int i = 0; i < 16; ++i) {
+        ev3s.push_back(std::unique_ptr<C>(new C()));
+        ev3s.back()->outputs[C::MIX_OUTPUT].channels = 1;
+    }
+    MeasureTime<float>::run(overheadOutOnly, "ev3 16 mono", [&ev3s]() {
+        float ret = 0;
+        for (auto& ev3 : ev3s) {
+            ev3->step();
+            ret += ev3->outputs[C::MIX_OUTPUT].getVoltage(0);
+        }
+        return ret;
+        }, 1);
+}
+
+/**
+ * 16 voices of three saws, scalar vs. SIMD oscillator core.
+ */
+static void testMinBLEPVCOCore()
+{
+    std::vector<MinBLEPVCO> scalar(48);
+    for (int i = 0; i < 48; ++i) {
+        scalar[i].setNormalizedFreq(.001f + .0003f * i, 1 / 44100.f);
+    }
+    MeasureTime<float>::run(overheadOutOnly, "minblep vco scalar x48", [&scalar]() {
+        float ret = 0;
+        for (auto& vco : scalar) {
+            vco.step();
+            ret += vco.getOutput();
+        }
+        return ret;
+        }, 1);
+
+    std::vector<MinBLEPVCOSimd> simd(12);
+    for (int i = 0; i < 12; ++i) {
+        const float f = .001f + .0012f * i;
+        simd[i].setNormalizedFreq(_mm_setr_ps(f, f + .0003f, f + .0006f, f + .0009f), 1 / 44100.f);
+    }
+    MeasureTime<float>::run(overheadOutOnly, "minblep vco simd x12", [&simd]() {
+        __m128 sum = _mm_setzero_ps();
+        for (auto& vco : simd) {
+            vco.step();
+            sum = _mm_add_ps(sum, vco.getOutput());
+        }
+        return _mm_cvtss_f32(sum);
         }, 1);
 }
-#endif
+
+static void testFunPoly(int channels)
+{
+    using C = FunVCOComposite<TestComposite>;
+    C fun;
+    fun.setSampleRate(44100);
+    fun.inputs[C::PITCH_INPUT].channels = channels;
+    fun.outputs[C::SIN_OUTPUT].channels = 0;
+    fun.outputs[C::TRI_OUTPUT].channels = 0;
+    fun.outputs[C::SQR_OUTPUT].channels = 0;
+    fun.outputs[C::SAW_OUTPUT].channels = 1;
+    std::string name = "funv poly saw " + std::to_string(channels);
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&fun]() {
+        fun.step();
+        return fun.outputs[C::SAW_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+static void testEV3Poly()
+{
+    testEV3();
+    testEV3Poly(4);
+    testEV3Poly(16);
+    testEV3Mono16();
+    testMinBLEPVCOCore();
+    testFunPoly(16);
+}
 
 static void testGMR()
 {
@@ -631,6 +977,186 @@ static void testSuper3()
         return super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(0);
         }, 1);
 }
+/**
+ * Measures a polyphonic Super, and reports the cost per voice.
+ */
+static void testSuperPoly(int channels, int clean, bool stereo)
+{
+    Super<TestComposite> super;
+
+    super.params[Super<TestComposite>::CLEAN_PARAM].value = float(clean);
+    super.inputs[Super<TestComposite>::CV_INPUT].channels = channels;
+    super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].channels = 1;
+    if (stereo) {
+        super.outputs[Super<TestComposite>::MAIN_OUTPUT_RIGHT].channels = 1;
+    }
+    for (int i = 0; i < channels; ++i) {
+        super.inputs[Super<TestComposite>::CV_INPUT].setVoltage(i * .1f, i);
+    }
+
+    std::string title = "super poly " + std::to_string(channels) +
+        " clean " + std::to_string(clean) +
+        (stereo ? " stereo" : "");
+    const double percent = MeasureTime<float>::run(overheadOutOnly, title.c_str(), [&super]() {
+        super.step();
+        return super.outputs[Super<TestComposite>::MAIN_OUTPUT_LEFT].getVoltage(0) +
+            super.outputs[Super<TestComposite>::MAIN_OUTPUT_RIGHT].getVoltage(0);
+        }, 1);
+    printf("%s: cost per voice %f\n", title.c_str(), percent / channels);
+}
+
+/**
+ * Compares the cost of step() and the block process() for a composite.
+ * Each call of the block lambda does a whole block, so we divide
+ * to get the cost per sample. Both are driven from the same audio input.
+ */
+template <class TComp>
+static void testStepVsBlock(const char* name, TComp& stepped, TComp& blocked, int inputId, int outputId)
+{
+    const std::string stepName = std::string(name) + " step";
+    const double stepPercent = MeasureTime<float>::run(overheadInOut, stepName.c_str(), [&stepped, inputId, outputId]() {
+        stepped.inputs[inputId].setVoltage(TestBuffers<float>::get(), 0);
+        stepped.step();
+        return stepped.outputs[outputId].getVoltage(0);
+        }, 1);
+
+    const int blockSize = 64;
+    float input[blockSize];
+    float output[blockSize];
+    SqProcessArgs args;
+    args.setInput(inputId, 0, input);
+    args.setOutput(outputId, 0, output);
+
+    const std::string blockName = std::string(name) + " block";
+    const double blockPercent = MeasureTime<float>::run(0, blockName.c_str(), [&]() {
+        for (int i = 0; i < blockSize; ++i) {
+            input[i] = TestBuffers<float>::get();
+        }
+        blocked.process(args, blockSize);
+        return output[blockSize - 1];
+        }, 1) / blockSize;
+
+    printf("%s: step %f block %f\n", name, stepPercent, blockPercent);
+}
+
+static void testMix8Block()
+{
+    using M = Mix8<TestComposite>;
+    M stepped, blocked;
+    for (M* m : {&stepped, &blocked}) {
+        m->init();
+        m->inputs[M::AUDIO0_INPUT].channels = 1;
+        m->outputs[M::LEFT_OUTPUT].channels = 1;
+    }
+    testStepVsBlock("mix8", stepped, blocked, M::AUDIO0_INPUT, M::LEFT_OUTPUT);
+}
+
+static void testMixMBlock()
+{
+    using M = MixM<TestComposite>;
+    M stepped, blocked;
+    for (M* m : {&stepped, &blocked}) {
+        m->init();
+        m->inputs[M::AUDIO0_INPUT].channels = 1;
+        m->outputs[M::LEFT_OUTPUT].channels = 1;
+    }
+    testStepVsBlock("mixM", stepped, blocked, M::AUDIO0_INPUT, M::LEFT_OUTPUT);
+}
+
+static void testTremoloBlock()
+{
+    Trem stepped, blocked;
+    for (Trem* t : {&stepped, &blocked}) {
+        t->setSampleRate(44100);
+        t->init();
+        t->inputs[Trem::AUDIO_INPUT].channels = 1;
+        t->outputs[Trem::AUDIO_OUTPUT].channels = 1;
+    }
+    testStepVsBlock("trem", stepped, blocked, Trem::AUDIO_INPUT, Trem::AUDIO_OUTPUT);
+}
+
+static void testCHBBlock()
+{
+    using C = CHB<TestComposite>;
+    C stepped, blocked;
+    testStepVsBlock("chb", stepped, blocked, C::CV_INPUT, C::MIX_OUTPUT);
+}
+
+static void testSuperBlock()
+{
+    using S = Super<TestComposite>;
+    S stepped, blocked;
+    for (S* s : {&stepped, &blocked}) {
+        s->outputs[S::MAIN_OUTPUT_LEFT].channels = 1;
+    }
+    testStepVsBlock("super", stepped, blocked, S::FM_INPUT, S::MAIN_OUTPUT_LEFT);
+}
+
+/**
+ * Eight mixers chained together, as in a 32 channel mix.
+ * Cost is for the whole chain.
+ */
+static void testMixerChain(const char* name, bool blockBus)
+{
+    MixerChain chain(7);
+    chain.setBlockBus(blockBus);
+    for (int i = 0; i < chain.numModules(); ++i) {
+        chain.setInput(i, 1);
+    }
+    MeasureTime<float>::run(overheadInOut, name, [&chain]() {
+        chain.setInput(1, TestBuffers<float>::get());
+        chain.step();
+        return chain.getOutput();
+        }, 1);
+}
+
+static void testMixerChain()
+{
+    testMixerChain("mixer chain x8", false);
+    testMixerChain("mixer chain x8 block bus", true);
+}
+
+/**
+ * Mixer-8 with a 16 voice input on every channel, voices spread out.
+ */
+static void testMix8PolySpread()
+{
+    using M = Mix8<TestComposite>;
+    M mix;
+    mix.init();
+    mix.params[M::VOICE_SPREAD_PARAM].value = 1;
+    for (int i = 0; i < M::numChannels; ++i) {
+        mix.inputs[M::AUDIO0_INPUT + i].channels = 16;
+        for (int voice = 0; voice < 16; ++voice) {
+            mix.inputs[M::AUDIO0_INPUT + i].setVoltage(1, voice);
+        }
+    }
+    MeasureTime<float>::run(overheadInOut, "mix8 poly spread 8x16", [&mix]() {
+        mix.inputs[M::AUDIO0_INPUT].setVoltage(TestBuffers<float>::get(), 0);
+        mix.step();
+        return mix.outputs[M::LEFT_OUTPUT].getVoltage(0);
+        }, 1);
+}
+
+static void testBlock()
+{
+    testMix8Block();
+    testMixMBlock();
+    testTremoloBlock();
+    testCHBBlock();
+    testSuperBlock();
+}
+
+static void testSuperPoly()
+{
+    const int channelCounts[] = {1, 4, 16};
+    for (int channels : channelCounts) {
+        testSuperPoly(channels, 0, false);
+        testSuperPoly(channels, 0, true);
+        testSuperPoly(channels, 2, false);
+    }
+}
+
 #if 0
 static void testSuper2()
 {
@@ -844,6 +1370,426 @@ static void testNormal()
 }
 #endif
 
+/**
+ * Normal noise from the std library, the way LFN used to make it,
+ * vs. RandomSimd one at a time, and a block at a time.
+ */
+static void testRandom()
+{
+    std::default_random_engine generator{57};
+    std::normal_distribution<double> distribution{0, 1.0};
+    const double stdPercent = MeasureTime<float>::run(overheadOutOnly, "std normal", [&distribution, &generator]() {
+        return float(distribution(generator));
+        }, 1);
+
+    RandomSimd random;
+    const double scalarPercent = MeasureTime<float>::run(overheadOutOnly, "RandomSimd normal", [&random]() {
+        return random.normal();
+        }, 1);
+
+    const int blockSize = 64;
+    float block[blockSize];
+    const double blockPercent = MeasureTime<float>::run(overheadOutOnly, "RandomSimd normal block 64", [&random, &block]() {
+        random.fillNormal(block, blockSize);
+        return block[0];
+        }, 1);
+    printf("RandomSimd normal is %.1fX faster than std, %.1fX in blocks\n",
+        stdPercent / scalarPercent, stdPercent * blockSize / blockPercent);
+
+    AudioMath::RandomUniformFunc uniform = AudioMath::random();
+    MeasureTime<float>::run(overheadOutOnly, "AudioMath::random", [&uniform]() {
+        return uniform();
+        }, 1);
+    MeasureTime<float>::run(overheadOutOnly, "RandomSimd uniform", [&random]() {
+        return random.uniform();
+        }, 1);
+}
+
+/**
+ * Compares walking all the notes of a big track through the
+ * multimap, and through the flat events.
+ */
+/**
+ * Patch save and load of a track with numNotes notes.
+ * Compares MidiTrackCodec to the old way of loading one note at a time.
+ */
+static void testMidiTrackCodec(int numNotes)
+{
+    auto lock = MidiLock::make();
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    std::vector<MidiEventPtr> events;
+    {
+        MidiLocker l(lock);
+        for (int i = 0; i < numNotes; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = i * .25f;
+            note->pitchCV = PitchUtils::pitchToCV(3 + (i % 24) / 12, i % 12);
+            note->duration = .25f;
+            track->insertEvent(note);
+            events.push_back(note);
+        }
+        track->insertEnd(numNotes * .25f);
+    }
+
+    const int iterations = std::max(1, 200000 / numNotes);
+    std::string data;
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        data = MidiTrackCodec::encode(*track);
+    }
+    const double encodeMs = (SqTime::seconds() - t0) * 1000 / iterations;
+
+    MidiLocker l(lock);
+    t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        MidiTrackPtr track2 = MidiTrackCodec::decode(data, lock);
+        assert(track2);
+    }
+    const double decodeMs = (SqTime::seconds() - t0) * 1000 / iterations;
+
+    t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        MidiTrackPtr track2 = std::make_shared<MidiTrack>(lock);
+        for (auto ev : events) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>(*safe_cast<MidiNoteEvent>(ev));
+            track2->insertEvent(note);
+        }
+    }
+    const double insertMs = (SqTime::seconds() - t0) * 1000 / iterations;
+
+    printf("track codec %d notes: %d bytes, encode %f ms, decode %f ms, insert per note %f ms\n",
+        numNotes, int(data.size()), encodeMs, decodeMs, insertMs);
+}
+
+static void testMidiTrackCodec()
+{
+    testMidiTrackCodec(1000);
+    testMidiTrackCodec(20000);
+    testMidiTrackCodec(100000);
+}
+
+/**
+ * Import of a MIDI file with numNotes notes.
+ * Compares MidiFileProxy::parseNotes to reading it all into smf::MidiFile.
+ */
+static void testMidiFileImport(int numNotes)
+{
+    smf::MidiFile midiFile;
+    midiFile.setTPQ(480);
+    for (int i = 0; i < numNotes; ++i) {
+        const int key = 48 + (i % 24);
+        midiFile.addNoteOn(0, i * 120, 0, key, 0x3f);
+        midiFile.addNoteOff(0, i * 120 + 100, 0, key);
+        midiFile.addController(0, i * 120, 0, 7, i & 0x7f);
+    }
+    std::vector<smf::uchar> endData;
+    midiFile.addMetaEvent(0, numNotes * 120, 0x2f, endData);
+    midiFile.sortTracks();
+    std::stringstream stream;
+    midiFile.write(stream);
+    const std::string str = stream.str();
+    const std::vector<uint8_t> data(str.begin(), str.end());
+
+    const int iterations = std::max(1, 200000 / numNotes);
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        MidiSongPtr song = MidiFileProxy::parseNotes(data.data(), data.size());
+        assert(song);
+    }
+    const double parseMs = (SqTime::seconds() - t0) * 1000 / iterations;
+
+    t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        std::stringstream in(str);
+        smf::MidiFile midiFile2;
+        midiFile2.read(in);
+        midiFile2.makeAbsoluteTicks();
+        midiFile2.linkNotePairs();
+        MidiSongPtr song = std::make_shared<MidiSong>();
+        MidiTrackPtr track = MidiFileProxy::getFirst(song, midiFile2);
+        assert(track);
+    }
+    const double smfMs = (SqTime::seconds() - t0) * 1000 / iterations;
+
+    printf("midi file import %d notes: parseNotes %f ms, smf %f ms\n", numNotes, parseMs, smfMs);
+}
+
+static void testMidiFileImport()
+{
+    testMidiFileImport(1000);
+    testMidiFileImport(20000);
+    testMidiFileImport(100000);
+}
+
+/**
+ * One frame of note editor geometry, with numNotes notes on the screen
+ * and half of them selected. Compares a frame where nothing
+ * changed to one where everything has to be re-built.
+ */
+static void testNoteRenderCache(int numNotes)
+{
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiTrackPtr track = std::make_shared<MidiTrack>(song->lock);
+    std::vector<MidiEventPtr> notes;
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = 8.f * i / numNotes;
+        note->duration = .25f;
+        note->setPitch(3 + (i % 36) / 12, i % 12);
+        notes.push_back(note);
+    }
+    {
+        MidiLocker l(song->lock);
+        track->insertEvents(notes);
+        track->insertEnd(8);
+    }
+    song->addTrack(0, track);
+
+    MidiSequencerPtr seq = MidiSequencer::make(song, std::make_shared<TestSettings>(), std::make_shared<TestAuditionHost>());
+    seq->context->setTimeRange(0, 8);
+    seq->context->setPitchRange(PitchUtils::pitchToCV(3, 0), PitchUtils::pitchToCV(6, 0));
+    seq->context->setCursorPitch(PitchUtils::pitchToCV(3, 0));
+    seq->context->setScaler(std::make_shared<NoteScreenScale>(800, 400, 10, 20));
+    seq->selection->setAuditionSuppressed(true);
+    for (int i = 0; i < numNotes; i += 2) {
+        seq->selection->extendSelection(notes[i]);
+    }
+
+    NoteRenderCache cache;
+    cache.update(*seq, 800, 400, false);
+    const int iterations = std::max(10, 100000 / numNotes);
+    double t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        cache.update(*seq, 800, 400, false);
+    }
+    const double cachedUs = (SqTime::seconds() - t0) * 1000000 / iterations;
+
+    t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        cache.invalidate();
+        cache.update(*seq, 800, 400, false);
+    }
+    const double buildUs = (SqTime::seconds() - t0) * 1000000 / iterations;
+    printf("note render cache %d notes: cached frame %f us, re-build %f us\n", numNotes, cachedUs, buildUs);
+}
+
+static void testNoteRenderCache()
+{
+    testNoteRenderCache(100);
+    testNoteRenderCache(5000);
+}
+
+class NullPlayerHost : public IMidiPlayerHost
+{
+public:
+    void setGate(int voice, bool gate) override
+    {
+    }
+    void setCV(int voice, float pitch) override
+    {
+    }
+    void setTrackGate(int track, int voice, bool gate) override
+    {
+        sum += gate;
+    }
+    void setTrackCV(int track, int voice, float pitch) override
+    {
+        sum += pitch;
+    }
+    void onLockFailed() override
+    {
+    }
+    float sum = 0;
+};
+
+static MidiSongPtr makeSongForPlayer(int numTracks)
+{
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiLocker l(song->lock);
+    for (int t = 0; t < numTracks; ++t) {
+        song->createTrack(t);
+        MidiTrackPtr track = song->getTrack(t);
+        for (int i = 0; i < 64; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = i * .25f;
+            note->pitchCV = float((i + t) % 24) / 12.f;
+            note->duration = .2f;
+            track->insertEvent(note);
+        }
+        track->insertEnd(16);
+    }
+    return song;
+}
+
+/**
+ * One player with numTracks tracks, against numTracks players with one track each,
+ * like chaining several sequencers.
+ */
+static void testMidiPlayerTracks(int numTracks)
+{
+    // 120 bpm at 44.1k
+    const double metricTimePerSample = 2.0 / 44100.0;
+    auto host = std::make_shared<NullPlayerHost>();
+
+    MidiSongPtr song = makeSongForPlayer(numTracks);
+    auto player = std::make_shared<MidiPlayer2>(host, song);
+    player->setNumVoices(4);
+    double time = 0;
+    std::string name = "midi player " + std::to_string(numTracks) + " tracks";
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [player, host, &time, metricTimePerSample]() {
+        time += metricTimePerSample;
+        player->updateToMetricTime(time, .25f, true);
+        player->updateSampleCount(1);
+        return host->sum;
+        }, 1);
+
+    std::vector<std::shared_ptr<MidiPlayer2>> players;
+    for (int i = 0; i < numTracks; ++i) {
+        players.push_back(std::make_shared<MidiPlayer2>(host, makeSongForPlayer(1)));
+        players.back()->setNumVoices(4);
+    }
+    time = 0;
+    name = "midi player " + std::to_string(numTracks) + " players";
+    MeasureTime<float>::run(overheadOutOnly, name.c_str(), [&players, host, &time, metricTimePerSample]() {
+        time += metricTimePerSample;
+        for (auto& pl : players) {
+            pl->updateToMetricTime(time, .25f, true);
+            pl->updateSampleCount(1);
+        }
+        return host->sum;
+        }, 1);
+}
+
+static void testMidiPlayerTracks()
+{
+    testMidiPlayerTracks(1);
+    testMidiPlayerTracks(16);
+}
+
+static void testMidiTrackWalk()
+{
+    auto lock = MidiLock::make();
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    {
+        MidiLocker l(lock);
+        const int numNotes = 20000;
+        for (int i = 0; i < numNotes; ++i) {
+            MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+            note->startTime = i * .25f;
+            note->pitchCV = float(i % 24) / 12.f;
+            note->duration = .2f;
+            track->insertEvent(note);
+        }
+        track->insertEnd(numNotes * .25f);
+    }
+
+    const double mapPercent = MeasureTime<float>::run(0, "midi walk map", [track]() {
+        float sum = 0;
+        for (const auto& it : *track) {
+            const MidiEvent* event = it.second.get();
+            if (event->type == MidiEvent::Type::Note) {
+                sum += static_cast<const MidiNoteEvent*>(event)->pitchCV;
+            }
+        }
+        return sum;
+        }, 1);
+
+    const double flatPercent = MeasureTime<float>::run(0, "midi walk flat", [track]() {
+        float sum = 0;
+        for (const auto& event : track->getFlatEvents()) {
+            if (event.type == MidiEvent::Type::Note) {
+                sum += event.pitchCV;
+            }
+        }
+        return sum;
+        }, 1);
+    printf("midi walk: map %f flat %f\n", mapPercent, flatPercent);
+}
+
+/**
+ * Regenerate a noise buffer, the way ColoredNoise does when the slope moves.
+ * Fresh buffers and no scratch, vs. re-using them.
+ */
+static void testFFTNoise()
+{
+    const int bins = 4096;
+    ColoredNoiseSpec spec;
+    spec.slope = -3;
+
+    const double freshPercent = MeasureTime<float>::run(0, "fft noise fresh", [&spec]() {
+        FFTDataCpx spectrum(bins);
+        FFTDataReal noise(bins);
+        FFT::makeNoiseSpectrum(&spectrum, spec);
+        FFT::inverse(&noise, spectrum);
+        return noise.get(0);
+        }, 1);
+
+    FFTDataCpx spectrum(bins);
+    FFTDataReal noise(bins);
+    FFTScratch scratch(bins);
+    const double scratchPercent = MeasureTime<float>::run(0, "fft noise scratch", [&spec, &spectrum, &noise, &scratch]() {
+        FFT::makeNoiseSpectrum(&spectrum, spec);
+        FFT::inverse(&noise, spectrum, scratch);
+        return noise.get(0);
+        }, 1);
+    printf("fft noise: fresh %f scratch %f\n", freshPercent, scratchPercent);
+}
+
+/**
+ * Time to make a few typical modules, as when a patch loads.
+ * Returns milliseconds.
+ */
+static double measurePatchLoad(int iterations)
+{
+    const double t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        Mix8<TestComposite> mix8;
+        mix8.init();
+        Super<TestComposite> super;
+        super.init();
+        VocFilter vocalFilter;
+        vocalFilter.init();
+        Tremolo<TestComposite> tremolo;
+        tremolo.init();
+        Filt<TestComposite> filt;
+        filt.init();
+        CHB<TestComposite> chb;
+    }
+    return (SqTime::seconds() - t0) * 1000 / iterations;
+}
+
+/**
+ * Time for ObjectCache to make everything. Milliseconds.
+ */
+static double measureWarmUp(int iterations, bool parallel)
+{
+    const double t0 = SqTime::seconds();
+    for (int i = 0; i < iterations; ++i) {
+        ObjectCache<float>::warmUp(parallel);
+        ObjectCache<double>::warmUp(parallel);
+        ObjectCache<float>::unpin();
+        ObjectCache<double>::unpin();
+    }
+    return (SqTime::seconds() - t0) * 1000 / iterations;
+}
+
+static void testStartup()
+{
+    const int iterations = 200;
+    const double cold = measurePatchLoad(iterations);
+    const double warmUpParallel = measureWarmUp(iterations, true);
+    const double warmUp = measureWarmUp(iterations, false);
+
+    ObjectCache<float>::warmUp(true);
+    ObjectCache<double>::warmUp(true);
+    const double pinned = measurePatchLoad(iterations);
+    ObjectCache<float>::unpin();
+    ObjectCache<double>::unpin();
+
+    printf("startup ms: patch load cold %f pinned %f, warm up %f parallel %f\n",
+        cold, pinned, warmUp, warmUpParallel);
+}
+
 void dummy()
 {
     MidiSongPtr ms = MidiSong::makeTest(MidiTrack::TestContent::empty, 0);
@@ -872,11 +1818,28 @@ void perfTest()
 
 
     testCHBdef();
+    testCHBPoly();
+    testEV3Poly();
+    testVocalPoly();
+    testBiquads();
+    testResamplers();
     testSuper();
     testSuperStereo();
     testSuper2();
     testSuper2Stereo();
     testSuper3();
+    testSuperPoly();
+    testBlock();
+    testMixerChain();
+    testMix8PolySpread();
+    testMidiTrackWalk();
+    testMidiPlayerTracks();
+    testMidiTrackCodec();
+    testMidiFileImport();
+    testNoteRenderCache();
+    testFFTNoise();
+    testRandom();
+    testStartup();
   //  testKS();
   //  testShaper1a();
 #if 0
@@ -888,8 +1851,6 @@ void perfTest()
     testShaper5();
 #endif
 
-   // testEV3();
-
     testFunSaw(true);
 #if 0
     testFunSaw(false);
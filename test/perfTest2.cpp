@@ -134,6 +134,50 @@ static void testNonUniform()
     }, 1);
 }
 
+static void testNonUniformMap()
+{
+    std::shared_ptr<NonUniformLookupTableParams<float>> lookup = makeLPFilterL_Lookup<float>();
+
+    MeasureTime<float>::run(overheadInOut, "non-uniform map", [lookup]() {
+        float x = TestBuffers<float>::get();
+        return  NonUniformLookupTable<float>::lookupMap(*lookup, x);
+    }, 1);
+}
+
+/**
+ * cost per lookup, doing four at a time.
+ * Compare with testUniformLookup
+ */
+static void testUniformLookup4()
+{
+    std::shared_ptr<LookupTableParams<float>> lookup = ObjectCache<float>::getSinLookup();
+    double percent = MeasureTime<float>::run(0, "uniform4", [lookup]() {
+        __m128 x = _mm_set_ps(TestBuffers<float>::get(), TestBuffers<float>::get(),
+            TestBuffers<float>::get(), TestBuffers<float>::get());
+        x = LookupTable<float>::lookup4(*lookup, x);
+        return _mm_cvtss_f32(x);
+    }, 1);
+    printf("uniform4: cost per lookup %f\n", percent / 4);
+}
+
+/**
+ * cost per lookup, doing the eight pan lookups Mix8 does.
+ */
+static void testUniformLookupBlock()
+{
+    std::shared_ptr<LookupTableParams<float>> lookup = ObjectCache<float>::getMixerPanL();
+    float input[8];
+    float output[8];
+    double percent = MeasureTime<float>::run(0, "uniform block", [lookup, &input, &output]() {
+        for (int i = 0; i < 8; ++i) {
+            input[i] = TestBuffers<float>::get();
+        }
+        LookupTable<float>::lookupBlock(*lookup, input, output, 8);
+        return output[7];
+    }, 1);
+    printf("uniform block: cost per lookup %f\n", percent / 8);
+}
+
 using Slewer = Slew4<TestComposite>;
 
 static void testSlew4()
@@ -199,6 +243,36 @@ static void testFilt2()
      }, 1);
 }
 
+/**
+ * Measures a polyphonic Filt, and reports the cost per voice.
+ */
+static void testFiltPoly(int channels)
+{
+    Filter fs;
+    fs.init();
+    fs.inputs[Filter::L_AUDIO_INPUT].channels = channels;
+    fs.outputs[Filter::L_AUDIO_OUTPUT].channels = 1;
+    assert(overheadInOut >= 0);
+
+    const std::string title = "filt poly " + std::to_string(channels);
+    const double percent = MeasureTime<float>::run(overheadInOut, title.c_str(), [&fs, channels]() {
+        const float x = TestBuffers<float>::get();
+        for (int i = 0; i < channels; ++i) {
+            fs.inputs[Filter::L_AUDIO_INPUT].setVoltage(x, i);
+        }
+        fs.step();
+        return fs.outputs[Filter::L_AUDIO_OUTPUT].getVoltage(0);
+        }, 1);
+    printf("%s: cost per voice %f\n", title.c_str(), percent / channels);
+}
+
+static void testFiltPoly()
+{
+    testFiltPoly(2);
+    testFiltPoly(4);
+    testFiltPoly(16);
+}
+
 using Mixer8 = Mix8<TestComposite>;
 static void testMix8()
 {
@@ -271,6 +345,7 @@ void perfTest2()
     testDrumTrigger();
     testFilt();
     testFilt2();
+    testFiltPoly();
     testSlew4();
     testMixStereo();
     testMix8();
@@ -279,6 +354,9 @@ void perfTest2()
    
     testUniformLookup();
     testNonUniform();
+    testNonUniformMap();
+    testUniformLookup4();
+    testUniformLookupBlock();
     testMultiLPF();
     testMultiLPFMod();
     testMultiLag();
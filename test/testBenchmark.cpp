@@ -0,0 +1,169 @@
+#include "asserts.h"
+#include "Benchmark.h"
+
+static Benchmark::Result makeResult(const char* name, float sampleRate, int blockSize, bool cold, double ns)
+{
+    Benchmark::Result r;
+    r.name = name;
+    r.sampleRate = sampleRate;
+    r.blockSize = blockSize;
+    r.cold = cold;
+    r.nsPerSample = ns;
+    r.nsPerSampleMedian = ns + 1;
+    return r;
+}
+
+static std::vector<Benchmark::Result> makeResults()
+{
+    return {
+        makeResult("super poly 16", 44100, 1, false, 123.5),
+        makeResult("super poly 16", 96000, 64, true, 234.25),
+        makeResult("lfn", 48000, 1, false, 4),
+    };
+}
+
+static void assertSameResults(const std::vector<Benchmark::Result>& a, const std::vector<Benchmark::Result>& b)
+{
+    assertEQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        assert(a[i].name == b[i].name);
+        assertEQ(a[i].sampleRate, b[i].sampleRate);
+        assertEQ(a[i].blockSize, b[i].blockSize);
+        assertEQ(a[i].cold, b[i].cold);
+        assertClose(a[i].nsPerSample, b[i].nsPerSample, .001);
+        assertClose(a[i].nsPerSampleMedian, b[i].nsPerSampleMedian, .001);
+    }
+}
+
+/**
+ * Writes results with fn, and returns what was written.
+ */
+static std::string write(void (*fn)(FILE*, const std::vector<Benchmark::Result>&),
+    const std::vector<Benchmark::Result>& results)
+{
+    FILE* file = tmpfile();
+    assert(file);
+    fn(file, results);
+    rewind(file);
+    std::string text;
+    char buffer[1024];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, n);
+    }
+    fclose(file);
+    return text;
+}
+
+static void testPercent()
+{
+    // 1000 ns per sample is 44.1 ms per second
+    auto r = makeResult("x", 44100, 1, false, 1000);
+    assertClose(r.percent(), 4.41, .00001);
+}
+
+static void testRoundTripJSON()
+{
+    const auto results = makeResults();
+    const std::string text = write(Benchmark::writeJSON, results);
+    std::vector<Benchmark::Result> parsed;
+    assert(Benchmark::parse(text, parsed));
+    assertSameResults(results, parsed);
+}
+
+static void testRoundTripCSV()
+{
+    const auto results = makeResults();
+    const std::string text = write(Benchmark::writeCSV, results);
+    std::vector<Benchmark::Result> parsed;
+    assert(Benchmark::parse(text, parsed));
+    assertSameResults(results, parsed);
+}
+
+static void testParseBad()
+{
+    std::vector<Benchmark::Result> parsed;
+    assert(!Benchmark::parse("", parsed));
+    assert(!Benchmark::parse("hello", parsed));
+    assert(!Benchmark::parse("{\"results\": [{\"name\": \"x\"}]}", parsed));
+}
+
+static void testCompare()
+{
+    const auto baseline = makeResults();
+    auto current = baseline;
+
+    FILE* out = tmpfile();
+    assertEQ(Benchmark::compare(out, baseline, current, 10), 0);
+
+    // 5% is noise, 20% is a regression
+    current[0].nsPerSample *= 1.05;
+    assertEQ(Benchmark::compare(out, baseline, current, 10), 0);
+    current[1].nsPerSample *= 1.2;
+    assertEQ(Benchmark::compare(out, baseline, current, 10), 1);
+
+    // faster is fine, and so are new and missing cases
+    current[2].nsPerSample *= .5;
+    current.push_back(makeResult("new", 44100, 1, false, 1000));
+    current.erase(current.begin());
+    assertEQ(Benchmark::compare(out, baseline, current, 10), 1);
+    fclose(out);
+}
+
+static void testRun()
+{
+    Benchmark suite([](const Benchmark::Config&) {
+        return []() {
+            return 0.f;
+        };
+    });
+    float x = 0;
+    suite.add("sum", [&x](const Benchmark::Config& config) {
+        const int blockSize = config.blockSize;
+        return [&x, blockSize]() {
+            for (int i = 0; i < blockSize; ++i) {
+                x += .1f;
+            }
+            return x;
+        };
+    });
+    suite.add("other", [](const Benchmark::Config&) {
+        return []() {
+            return 0.f;
+        };
+    });
+
+    Benchmark::Options options;
+    options.sampleRates = {44100, 96000};
+    options.blockSizes = {1, 16};
+    options.cacheModes = {false, true};
+    options.coldInstances = 3;
+    options.minTime = .001;
+    options.trials = 2;
+    options.filter = "sum";
+
+    int calls = 0;
+    const auto results = suite.run(options, [&calls](const Benchmark::Result&) {
+        ++calls;
+    });
+    assertEQ(results.size(), 8);
+    assertEQ(calls, 8);
+    for (auto& r : results) {
+        assert(r.name == "sum");
+        assertGE(r.nsPerSample, 0);
+    }
+    assertEQ(results[0].sampleRate, 44100);
+    assertEQ(results[7].sampleRate, 96000);
+    assertEQ(results[7].blockSize, 16);
+    assertEQ(results[7].cold, true);
+}
+
+void testBenchmark()
+{
+    testPercent();
+    testRoundTripJSON();
+    testRoundTripCSV();
+    testParseBad();
+    testCompare();
+    testRun();
+}
@@ -8,10 +8,14 @@
 #include "ButterworthFilterDesigner.h"
 #include "BiquadFilter.h"
 #include "BiquadFilter.h"
+#include "BiquadFilterSimd.h"
 #include "BiquadParams.h"
 #include "BiquadParams.h"
 #include "BiquadState.h"
 #include "BiquadState.h"
+#include "asserts.h"
+
+#include <vector>
 
 template<typename T, int N>
 static void testState_0()
@@ -181,6 +185,114 @@ static void testBasicFilter3()
 }
 
 
+static float testSignal(int i)
+{
+    return (i % 37 < 11) ? 1.f : -.3f;
+}
+
+// block mode should be exactly the same as sample at a time
+template<typename T>
+static void testBlock(bool inPlace)
+{
+    BiquadParams<T, 3> params;
+    ButterworthFilterDesigner<T>::designSixPoleLowpass(params, T(.05));
+    BiquadState<T, 3> state;
+    BiquadState<T, 3> blockState;
+
+    const int blockSize = 16;
+    std::vector<T> input(blockSize);
+    std::vector<T> output(blockSize);
+    for (int block = 0; block < 20; ++block) {
+        for (int i = 0; i < blockSize; ++i) {
+            input[i] = testSignal(block * blockSize + i);
+        }
+        T* out = inPlace ? input.data() : output.data();
+        const T last = BiquadFilter<T>::runBlock(input.data(), out, blockSize, blockState, params);
+        for (int i = 0; i < blockSize; ++i) {
+            const T expected = BiquadFilter<T>::run(testSignal(block * blockSize + i), state, params);
+            assertEQ(out[i], expected);
+        }
+        assertEQ(last, out[blockSize - 1]);
+    }
+}
+
+// only asking for the last sample is the same as the full block
+static void testBlockLastOnly()
+{
+    BiquadParams<float, 2> params;
+    ButterworthFilterDesigner<float>::designThreePoleLowpass(params, .1f);
+    BiquadState<float, 2> state;
+    BiquadState<float, 2> lastState;
+
+    float input[8];
+    float output[8];
+    for (int block = 0; block < 20; ++block) {
+        for (int i = 0; i < 8; ++i) {
+            input[i] = testSignal(block * 8 + i);
+        }
+        BiquadFilter<float>::runBlock(input, output, 8, state, params);
+        assertEQ(BiquadFilter<float>::runBlock(input, nullptr, 8, lastState, params), output[7]);
+    }
+}
+
+static float getLane(__m128 x, int lane)
+{
+    float buffer[4];
+    _mm_storeu_ps(buffer, x);
+    return buffer[lane];
+}
+
+// each lane of the SoA filter is exactly the same as the scalar filter
+static void testSimdLanes()
+{
+    BiquadParams<float, 2> params[4];
+    BiquadState<float, 2> states[4];
+    BiquadParamsSimd<2> simdParams;
+    BiquadStateSimd<2> simdState;
+
+    ButterworthFilterDesigner<float>::designThreePoleLowpass(params[0], .1f);
+    ButterworthFilterDesigner<float>::designThreePoleLowpass(params[1], .013f);
+    ButterworthFilterDesigner<float>::designFourPoleHighpass(params[2], .02f);
+    ButterworthFilterDesigner<float>::designFourPoleLowpass(params[3], .3f);
+    for (int lane = 0; lane < 4; ++lane) {
+        simdParams.setLane(lane, params[lane]);
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        const __m128 y = BiquadFilterSimd::run(_mm_setr_ps(
+            testSignal(i), testSignal(i + 1), testSignal(i + 2), testSignal(i + 3)), simdState, simdParams);
+        for (int lane = 0; lane < 4; ++lane) {
+            const float expected = BiquadFilter<float>::run(testSignal(i + lane), states[lane], params[lane]);
+            assertEQ(getLane(y, lane), expected);
+        }
+    }
+}
+
+static void testSimdBlock()
+{
+    BiquadParams<float, 3> params;
+    ButterworthFilterDesigner<float>::designSixPoleLowpass(params, .05f);
+    BiquadStateSimd<3> state;
+    BiquadStateSimd<3> blockState;
+
+    __m128 buffer[16];
+    for (int block = 0; block < 10; ++block) {
+        for (int i = 0; i < 16; ++i) {
+            const int n = block * 16 + i;
+            buffer[i] = _mm_setr_ps(testSignal(n), testSignal(n + 5), 0, -testSignal(n));
+        }
+        BiquadFilterSimd::runBlock(buffer, buffer, 16, blockState, params);
+        for (int i = 0; i < 16; ++i) {
+            const int n = block * 16 + i;
+            const __m128 expected = BiquadFilterSimd::run(
+                _mm_setr_ps(testSignal(n), testSignal(n + 5), 0, -testSignal(n)), state, params);
+            for (int lane = 0; lane < 4; ++lane) {
+                assertEQ(getLane(buffer[i], lane), getLane(expected, lane));
+            }
+        }
+    }
+}
+
 void testBiquad()
 {
     testState_0<double, 1>();
@@ -202,5 +314,12 @@ void testBiquad()
     testBasicFilter3<double>();
     testBasicFilter3<float>();
 
+    testBlock<float>(false);
+    testBlock<float>(true);
+    testBlock<double>(false);
+    testBlockLastOnly();
+    testSimdLanes();
+    testSimdBlock();
+
     // TODO: actually measure the freq resp
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "asserts.h"
+#include "BlockBus.h"
+#include "MixerChain.h"
+
+// eight mixers: the master and seven expanders
+static const int numExpanders = 7;
+
+static void settle(MixerChain& chain)
+{
+    for (int i = 0; i < 1000; ++i) {
+        chain.step();
+    }
+}
+
+/**
+ * Puts an impulse into one mixer in the chain, and returns
+ * how many samples later it comes out of the master.
+ */
+static int measureLatency(MixerChain& chain, int module)
+{
+    for (int i = 0; i < chain.numModules(); ++i) {
+        chain.setInput(i, 0);
+    }
+    settle(chain);
+    assertEQ(chain.getOutput(), 0);
+
+    chain.setInput(module, 1);
+    for (int latency = 0; latency < 100; ++latency) {
+        chain.step();
+        chain.setInput(module, 0);
+        if (chain.getOutput() != 0) {
+            return latency;
+        }
+    }
+    assert(false);
+    return -1;
+}
+
+// without the block bus each expander adds a sample
+static void testChainLatencyPerSample()
+{
+    MixerChain chain(numExpanders);
+    for (int module = 0; module <= numExpanders; ++module) {
+        assertEQ(measureLatency(chain, module), module);
+    }
+    assertEQ(chain.bus->getNumActive(), 0);
+}
+
+static void testChainLatencyBlock(bool shuffle)
+{
+    MixerChain chain(numExpanders);
+    chain.setBlockBus(true);
+    chain.setShuffle(shuffle);
+    assertEQ(measureLatency(chain, 0), 0);
+    for (int module = 1; module <= numExpanders; ++module) {
+        assertEQ(measureLatency(chain, module), BlockBus::blockSize);
+    }
+    assertEQ(chain.bus->getNumActive(), numExpanders);
+
+    // and they all have the same clock
+    for (int module = 1; module <= numExpanders; ++module) {
+        assertEQ(chain.getFrame(module), chain.getFrame(0));
+    }
+}
+
+// the mix should be the same either way, just later
+static float getSteadyOutput(bool block)
+{
+    MixerChain chain(numExpanders);
+    chain.setBlockBus(block);
+    for (int module = 0; module <= numExpanders; ++module) {
+        chain.setInput(module, 1);
+    }
+    settle(chain);
+    return chain.getOutput();
+}
+
+static void testChainLevel()
+{
+    const float perSample = getSteadyOutput(false);
+    assertGT(perSample, numExpanders * .1f);
+    assertClose(getSteadyOutput(true), perSample, .0001);
+}
+
+// an expander that isn't on the block bus (yet) still gets heard,
+// through the ones that are
+static void testChainPassThrough()
+{
+    MixerChain chain(numExpanders);
+    chain.setBlockBus(true);
+    chain.disconnectFromBus(numExpanders);
+    assertEQ(measureLatency(chain, numExpanders), numExpanders);
+    assertEQ(measureLatency(chain, 1), BlockBus::blockSize);
+    assertEQ(chain.bus->getNumActive(), numExpanders - 1);
+}
+
+// turning it on and off should just work
+static void testChainSwitch()
+{
+    MixerChain chain(numExpanders);
+    for (int module = 0; module <= numExpanders; ++module) {
+        chain.setInput(module, 1);
+    }
+    settle(chain);
+    const float expected = chain.getOutput();
+
+    chain.setBlockBus(true);
+    settle(chain);
+    assertClose(chain.getOutput(), expected, .0001);
+
+    chain.setBlockBus(false);
+    settle(chain);
+    assertClose(chain.getOutput(), expected, .0001);
+    assertEQ(chain.bus->getNumActive(), 0);
+}
+
+// only whole blocks get summed, and frame numbers can wrap
+static void testBlockBusWrap()
+{
+    BlockBus bus;
+    const float x[BlockBus::frameStride] = {1, 2, 3, 4, 5, 6, 0, 0};
+    const uint32_t start = uint32_t(0) - 2 * BlockBus::blockSize;
+
+    // start half way through a block, so the first block is no good
+    uint32_t frame = start - BlockBus::blockSize / 2;
+    for (int i = 0; i < 4 * BlockBus::blockSize; ++i, ++frame) {
+        const float* out = bus.read(frame);
+        bus.write(1, frame, x);
+
+        // first whole block starts at 'start', and comes out a block later
+        const int sinceStart = i - BlockBus::blockSize / 2;
+        const bool expectData = sinceStart >= BlockBus::blockSize;
+        assertEQ(out[0], (expectData ? 1.f : 0.f));
+        assertEQ(out[5], (expectData ? 6.f : 0.f));
+    }
+}
+
+void testBlockBus()
+{
+    testBlockBusWrap();
+    testChainLatencyPerSample();
+    testChainLatencyBlock(false);
+    testChainLatencyBlock(true);
+    testChainLevel();
+    testChainPassThrough();
+    testChainSwitch();
+}
@@ -0,0 +1,282 @@
+/**
+ * Tests for the block processing API: process(args, frames)
+ * should give the same output as calling step() 'frames' times.
+ */
+
+#include "asserts.h"
+#include "TestComposite.h"
+#include "CHB.h"
+#include "Filt.h"
+#include "Mix8.h"
+#include "MixM.h"
+#include "Super.h"
+#include "Tremolo.h"
+
+#include <cmath>
+
+class PortSpec
+{
+public:
+    int id;
+    int channels;
+};
+
+/**
+ * deterministic test signal for a given input channel
+ */
+static float getTestInput(int id, int channel, int frame)
+{
+    return 5 * std::sin(.013f * (frame + 1) * (id + 1) + channel);
+}
+
+/**
+ * Runs two identically configured composites, one with step(), one with process(),
+ * and checks that all the outputs match.
+ */
+template <class T>
+static void testBlockMatchesStep(
+    std::function<void(T&)> setup,
+    const std::vector<PortSpec>& inputs,
+    const std::vector<PortSpec>& outputs,
+    int blockSize,
+    float tolerance = 0)
+{
+    T stepped;
+    T blocked;
+    setup(stepped);
+    setup(blocked);
+
+    const int maxChannels = SqProcessArgs::maxChannels;
+    const int numBlocks = 30;
+
+    // [port][channel][frame]
+    std::vector<float> inputData(inputs.size() * maxChannels * blockSize);
+    std::vector<float> outputData(outputs.size() * maxChannels * blockSize);
+    auto inputBuffer = [&](int port, int channel) {
+        return inputData.data() + (port * maxChannels + channel) * blockSize;
+    };
+    auto outputBuffer = [&](int port, int channel) {
+        return outputData.data() + (port * maxChannels + channel) * blockSize;
+    };
+
+    SqProcessArgs args;
+    for (int port = 0; port < int(inputs.size()); ++port) {
+        for (int channel = 0; channel < inputs[port].channels; ++channel) {
+            args.setInput(inputs[port].id, channel, inputBuffer(port, channel));
+        }
+    }
+    for (int port = 0; port < int(outputs.size()); ++port) {
+        for (int channel = 0; channel < outputs[port].channels; ++channel) {
+            args.setOutput(outputs[port].id, channel, outputBuffer(port, channel));
+        }
+    }
+
+    int frameCount = 0;
+    for (int block = 0; block < numBlocks; ++block) {
+        for (int frame = 0; frame < blockSize; ++frame) {
+            for (int port = 0; port < int(inputs.size()); ++port) {
+                for (int channel = 0; channel < inputs[port].channels; ++channel) {
+                    inputBuffer(port, channel)[frame] = getTestInput(inputs[port].id, channel, frameCount + frame);
+                }
+            }
+        }
+
+        blocked.process(args, blockSize);
+
+        for (int frame = 0; frame < blockSize; ++frame) {
+            for (int port = 0; port < int(inputs.size()); ++port) {
+                for (int channel = 0; channel < inputs[port].channels; ++channel) {
+                    stepped.inputs[inputs[port].id].setVoltage(inputBuffer(port, channel)[frame], channel);
+                }
+            }
+            stepped.step();
+            for (int port = 0; port < int(outputs.size()); ++port) {
+                for (int channel = 0; channel < outputs[port].channels; ++channel) {
+                    const float expected = stepped.outputs[outputs[port].id].getVoltage(channel);
+                    const float actual = outputBuffer(port, channel)[frame];
+                    if (tolerance == 0) {
+                        assertEQ(actual, expected);
+                    } else {
+                        assertClose(actual, expected, tolerance);
+                    }
+                }
+            }
+        }
+        frameCount += blockSize;
+
+        // ports should be left the same as step() would leave them
+        for (int port = 0; port < int(outputs.size()); ++port) {
+            for (int channel = 0; channel < outputs[port].channels; ++channel) {
+                assertEQ(blocked.outputs[outputs[port].id].getVoltage(channel),
+                    stepped.outputs[outputs[port].id].getVoltage(channel));
+            }
+        }
+    }
+}
+
+static void connect(TestComposite& comp, const std::vector<PortSpec>& inputs, const std::vector<PortSpec>& outputs)
+{
+    for (auto port : inputs) {
+        comp.inputs[port.id].channels = port.channels;
+    }
+    for (auto port : outputs) {
+        comp.outputs[port.id].channels = port.channels;
+    }
+}
+
+static const int blockSizes[] = {1, 3, 4, 64};
+
+static void testMix8(bool perVoice)
+{
+    using M = Mix8<TestComposite>;
+    std::vector<PortSpec> inputs = {
+        {M::AUDIO0_INPUT, 1}, {M::AUDIO3_INPUT, perVoice ? 5 : 1}, {M::AUDIO7_INPUT, 1},
+        {M::LEVEL3_INPUT, 1}, {M::PAN0_INPUT, 1}, {M::LEFT_RETURN_INPUT, 1}
+    };
+    if (perVoice) {
+        inputs.push_back({M::PAN3_INPUT, 3});
+    }
+    std::vector<PortSpec> outputs = {
+        {M::LEFT_OUTPUT, 1}, {M::RIGHT_OUTPUT, 1}, {M::LEFT_SEND_OUTPUT, 1},
+        {M::RIGHT_SEND_OUTPUT, 1}, {M::CHANNEL3_OUTPUT, 1}
+    };
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<M>([&](M& m) {
+            connect(m, inputs, outputs);
+            m.init();
+            m.params[M::MASTER_VOLUME_PARAM].value = 1;
+            m.params[M::RETURN_GAIN_PARAM].value = .5f;
+            for (int i = 0; i < M::numChannels; ++i) {
+                m.params[M::GAIN0_PARAM + i].value = 1;
+                m.params[M::SEND0_PARAM + i].value = .3f;
+            }
+            m.params[M::MUTE7_PARAM].value = 1;
+            m.params[M::VOICE_SPREAD_PARAM].value = perVoice ? 1.f : 0.f;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+static void testMixM(bool perVoice)
+{
+    using M = MixM<TestComposite>;
+    std::vector<PortSpec> inputs = {
+        {M::AUDIO0_INPUT, 1}, {M::AUDIO1_INPUT, 3}, {M::AUDIO3_INPUT, 1},
+        {M::PAN1_INPUT, perVoice ? 3 : 1}, {M::RIGHT_RETURNb_INPUT, 1}
+    };
+    std::vector<PortSpec> outputs = {
+        {M::LEFT_OUTPUT, 1}, {M::RIGHT_OUTPUT, 1}, {M::LEFT_SENDb_OUTPUT, 1},
+        {M::RIGHT_SEND_OUTPUT, 1}, {M::CHANNEL1_OUTPUT, 1}
+    };
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<M>([&](M& m) {
+            connect(m, inputs, outputs);
+            m.init();
+            m.params[M::MASTER_VOLUME_PARAM].value = 1;
+            m.params[M::RETURN_GAINb_PARAM].value = .5f;
+            for (int i = 0; i < M::numChannels; ++i) {
+                m.params[M::GAIN0_PARAM + i].value = 1;
+                m.params[M::SEND0_PARAM + i].value = .3f;
+                m.params[M::SENDb0_PARAM + i].value = .6f;
+            }
+            m.params[M::VOICE_PAN_PARAM].value = perVoice ? 1.f : 0.f;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+static void testTremolo()
+{
+    using Trem = Tremolo<TestComposite>;
+    std::vector<PortSpec> inputs = {
+        {Trem::AUDIO_INPUT, 1}, {Trem::CLOCK_INPUT, 1}, {Trem::MOD_DEPTH_INPUT, 1}
+    };
+    std::vector<PortSpec> outputs = {
+        {Trem::AUDIO_OUTPUT, 1}, {Trem::SAW_OUTPUT, 1}, {Trem::LFO_OUTPUT, 1}
+    };
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<Trem>([&](Trem& t) {
+            connect(t, inputs, outputs);
+            t.setSampleRate(44100);
+            t.init();
+            t.params[Trem::CLOCK_MULT_PARAM].value = 4;
+            t.params[Trem::MOD_DEPTH_TRIM_PARAM].value = 1;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+static void testCHB(bool external, int channels)
+{
+    using C = CHB<TestComposite>;
+    std::vector<PortSpec> inputs;
+    if (external) {
+        inputs = {{C::AUDIO_INPUT, channels}, {C::GAIN_INPUT, 1}, {C::H2_INPUT, channels}};
+    } else if (channels > 1) {
+        inputs = {{C::CV_INPUT, channels}, {C::ENV_INPUT, channels}};
+    }
+    std::vector<PortSpec> outputs = {{C::MIX_OUTPUT, channels}};
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<C>([&](C& c) {
+            connect(c, inputs, outputs);
+            c.params[C::PARAM_H2].value = 1;
+            c.params[C::PARAM_EXTGAIN_TRIM].value = 1;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+static void testSuper(int channels, int clean, bool stereo)
+{
+    using S = Super<TestComposite>;
+    // no trigger, the random phases would be different for the two instances
+    std::vector<PortSpec> inputs = {{S::CV_INPUT, channels}, {S::FM_INPUT, 1}};
+    std::vector<PortSpec> outputs = {{S::MAIN_OUTPUT_LEFT, channels}};
+    if (stereo) {
+        outputs.push_back({S::MAIN_OUTPUT_RIGHT, channels});
+    }
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<S>([&](S& s) {
+            connect(s, inputs, outputs);
+            s.params[S::CLEAN_PARAM].value = float(clean);
+            s.params[S::DETUNE_PARAM].value = 2;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+static void testSuper()
+{
+    testSuper(1, 0, false);
+    testSuper(5, 0, true);
+    testSuper(2, 1, false);
+    testSuper(3, 2, true);
+}
+
+/**
+ * Composites that don't override process() get the default, which
+ * just calls step().
+ */
+static void testDefault()
+{
+    using F = Filt<TestComposite>;
+    std::vector<PortSpec> inputs = {{F::L_AUDIO_INPUT, 1}, {F::CV_INPUT1, 1}};
+    std::vector<PortSpec> outputs = {{F::L_AUDIO_OUTPUT, 1}};
+    for (int blockSize : blockSizes) {
+        testBlockMatchesStep<F>([&](F& f) {
+            connect(f, inputs, outputs);
+            f.init();
+            f.params[F::MASTER_VOLUME_PARAM].value = 1;
+            }, inputs, outputs, blockSize);
+    }
+}
+
+void testBlockProcess()
+{
+    testMix8(false);
+    testMix8(true);
+    testMixM(false);
+    testMixM(true);
+    testTremolo();
+    testCHB(false, 1);
+    testCHB(true, 1);
+    testCHB(false, 7);
+    testCHB(true, 16);
+    testSuper();
+    testDefault();
+}
@@ -7,6 +7,7 @@
 #include "FFT.h"
 
 #include "asserts.h"
+#include <complex>
 
 // test that the API does something
 static void testButterLookup0()
@@ -95,8 +96,66 @@ static void testButterLookup1()
     //doHighTest(100);
 }
 
+/**
+ * Response of the filter at normalized frequency f, in dB.
+ */
+template <typename T>
+static double getResponseDb(const BiquadParams<T, 2>& params, double f)
+{
+    const std::complex<double> z1 = std::polar(1.0, -2 * AudioMath::Pi * f);      // z ** -1
+    std::complex<double> h = 1;
+    for (int stage = 0; stage < 2; ++stage) {
+        const std::complex<double> num = double(params.B0(stage)) + double(params.B1(stage)) * z1 +
+            double(params.B2(stage)) * z1 * z1;
+        const std::complex<double> den = 1.0 - double(params.A1(stage)) * z1 - double(params.A2(stage)) * z1 * z1;
+        h *= num / den;
+    }
+    return AudioMath::db(std::abs(h));
+}
+
+// the 3 pole lowpass lookup should match the designer everywhere, including between the bins
+static void testButterLookup3PLP()
+{
+    ButterworthLookup3PLP<double> lookup;
+    const double octaves = std::log2(lookup.maxCutoff() / lookup.minCutoff());
+    for (double x = 0; x <= octaves; x += .07) {
+        const double fc = lookup.minCutoff() * std::exp2(x);
+        BiquadParams<double, 2> expected;
+        BiquadParams<double, 2> actual;
+        ButterworthFilterDesigner<double>::designThreePoleLowpass(expected, fc);
+        lookup.get(actual, fc);
+
+        for (double f : { 0.0, fc / 2, fc, 2 * fc, 4 * fc }) {
+            const double expectedDb = getResponseDb(expected, f);
+            const double actualDb = getResponseDb(actual, f);
+            assertClose(actualDb, expectedDb, .005);
+        }
+        assertClose(getResponseDb(actual, fc), -3.0103, .005);
+
+        // poles must be inside the unit circle
+        for (int stage = 0; stage < 2; ++stage) {
+            assertLT(-actual.A2(stage), 1);
+        }
+    }
+}
+
+// outside the range gets clamped
+static void testButterLookup3PLPLimits()
+{
+    ButterworthLookup3PLP<double> lookup;
+    BiquadParams<double, 2> params;
+
+    lookup.get(params, 0);
+    assertClose(getResponseDb(params, lookup.minCutoff()), -3.0103, .005);
+
+    lookup.get(params, .4);
+    assertClose(getResponseDb(params, lookup.maxCutoff()), -3.0103, .005);
+}
+
 void  testButterLookup()
 {
     testButterLookup0();
+    testButterLookup3PLP();
+    testButterLookup3PLPLimits();
     //testButterLookup1();
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "asserts.h"
+#include "DspTiming.h"
+
+static void testBuckets()
+{
+    assertEQ(DspTimingStats::getBucket(0), 0);
+    assertEQ(DspTimingStats::getBucket(1), 0);
+    assertEQ(DspTimingStats::getBucket(2), 1);
+    assertEQ(DspTimingStats::getBucket(3), 1);
+    assertEQ(DspTimingStats::getBucket(4), 2);
+    assertEQ(DspTimingStats::getBucket(1023), 9);
+    assertEQ(DspTimingStats::getBucket(1024), 10);
+    assertEQ(DspTimingStats::getBucket(~uint64_t(0)), DspTimingStats::numBuckets - 1);
+}
+
+static void testRecord()
+{
+    DspTimingStats stats;
+    assertEQ(stats.read().count, 0);
+
+    for (int i = 0; i < 98; ++i) {
+        stats.record(100);
+    }
+    stats.record(1000);
+    stats.record(5000);
+
+    const DspTimingStats::Snapshot data = stats.read();
+    assertEQ(data.count, 100);
+    assertEQ(data.totalNs, 98 * 100 + 1000 + 5000);
+    assertEQ(data.maxNs, 5000);
+    assertClose(data.meanNs(), 158, .001);
+
+    // 100 is in the 64..127 bucket
+    assertEQ(data.buckets[6], 98);
+    assertEQ(data.percentileNs(.5), 128);
+    assertEQ(data.percentileNs(.99), 1024);
+    assertEQ(data.percentileNs(1), 8192);
+
+    // 158ns is 0.7% of a sample at 44.1k
+    assertClose(data.percentOfSample(44100), 158e-9 * 44100 * 100, .0001);
+}
+
+static void testReset()
+{
+    DspTimingStats stats;
+    stats.record(100);
+    stats.record(200);
+    assertEQ(stats.read().count, 2);
+
+    // readers see nothing until the audio thread clears it
+    stats.requestReset();
+    assertEQ(stats.read().count, 0);
+
+    stats.record(300);
+    const DspTimingStats::Snapshot data = stats.read();
+    assertEQ(data.count, 1);
+    assertEQ(data.totalNs, 300);
+    assertEQ(data.maxNs, 300);
+    assertEQ(data.buckets[6], 0);
+}
+
+static void testScope()
+{
+    DspTimingStats stats;
+    DspTiming::setEnabled(false);
+    {
+        DspTimingScope timing(stats);
+    }
+    assertEQ(stats.read().count, 0);
+
+    DspTiming::setEnabled(true);
+    {
+        DspTimingScope timing(stats);
+    }
+    assertEQ(stats.read().count, 1);
+    DspTiming::setEnabled(false);
+}
+
+static void testRegistry()
+{
+    const int oldSize = DspTiming::size();
+    DspTimingStats a, b;
+    int ownerA = 0, ownerB = 0;
+    DspTiming::add(&ownerA, &a);
+    DspTiming::add(&ownerB, &b);
+    assertEQ(DspTiming::size(), oldSize + 2);
+
+    a.record(100);
+    b.record(100);
+    b.record(100);
+
+    DspTimingStats::Snapshot data;
+    assert(DspTiming::read(&ownerB, data));
+    assertEQ(data.count, 2);
+
+    // turning it on starts over
+    DspTiming::setEnabled(true);
+    assert(DspTiming::read(&ownerA, data));
+    assertEQ(data.count, 0);
+    DspTiming::setEnabled(false);
+
+    DspTiming::remove(&ownerA);
+    assert(!DspTiming::read(&ownerA, data));
+    assert(DspTiming::read(&ownerB, data));
+    DspTiming::remove(&ownerB);
+    assertEQ(DspTiming::size(), oldSize);
+}
+
+static void testReport()
+{
+    DspTimingStats fast, slow;
+    int ownerFast = 0, ownerSlow = 0;
+    DspTiming::add(&ownerFast, &fast);
+    DspTiming::add(&ownerSlow, &slow);
+    fast.record(100);
+    slow.record(10000);
+
+    FILE* f = tmpfile();
+    assert(f);
+    DspTiming::writeReport(f, 44100, [&](const void* owner) {
+        return std::string(owner == &ownerFast ? "fast" : (owner == &ownerSlow ? "slow" : "other"));
+        });
+    rewind(f);
+    std::string text;
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), f)) {
+        text += buffer;
+    }
+    fclose(f);
+
+    DspTiming::remove(&ownerFast);
+    DspTiming::remove(&ownerSlow);
+
+    const size_t posFast = text.find("fast");
+    const size_t posSlow = text.find("slow");
+    assert(posFast != std::string::npos);
+    assert(posSlow != std::string::npos);
+    assertLT(posSlow, posFast);     // busiest first
+    assert(text.find("total") != std::string::npos);
+}
+
+void testDspTiming()
+{
+    testBuckets();
+    testRecord();
+    testReset();
+    testScope();
+    testRegistry();
+    testReport();
+}
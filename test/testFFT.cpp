@@ -2,6 +2,8 @@
 #include "asserts.h"
 #include <memory>
 #include <set>
+#include <thread>
+#include <vector>
 
 #include "AudioMath.h"
 #include "FFTData.h"
@@ -86,9 +88,11 @@ static void testRoundTrip()
         realIn.set(i, 1.0);
     }
 
-    bool b = FFT::forward(&complex, realIn);
+    FFTScratch scratch;
+    bool b = FFT::forward(&complex, realIn, scratch);
+    assert(b);
+    b = FFT::inverse(&realOut, complex, scratch);
     assert(b);
-    b = FFT::inverse(&realOut, complex);
 
     for (int i = 0; i < 16; ++i) {
 
@@ -144,9 +148,10 @@ static void testWhiteNoiseRT()
 
     FFT::makeNoiseSpectrum(noiseSpectrum.get(), ColoredNoiseSpec());
 
-    FFT::inverse(noiseRealSignal.get(), *noiseSpectrum);
+    FFTScratch scratch(bins);
+    FFT::inverse(noiseRealSignal.get(), *noiseSpectrum, scratch);
 
-    FFT::forward(noiseSpectrum2.get(), *noiseRealSignal);
+    FFT::forward(noiseSpectrum2.get(), *noiseRealSignal, scratch);
 
     float totalPhase = 0;
     float minPhase = 0;
@@ -175,7 +180,8 @@ static void testNoiseRTSub(int bins)
     assertEQ(dataCpx->size(), bins);
     FFT::makeNoiseSpectrum(dataCpx.get(), ColoredNoiseSpec());
 
-    FFT::inverse(dataReal.get(), *dataCpx);
+    FFTScratch scratch;
+    FFT::inverse(dataReal.get(), *dataCpx, scratch);
     FFT::normalize(dataReal.get(), 2);
 
     const float peak = getPeak(*dataReal);
@@ -272,6 +278,134 @@ static void testBlueNoise(float corner = 0)
     }
 }
 
+static void fillTestSignal(FFTDataReal& data, int seed)
+{
+    for (int i = 0; i < data.size(); ++i) {
+        data.set(i, float(std::sin(.01 * (i + 1) * (seed + 1)) + .3 * std::cos(.37 * i * seed)));
+    }
+}
+
+// the scratch versions should give exactly the same answer
+static void testScratchMatches()
+{
+    const int bins = 1024;
+    FFTDataReal real(bins);
+    fillTestSignal(real, 3);
+
+    FFTDataCpx expectedCpx(bins);
+    FFTDataCpx actualCpx(bins);
+    FFTScratch scratch;
+    assert(FFT::forward(&expectedCpx, real));
+    assert(FFT::forward(&actualCpx, real, scratch));
+    for (int i = 0; i < bins; ++i) {
+        assertEQ(actualCpx.get(i), expectedCpx.get(i));
+    }
+
+    FFTDataReal expectedReal(bins);
+    FFTDataReal actualReal(bins);
+    assert(FFT::inverse(&expectedReal, expectedCpx));
+    assert(FFT::inverse(&actualReal, actualCpx, scratch));
+    for (int i = 0; i < bins; ++i) {
+        assertEQ(actualReal.get(i), expectedReal.get(i));
+    }
+}
+
+// one plan for each size and direction, no matter how many buffers
+static void testPlanCache()
+{
+    const int bins = 512;       // a size no other test uses
+    const int plans = FFT::_numPlans();
+    FFTScratch scratch;
+    FFTDataReal real(bins);
+    FFTDataCpx complex(bins);
+    fillTestSignal(real, 1);
+
+    FFT::forward(&complex, real, scratch);
+    assertEQ(FFT::_numPlans(), plans + 1);
+    FFT::forward(&complex, real, scratch);
+    assertEQ(FFT::_numPlans(), plans + 1);
+
+    // complex data isn't tied to the inverse direction any more
+    FFT::inverse(&real, complex, scratch);
+    FFT::forward(&complex, real, scratch);
+    assertEQ(FFT::_numPlans(), plans + 2);
+
+    // a different scratch, and different buffers, share the plans
+    FFTScratch scratch2(bins);
+    FFTDataReal real2(bins);
+    FFTDataCpx complex2(bins);
+    FFT::forward(&complex2, real2, scratch2);
+    FFT::inverse(&real2, complex2, scratch2);
+    assertEQ(FFT::_numPlans(), plans + 2);
+}
+
+// one scratch can be used for different sizes
+static void testScratchSizes()
+{
+    FFTScratch scratch(16);
+    for (int bins : {16, 2048, 16, 64}) {
+        FFTDataReal real(bins);
+        FFTDataReal realOut(bins);
+        FFTDataCpx complex(bins);
+        fillTestSignal(real, 2);
+        assert(FFT::forward(&complex, real, scratch));
+        assert(FFT::inverse(&realOut, complex, scratch));
+        for (int i = 0; i < bins; ++i) {
+            // forward scales by 1/N, inverse doesn't
+            assertClose(realOut.get(i), real.get(i), .0001);
+        }
+    }
+}
+
+// threads may share the plans, as long as they each have their own scratch
+static void testFFTThreads()
+{
+    const int bins = 4096;
+    const int numThreads = 4;
+    const int reps = 20;
+    std::vector<std::unique_ptr<FFTDataCpx>> expected;
+    for (int t = 0; t < numThreads; ++t) {
+        FFTDataReal real(bins);
+        fillTestSignal(real, t);
+        expected.push_back(std::unique_ptr<FFTDataCpx>(new FFTDataCpx(bins)));
+        FFT::forward(expected.back().get(), real);
+    }
+
+    // make the buffers here, FFTData's instance count isn't thread safe
+    std::vector<std::unique_ptr<FFTDataReal>> reals;
+    std::vector<std::unique_ptr<FFTDataCpx>> complexes;
+    for (int t = 0; t < numThreads; ++t) {
+        reals.push_back(std::unique_ptr<FFTDataReal>(new FFTDataReal(bins)));
+        complexes.push_back(std::unique_ptr<FFTDataCpx>(new FFTDataCpx(bins)));
+    }
+
+    std::vector<int> errors(numThreads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.push_back(std::thread([t, &expected, &errors, &reals, &complexes]() {
+            FFTScratch scratch;
+            FFTDataReal& real = *reals[t];
+            FFTDataCpx& complex = *complexes[t];
+            for (int rep = 0; rep < reps; ++rep) {
+                fillTestSignal(real, t);
+                FFT::forward(&complex, real, scratch);
+                for (int i = 0; i < bins; ++i) {
+                    if (complex.get(i) != expected[t]->get(i)) {
+                        ++errors[t];
+                    }
+                }
+                FFT::inverse(&real, complex, scratch);
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < numThreads; ++t) {
+        assertEQ(errors[t], 0);
+    }
+}
+
 void testFFT()
 {
     assertEQ(FFTDataReal::_count, 0);
@@ -287,5 +421,9 @@ void testFFT()
     testBlueNoise();
     testBlueNoise(8000.f);
     testWhiteNoiseRT();
+    testScratchMatches();
+    testPlanCache();
+    testScratchSizes();
+    testFFTThreads();
     testFinalLeaks();
 }
\ No newline at end of file
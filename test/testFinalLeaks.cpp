@@ -2,6 +2,7 @@
 #include "LookupTable.h"
 #include "ThreadSharedState.h"
 #include "ThreadServer.h"
+#include "ThreadPool.h"
 #include "FFTData.h"
 
 #include "asserts.h"
@@ -14,6 +15,7 @@ void testFinalLeaks()
     assertEQ(FFTDataCpx::_count, 0);
     assertEQ(ThreadSharedState::_dbgCount, 0);
     assertEQ(ThreadServer::_instanceCount, 0);
+    assertEQ(ThreadPool::_instanceCount, 0);
     assertEQ(_numLookupParams, 0);
     assertEQ(_numBiquads, 0)
 }
\ No newline at end of file
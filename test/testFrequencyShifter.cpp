@@ -4,6 +4,7 @@
 #include "FrequencyShifter.h"
 #include "TestComposite.h"
 #include "ExtremeTester.h"
+#include "asserts.h"
 
 using Shifter = FrequencyShifter<TestComposite>;
 
@@ -42,6 +43,42 @@ static void test1()
     }
 }
 
+/**
+ * The Hilbert filters run in SIMD lanes; make sure that gives
+ * exactly what the scalar filters would.
+ */
+static void testMatchesScalar()
+{
+    Shifter fs;
+    fs.setSampleRate(44100);
+    fs.init();
+    fs.params[Shifter::PITCH_PARAM].value = 2;
+
+    BiquadParams<float, 3> paramsSin;
+    BiquadParams<float, 3> paramsCos;
+    BiquadState<float, 3> stateSin;
+    BiquadState<float, 3> stateCos;
+    HilbertFilterDesigner<float>::design(44100, paramsSin, paramsCos);
+    SinOscillatorParams<float> oscParams;
+    SinOscillatorState<float> oscState;
+
+    for (int i = 0; i < 1000; ++i) {
+        const float input = (i % 50 < 25) ? 1.f : -1.f;
+        fs.inputs[Shifter::AUDIO_INPUT].setVoltage(input, 0);
+        fs.step();
+
+        // 2V on the pitch knob, in linear mode, is 2 Hz.
+        SinOscillator<float, true>::setFrequency(oscParams, 2.f * (1.f / 44100));
+        float x, y;
+        SinOscillator<float, true>::runQuadrature(x, y, oscState, oscParams);
+        x *= BiquadFilter<float>::run(input, stateSin, paramsSin);
+        y *= BiquadFilter<float>::run(input, stateCos, paramsCos);
+
+        assertEQ(fs.outputs[Shifter::SIN_OUTPUT].getVoltage(0), x + y);
+        assertEQ(fs.outputs[Shifter::COS_OUTPUT].getVoltage(0), x - y);
+    }
+}
+
 static void testExtreme()
 {
 
@@ -61,5 +98,6 @@ void testFrequencyShifter()
 {
     test0();
     test1();
+    testMatchesScalar();
     testExtreme();
 }
\ No newline at end of file
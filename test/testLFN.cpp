@@ -0,0 +1,92 @@
+#include "LFN.h"
+#include "TestComposite.h"
+#include "asserts.h"
+
+using Lfn = LFN<TestComposite>;
+
+static void run(Lfn& lfn, int samples)
+{
+    for (int i = 0; i < samples; ++i) {
+        lfn.step();
+    }
+}
+
+// the range knob should take effect without anything on the UI thread
+static void testLFNRangeKnob()
+{
+    Lfn lfn;
+    lfn.setSampleTime(1.0f / 44100.f);
+    lfn.init();
+
+    lfn.params[Lfn::FREQ_RANGE_PARAM].value = -5;
+    run(lfn, 10);
+    assertClose(lfn.getBaseFrequency(), .1f, .001);
+
+    lfn.params[Lfn::FREQ_RANGE_PARAM].value = 5;
+    run(lfn, 10);
+    assertClose(lfn.getBaseFrequency(), 2.f, .001);
+
+    lfn.params[Lfn::XLFN_PARAM].value = 1;
+    run(lfn, 10);
+    assertClose(lfn.getBaseFrequency(), .2f, .001);
+}
+
+// CV adds to the knob, and is limited to the knob's range
+static void testLFNRangeCV()
+{
+    Lfn lfn;
+    lfn.setSampleTime(1.0f / 44100.f);
+    lfn.init();
+
+    lfn.inputs[Lfn::FREQ_RANGE_INPUT].setVoltage(-5, 0);
+    run(lfn, 10);
+    assertClose(lfn.getBaseFrequency(), .1f, .001);
+
+    lfn.inputs[Lfn::FREQ_RANGE_INPUT].setVoltage(10, 0);
+    run(lfn, 10);
+    assertClose(lfn.getBaseFrequency(), 2.f, .001);
+}
+
+/**
+ * Returns the peak to peak output after four seconds.
+ * If modulate, the range CV switches back and forth all the time.
+ */
+static float getPeakToPeak(bool modulate)
+{
+    Lfn lfn;
+    lfn.setSampleTime(1.0f / 44100.f);
+    lfn.init();
+    lfn.params[Lfn::EQ4_PARAM].value = 5;
+    lfn.inputs[Lfn::FREQ_RANGE_INPUT].setVoltage(5, 0);
+
+    float minOut = 100;
+    float maxOut = -100;
+    for (int i = 0; i < 44100 * 4; ++i) {
+        if (modulate) {
+            lfn.inputs[Lfn::FREQ_RANGE_INPUT].setVoltage((i % 1000) < 500 ? 5.f : 4.f, 0);
+        }
+        lfn.step();
+        const float x = lfn.outputs[Lfn::OUTPUT].getVoltage(0);
+        assert(std::isfinite(x));
+        minOut = std::min(minOut, x);
+        maxOut = std::max(maxOut, x);
+    }
+    return maxOut - minOut;
+}
+
+// modulating the range must not stop the noise, or blow it up
+static void testLFNModulated()
+{
+    const float steady = getPeakToPeak(false);
+    const float modulated = getPeakToPeak(true);
+    assertGT(steady, 1);
+    assertGT(modulated, steady / 3);
+    assertLT(modulated, steady * 3);
+}
+
+void testLFN()
+{
+    testLFNRangeKnob();
+    testLFNRangeCV();
+    testLFNModulated();
+}
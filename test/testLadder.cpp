@@ -3,6 +3,7 @@
 #include "TestComposite.h"
 #include "Filt.h"
 #include "LadderFilter.h"
+#include "LadderFilterSimd.h"
 #include "PeakDetector.h"
 #include "TestComposite.h"
 
@@ -470,6 +471,142 @@ static void testFiltOutputsLeftDisconnect()
 }
 
 
+/**
+ * Each lane of the SSE filter should match a scalar LadderFilter<float>.
+ */
+static void testLadderSimdMatchesScalar(LadderFilter<float>::Voicing voicing, LadderFilter<float>::Types type, bool polyphase)
+{
+    const float fc[4] = {.001f, .01f, .05f, .2f};
+    const float feedback[4] = {0, 1, 2.5f, 3.5f};
+    const float edge[4] = {0, .3f, .5f, 1};
+    const float slope[4] = {3, 2.5f, 1, 0};
+
+    LadderFilterSimd simd;
+    simd.setVoicing(voicing);
+    simd.setType(type);
+    simd.setFreqSpread(.5f);
+    simd.setVolume(.7f);
+    simd.setNormalizedFc(_mm_loadu_ps(fc));
+    simd.setFeedback(_mm_loadu_ps(feedback));
+    simd.setEdge(_mm_loadu_ps(edge));
+    simd.setSlope(_mm_loadu_ps(slope));
+    simd.setGain(_mm_set_ps1(2));
+    simd.setBassMakeupGain(_mm_set_ps1(1.5f));
+    simd.setPolyphase(polyphase);
+
+    LadderFilter<float> scalar[4];
+    for (int i = 0; i < 4; ++i) {
+        scalar[i].setVoicing(voicing);
+        scalar[i].setType(type);
+        scalar[i].setFreqSpread(.5f);
+        scalar[i].setVolume(.7f);
+        scalar[i].setNormalizedFc(fc[i]);
+        scalar[i].setFeedback(feedback[i]);
+        scalar[i].setEdge(edge[i]);
+        scalar[i].setSlope(slope[i]);
+        scalar[i].setGain(2);
+        scalar[i].setBassMakeupGain(1.5f);
+        scalar[i].setPolyphase(polyphase);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        assertEQ(simd.getLEDValue(i, 0), scalar[i].getLEDValue(0));
+        assertEQ(simd.getLEDValue(i, 3), scalar[i].getLEDValue(3));
+    }
+
+    for (int n = 0; n < 1000; ++n) {
+        // square wave, to give the shapers something to do
+        const float x = ((n / 20) & 1) ? 5.f : -5.f;
+        simd.run(_mm_set_ps1(x));
+        float output[4];
+        _mm_storeu_ps(output, simd.getOutput());
+        for (int i = 0; i < 4; ++i) {
+            scalar[i].run(x);
+            assertClose(output[i], scalar[i].getOutput(), .001);
+        }
+    }
+}
+
+static void testLadderSimdMatchesScalar()
+{
+    for (int v = 0; v < (int) LadderFilter<float>::Voicing::NUM_VOICINGS; ++v) {
+        testLadderSimdMatchesScalar(LadderFilter<float>::Voicing(v), LadderFilter<float>::Types::_4PLP, false);
+        testLadderSimdMatchesScalar(LadderFilter<float>::Voicing(v), LadderFilter<float>::Types::_2PHP, false);
+        testLadderSimdMatchesScalar(LadderFilter<float>::Voicing(v), LadderFilter<float>::Types::_4PLP, true);
+    }
+    for (int t = 0; t < (int) LadderFilter<float>::Types::NUM_TYPES; ++t) {
+        testLadderSimdMatchesScalar(LadderFilter<float>::Voicing::Clean, LadderFilter<float>::Types(t), false);
+    }
+}
+
+/**
+ * Each voice of a poly Filt should sound like a mono Filt with the same CV.
+ * Mono uses the double precision filter, poly uses float, so they won't be exact.
+ */
+static void testFiltPolyMatchesMono(int channels, bool polyphase)
+{
+    using F = Filt<TestComposite>;
+    auto setup = [polyphase](F& f, int channels) {
+        f.init();
+        f.inputs[F::L_AUDIO_INPUT].channels = channels;
+        f.outputs[F::L_AUDIO_OUTPUT].channels = 1;
+        f.inputs[F::CV_INPUT1].channels = channels;
+        f.inputs[F::Q_INPUT].channels = channels;
+        f.params[F::MASTER_VOLUME_PARAM].value = 1;
+        f.params[F::FC1_TRIM_PARAM].value = 1;
+        f.params[F::Q_TRIM_PARAM].value = 1;
+        f.params[F::POLYPHASE_PARAM].value = polyphase ? 1.f : 0.f;
+    };
+
+    F poly;
+    setup(poly, channels);
+    std::vector<std::shared_ptr<F>> monos;
+    for (int ch = 0; ch < channels; ++ch) {
+        auto mono = std::make_shared<F>();
+        setup(*mono, 1);
+        monos.push_back(mono);
+
+        const float cv = -2.f + .5f * ch;
+        const float q = -5.f + .5f * ch;
+        poly.inputs[F::CV_INPUT1].setVoltage(cv, ch);
+        mono->inputs[F::CV_INPUT1].setVoltage(cv, 0);
+        poly.inputs[F::Q_INPUT].setVoltage(q, ch);
+        mono->inputs[F::Q_INPUT].setVoltage(q, 0);
+    }
+
+    for (int n = 0; n < 2000; ++n) {
+        const float x = ((n / 50) & 1) ? 1.f : -1.f;
+        for (int ch = 0; ch < channels; ++ch) {
+            poly.inputs[F::L_AUDIO_INPUT].setVoltage(x, ch);
+            monos[ch]->inputs[F::L_AUDIO_INPUT].setVoltage(x, 0);
+        }
+        poly.step();
+        for (int ch = 0; ch < channels; ++ch) {
+            monos[ch]->step();
+            assertClose(poly.outputs[F::L_AUDIO_OUTPUT].getVoltage(ch),
+                monos[ch]->outputs[F::L_AUDIO_OUTPUT].getVoltage(0), .01);
+        }
+    }
+    assertEQ(poly.outputs[F::L_AUDIO_OUTPUT].getChannels(), channels);
+
+    // right output should follow left
+    assertEQ(poly.outputs[F::R_AUDIO_OUTPUT].getChannels(), 0);
+    poly.outputs[F::R_AUDIO_OUTPUT].channels = 1;
+    poly.step();
+    assertEQ(poly.outputs[F::R_AUDIO_OUTPUT].getChannels(), channels);
+    for (int ch = 0; ch < channels; ++ch) {
+        assertEQ(poly.outputs[F::R_AUDIO_OUTPUT].getVoltage(ch), poly.outputs[F::L_AUDIO_OUTPUT].getVoltage(ch));
+    }
+}
+
+static void testFiltPolyMatchesMono()
+{
+    testFiltPolyMatchesMono(2, false);
+    testFiltPolyMatchesMono(7, false);
+    testFiltPolyMatchesMono(16, false);
+    testFiltPolyMatchesMono(7, true);
+}
+
 void testLadder()
 {
     testEdgeInMiddleUnity(true);
@@ -502,4 +639,7 @@ void testLadder()
     testFiltOutputsDisconnect();
     testFiltOutputsRightDisconnect();
     testFiltOutputsLeftDisconnect();
+
+    testLadderSimdMatchesScalar();
+    testFiltPolyMatchesMono();
 }
\ No newline at end of file
@@ -446,6 +446,80 @@ static void testNonUniform4()
     assertClose(result, 11.f, .000001);
 }
 
+/**
+ * The flat array lookup should give exactly the same
+ * answers as the original std::map lookup.
+ */
+template <typename T>
+static void testNonUniformMatchesMap()
+{
+    NonUniformLookupTableParams<T> params;
+    NonUniformLookupTable<T>::addPoint(params, -2, 5);
+    NonUniformLookupTable<T>::addPoint(params, 0, 0);
+    NonUniformLookupTable<T>::addPoint(params, 1, 1);
+    NonUniformLookupTable<T>::addPoint(params, 2, 21);
+    NonUniformLookupTable<T>::addPoint(params, 10, -3);
+    NonUniformLookupTable<T>::finalize(params);
+
+    for (T x = -5; x < 15; x += T(.0137)) {
+        assertEQ(NonUniformLookupTable<T>::lookup(params, x), NonUniformLookupTable<T>::lookupMap(params, x));
+    }
+    for (T x : {T(-2), T(0), T(1), T(2), T(10)}) {
+        assertEQ(NonUniformLookupTable<T>::lookup(params, x), NonUniformLookupTable<T>::lookupMap(params, x));
+    }
+}
+
+/**
+ * lookup4 and lookupBlock should give exactly the same
+ * answers as lookup, including outside the domain.
+ */
+static void testLookup4MatchesScalar(std::shared_ptr<LookupTableParams<float>> params)
+{
+    const float range = params->xMax - params->xMin;
+    const float start = params->xMin - range * .1f;
+    const float end = params->xMax + range * .1f;
+    const int n = 1001;         // not a multiple of 4
+    std::vector<float> input;
+    for (int i = 0; i < n; ++i) {
+        input.push_back(start + (end - start) * i / (n - 1));
+    }
+    input.push_back(params->xMin);
+    input.push_back(params->xMax);
+
+    for (size_t i = 0; i + 4 <= input.size(); i += 4) {
+        float output[4];
+        _mm_storeu_ps(output, LookupTable<float>::lookup4(*params, _mm_loadu_ps(&input[i])));
+        for (int j = 0; j < 4; ++j) {
+            assertEQ(output[j], LookupTable<float>::lookup(*params, input[i + j], true));
+        }
+    }
+
+    std::vector<float> output(input.size());
+    LookupTable<float>::lookupBlock(*params, input.data(), output.data(), int(input.size()));
+    for (size_t i = 0; i < input.size(); ++i) {
+        assertEQ(output[i], LookupTable<float>::lookup(*params, input[i], true));
+    }
+}
+
+static void testLookup4MatchesScalar()
+{
+    testLookup4MatchesScalar(ObjectCache<float>::getSinLookup());
+    testLookup4MatchesScalar(ObjectCache<float>::getMixerPanL());
+    testLookup4MatchesScalar(ObjectCache<float>::getAudioTaper18());
+    testLookup4MatchesScalar(ObjectCache<float>::getExp2());
+}
+
+template <typename T>
+static void testLookupBlock()
+{
+    std::shared_ptr<LookupTableParams<T>> params = ObjectCache<T>::getBipolarAudioTaper();
+    T input[7] = {-1, T(-.5), 0, T(.1), T(.7), 1, 2};
+    T output[7];
+    LookupTable<T>::lookupBlock(*params, input, output, 7);
+    for (int i = 0; i < 7; ++i) {
+        assertEQ(output[i], LookupTable<T>::lookup(*params, input[i], true));
+    }
+}
 
 static void testDetune()
 {
@@ -495,11 +569,14 @@ static void test()
     testNonUniform2<T>();
     testNonUniform3<T>();
     testNonUniform4<T>();   
+    testNonUniformMatchesMap<T>();
+    testLookupBlock<T>();
 }
 
 void testLookupTable()
 {
     test<double>();
     test<float>();
+    testLookup4MatchesScalar();
     testDetune();
 }
\ No newline at end of file
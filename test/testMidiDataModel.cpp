@@ -315,7 +315,81 @@ static void testSeekTime2()
 
 static void testSameTime()
 {
-    printf("ADD A TEST FOR SAME TIME\n");
+    auto lock = MidiLock::make();
+    MidiTrack mt(lock);
+    MidiLocker l(lock);
+
+    // three notes at the same time, in an order that isn't sorted by pitch
+    std::vector<MidiNoteEventPtr> notes;
+    for (float pitch : {2.f, 1.f, 3.f}) {
+        MidiNoteEventPtr ev = std::make_shared<MidiNoteEvent>();
+        ev->startTime = 5;
+        ev->pitchCV = pitch;
+        mt.insertEvent(ev);
+        notes.push_back(ev);
+    }
+    mt.insertEnd(10);
+    mt.assertValid();
+
+    // same time events stay in the order they were inserted
+    auto mv = mt._testGetVector();
+    const MidiEventArray& flat = mt.getFlatEvents();
+    for (int i = 0; i < 3; ++i) {
+        assert(mv[i] == notes[i]);
+        assertEQ(flat[i].pitchCV, notes[i]->pitchCV);
+    }
+
+    mt.deleteEvent(*notes[1]);
+    mt.assertValid();
+    assertEQ(flat.size(), 3);
+    assertEQ(flat[0].pitchCV, 2.f);
+    assertEQ(flat[1].pitchCV, 3.f);
+}
+
+/**
+ * Lots of inserts and deletes, the flat events should always
+ * match the track (assertValid checks that).
+ */
+static void testFlatEvents()
+{
+    auto lock = MidiLock::make();
+    MidiTrack mt(lock);
+    MidiLocker l(lock);
+    mt.insertEnd(100);
+
+    std::vector<MidiNoteEventPtr> notes;
+    for (int i = 0; i < 200; ++i) {
+        MidiNoteEventPtr ev = std::make_shared<MidiNoteEvent>();
+        ev->startTime = float((i * 37) % 50);        // lots of duplicate times
+        ev->pitchCV = float(i % 5) / 12.f;
+        ev->duration = 1 + float(i % 3);
+        mt.insertEvent(ev);
+        notes.push_back(ev);
+    }
+    mt.assertValid();
+
+    for (int i = 0; i < 200; i += 3) {
+        mt.deleteEvent(*notes[i]);
+    }
+    mt.assertValid();
+
+    const MidiEventArray& flat = mt.getFlatEvents();
+    assertEQ(flat.size(), mt.size());
+
+    // seek should find the first event at or after the time
+    const int index = flat.seek(10.5f);
+    assertEQ(flat[index].startTime, 11.f);
+    assertLT(flat[index - 1].startTime, 10.5f);
+    assertEQ(flat.seek(0), 0);
+    assertEQ(flat.seek(101), flat.size());
+
+    // timeRange should agree with the track's timeRange
+    auto flatRange = flat.timeRange(10, 20);
+    auto range = mt.timeRange(10, 20);
+    assertEQ(std::distance(flatRange.first, flatRange.second), std::distance(range.first, range.second));
+    for (; range.first != range.second; ++range.first, ++flatRange.first) {
+        assert(flatRange.first->matches(*range.first->second));
+    }
 }
 
 static void testSong()
@@ -483,6 +557,7 @@ void testMidiDataModel()
     testTimeRange1();
     testNoteTimeRange1();
     testSameTime();
+    testFlatEvents();
     testSeekTime1();
     testSeekTime2();
     testSong();
@@ -1,12 +1,17 @@
 
 #define __STDC_WANT_LIB_EXT1__ 1        // to get tempnam_s
+#include "MidiFile.h"
+#include "MidiFileImporter.h"
 #include "MidiSong.h"
 #include "MidiTrack.h"
 #include "MidiFileProxy.h"
 #include "asserts.h"
 //#include <filesystem>
 
+#include <chrono>
+#include <sstream>
 #include <stdio.h>
+#include <thread>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -84,10 +89,233 @@ static void test2()
 }
 #endif
 
+static const char* testFilePath()
+{
+#if defined(_MSC_VER)
+    return "..\\..\\test\\test1.mid";
+#else
+    return "./test/test1.mid";
+#endif
+}
+
+/**
+ * Songs should be exactly the same, durations and all.
+ */
+static void assertSameNotes(MidiSongPtr song1, MidiSongPtr song2)
+{
+    assert(song1 && song2);
+    assertEQ(song1->getHighestTrackNumber(), song2->getHighestTrackNumber());
+    const MidiEventArray& events1 = song1->getTrack(0)->getFlatEvents();
+    const MidiEventArray& events2 = song2->getTrack(0)->getFlatEvents();
+    assertEQ(events1.size(), events2.size());
+    for (int i = 0; i < events1.size(); ++i) {
+        assert(events1[i].type == events2[i].type);
+        assertEQ(events1[i].startTime, events2[i].startTime);
+        assertEQ(events1[i].duration, events2[i].duration);
+        assertEQ(events1[i].pitchCV, events2[i].pitchCV);
+    }
+}
+
+/**
+ * The old way of loading: smf::MidiFile, then getFirst.
+ */
+static MidiSongPtr loadWithSmf(const std::vector<uint8_t>& data)
+{
+    std::stringstream stream(std::string(data.begin(), data.end()));
+    smf::MidiFile midiFile;
+    if (!midiFile.read(stream)) {
+        return nullptr;
+    }
+    midiFile.makeAbsoluteTicks();
+    midiFile.linkNotePairs();
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiTrackPtr track = MidiFileProxy::getFirst(song, midiFile);
+    if (!track) {
+        return nullptr;
+    }
+    song->addTrack(0, track);
+    return song;
+}
+
+static void putVarint(std::vector<uint8_t>& data, uint32_t x)
+{
+    uint8_t bytes[4];
+    int n = 0;
+    do {
+        bytes[n++] = uint8_t(x & 0x7f);
+        x >>= 7;
+    } while (x);
+    while (n > 1) {
+        data.push_back(bytes[--n] | 0x80);
+    }
+    data.push_back(bytes[0]);
+}
+
+static void putBigEndian(std::vector<uint8_t>& data, uint32_t x, int numBytes)
+{
+    for (int i = numBytes - 1; i >= 0; --i) {
+        data.push_back(uint8_t(x >> (8 * i)));
+    }
+}
+
+static std::vector<uint8_t> makeSmf(const std::vector<std::vector<uint8_t>>& tracks, int division)
+{
+    std::vector<uint8_t> data = { 'M', 'T', 'h', 'd' };
+    putBigEndian(data, 6, 4);
+    putBigEndian(data, 1, 2);
+    putBigEndian(data, uint32_t(tracks.size()), 2);
+    putBigEndian(data, division, 2);
+    for (auto track : tracks) {
+        data.insert(data.end(), { 'M', 'T', 'r', 'k' });
+        putBigEndian(data, uint32_t(track.size()), 4);
+        data.insert(data.end(), track.begin(), track.end());
+    }
+    return data;
+}
+
+/**
+ * A conductor track with no notes, then a track with all
+ * the things that make SMF parsing interesting.
+ */
+static std::vector<uint8_t> makeTestSmf(int division)
+{
+    std::vector<uint8_t> conductor = {
+        0, 0xff, 0x51, 3, 0x07, 0xa1, 0x20,         // tempo
+        0, 0xff, 0x03, 4, 'n', 'a', 'm', 'e',       // track name
+        0, 0xff, 0x2f, 0
+    };
+
+    std::vector<uint8_t> notes = {
+        0, 0xf0, 3, 0x7e, 0x09, 0xf7,               // sysex
+        0, 0xc0, 5,                                 // program change
+        0, 0x90, 60, 100,
+        0, 64, 100,                                 // running status
+        0x60, 60, 90,                               // same key again, before the first is off
+        0x30, 60, 0,                                // velocity 0 is note off
+        0x30, 0x80, 60, 0,
+        0, 0xb0, 0x40, 0x7f,                        // sustain pedal
+        0, 0xe0, 0, 0x40,                           // pitch bend
+        0x10, 0x90, 64, 0,
+        0, 0x91, 72, 80,
+        0, 0xa1, 72, 20,                            // aftertouch
+    };
+    putVarint(notes, 1000);                         // multi-byte delta
+    notes.insert(notes.end(), { 0x81, 72, 0 });
+    putVarint(notes, 200);
+    notes.insert(notes.end(), { 0xff, 0x2f, 0 });
+    return makeSmf({ conductor, notes }, division);
+}
+
+static void testParseNotesMatchesSmf()
+{
+    for (int division : { 96, 480, 0xe728 }) {
+        const std::vector<uint8_t> data = makeTestSmf(division);
+        MidiSongPtr song = MidiFileProxy::parseNotes(data.data(), data.size());
+        MidiSongPtr expected = loadWithSmf(data);
+        assertEQ(song->getTrack(0)->size(), 5);
+        assertSameNotes(song, expected);
+    }
+}
+
+static void testParseNotesBadData()
+{
+    const std::vector<uint8_t> data = makeTestSmf(96);
+    assert(MidiFileProxy::parseNotes(data.data(), data.size()));
+    assert(!MidiFileProxy::parseNotes(data.data(), 0));
+    assert(!MidiFileProxy::parseNotes(data.data(), 20));
+    assert(!MidiFileProxy::parseNotes(data.data(), data.size() - 10));
+
+    std::vector<uint8_t> notMidi = data;
+    notMidi[0] = 'X';
+    assert(!MidiFileProxy::parseNotes(notMidi.data(), notMidi.size()));
+
+    // no notes
+    const std::vector<uint8_t> empty = makeSmf({ { 0, 0xff, 0x2f, 0 } }, 96);
+    assert(!MidiFileProxy::parseNotes(empty.data(), empty.size()));
+}
+
+/**
+ * smf would give these zero duration. We hold the first to the end,
+ * and make the second one tick long.
+ */
+static void testParseNotesZeroLength()
+{
+    const std::vector<uint8_t> data = makeSmf({ {
+        0, 0x90, 60, 100,
+        0x60, 0x90, 62, 100,
+        0, 0x80, 62, 0,
+        0x60, 0xff, 0x2f, 0
+    } }, 96);
+    MidiSongPtr song = MidiFileProxy::parseNotes(data.data(), data.size());
+    assert(song);
+    const MidiEventArray& events = song->getTrack(0)->getFlatEvents();
+    assertEQ(events.size(), 3);
+    assertEQ(events[0].duration, 2);
+    assertEQ(events[1].startTime, 1);
+    assertEQ(events[1].duration, 1.f / 96);
+    assert(events[2].type == MidiEvent::Type::End);
+    assertEQ(events[2].startTime, 2);
+}
+
+static void testLoadNotes()
+{
+    MidiSongPtr song = MidiFileProxy::loadNotes(testFilePath());
+    MidiSongPtr expected = MidiFileProxy::load(testFilePath());
+    assertSameNotes(song, expected);
+
+    assert(!MidiFileProxy::loadNotes("no such file.mid"));
+}
+
+static bool waitForImport(MidiFileImporter& importer, MidiSongPtr& song, std::string& filename)
+{
+    for (int i = 0; i < 1000; ++i) {
+        if (importer.poll(song, filename)) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return false;
+}
+
+static void testImport()
+{
+    MidiFileImporter importer;
+    MidiSongPtr song;
+    std::string filename;
+    assert(!importer.poll(song, filename));
+
+    assert(importer.startImport(testFilePath()));
+    assert(importer.isBusy());
+    assert(!importer.startImport(testFilePath()));
+    assert(waitForImport(importer, song, filename));
+    assert(!importer.isBusy());
+    assertEQ(filename, testFilePath());
+    assertSameNotes(song, MidiFileProxy::load(testFilePath()));
+
+    // bad files come back too, just without a song
+    assert(importer.startImport("no such file.mid"));
+    assert(waitForImport(importer, song, filename));
+    assert(!song);
+    assert(!importer.poll(song, filename));
+}
+
+static void testImportDestroyWhileBusy()
+{
+    MidiFileImporter importer;
+    assert(importer.startImport(testFilePath()));
+}
+
 void testMidiFile()
 {
     test1();
 #ifdef _TMPNAM
     test2();
 #endif
+    testParseNotesMatchesSmf();
+    testParseNotesBadData();
+    testParseNotesZeroLength();
+    testLoadNotes();
+    testImport();
+    testImportDestroyWhileBusy();
+    assertNoMidi();     // check for leaks
 }
\ No newline at end of file
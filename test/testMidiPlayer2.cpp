@@ -8,7 +8,10 @@
 #include "TestHost2.h"
 
 #include "asserts.h"
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <vector>
 
 
@@ -1015,6 +1018,319 @@ static void testQuantizedRetrigger2()
     _testQuantizedRetrigger2(.25f);
 }
 
+
+//********************** tests of editing while playing **************************
+
+/**
+ * Host that counts how many times each pitch starts playing.
+ */
+class NoteCountHost : public TestHost2
+{
+public:
+    void setGate(int voice, bool g) override
+    {
+        if (g && !gateState[voice]) {
+            if (cvValue[voice] == 0) {
+                ++referenceNotes;
+            } else {
+                ++otherNotes;
+            }
+        }
+        TestHost2::setGate(voice, g);
+    }
+    int referenceNotes = 0;
+    int otherNotes = 0;
+};
+
+/**
+ * Makes a song with a note of pitch 0 on every beat,
+ * each one an eighth note long.
+ */
+static MidiSongPtr makeSongReferenceNotes(int numNotes)
+{
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiLocker l(song->lock);
+    song->createTrack(0);
+    MidiTrackPtr track = song->getTrack(0);
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = float(i);
+        note->duration = .5;
+        note->pitchCV = 0;
+        track->insertEvent(note);
+    }
+    track->insertEnd(float(numNotes));
+    return song;
+}
+
+static MidiNoteEventPtr makeScratchNote(float time)
+{
+    MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+    note->startTime = time;
+    note->duration = .2f;
+    note->pitchCV = 1;
+    return note;
+}
+
+/**
+ * edit while the player is locked out, then make sure
+ * playback carries on without dropping or repeating anything.
+ */
+static void testMidiPlayerEditWhilePlaying()
+{
+    MidiSongPtr song = makeSongReferenceNotes(4);
+    MidiTrackPtr track = song->getTrack(0);
+    auto host = std::make_shared<NoteCountHost>();
+    MidiPlayer2 pl(host, song);
+    pl.setNumVoices(1);
+
+    pl.updateToMetricTime(1.2, quantInterval, true);
+    assertEQ(host->referenceNotes, 2);
+    {
+        MidiLocker l(song->lock);
+        track->insertEvent(makeScratchNote(2.6f));          // in the future
+        track->insertEvent(makeScratchNote(.6f));           // in the past
+        track->deleteEvent(*track->begin()->second);        // already played
+
+        // still plays the old version while locked
+        pl.updateToMetricTime(2.2, quantInterval, true);
+        assertEQ(host->lockConflicts, 1);
+        assertEQ(host->referenceNotes, 3);
+        assertEQ(host->otherNotes, 0);
+    }
+
+    // picks up the edits without starting over
+    pl.updateToMetricTime(3.2, quantInterval, true);
+    assertEQ(host->referenceNotes, 4);
+    assertEQ(host->otherNotes, 1);
+    assertEQ(pl.getCurrentLoopIterationStart(), 0);
+
+    // second time around the first note is gone
+    pl.updateToMetricTime(4 + 3.2, quantInterval, true);
+    assertEQ(host->referenceNotes, 4 + 3);
+    assertEQ(host->otherNotes, 1 + 2);
+    assertEQ(host->lockConflicts, 1);
+}
+
+/**
+ * Audio thread plays a song with a note on every beat, while the UI
+ * thread keeps adding and removing other notes.
+ * Every beat should play exactly once.
+ */
+static void testMidiPlayerEditStress()
+{
+    const int numNotes = 8;
+    const int numLoops = 3;
+    MidiSongPtr song = makeSongReferenceNotes(numNotes);
+    MidiTrackPtr track = song->getTrack(0);
+    auto host = std::make_shared<NoteCountHost>();
+
+    std::atomic<bool> done(false);
+    std::thread audio([&]() {
+        MidiPlayer2 pl(host, song);
+        pl.setNumVoices(1);
+        for (double t = 0; t < numLoops * numNotes - .3; t += .01) {
+            pl.updateToMetricTime(t, quantInterval, true);
+            std::this_thread::sleep_for(std::chrono::microseconds(20));
+        }
+        done = true;
+    });
+
+    int edits = 0;
+    std::vector<MidiNoteEventPtr> scratch;
+    while (!done) {
+        {
+            MidiLocker l(song->lock);
+            const int beat = edits % numNotes;
+            if (scratch.size() < numNotes / 2) {
+                scratch.push_back(makeScratchNote(beat + .6f));
+                track->insertEvent(scratch.back());
+            } else {
+                track->deleteEvent(*scratch.front());
+                scratch.erase(scratch.begin());
+            }
+            ++edits;
+        }
+        std::this_thread::yield();
+    }
+    audio.join();
+
+    assertGT(edits, 0);
+    assertEQ(host->referenceNotes, numLoops * numNotes);
+}
+
+//********************** tests of multi-track playback **************************
+
+/**
+ * Host that logs everything each track does.
+ */
+class TrackLogHost : public TestHost2
+{
+public:
+    class Entry
+    {
+    public:
+        double time;
+        int voice;
+        bool isGate;
+        float value;
+        bool operator == (const Entry& other) const
+        {
+            return time == other.time && voice == other.voice &&
+                isGate == other.isGate && value == other.value;
+        }
+    };
+
+    void setTrackGate(int track, int voice, bool g) override
+    {
+        assert(track >= 0 && track < MidiPlayer2::maxTracks);
+        log[track].push_back({ time, voice, true, g ? 1.f : 0.f });
+    }
+    void setTrackCV(int track, int voice, float cv) override
+    {
+        assert(track >= 0 && track < MidiPlayer2::maxTracks);
+        log[track].push_back({ time, voice, false, cv });
+    }
+
+    double time = 0;
+    std::vector<Entry> log[MidiPlayer2::maxTracks];
+};
+
+/**
+ * Fills in track number trackNumber of song with a pattern
+ * that is different for each pattern number.
+ * Odd patterns have touching notes, to make them re-trigger.
+ */
+static void makeTrackPattern(MidiSongPtr song, int trackNumber, int pattern)
+{
+    song->createTrack(trackNumber);
+    MidiTrackPtr track = song->getTrack(trackNumber);
+    const float spacing = .25f * (1 + pattern % 3);
+    const float length = 2.f + pattern;
+    for (float t = 0; t < length; t += spacing) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = t;
+        note->duration = (pattern & 1) ? spacing : spacing / 2;
+        note->pitchCV = pattern + t / 8;
+        track->insertEvent(note);
+    }
+    track->insertEnd(length);
+}
+
+static MidiSongPtr makeSongMultiTrack(int numTracks)
+{
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    MidiLocker l(song->lock);
+    for (int i = 0; i < numTracks; ++i) {
+        makeTrackPattern(song, i, i);
+    }
+    return song;
+}
+
+static void runLogged(MidiSongPtr song, std::shared_ptr<TrackLogHost> host, double endTime)
+{
+    MidiPlayer2 pl(host, song);
+    pl.setNumVoices(4);
+    pl.setSampleCountForRetrigger(4);
+    for (int i = 0; i < endTime * 100; ++i) {
+        host->time = i / 100.0;
+        pl.updateToMetricTime(host->time, .125f, true);
+        pl.updateSampleCount(1);
+    }
+}
+
+/**
+ * Each track of a multi-track song should play exactly like it would on its own.
+ */
+static void testMidiPlayerMultiTrackMatchesSingle()
+{
+    const int numTracks = 5;
+    const double endTime = 30;
+    auto multiHost = std::make_shared<TrackLogHost>();
+    runLogged(makeSongMultiTrack(numTracks), multiHost, endTime);
+
+    for (int i = 0; i < numTracks; ++i) {
+        MidiSongPtr single = std::make_shared<MidiSong>();
+        {
+            MidiLocker l(single->lock);
+            makeTrackPattern(single, 0, i);
+        }
+        auto singleHost = std::make_shared<TrackLogHost>();
+        runLogged(single, singleHost, endTime);
+
+        assertGT(singleHost->log[0].size(), 20);
+        assertEQ(multiHost->log[i].size(), singleHost->log[0].size());
+        assert(multiHost->log[i] == singleHost->log[0]);
+    }
+    for (int i = numTracks; i < MidiPlayer2::maxTracks; ++i) {
+        assert(multiHost->log[i].empty());
+    }
+}
+
+/**
+ * Hosts that don't know about tracks only hear the first one.
+ */
+static void testMidiPlayerMultiTrackDefaultHost()
+{
+    MidiSongPtr song = std::make_shared<MidiSong>();
+    {
+        MidiLocker l(song->lock);
+        song->createTrack(0);
+        makeTrackPattern(song, 1, 0);
+        song->getTrack(0)->insertEnd(4);
+    }
+    std::shared_ptr<TestHost2> host = std::make_shared<TestHost2>();
+    MidiPlayer2 pl(host, song);
+    pl.setNumVoices(4);
+    pl.updateToMetricTime(3, .25f, true);
+
+    assertEQ(pl.getNumTracks(), 2);
+    assertEQ(host->gateChangeCount, 0);
+    assertEQ(host->cvChangeCount, 0);
+}
+
+/**
+ * Edits to one track get picked up without disturbing the others.
+ */
+static std::shared_ptr<TrackLogHost> runMultiTrackEdit(bool edit)
+{
+    MidiSongPtr song = makeSongReferenceNotes(4);
+    {
+        MidiLocker l(song->lock);
+        makeTrackPattern(song, 1, 0);
+    }
+    auto host = std::make_shared<TrackLogHost>();
+    MidiPlayer2 pl(host, song);
+    pl.setNumVoices(1);
+    pl.updateToMetricTime(1.2, quantInterval, true);
+    if (edit) {
+        MidiLocker l(song->lock);
+        song->getTrack(0)->insertEvent(makeScratchNote(1.6f));
+    }
+
+    host->time = 1.7;
+    pl.updateToMetricTime(1.7, quantInterval, true);
+    host->time = 5;
+    pl.updateToMetricTime(5, quantInterval, true);
+    assertEQ(pl.getCurrentLoopIterationStart(0), 4);
+    assertEQ(pl.getCurrentLoopIterationStart(1), 4);
+    return host;
+}
+
+static void testMidiPlayerMultiTrackEdit()
+{
+    auto host = runMultiTrackEdit(false);
+    auto editedHost = runMultiTrackEdit(true);
+
+    // the new note played
+    const TrackLogHost::Entry expected = { 1.7, 0, false, 1 };
+    assert(std::find(host->log[0].begin(), host->log[0].end(), expected) == host->log[0].end());
+    assert(std::find(editedHost->log[0].begin(), editedHost->log[0].end(), expected) != editedHost->log[0].end());
+
+    assertGT(host->log[1].size(), 20);
+    assert(host->log[1] == editedHost->log[1]);
+}
+
 //*******************************tests of MidiPlayer2 **************************************
 void testMidiPlayer2()
 {
@@ -1050,4 +1366,9 @@ void testMidiPlayer2()
     testMidiPlayerLoop2();
     testMidiPlayerLoop3();
     testQuantizedRetrigger2();
+    testMidiPlayerEditWhilePlaying();
+    testMidiPlayerEditStress();
+    testMidiPlayerMultiTrackMatchesSingle();
+    testMidiPlayerMultiTrackDefaultHost();
+    testMidiPlayerMultiTrackEdit();
 }
@@ -0,0 +1,166 @@
+#include "MidiLock.h"
+#include "MidiSong.h"
+#include "MidiTrack.h"
+#include "MidiTrackCodec.h"
+#include "PitchUtils.h"
+
+#include "asserts.h"
+
+#include <random>
+
+/**
+ * Makes a track with numNotes notes.
+ * If onGrid, notes are on sixteenths and semitones. Otherwise times
+ * and pitches are random floats.
+ */
+static MidiTrackPtr makeTrack(int numNotes, bool onGrid, std::shared_ptr<MidiLock> lock)
+{
+    std::mt19937 gen(numNotes);
+    std::uniform_real_distribution<float> dist(0, 1);
+    MidiTrackPtr track = std::make_shared<MidiTrack>(lock);
+    MidiLocker l(lock);
+    float time = 0;
+    for (int i = 0; i < numNotes; ++i) {
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        if (onGrid) {
+            time += .25f * int(dist(gen) * 4);
+            note->startTime = time;
+            note->duration = .25f * (1 + int(dist(gen) * 8));
+            note->pitchCV = PitchUtils::pitchToCV(1 + int(dist(gen) * 6), int(dist(gen) * 12));
+        } else {
+            time += dist(gen);
+            note->startTime = time;
+            note->duration = dist(gen);
+            note->pitchCV = dist(gen) * 10 - 5;
+        }
+        track->insertEvent(note);
+    }
+    track->insertEnd(std::floor(time) + 4);
+    return track;
+}
+
+static void assertTracksEqual(const MidiTrack& a, const MidiTrack& b)
+{
+    const MidiEventArray& eventsA = a.getFlatEvents();
+    const MidiEventArray& eventsB = b.getFlatEvents();
+    assertEQ(eventsA.size(), eventsB.size());
+    for (int i = 0; i < eventsA.size(); ++i) {
+        assert(eventsA[i].type == eventsB[i].type);
+        assertEQ(eventsA[i].startTime, eventsB[i].startTime);
+        assertEQ(eventsA[i].duration, eventsB[i].duration);
+        assertEQ(eventsA[i].pitchCV, eventsB[i].pitchCV);
+    }
+}
+
+static void testBase64()
+{
+    for (int size = 0; size < 8; ++size) {
+        std::vector<uint8_t> data;
+        for (int i = 0; i < size; ++i) {
+            data.push_back(uint8_t(i * 77 + 200));
+        }
+        const std::string text = MidiTrackCodec::toBase64(data);
+        assertEQ(text.size() % 4, 0);
+        std::vector<uint8_t> data2;
+        assert(MidiTrackCodec::fromBase64(text, data2));
+        assert(data == data2);
+    }
+
+    std::vector<uint8_t> data;
+    assertEQ(MidiTrackCodec::toBase64({ 'M', 'a' }), "TWE=");
+    assert(!MidiTrackCodec::fromBase64("TWE", data));
+    assert(!MidiTrackCodec::fromBase64("T*E=", data));
+}
+
+static void testRoundTrip(int numNotes, bool onGrid)
+{
+    auto lock = MidiLock::make();
+    MidiTrackPtr track = makeTrack(numNotes, onGrid, lock);
+    const std::string data = MidiTrackCodec::encode(*track);
+
+    MidiLocker l(lock);
+    MidiTrackPtr track2 = MidiTrackCodec::decode(data, lock);
+    assert(track2);
+    track2->assertValid();
+    assertTracksEqual(*track, *track2);
+
+    // notes on the grid should take just a few bytes each
+    if (onGrid && numNotes >= 100) {
+        assertLT(data.size(), 8 * numNotes);
+    }
+}
+
+static void testRoundTrip()
+{
+    testRoundTrip(0, true);
+    testRoundTrip(1, true);
+    testRoundTrip(100, true);
+    testRoundTrip(100, false);
+    testRoundTrip(20000, true);
+    testRoundTrip(20000, false);
+}
+
+static void testRoundTripTestContent()
+{
+    MidiSongPtr song = MidiSong::makeTest(MidiTrack::TestContent::eightQNotes, 0);
+    MidiTrackPtr track = song->getTrack(0);
+    const std::string data = MidiTrackCodec::encode(*track);
+
+    MidiLocker l(song->lock);
+    MidiTrackPtr track2 = MidiTrackCodec::decode(data, song->lock);
+    assert(track2);
+    assertTracksEqual(*track, *track2);
+}
+
+static void testBadData()
+{
+    auto lock = MidiLock::make();
+    MidiTrackPtr track = makeTrack(10, true, lock);
+    const std::string data = MidiTrackCodec::encode(*track);
+
+    MidiLocker l(lock);
+    assert(!MidiTrackCodec::decode("", lock));
+    assert(!MidiTrackCodec::decode("not base 64", lock));
+
+    // truncated
+    assert(!MidiTrackCodec::decode(data.substr(0, data.size() - 4), lock));
+
+    // from the future
+    std::vector<uint8_t> bytes;
+    assert(MidiTrackCodec::fromBase64(data, bytes));
+    bytes[0] = MidiTrackCodec::version + 1;
+    assert(!MidiTrackCodec::decode(MidiTrackCodec::toBase64(bytes), lock));
+}
+
+/**
+ * insertEvents should make the same track as insertEvent, even
+ * when the events are not in order.
+ */
+static void testInsertEvents()
+{
+    auto lock = MidiLock::make();
+    MidiTrackPtr track = makeTrack(100, false, lock);
+
+    std::vector<MidiEventPtr> events;
+    for (auto it : *track) {
+        events.push_back(it.second);
+    }
+    std::swap(events[3], events[50]);
+    std::swap(events[0], events.back());
+
+    MidiLocker l(lock);
+    MidiTrackPtr track2 = std::make_shared<MidiTrack>(lock);
+    track2->insertEvents(events);
+    track2->assertValid();
+    assertTracksEqual(*track, *track2);
+}
+
+void testMidiTrackCodec()
+{
+    testBase64();
+    testRoundTrip();
+    testRoundTripTestContent();
+    testBadData();
+    testInsertEvents();
+    assertNoMidi();     // check for leaks
+}
@@ -0,0 +1,350 @@
+#include "asserts.h"
+#include "FFT.h"
+#include "MinBLEPVCOSimd.h"
+#include "ObjectCache.h"
+
+#include "TestComposite.h"
+#include "EV3.h"
+#include "FunVCOComposite.h"
+
+#include <memory>
+#include <vector>
+
+using Waveform = MinBLEPVCOSimd::Waveform;
+
+static float getLane(__m128 x, int lane)
+{
+    float buffer[4];
+    _mm_storeu_ps(buffer, x);
+    return buffer[lane];
+}
+
+static void testTable()
+{
+    auto table = ObjectCache<float>::getMinBLEP();
+    const int size = 2 * LookupTableFactory<float>::minBLEPZeroCrossings() *
+        LookupTableFactory<float>::minBLEPOversample();
+    assertEQ(table->xMin, 0);
+    assertEQ(table->xMax, size);
+
+    // starts at zero, ends at exactly one, rings a little above one
+    assertClose(LookupTable<float>::lookup(*table, 0), 0, .01);
+    assertEQ(LookupTable<float>::lookup(*table, float(size)), 1);
+    float max = 0;
+    for (int i = 0; i <= size; ++i) {
+        max = std::max(max, LookupTable<float>::lookup(*table, float(i)));
+    }
+    assertGT(max, 1);
+    assertLT(max, 1.3);
+}
+
+/**
+ * Each lane should do exactly what it would do on its own.
+ */
+static void testLanesIndependent(Waveform wf)
+{
+    const float freqs[4] = {.01f, .0371f, .1234f, .0022f};
+    MinBLEPVCOSimd poly;
+    poly.setWaveform(wf);
+    poly.setNormalizedFreq(_mm_loadu_ps(freqs), 1 / 44100.f);
+    poly.setPulseWidth(_mm_setr_ps(.5f, .2f, .7f, .9f));
+
+    MinBLEPVCOSimd single[4];
+    for (int lane = 0; lane < 4; ++lane) {
+        single[lane].setWaveform(wf);
+        single[lane].setNormalizedFreq(_mm_set_ps1(freqs[lane]), 1 / 44100.f);
+        single[lane].setPulseWidth(_mm_set_ps1(getLane(_mm_setr_ps(.5f, .2f, .7f, .9f), lane)));
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        poly.step();
+        for (int lane = 0; lane < 4; ++lane) {
+            single[lane].step();
+            assertEQ(getLane(poly.getOutput(), lane), getLane(single[lane].getOutput(), 0));
+        }
+    }
+}
+
+static void testLanesIndependent()
+{
+    testLanesIndependent(Waveform::Sin);
+    testLanesIndependent(Waveform::Tri);
+    testLanesIndependent(Waveform::Saw);
+    testLanesIndependent(Waveform::Square);
+    testLanesIndependent(Waveform::Even);
+}
+
+/**
+ * The sync output should tick once per cycle.
+ */
+static void testFrequency(Waveform wf)
+{
+    const float freqs[4] = {.01f, .0371f, .1234f, .3f};
+    MinBLEPVCOSimd vco;
+    vco.setWaveform(wf);
+    vco.setNormalizedFreq(_mm_loadu_ps(freqs), 1 / 44100.f);
+
+    const int samples = 10000;
+    int cycles[4] = {0};
+    for (int i = 0; i < samples; ++i) {
+        vco.step();
+        const int mask = _mm_movemask_ps(vco.getSync().mask);
+        for (int lane = 0; lane < 4; ++lane) {
+            if (mask & (1 << lane)) {
+                ++cycles[lane];
+                const float crossing = getLane(vco.getSync().crossing, lane);
+                assertLE(crossing, 0);
+                assertGT(crossing, -1.001);
+            }
+        }
+    }
+    for (int lane = 0; lane < 4; ++lane) {
+        assertClose(cycles[lane], freqs[lane] * samples, 1.1);
+    }
+}
+
+static void testFrequency()
+{
+    testFrequency(Waveform::Sin);
+    testFrequency(Waveform::Tri);
+    testFrequency(Waveform::Saw);
+    testFrequency(Waveform::Square);
+    testFrequency(Waveform::Even);
+}
+
+/**
+ * Without sync, the sine has no steps in it, so it should be
+ * the same as MinBLEPVCO.
+ */
+static void testSinMatchesScalar()
+{
+    const float freq = .0123f;
+    MinBLEPVCOSimd vco;
+    vco.setWaveform(Waveform::Sin);
+    vco.setNormalizedFreq(_mm_set_ps1(freq), 1 / 44100.f);
+
+    float phase = 0;
+    auto sinLookup = ObjectCache<float>::getSinLookup();
+    for (int i = 0; i < 1000; ++i) {
+        vco.step();
+        phase += freq;
+        if (phase >= 1) {
+            phase -= 1;
+        }
+        float adjPhase = phase + .25f;
+        if (adjPhase >= 1) {
+            adjPhase -= 1;
+        }
+        const float expected = -5 * LookupTable<float>::lookup(*sinLookup, adjPhase, true);
+        assertClose(getLane(vco.getOutput(), 0), expected, .0001);
+    }
+}
+
+/**
+ * Energy that is not in a harmonic of the saw is aliasing.
+ * Returns aliasing / total, in dB.
+ */
+static double getAliasingDb(bool useMinBLEP)
+{
+    const int size = 4096;
+    const int period = 187;             // bins per harmonic
+    const float freq = float(period) / size;
+    MinBLEPVCOSimd vco;
+    vco.setWaveform(Waveform::Saw);
+    vco.setNormalizedFreq(_mm_set_ps1(freq), 1 / 44100.f);
+
+    // let the first step settle
+    for (int i = 0; i < size; ++i) {
+        vco.step();
+    }
+
+    FFTDataReal data(size);
+    float phase = 0;
+    for (int i = 0; i < size; ++i) {
+        vco.step();
+        if (useMinBLEP) {
+            data.set(i, getLane(vco.getOutput(), 0));
+        } else {
+            phase += freq;
+            if (phase >= 1) {
+                phase -= 1;
+            }
+            data.set(i, 5 * (2 * phase - 1));
+        }
+    }
+    FFTDataCpx spectrum(size);
+    FFT::forward(&spectrum, data);
+
+    // Only look below .35 * sample rate. The minBLEP rolls off above that,
+    // so harmonics just above nyquist fold back up there.
+    double total = 0;
+    double aliasing = 0;
+    for (int bin = 1; bin <= int(size * .35); ++bin) {
+        const double energy = std::norm(spectrum.get(bin));
+        total += energy;
+        if (bin % period) {
+            aliasing += energy;
+        }
+    }
+    return 10 * std::log10(aliasing / total);
+}
+
+static void testAliasing()
+{
+    const double naive = getAliasingDb(false);
+    const double minBLEP = getAliasingDb(true);
+    assertLT(minBLEP, naive - 40);
+}
+
+/**
+ * A synced saw starts over every time the master does,
+ * so it repeats at the master period.
+ */
+static void testSync(Waveform wf)
+{
+    const int masterPeriod = 64;
+    MinBLEPVCOSimd master;
+    master.setNormalizedFreq(_mm_set_ps1(1.f / masterPeriod), 1 / 44100.f);
+    MinBLEPVCOSimd slave;
+    slave.setWaveform(wf);
+    slave.setSyncEnabled(true);
+    slave.setNormalizedFreq(_mm_setr_ps(.037f, .051f, .0123f, .1f), 1 / 44100.f);
+
+    std::vector<float> output;
+    for (int i = 0; i < 10 * masterPeriod; ++i) {
+        master.step();
+        slave.step(master.getSync());
+        output.push_back(getLane(slave.getOutput(), 1));
+    }
+    for (int i = 5 * masterPeriod; i < 9 * masterPeriod; ++i) {
+        assertClose(output[i], output[i + masterPeriod], .001);
+    }
+
+    // and it's not just something silly, like all zero
+    float max = 0;
+    for (float x : output) {
+        max = std::max(max, std::abs(x));
+    }
+    assertGT(max, 3);
+}
+
+static void testSync()
+{
+    testSync(Waveform::Saw);
+    testSync(Waveform::Square);
+    testSync(Waveform::Sin);
+    testSync(Waveform::Tri);
+    testSync(Waveform::Even);
+}
+
+/**
+ * Each voice of a poly EV3 should sound exactly like a mono EV3 with the same CV.
+ */
+static void testEV3PolyMatchesMono(int channels)
+{
+    using Comp = EV3<TestComposite>;
+    auto setup = [](Comp& ev3) {
+        for (int i = 0; i < Comp::NUM_OUTPUTS; ++i) {
+            ev3.outputs[i].channels = 1;
+        }
+        ev3.params[Comp::MIX1_PARAM].value = 1;
+        ev3.params[Comp::MIX2_PARAM].value = .5;
+        ev3.params[Comp::MIX3_PARAM].value = .7f;
+        ev3.params[Comp::WAVE1_PARAM].value = float(Waveform::Saw);
+        ev3.params[Comp::WAVE2_PARAM].value = float(Waveform::Square);
+        ev3.params[Comp::WAVE3_PARAM].value = float(Waveform::Even);
+        ev3.params[Comp::SEMI2_PARAM].value = 7;
+        ev3.params[Comp::OCTAVE3_PARAM].value = -1;
+        ev3.params[Comp::SYNC2_PARAM].value = 1;
+        ev3.params[Comp::PW2_PARAM].value = .3f;
+    };
+
+    Comp poly;
+    setup(poly);
+    poly.inputs[Comp::CV1_INPUT].channels = channels;
+    for (int i = 0; i < channels; ++i) {
+        poly.inputs[Comp::CV1_INPUT].setVoltage(-1.f + .3f * i, i);
+    }
+
+    std::vector<std::shared_ptr<Comp>> monos;
+    for (int i = 0; i < channels; ++i) {
+        auto mono = std::make_shared<Comp>();
+        setup(*mono);
+        mono->inputs[Comp::CV1_INPUT].channels = 1;
+        mono->inputs[Comp::CV1_INPUT].setVoltage(-1.f + .3f * i, 0);
+        monos.push_back(mono);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        poly.step();
+        for (int ch = 0; ch < channels; ++ch) {
+            monos[ch]->step();
+            for (int output = 0; output < Comp::NUM_OUTPUTS; ++output) {
+                assertEQ(poly.outputs[output].getVoltage(ch), monos[ch]->outputs[output].getVoltage(0));
+            }
+        }
+    }
+    assertEQ(poly.getNumChannels(), channels);
+    assertEQ(poly.outputs[Comp::MIX_OUTPUT].getChannels(), channels);
+    assert(poly.isLoweringVolume());
+}
+
+static void testEV3Poly()
+{
+    testEV3PolyMatchesMono(1);
+    testEV3PolyMatchesMono(5);
+    testEV3PolyMatchesMono(16);
+}
+
+/**
+ * Poly FunV should make one saw per voice, at the right pitch.
+ */
+static void testFunVPoly()
+{
+    using Comp = FunVCOComposite<TestComposite>;
+    Comp fun;
+    fun.setSampleRate(44100);
+    for (int i = 0; i < Comp::NUM_OUTPUTS; ++i) {
+        fun.outputs[i].channels = 1;
+    }
+    const int channels = 6;
+    fun.inputs[Comp::PITCH_INPUT].channels = channels;
+    for (int i = 0; i < channels; ++i) {
+        fun.inputs[Comp::PITCH_INPUT].setVoltage(i * .5f, i);
+    }
+
+    const int samples = 44100;
+    int cycles[channels] = {0};
+    float last[channels] = {0};
+    for (int i = 0; i < samples; ++i) {
+        fun.step();
+        for (int ch = 0; ch < channels; ++ch) {
+            // the saw ramp goes up through zero once per cycle
+            const float x = fun.outputs[Comp::SAW_OUTPUT].getVoltage(ch);
+            if (x >= 0 && last[ch] < 0) {
+                ++cycles[ch];
+            }
+            last[ch] = x;
+        }
+    }
+    assertEQ(fun.getNumChannels(), channels);
+    for (int i = 0; i < Comp::NUM_OUTPUTS; ++i) {
+        assertEQ(fun.outputs[i].getChannels(), channels);
+    }
+    for (int ch = 0; ch < channels; ++ch) {
+        const double expected = 261.626 * std::pow(2, ch * .5);
+        assertClose(cycles[ch], expected, 2);
+    }
+}
+
+void testMinBLEPVCOSimd()
+{
+    testTable();
+    testLanesIndependent();
+    testFrequency();
+    testSinMatchesScalar();
+    testAliasing();
+    testSync();
+    testEV3Poly();
+    testFunVPoly();
+}
@@ -0,0 +1,195 @@
+#include "asserts.h"
+#include "TestComposite.h"
+#include "Mix8.h"
+#include "MixM.h"
+#include "MixPolyVoices.h"
+
+#include <cmath>
+
+using Voices = MixPolyVoices<4>;
+
+static void settle(Voices& v)
+{
+    v.setCutoff(.49f);
+    for (int i = 0; i < 100; ++i) {
+        v.update();
+    }
+}
+
+/**
+ * plays one voice at a time, returns where it went.
+ */
+static void measureVoice(const Voices& v, int channel, int voice, float& left, float& right, float& mono)
+{
+    float input[Voices::maxVoices] = {0};
+    input[voice] = 1;
+    v.step(channel, input, left, right, mono);
+}
+
+static void testSpreadPosition()
+{
+    assertEQ(Voices::spreadPosition(0, 1), 0);
+    assertEQ(Voices::spreadPosition(0, 2), -1);
+    assertEQ(Voices::spreadPosition(1, 2), 1);
+    assertEQ(Voices::spreadPosition(2, 5), 0);
+    assertEQ(Voices::spreadPosition(15, 16), 1);
+}
+
+static void testVoicesSpread()
+{
+    Voices v;
+    v.voices[1] = 3;
+    v.spread = true;
+    settle(v);
+
+    const float center = float(1.0 / std::sqrt(2.0));
+    float left, right, mono;
+    measureVoice(v, 1, 0, left, right, mono);
+    assertClose(left, 1.f / 3, .001);
+    assertClose(right, 0, .001);
+    assertClose(mono, 1.f / 3, .0001);
+
+    measureVoice(v, 1, 1, left, right, mono);
+    assertClose(left, center / 3, .001);
+    assertClose(right, center / 3, .001);
+
+    measureVoice(v, 1, 2, left, right, mono);
+    assertClose(left, 0, .001);
+    assertClose(right, 1.f / 3, .001);
+
+    // other channels don't have any voices
+    measureVoice(v, 0, 0, left, right, mono);
+    assertEQ(left, 0);
+    assertEQ(right, 0);
+    assertEQ(mono, 0);
+}
+
+// each voice follows its own pan CV, and there is no spread
+static void testVoicesPanCV()
+{
+    Voices v;
+    v.voices[2] = 2;
+    v.pan[2] = -.5f;
+    v.panCV[2][0] = 10;         // way past hard right
+    v.panCV[2][1] = 0;
+    settle(v);
+
+    float left, right, mono;
+    measureVoice(v, 2, 0, left, right, mono);
+    assertClose(left, 0, .001);
+    assertClose(right, .5f, .001);
+
+    measureVoice(v, 2, 1, left, right, mono);
+    assertGT(left, right);
+    assertGT(right, 0);
+}
+
+template <class T>
+static std::shared_ptr<T> makeMixer()
+{
+    auto ret = std::make_shared<T>();
+    ret->init();
+    auto icomp = ret->getDescription();
+    for (int i = 0; i < icomp->getNumParams(); ++i) {
+        ret->params[i].value = icomp->getParam(i).def;
+    }
+    ret->params[T::MASTER_VOLUME_PARAM].value = 1;
+    return ret;
+}
+
+// long enough for the anti-pop filters to settle
+static void run(TestComposite& m)
+{
+    for (int i = 0; i < 4000; ++i) {
+        m.step();
+    }
+}
+
+// two voices, spread, one playing: should all be on one side.
+static void testMix8Spread(bool spread)
+{
+    using M = Mix8<TestComposite>;
+    auto m = makeMixer<M>();
+    m->params[M::GAIN2_PARAM].value = 1;
+    m->params[M::VOICE_SPREAD_PARAM].value = spread ? 1.f : 0.f;
+    m->inputs[M::AUDIO2_INPUT].channels = 2;
+    m->inputs[M::AUDIO2_INPUT].setVoltage(4, 0);
+    run(*m);
+
+    const float left = m->outputs[M::LEFT_OUTPUT].getVoltage(0);
+    const float right = m->outputs[M::RIGHT_OUTPUT].getVoltage(0);
+    if (spread) {
+        assertClose(left, 2, .01);
+        assertClose(right, 0, .01);
+        assertClose(m->outputs[M::CHANNEL2_OUTPUT].getVoltage(0), 2, .01);
+    } else {
+        // Mix8 normally only hears the first voice
+        const float center = float(4 / std::sqrt(2.0));
+        assertClose(left, center, .01);
+        assertClose(right, center, .01);
+    }
+}
+
+// a mono input in per voice mode is the same as a normal channel
+static void testMixMMonoInput()
+{
+    using M = MixM<TestComposite>;
+    float expected[2] = {0};
+    for (int perVoice = 0; perVoice < 2; ++perVoice) {
+        auto m = makeMixer<M>();
+        m->params[M::GAIN0_PARAM].value = 1;
+        m->params[M::PAN0_PARAM].value = .3f;
+        m->params[M::VOICE_PAN_PARAM].value = float(perVoice);
+        m->inputs[M::AUDIO0_INPUT].channels = 1;
+        m->inputs[M::AUDIO0_INPUT].setVoltage(3, 0);
+        run(*m);
+
+        const float left = m->outputs[M::LEFT_OUTPUT].getVoltage(0);
+        const float right = m->outputs[M::RIGHT_OUTPUT].getVoltage(0);
+        if (perVoice) {
+            assertEQ(left, expected[0]);
+            assertEQ(right, expected[1]);
+        } else {
+            assertGT(right, left);
+            expected[0] = left;
+            expected[1] = right;
+        }
+    }
+}
+
+// voices panned by poly CV, pre fader sends follow the voices
+static void testMixMPolyPanCV()
+{
+    using M = MixM<TestComposite>;
+    auto m = makeMixer<M>();
+    m->params[M::GAIN1_PARAM].value = 1;
+    m->params[M::SEND1_PARAM].value = 1;
+    m->params[M::PRE_FADERa_PARAM].value = 1;
+    m->params[M::VOICE_PAN_PARAM].value = 1;
+    m->inputs[M::AUDIO1_INPUT].channels = 2;
+    m->inputs[M::AUDIO1_INPUT].setVoltage(2, 0);
+    m->inputs[M::AUDIO1_INPUT].setVoltage(6, 1);
+    m->inputs[M::PAN1_INPUT].channels = 2;
+    m->inputs[M::PAN1_INPUT].setVoltage(-5, 0);
+    m->inputs[M::PAN1_INPUT].setVoltage(5, 1);
+    run(*m);
+
+    // the master has 6db of gain when all the way up
+    const float masterGain = 2;
+    assertClose(m->outputs[M::LEFT_OUTPUT].getVoltage(0), masterGain * 1, .01);
+    assertClose(m->outputs[M::RIGHT_OUTPUT].getVoltage(0), masterGain * 3, .01);
+    assertClose(m->outputs[M::LEFT_SEND_OUTPUT].getVoltage(0), 1, .01);
+    assertClose(m->outputs[M::RIGHT_SEND_OUTPUT].getVoltage(0), 3, .01);
+    assertClose(m->outputs[M::CHANNEL1_OUTPUT].getVoltage(0), 4, .01);
+}
+
+void testMixPolyVoices()
+{
+    testSpreadPosition();
+    testVoicesSpread();
+    testVoicesPanCV();
+    testMix8Spread(false);
+    testMix8Spread(true);
+    testMixMMonoInput();
+    testMixMPolyPanCV();
+}
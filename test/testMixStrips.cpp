@@ -0,0 +1,88 @@
+#include "asserts.h"
+#include "MixStrips.h"
+
+template <class T>
+static void settle(T& strips)
+{
+    strips.setCutoff(.49f);
+    for (int i = 0; i < 100; ++i) {
+        strips.update();
+    }
+}
+
+// eight channels, all different, should add up the same as doing it one at a time
+static void testMixStripsSum()
+{
+    using S = MixStrips<8, false>;
+    S strips;
+    for (int i = 0; i < S::numStrips; ++i) {
+        strips.fader[i] = .3f + i * .09f;
+        strips.levelCV[i] = 10;
+        strips.pan[i] = -1 + i * .25f;
+        strips.mute[i] = (i == 5) ? 0.f : 1.f;
+        strips.sendA[i] = i * .1f;
+        strips.sendB[i] = 1 - i * .1f;
+    }
+    strips.preFaderB = true;
+    settle(strips);
+
+    float input[S::numChannels];
+    for (int i = 0; i < S::numChannels; ++i) {
+        input[i] = float(i + 1);
+    }
+    float busses[S::busBufferSize] = {1, 2, 3, 4, 5, 6, 0, 0};
+    float outputs[S::numChannels];
+    strips.step(input, outputs, busses);
+
+    for (int bus = 0; bus < S::numBusses; ++bus) {
+        float expected = float(bus + 1);
+        for (int i = 0; i < S::numChannels; ++i) {
+            expected += input[i] * strips.getBusGain(bus, i);
+        }
+        assertClose(busses[bus], expected, .0001);
+    }
+    assertEQ(busses[6], 0);
+    assertEQ(busses[7], 0);
+
+    for (int i = 0; i < S::numChannels; ++i) {
+        assertClose(outputs[i], input[i] * strips.getChannelGain(i), .0001);
+    }
+    assertEQ(outputs[5], 0);
+    assertEQ(strips.getBusGain(4, 5), 0);
+}
+
+// stereo strips: each side only goes to its own busses
+static void testMixStripsStereo()
+{
+    using S = MixStrips<4, true>;
+    S strips;
+    for (int i = 0; i < S::numStrips; ++i) {
+        strips.fader[i] = 1;
+        strips.levelCV[i] = 10;
+        strips.mute[i] = 1;
+        strips.sendA[i] = 1;
+    }
+    strips.pan[1] = 1;          // second strip all the way right
+    settle(strips);
+
+    const float input[S::numChannels] = {1, 2, 4, 8};
+    float busses[S::busBufferSize] = {0};
+    float outputs[S::numChannels];
+    strips.step(input, outputs, busses);
+
+    // centered is 6db down on each side
+    assertClose(busses[0], .5f * 1, .0001);
+    assertClose(busses[1], .5f * 2 + 8, .0001);
+    assertClose(busses[2], busses[0], .0001);
+    assertClose(busses[3], busses[1], .0001);
+    assertEQ(busses[4], 0);
+    assertEQ(busses[5], 0);
+    assertClose(outputs[2], 0, .0001);
+    assertClose(outputs[3], 8, .0001);
+}
+
+void testMixStrips()
+{
+    testMixStripsSum();
+    testMixStripsStereo();
+}
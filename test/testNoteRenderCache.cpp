@@ -0,0 +1,189 @@
+#include "MidiEditorContext.h"
+#include "MidiLock.h"
+#include "MidiSelectionModel.h"
+#include "MidiSequencer.h"
+#include "MidiSong.h"
+#include "NoteRenderCache.h"
+#include "NoteScreenScale.h"
+#include "TestAuditionHost.h"
+#include "TestSettings.h"
+
+#include "asserts.h"
+
+using Layer = NoteRenderCache::Layer;
+
+static const float width = 400;
+static const float height = 200;
+
+/**
+ * Sequencer with the eight quarter notes test song,
+ * set up the way NoteDisplay sets it up.
+ */
+static MidiSequencerPtr makeTest()
+{
+    MidiSongPtr song = MidiSong::makeTest(MidiTrack::TestContent::eightQNotes, 0);
+    MidiSequencerPtr seq = MidiSequencer::make(
+        song,
+        std::make_shared<TestSettings>(),
+        std::make_shared<TestAuditionHost>());
+    seq->context->setTimeRange(0, 8);
+    seq->context->setPitchRange(PitchUtils::pitchToCV(3, 0), PitchUtils::pitchToCV(6, 0));
+    seq->context->setCursorPitch(PitchUtils::pitchToCV(3, 0));
+    seq->context->setScaler(std::make_shared<NoteScreenScale>(width, height, 10, 20));
+    return seq;
+}
+
+static MidiNoteEventPtr getNote(MidiSequencerPtr seq, int index)
+{
+    auto it = seq->context->getTrack()->begin();
+    for (int i = 0; i < index; ++i) {
+        ++it;
+    }
+    MidiNoteEventPtr note = safe_cast<MidiNoteEvent>(it->second);
+    assert(note);
+    return note;
+}
+
+static void testNoteGeometry()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+
+    const std::vector<NoteRenderCache::Rect>& notes = cache.getRects(Layer::Note);
+    assertEQ(notes.size(), 8);
+    assert(cache.getRects(Layer::SelectedNote).empty());
+
+    auto scaler = seq->context->getScaler();
+    MidiNoteEventPtr note = getNote(seq, 3);
+    assertEQ(notes[3].x, scaler->midiTimeToX(*note));
+    assertEQ(notes[3].y, scaler->midiPitchToY(*note));
+    assertEQ(notes[3].width, scaler->midiTimeTodX(note->duration));
+    assertEQ(notes[3].height, int(scaler->noteHeight()));
+}
+
+static void testBackgroundAndGrid()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+
+    // three octaves
+    assertEQ(cache.getRects(Layer::AccidentalBackground).size(), 3 * 5);
+    // the top C may be lost to rounding in the semitone loop
+    assertGE(cache.getRects(Layer::CLine).size(), 3);
+
+    // Two bars. The sixteenth note grid is too dense at this size,
+    // so we get eighth notes. Song ends at the end of the screen.
+    assertEQ(cache.getRects(Layer::GridBar).size(), 2);
+    assertEQ(cache.getRects(Layer::Grid).size(), 14);
+    assertEQ(cache.getRects(Layer::GridEnd).size(), 1);
+    for (auto r : cache.getRects(Layer::Grid)) {
+        assertEQ(r.y, 20);
+        assertEQ(r.height, height - 20);
+    }
+}
+
+static void testNoRebuild()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+    const int count = cache._getBuildCount();
+    assertEQ(count, 3);
+
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count);
+
+    // cursor isn't cached
+    seq->context->setCursorTime(3);
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count);
+
+    cache.invalidate();
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count + 3);
+}
+
+static void testSelection()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+    int count = cache._getBuildCount();
+
+    seq->selection->select(getNote(seq, 2));
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count + 1);
+    assertEQ(cache.getRects(Layer::Note).size(), 7);
+    assertEQ(cache.getRects(Layer::SelectedNote).size(), 1);
+
+    // while dragging, someone else draws the selection
+    count = cache._getBuildCount();
+    cache.update(*seq, width, height, true);
+    assertEQ(cache._getBuildCount(), count + 1);
+    assertEQ(cache.getRects(Layer::Note).size(), 7);
+    assert(cache.getRects(Layer::SelectedNote).empty());
+
+    seq->selection->clear();
+    cache.update(*seq, width, height, false);
+    assertEQ(cache.getRects(Layer::Note).size(), 8);
+}
+
+static void testEdit()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+    const int count = cache._getBuildCount();
+
+    {
+        MidiLocker l(seq->song->lock);
+        MidiNoteEventPtr note = std::make_shared<MidiNoteEvent>();
+        note->startTime = 6.5;
+        note->duration = .5;
+        note->setPitch(4, 0);
+        seq->context->getTrack()->insertEvent(note);
+    }
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count + 1);
+    assertEQ(cache.getRects(Layer::Note).size(), 9);
+}
+
+static void testScroll()
+{
+    MidiSequencerPtr seq = makeTest();
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+    const int count = cache._getBuildCount();
+
+    seq->context->setTimeRange(4, 12);
+    cache.update(*seq, width, height, false);
+    assertEQ(cache._getBuildCount(), count + 3);
+
+    // notes that end before the screen are culled
+    assertEQ(cache.getRects(Layer::Note).size(), 4);
+}
+
+static void testCullPitch()
+{
+    MidiSequencerPtr seq = makeTest();
+    seq->context->setPitchRange(PitchUtils::pitchToCV(3, 2), PitchUtils::pitchToCV(3, 5));
+    seq->context->setCursorPitch(PitchUtils::pitchToCV(3, 2));
+    seq->context->setScaler(std::make_shared<NoteScreenScale>(width, height, 10, 20));
+    NoteRenderCache cache;
+    cache.update(*seq, width, height, false);
+    assertEQ(cache.getRects(Layer::Note).size(), 4);
+}
+
+void testNoteRenderCache()
+{
+    testNoteGeometry();
+    testBackgroundAndGrid();
+    testNoRebuild();
+    testSelection();
+    testEdit();
+    testScroll();
+    testCullPitch();
+    assertNoMidi();     // check for leaks
+}
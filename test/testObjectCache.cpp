@@ -2,7 +2,9 @@
 #include "asserts.h"
 #include "ObjectCache.h"
 
-extern int _numLookupParams;
+#include <thread>
+
+extern std::atomic<int> _numLookupParams;
 
 template <typename T>
 static void testBipolar()
@@ -233,10 +235,94 @@ static void test()
     testLPF<T>();
 }
 
-void testObjectCache()
+template <typename T>
+static void testWarmUp(bool parallel)
+{
+    const int numTables = int(CachedTableId::NumTables);
+    assertEQ(_numLookupParams, 0);
+
+    ObjectCache<T>::warmUp(parallel);
+    assertEQ(_numLookupParams, numTables);
+
+    // now getting them doesn't make any more
+    auto sin = ObjectCache<T>::getSinLookup();
+    auto exp = ObjectCache<T>::getExp2Ex();
+    auto lpf = ObjectCache<T>::get6PLPParams(.25f / 16);
+    assertEQ(_numLookupParams, numTables);
+
+    // and releasing our refs doesn't free them
+    sin.reset();
+    assertEQ(_numLookupParams, numTables);
+
+    ObjectCache<T>::unpin();
+
+    // exp still holds two tables
+    assertEQ(_numLookupParams, 2);
+    exp = nullptr;
+    assertEQ(_numLookupParams, 0);
+}
+
+/**
+ * Clients on different threads should all get the same table.
+ */
+template <typename T>
+static void testThreads()
 {
+    const int numThreads = 8;
+    std::shared_ptr<LookupTableParams<T>> tables[numThreads];
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.push_back(std::thread([&tables, i]() {
+            tables[i] = ObjectCache<T>::getTanh5();
+            }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        assert(tables[i]);
+        assertEQ(tables[i].get(), tables[0].get());
+    }
+    assertEQ(_numLookupParams, 1);
+}
+
+extern const PrecomputedTable precomputedTables[];
+
+/**
+ * If this fails, the table code has changed. Re-generate
+ * ObjectCacheTables.cpp with "test --tables".
+ */
+static void testPrecomputedMatches()
+{
+    for (int i = 0; i < int(CachedTableId::NumTables); ++i) {
+        LookupTableParams<float> params;
+        ObjectCache<float>::makeTable(params, CachedTableId(i));
+        const PrecomputedTable& table = precomputedTables[i];
+
+        assertEQ(table.numBins, params.numBins_i);
+        assertEQ(table.a, params.a);
+        assertEQ(table.b, params.b);
+        assertEQ(table.xMin, params.xMin);
+        assertEQ(table.xMax, params.xMax);
+        for (int j = 0; j < (params.numBins_i + 1) * 2; ++j) {
+            assertEQ(table.entries[j], params.entries[j]);
+        }
+    }
+}
+
+void testObjectCache(bool doEmit)
+{
+    if (doEmit) {
+        ObjectCache<float>::genTables();
+        return;
+    }
     assertEQ(_numLookupParams, 0);
     test<float>();
     test<double>();
+    testWarmUp<float>(false);
+    testWarmUp<float>(true);
+    testWarmUp<double>(true);
+    testThreads<float>();
+    testPrecomputedMatches();
     assertEQ(_numLookupParams, 0);
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "TestComposite.h"
 #include "asserts.h"
 #include "poly.h"
+#include "PolySimd.h"
 #include "Analyzer.h"
+#include "CHB.h"
 #include "Shaper.h"
 #include "SinOscillator.h"
 #include "TestComposite.h"
@@ -99,6 +101,115 @@ static void testDC()
     }
 }
 
+/**
+ * Each lane of PolySimd should match a Poly with the same gains.
+ */
+static void testSimdMatchesScalar(float inputGain)
+{
+    Poly<double, 10> poly[4];
+    PolySimd polySimd;
+
+    AudioMath::RandomUniformFunc random = AudioMath::random();
+    for (int i = 0; i < 10; ++i) {
+        float gains[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            gains[lane] = random();
+            poly[lane].setGain(i, gains[lane]);
+        }
+        polySimd.setGain(i, _mm_loadu_ps(gains));
+    }
+    polySimd.setInputGain(_mm_set_ps1(inputGain));
+
+    for (int i = 0; i < 100; ++i) {
+        float x[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            x[lane] = inputGain * float(2 * random() - 1);
+        }
+
+        float y[4];
+        _mm_storeu_ps(y, polySimd.run(_mm_loadu_ps(x)));
+        for (int lane = 0; lane < 4; ++lane) {
+            const float expected = poly[lane].run(x[lane], inputGain);
+            assertClose(y[lane], expected, .0001);
+        }
+    }
+}
+
+static void testSimdMatchesScalar()
+{
+    testSimdMatchesScalar(1);
+    testSimdMatchesScalar(.3f);
+}
+
+static void testSimdFold()
+{
+    for (float x = -7; x < 7; x += .1f) {
+        float y[4];
+        _mm_storeu_ps(y, PolySimd::fold(_mm_set_ps1(x)));
+        assertClose(y[0], AudioMath::fold(x), .00001);
+    }
+}
+
+/**
+ * Every voice of a poly CHB should sound like a mono CHB
+ * with the same inputs.
+ */
+static void testCHBPolyMatchesMono(bool external, int channels)
+{
+    using C = CHB<TestComposite>;
+    C polyChb;
+    std::vector<std::unique_ptr<C>> monoChb;
+    for (int channel = 0; channel < channels; ++channel) {
+        monoChb.push_back(std::unique_ptr<C>(new C()));
+    }
+
+    auto setup = [external](C& chb, int numChannels) {
+        chb.inputs[C::CV_INPUT].channels = numChannels;
+        chb.inputs[C::AUDIO_INPUT].channels = external ? numChannels : 0;
+        chb.inputs[C::ENV_INPUT].channels = numChannels;
+        chb.inputs[C::H1_INPUT].channels = numChannels;
+        chb.outputs[C::MIX_OUTPUT].channels = numChannels;
+        chb.params[C::PARAM_H1].value = 1;
+        chb.params[C::PARAM_H4].value = .5;
+    };
+    setup(polyChb, channels);
+
+    for (int channel = 0; channel < channels; ++channel) {
+        setup(*monoChb[channel], 1);
+        const float cv = channel * .1f - .5f;
+        const float env = 10.f - channel * .3f;
+        const float h1 = 2.f + channel * .5f;
+        polyChb.inputs[C::CV_INPUT].setVoltage(cv, channel);
+        polyChb.inputs[C::ENV_INPUT].setVoltage(env, channel);
+        polyChb.inputs[C::H1_INPUT].setVoltage(h1, channel);
+        monoChb[channel]->inputs[C::CV_INPUT].setVoltage(cv, 0);
+        monoChb[channel]->inputs[C::ENV_INPUT].setVoltage(env, 0);
+        monoChb[channel]->inputs[C::H1_INPUT].setVoltage(h1, 0);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        for (int channel = 0; channel < channels; ++channel) {
+            const float x = float(std::sin(.01 * i * (channel + 1)));
+            polyChb.inputs[C::AUDIO_INPUT].setVoltage(x, channel);
+            monoChb[channel]->inputs[C::AUDIO_INPUT].setVoltage(x, 0);
+        }
+        polyChb.step();
+        assertEQ(polyChb.getNumChannels(), channels);
+        for (int channel = 0; channel < channels; ++channel) {
+            C& mono = *monoChb[channel];
+            mono.step();
+            assertClose(polyChb.outputs[C::MIX_OUTPUT].getVoltage(channel),
+                mono.outputs[C::MIX_OUTPUT].getVoltage(0), .001);
+        }
+    }
+}
+
+static void testCHBPoly()
+{
+    testCHBPolyMatchesMono(false, 3);
+    testCHBPolyMatchesMono(false, 16);
+    testCHBPolyMatchesMono(true, 5);
+}
 
 void testPoly()
 {
@@ -106,4 +217,7 @@ void testPoly()
     test1();
     testDC();
     testTerms();
-}
\ No newline at end of file
+    testSimdMatchesScalar();
+    testSimdFold();
+    testCHBPoly();
+}
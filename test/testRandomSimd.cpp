@@ -0,0 +1,201 @@
+#include "asserts.h"
+#include "LookupTableFactory.h"
+#include "RandomSimd.h"
+
+#include <vector>
+
+/**
+ * Plain xoshiro128+, from the reference implementation.
+ */
+class RefXoshiro
+{
+public:
+    uint32_t s[4];
+
+    uint32_t next()
+    {
+        const uint32_t result = s[0] + s[3];
+        const uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+        return result;
+    }
+};
+
+static uint64_t refSplitMix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// each lane should be a plain xoshiro128+
+static void testRandomSimdReference()
+{
+    const uint32_t seed = 1234;
+    RefXoshiro ref[4];
+    uint64_t state = seed;
+    for (int word = 0; word < 4; ++word) {
+        for (int lane = 0; lane < 4; lane += 2) {
+            const uint64_t x = refSplitMix64(state);
+            ref[lane].s[word] = uint32_t(x);
+            ref[lane + 1].s[word] = uint32_t(x >> 32);
+        }
+    }
+
+    RandomSimd r(seed);
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t x[4];
+        _mm_storeu_si128((__m128i*) x, r.next());
+        for (int lane = 0; lane < 4; ++lane) {
+            assertEQ(x[lane], ref[lane].next());
+        }
+    }
+}
+
+static void testRandomSimdSeed()
+{
+    const int n = 64;
+    float a[n], b[n], c[n];
+    RandomSimd r1(5);
+    RandomSimd r2(5);
+    RandomSimd r3(6);
+    r1.fillUniform(a, n);
+    r2.fillUniform(b, n);
+    r3.fillUniform(c, n);
+
+    int numSame = 0;
+    for (int i = 0; i < n; ++i) {
+        assertEQ(a[i], b[i]);
+        if (a[i] == c[i]) {
+            ++numSame;
+        }
+    }
+    assertLT(numSame, 2);
+
+    // and setSeed starts over
+    r1.setSeed(5);
+    r1.fillUniform(b, n);
+    for (int i = 0; i < n; ++i) {
+        assertEQ(a[i], b[i]);
+    }
+}
+
+// the scalar calls and the odd sized blocks should give the same numbers
+static void testRandomSimdScalar()
+{
+    const int n = 15;
+    float a[n];
+    RandomSimd r1;
+    RandomSimd r2;
+    r1.fillNormal(a, n);
+    for (int i = 0; i < n; ++i) {
+        assertEQ(a[i], r2.normal());
+    }
+}
+
+static void testUniformStats()
+{
+    RandomSimd r;
+    const int n = 400 * 1000;
+    std::vector<float> data(n);
+    r.fillUniform(data.data(), n);
+
+    const int numBins = 20;
+    int bins[numBins] = {0};
+    double sum = 0;
+    double sumSq = 0;
+    double sumLanes = 0;        // neighbors are from different lanes
+    for (int i = 0; i < n; ++i) {
+        const double x = data[i];
+        assert(x >= 0 && x < 1);
+        sum += x;
+        sumSq += x * x;
+        if (i > 0) {
+            sumLanes += (x - .5) * (data[i - 1] - .5);
+        }
+        bins[int(x * numBins)]++;
+    }
+    const double mean = sum / n;
+    const double variance = sumSq / n - mean * mean;
+    assertClose(mean, .5, .005);
+    assertClose(variance, 1.0 / 12.0, .002);
+
+    // correlation of neighbors
+    assertClose(sumLanes / (n * variance), 0, .01);
+
+    // chi squared, 19 degrees of freedom. 43.8 is the .1% point
+    const double expected = double(n) / numBins;
+    double chi = 0;
+    for (int i = 0; i < numBins; ++i) {
+        chi += (bins[i] - expected) * (bins[i] - expected) / expected;
+    }
+    assertLT(chi, 43.8);
+}
+
+static void testNormalStats()
+{
+    RandomSimd r;
+    const int n = 400 * 1000;
+    std::vector<float> data(n);
+    r.fillNormal(data.data(), n);
+
+    double sum = 0;
+    double sumSq = 0;
+    double sum4 = 0;
+    int within1 = 0;
+    int within2 = 0;
+    float biggest = 0;
+    for (int i = 0; i < n; ++i) {
+        const double x = data[i];
+        sum += x;
+        sumSq += x * x;
+        sum4 += x * x * x * x;
+        if (std::abs(x) < 1) {
+            ++within1;
+        }
+        if (std::abs(x) < 2) {
+            ++within2;
+        }
+        biggest = std::max(biggest, std::abs(data[i]));
+    }
+    const double mean = sum / n;
+    const double variance = sumSq / n - mean * mean;
+    assertClose(mean, 0, .01);
+    assertClose(variance, 1, .02);
+    assertClose(sum4 / n, 3, .1);      // kurtosis
+    assertClose(double(within1) / n, .6827, .005);
+    assertClose(double(within2) / n, .9545, .003);
+    assertLT(biggest, 3.5);
+    assertGT(biggest, 3.3);
+}
+
+static void testNormalInverse()
+{
+    using F = LookupTableFactory<double>;
+    assertClose(F::normalInverse(.5), 0, 1e-9);
+    assertClose(F::normalInverse(.975), 1.959964, 1e-5);
+    assertClose(F::normalInverse(.025), -1.959964, 1e-5);
+    assertClose(F::normalInverse(.001), -3.090232, 1e-5);
+
+    auto table = ObjectCache<float>::getNormalInverse();
+    for (double p = .01; p < .99; p += .001) {
+        const float y = LookupTable<float>::lookup(*table, float(p));
+        assertClose(y, F::normalInverse(p), .001);
+    }
+}
+
+void testRandomSimd()
+{
+    testRandomSimdReference();
+    testRandomSimdSeed();
+    testRandomSimdScalar();
+    testUniformStats();
+    testNormalStats();
+    testNormalInverse();
+}
@@ -1,9 +1,14 @@
 
+#include "HalfBandDecimator.h"
+#include "HalfBandUpsampler.h"
 #include "IIRUpsampler.h"
 #include "IIRDecimator.h"
 
 #include "asserts.h"
 
+#include <complex>
+#include <vector>
+
 static void setup(IIRUpsampler& up, IIRDecimator& dec)
 {
    // float cutoff = .25 / 16;
@@ -55,9 +60,186 @@ static void test2()
     assertClose(x, 10, .001);
 }
 
+// half band: 0 -> 0, 10 -> 10, at every oversample rate
+static void testHalfBandDC(int factor)
+{
+    float buffer[16];
+    HalfBandUpsampler up;
+    HalfBandDecimator dec;
+    up.setup(factor);
+    dec.setup(factor);
+
+    up.process(buffer, 0);
+    assertEQ(dec.process(buffer), 0);
+
+    float x = 0;
+    for (int i = 0; i < 100; ++i) {
+        up.process(buffer, 10);
+        x = dec.process(buffer);
+    }
+    assertClose(x, 10, .001);
+
+    // every up-sampled sample should settle, not just the ones we keep
+    for (int i = 0; i < factor; ++i) {
+        assertClose(buffer[i], 10, .001);
+    }
+}
+
+/**
+ * Amplitude of the component of signal at normalized freq.
+ * freq should be a multiple of 1 / signal.size()
+ */
+static double getAmplitude(const std::vector<float>& signal, double freq)
+{
+    std::complex<double> sum = 0;
+    for (int i = 0; i < int(signal.size()); ++i) {
+        sum += double(signal[i]) * std::polar(1.0, -2 * AudioMath::Pi * freq * i);
+    }
+    return 2 * std::abs(sum) / signal.size();
+}
+
+static const int analyzeSize = 4096;
+
+/**
+ * Decimates a unit sine at bin (normalized to the final sample rate,
+ * may be above nyquist), and returns the amplitude that comes out
+ * at outBin.
+ */
+template <class Dec>
+static double getDecimatorGain(int factor, int bin, int outBin)
+{
+    Dec dec;
+    dec.setup(factor);
+    const double freq = double(bin) / analyzeSize;
+    std::vector<float> output;
+    float buffer[16];
+    int n = 0;
+    for (int i = 0; i < 256 + analyzeSize; ++i) {
+        for (int j = 0; j < factor; ++j) {
+            buffer[j] = float(std::sin(2 * AudioMath::Pi * freq * n++ / factor));
+        }
+        const float y = dec.process(buffer);
+        if (i >= 256) {
+            output.push_back(y);
+        }
+    }
+    return getAmplitude(output, double(outBin) / analyzeSize);
+}
+
+static void testHalfBandDecimator(int factor)
+{
+    // pass band is flat up to 45% of the sample rate
+    const int bin = int(.45 * analyzeSize);
+    assertClose(getDecimatorGain<HalfBandDecimator>(factor, bin, bin), 1, .001);
+    assertClose(getDecimatorGain<HalfBandDecimator>(factor, 100, 100), 1, .001);
+
+    // .65 aliases down to .35
+    const int aliasBin = int(.65 * analyzeSize);
+    const double alias = getDecimatorGain<HalfBandDecimator>(factor, aliasBin, analyzeSize - aliasBin);
+    assertLT(AudioMath::db(alias), -75);
+
+    // IIRDecimator only does 4X and up
+    if (factor >= 4) {
+        // IIR is already rolling off in the pass band
+        assertLT(getDecimatorGain<IIRDecimator>(factor, bin, bin), .1);
+        const double aliasIIR = getDecimatorGain<IIRDecimator>(factor, aliasBin, analyzeSize - aliasBin);
+        assertLT(AudioMath::db(alias), AudioMath::db(aliasIIR) - 20);
+    }
+
+    // just below the sample rate, it aliases down to almost DC
+    const double nearDC = getDecimatorGain<HalfBandDecimator>(factor, analyzeSize - 10, 10);
+    assertLT(AudioMath::db(nearDC), -75);
+}
+
+/**
+ * Up-samples a unit sine at bin, and returns the amplitude of the image
+ * just above the original nyquist, or of the sine itself.
+ */
+static double getUpsamplerImage(int factor, int bin, bool wantImage)
+{
+    HalfBandUpsampler up;
+    up.setup(factor);
+    const double freq = double(bin) / analyzeSize;
+    std::vector<float> output;
+    float buffer[16];
+    for (int i = 0; i < 256 + analyzeSize; ++i) {
+        up.process(buffer, float(std::sin(2 * AudioMath::Pi * freq * i)));
+        if (i >= 256) {
+            for (int j = 0; j < factor; ++j) {
+                output.push_back(buffer[j]);
+            }
+        }
+    }
+    const double outFreq = wantImage ? (1 - freq) / factor : freq / factor;
+    return getAmplitude(output, outFreq);
+}
+
+static void testHalfBandUpsampler(int factor)
+{
+    const int bin = int(.3 * analyzeSize);
+    assertClose(getUpsamplerImage(factor, bin, false), 1, .001);
+    assertLT(AudioMath::db(getUpsamplerImage(factor, bin, true)), -75);
+}
+
+/**
+ * Each lane of the SSE version should be the same as the scalar one.
+ */
+static void testHalfBandSimd(int factor)
+{
+    HalfBandUpsampler up[4];
+    HalfBandDecimator dec[4];
+    HalfBandUpsamplerSimd upSimd;
+    HalfBandDecimatorSimd decSimd;
+    for (int lane = 0; lane < 4; ++lane) {
+        up[lane].setup(factor);
+        dec[lane].setup(factor);
+    }
+    upSimd.setup(factor);
+    decSimd.setup(factor);
+
+    for (int i = 0; i < 200; ++i) {
+        float input[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            input[lane] = float(std::sin(.01 * (lane + 1) * i)) + ((i % (lane + 3)) ? 0 : 1);
+        }
+        __m128 bufferSimd[16];
+        upSimd.process(bufferSimd, _mm_loadu_ps(input));
+
+        // mess up the signal, so the decimator sees something different
+        for (int j = 0; j < factor; ++j) {
+            bufferSimd[j] = _mm_mul_ps(bufferSimd[j], _mm_mul_ps(bufferSimd[j], bufferSimd[j]));
+        }
+        float outputSimd[4];
+        _mm_storeu_ps(outputSimd, decSimd.process(bufferSimd));
+
+        for (int lane = 0; lane < 4; ++lane) {
+            float buffer[16];
+            up[lane].process(buffer, input[lane]);
+            for (int j = 0; j < factor; ++j) {
+                float expected[4];
+                _mm_storeu_ps(expected, bufferSimd[j]);
+                buffer[j] = buffer[j] * buffer[j] * buffer[j];
+                assertEQ(buffer[j], expected[lane]);
+            }
+            assertEQ(dec[lane].process(buffer), outputSimd[lane]);
+        }
+    }
+}
+
+static void testHalfBand()
+{
+    for (int factor = 2; factor <= 16; factor *= 2) {
+        testHalfBandDC(factor);
+        testHalfBandDecimator(factor);
+        testHalfBandUpsampler(factor);
+        testHalfBandSimd(factor);
+    }
+}
+
 void testRateConversion()
 {
     test0();
     test1();
     test2();
+    testHalfBand();
 }
\ No newline at end of file
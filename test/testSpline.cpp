@@ -147,10 +147,11 @@ static void testShaper0()
     }
 }
 
-static void testShaper1Sub(int shape, float gain, float targetRMS)
+static void testShaper1Sub(int shape, float gain, float targetRMS, bool polyphase)
 {
     Shaper<TestComposite> gmr;
     gmr.params[Shaper<TestComposite>::PARAM_SHAPE].value = (float) shape;
+    gmr.params[Shaper<TestComposite>::PARAM_POLYPHASE].value = polyphase ? 1.f : 0.f;
     gmr.params[Shaper<TestComposite>::PARAM_GAIN].value = gain;        // max gain
     gmr.inputs[Shaper<TestComposite>::INPUT_AUDIO0].channels = 1;
     gmr.outputs[Shaper<TestComposite>::OUTPUT_AUDIO0].channels = 1;
@@ -182,8 +183,9 @@ static void testShaper1()
     for (int i = 0; i < shapeMax; ++i) {
         const float targetOutput = (i == (int) Shaper<TestComposite>::Shapes::Crush) ? 0 : 5 * .707f;
 
-        testShaper1Sub(i, 5, targetOutput);
-        testShaper1Sub(i, 0, 0);
+        testShaper1Sub(i, 5, targetOutput, false);
+        testShaper1Sub(i, 0, 0, false);
+        testShaper1Sub(i, 5, targetOutput, true);
     }
 }
 
@@ -205,6 +207,7 @@ static void testSplineExtremes()
     paramLimits[sp.PARAM_OFFSET_TRIM] = fp(-1.f, 1.f);
     paramLimits[sp.PARAM_OVERSAMPLE] = fp(0.f, 2.f);
     paramLimits[sp.PARAM_ACDC] = fp(0.f, 1.f);
+    paramLimits[sp.PARAM_POLYPHASE] = fp(0.f, 1.f);
 
     ExtremeTester< Shaper<TestComposite>>::test(sp, paramLimits, true, "shaper");
 }
@@ -73,16 +73,9 @@ static void step(std::shared_ptr<T> mixer)
 template <typename T>
 static void dumpUb(std::shared_ptr<T> mixer)
 {
-    const int numUb = sizeof(mixer->unbufferedCV) / sizeof(mixer->unbufferedCV[0]);
-    printf("ubcv: ");
-
-    int x = 0;
-    for (int i = 0; i < numUb; ++i) {
-        printf("%.2f ", mixer->unbufferedCV[i]);
-        if (++x >= 4) {
-            printf("\n      ");
-            x = 0;
-        }
+    printf("gains: ");
+    for (int i = 0; i < T::numChannels; ++i) {
+        printf("%.2f ", mixer->strips.getChannelGain(i));
     }
     printf("\n");
 }
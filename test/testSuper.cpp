@@ -0,0 +1,95 @@
+#include "asserts.h"
+#include "Super.h"
+#include "TestComposite.h"
+
+using Comp = Super<TestComposite>;
+
+static void connect(Comp& super, bool stereo)
+{
+    super.outputs[Comp::MAIN_OUTPUT_LEFT].channels = 1;
+    if (stereo) {
+        super.outputs[Comp::MAIN_OUTPUT_RIGHT].channels = 1;
+    }
+}
+
+static void testMono(int clean, bool polyphase)
+{
+    Comp super;
+    connect(super, false);
+    super.params[Comp::CLEAN_PARAM].value = float(clean);
+    super.params[Comp::POLYPHASE_PARAM].value = polyphase ? 1.f : 0.f;
+    float max = -100;
+    float min = 100;
+    for (int i = 0; i < 4000; ++i) {
+        super.step();
+        const float x = super.outputs[Comp::MAIN_OUTPUT_LEFT].getVoltage(0);
+        max = std::max(x, max);
+        min = std::min(x, min);
+    }
+    assertEQ(super.getNumChannels(), 1);
+    assertEQ(super.outputs[Comp::MAIN_OUTPUT_LEFT].getChannels(), 1);
+    assertGT(max, 1);
+    assertLT(min, -1);
+}
+
+/**
+ * Each voice of a poly Super should sound exactly like
+ * a mono Super with the same CV.
+ */
+static void testPolyMatchesMono(int channels, int clean, bool stereo, bool polyphase)
+{
+    Comp poly;
+    connect(poly, stereo);
+    poly.params[Comp::CLEAN_PARAM].value = float(clean);
+    poly.params[Comp::POLYPHASE_PARAM].value = polyphase ? 1.f : 0.f;
+    poly.params[Comp::DETUNE_PARAM].value = 2;
+    poly.inputs[Comp::CV_INPUT].channels = channels;
+    for (int i = 0; i < channels; ++i) {
+        poly.inputs[Comp::CV_INPUT].setVoltage(-1.f + .3f * i, i);
+    }
+
+    std::vector<std::shared_ptr<Comp>> monos;
+    for (int i = 0; i < channels; ++i) {
+        auto mono = std::make_shared<Comp>();
+        connect(*mono, stereo);
+        mono->params[Comp::CLEAN_PARAM].value = float(clean);
+        mono->params[Comp::POLYPHASE_PARAM].value = polyphase ? 1.f : 0.f;
+        mono->params[Comp::DETUNE_PARAM].value = 2;
+        mono->inputs[Comp::CV_INPUT].channels = 1;
+        mono->inputs[Comp::CV_INPUT].setVoltage(-1.f + .3f * i, 0);
+        monos.push_back(mono);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        poly.step();
+        for (int ch = 0; ch < channels; ++ch) {
+            monos[ch]->step();
+            assertEQ(poly.outputs[Comp::MAIN_OUTPUT_LEFT].getVoltage(ch),
+                monos[ch]->outputs[Comp::MAIN_OUTPUT_LEFT].getVoltage(0));
+            assertEQ(poly.outputs[Comp::MAIN_OUTPUT_RIGHT].getVoltage(ch),
+                monos[ch]->outputs[Comp::MAIN_OUTPUT_RIGHT].getVoltage(0));
+        }
+    }
+    assertEQ(poly.getNumChannels(), channels);
+    assertEQ(poly.outputs[Comp::MAIN_OUTPUT_LEFT].getChannels(), channels);
+}
+
+static void testPolyMatchesMono()
+{
+    for (int clean = 0; clean < 3; ++clean) {
+        testPolyMatchesMono(3, clean, false, false);
+        testPolyMatchesMono(16, clean, false, false);
+        testPolyMatchesMono(6, clean, true, false);
+    }
+    testPolyMatchesMono(6, 1, true, true);
+    testPolyMatchesMono(16, 2, false, true);
+}
+
+void testSuper()
+{
+    testMono(0, false);
+    testMono(2, false);
+    testMono(1, true);
+    testMono(2, true);
+    testPolyMatchesMono();
+}
@@ -3,9 +3,11 @@
 #include "ThreadSharedState.h"
 #include "ThreadServer.h"
 #include "ThreadClient.h"
+#include "ThreadPool.h"
 #include "ThreadPriority.h"
 
 #include <assert.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -212,6 +214,259 @@ static void test5()
     ThreadPriority::boostRealtimeWindows();
 }
 #endif
+
+/*****************************************************************/
+// tests of ThreadPool
+
+class TestHandler : public ThreadPoolHandler
+{
+public:
+    ThreadMessage* handleMessage(ThreadMessage* msg) override
+    {
+        assert(msg->type == ThreadMessage::Type::TEST1);
+        Test1Message* tstMsg = static_cast<Test1Message *>(msg);
+        assertEQ(tstMsg->payload, nextExpectedPayload);
+        ++nextExpectedPayload;
+        tstMsg->payload += 1000;
+        return tstMsg;
+    }
+    int nextExpectedPayload = 100;
+};
+
+static std::unique_ptr<ThreadPoolClient> makeTestClient(int queueSize, std::shared_ptr<ThreadPool> pool)
+{
+    std::unique_ptr<ThreadPoolHandler> handler(new TestHandler());
+    return std::unique_ptr<ThreadPoolClient>(new ThreadPoolClient(std::move(handler), queueSize, pool));
+}
+
+static ThreadMessage* waitForMessage(ThreadPoolClient* client)
+{
+    for (;;) {
+        ThreadMessage* msg = client->getMessage();
+        if (msg) {
+            return msg;
+        }
+    }
+}
+
+static void testPool0()
+{
+    assertEQ(ThreadPool::_instanceCount, 0);
+    {
+        auto pool = std::make_shared<ThreadPool>(3);
+        assertEQ(pool->getNumWorkers(), 3);
+        auto client = makeTestClient(4, pool);
+        assertEQ(ThreadPool::_instanceCount, 1);
+    }
+    assertEQ(ThreadPool::_instanceCount, 0);
+
+    // shared pool is made for the first user, goes away with the last
+    {
+        auto pool = ThreadPool::getShared();
+        assertEQ(ThreadPool::getShared(), pool);
+        assertGT(pool->getNumWorkers(), 0);
+    }
+    assertEQ(ThreadPool::_instanceCount, 0);
+}
+
+// many messages in play at once, replies come back in order
+static void testPoolQueue()
+{
+    const int queueSize = 8;
+    auto client = makeTestClient(queueSize, std::make_shared<ThreadPool>(4));
+
+    Test1Message messages[queueSize];
+    for (int i = 0; i < queueSize; ++i) {
+        messages[i].payload = 100 + i;
+        assert(client->sendMessage(messages + i));
+    }
+
+    // queue is full until we take a reply
+    Test1Message extra;
+    extra.payload = 100 + queueSize;
+    assert(!client->sendMessage(&extra));
+
+    for (int i = 0; i < queueSize; ++i) {
+        ThreadMessage* msg = waitForMessage(client.get());
+        assert(msg == messages + i);
+        assertEQ(messages[i].payload, 1100 + i);
+        if (i == 0) {
+            assert(client->sendMessage(&extra));
+        }
+    }
+    assert(waitForMessage(client.get()) == &extra);
+    assertEQ(extra.payload, 1100 + queueSize);
+    assert(!client->getMessage());
+}
+
+// several clients sharing a pool
+static void testPoolClients()
+{
+    const int numClients = 10;
+    const int numRounds = 50;
+    auto pool = std::make_shared<ThreadPool>(3);
+    std::vector<std::unique_ptr<ThreadPoolClient>> clients;
+    std::vector<Test1Message> messages(numClients);
+    for (int i = 0; i < numClients; ++i) {
+        clients.push_back(makeTestClient(1, pool));
+    }
+    for (int round = 0; round < numRounds; ++round) {
+        for (int i = 0; i < numClients; ++i) {
+            messages[i].payload = 100 + round;
+            assert(clients[i]->sendMessage(&messages[i]));
+        }
+        for (int i = 0; i < numClients; ++i) {
+            waitForMessage(clients[i].get());
+            assertEQ(messages[i].payload, 1100 + round);
+        }
+    }
+}
+
+/*****************************************************************/
+// benchmark ThreadPool against one ThreadServer per client
+
+using BenchClock = std::chrono::high_resolution_clock;
+
+class BenchMessage : public ThreadMessage
+{
+public:
+    BenchMessage() : ThreadMessage(Type::TEST2)
+    {
+    }
+    int payload = 0;
+    BenchClock::time_point sentTime;
+};
+
+// a little bit of work, so that the workers have something to do
+static int benchWork(int x)
+{
+    for (int i = 0; i < 200; ++i) {
+        x = x * 1103515245 + 12345;
+    }
+    return x;
+}
+
+class BenchServer : public ThreadServer
+{
+public:
+    BenchServer(std::shared_ptr<ThreadSharedState> state) : ThreadServer(state)
+    {
+    }
+    void handleMessage(ThreadMessage* msg) override
+    {
+        BenchMessage* benchMsg = static_cast<BenchMessage*>(msg);
+        benchMsg->payload = benchWork(benchMsg->payload);
+        sendMessageToClient(msg);
+    }
+};
+
+class BenchHandler : public ThreadPoolHandler
+{
+public:
+    ThreadMessage* handleMessage(ThreadMessage* msg) override
+    {
+        BenchMessage* benchMsg = static_cast<BenchMessage*>(msg);
+        benchMsg->payload = benchWork(benchMsg->payload);
+        return msg;
+    }
+};
+
+/**
+ * One thread (like the audio thread) polls all the clients, keeping up to
+ * 'depth' messages in play for each, until each client has done 'count' round trips.
+ */
+template <class TClient>
+static void runBenchmark(const char* name, std::vector<std::unique_ptr<TClient>>& clients, int depth, int count)
+{
+    const int numClients = int(clients.size());
+    std::vector<BenchMessage> messages(numClients * depth);
+    std::vector<std::vector<BenchMessage*>> freeMessages(numClients);
+    for (int i = 0; i < numClients; ++i) {
+        for (int j = 0; j < depth; ++j) {
+            freeMessages[i].push_back(&messages[i * depth + j]);
+        }
+    }
+
+    std::vector<int> sent(numClients, 0);
+    std::vector<int> received(numClients, 0);
+    double totalLatency = 0;
+    double maxLatency = 0;
+    int done = 0;
+
+    const auto start = BenchClock::now();
+    while (done < numClients) {
+        bool gotAny = false;
+        for (int i = 0; i < numClients; ++i) {
+            if (received[i] == count) {
+                continue;
+            }
+            while (sent[i] < count && !freeMessages[i].empty()) {
+                BenchMessage* msg = freeMessages[i].back();
+                msg->payload = sent[i];
+                msg->sentTime = BenchClock::now();
+                if (!clients[i]->sendMessage(msg)) {
+                    break;
+                }
+                freeMessages[i].pop_back();
+                ++sent[i];
+            }
+            for (ThreadMessage* msg = clients[i]->getMessage(); msg; msg = clients[i]->getMessage()) {
+                BenchMessage* benchMsg = static_cast<BenchMessage*>(msg);
+                const double latency = std::chrono::duration<double, std::micro>(BenchClock::now() - benchMsg->sentTime).count();
+                totalLatency += latency;
+                maxLatency = std::max(maxLatency, latency);
+                freeMessages[i].push_back(benchMsg);
+                gotAny = true;
+                if (++received[i] == count) {
+                    ++done;
+                }
+            }
+        }
+        if (!gotAny) {
+            // the real audio thread has better things to do than spin, so let the workers run
+            std::this_thread::yield();
+        }
+    }
+    const double seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    const int total = numClients * count;
+    printf("%s clients=%d depth=%d: %.0f msg/sec, latency avg %.1f max %.0f usec\n",
+        name, numClients, depth, total / seconds, totalLatency / total, maxLatency);
+    fflush(stdout);
+}
+
+static void benchmarkServers(int numClients, int count)
+{
+    std::vector<std::unique_ptr<ThreadClient>> clients;
+    for (int i = 0; i < numClients; ++i) {
+        auto state = std::make_shared<ThreadSharedState>();
+        std::unique_ptr<ThreadServer> server(new BenchServer(state));
+        clients.push_back(std::unique_ptr<ThreadClient>(new ThreadClient(state, std::move(server))));
+    }
+    runBenchmark("thread per client", clients, 1, count);
+}
+
+static void benchmarkPool(int numClients, int depth, int count)
+{
+    std::vector<std::unique_ptr<ThreadPoolClient>> clients;
+    auto pool = std::make_shared<ThreadPool>();
+    for (int i = 0; i < numClients; ++i) {
+        std::unique_ptr<ThreadPoolHandler> handler(new BenchHandler());
+        clients.push_back(std::unique_ptr<ThreadPoolClient>(new ThreadPoolClient(std::move(handler), depth, pool)));
+    }
+    runBenchmark("thread pool", clients, depth, count);
+}
+
+static void testPoolBenchmark(bool extended)
+{
+    const int totalMessages = extended ? 200000 : 20000;
+    for (int numClients : {1, 8, 32}) {
+        const int count = totalMessages / numClients;
+        benchmarkServers(numClients, count);
+        benchmarkPool(numClients, 1, count);
+        benchmarkPool(numClients, 4, count);
+    }
+}
+
 /*****************************************************************/
 
 void testThread(bool extended)
@@ -223,6 +478,10 @@ void testThread(bool extended)
     test1();
     test2();
     test3();
+    testPool0();
+    testPoolQueue();
+    testPoolClients();
+    testPoolBenchmark(extended);
     if (extended) {
         test4();
     }
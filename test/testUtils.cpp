@@ -25,7 +25,36 @@ static void testDiv0()
     assert(called);
 }
 
+static void testDivBlock()
+{
+    int calls = 0;
+    Divider d;
+    d.setup(4, [&calls]() {
+        ++calls;
+        });
+
+    // fires on first call, then can run 4
+    int samples = d.stepBlock(100);
+    assertEQ(calls, 1);
+    assertEQ(samples, 4);
+
+    // partial run
+    samples = d.stepBlock(3);
+    assertEQ(calls, 2);
+    assertEQ(samples, 3);
+
+    // only one left before next call
+    samples = d.stepBlock(100);
+    assertEQ(calls, 2);
+    assertEQ(samples, 1);
+
+    samples = d.stepBlock(100);
+    assertEQ(calls, 3);
+    assertEQ(samples, 4);
+}
+
 void testUtils()
 {
     testDiv0();
+    testDivBlock();
 }
\ No newline at end of file
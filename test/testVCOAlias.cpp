@@ -2,10 +2,14 @@
 #include "Analyzer.h"
 #include "asserts.h"
 #include "FunVCO.h"
+#include "HalfBandDecimator.h"
+#include "IIRDecimator.h"
 #include "SawOscillator.h"
 #include "SinOscillator.h"
 #include "TestComposite.h"
 
+#include <complex>
+
 
 // globals for these tests
 static const float sampleRate = 44100;
@@ -423,6 +427,55 @@ static void testAliasFun(double normalizedFreq)
 }
 
 
+/**
+ * Decimate an oversampled sine, and return how much of it
+ * comes out, in db. Above nyquist, that's how much it aliases
+ * down into the audio band.
+ * freq is normalized to the final sample rate.
+ */
+template <class Dec>
+static double getDecimatorGainDb(double freq, int oversample)
+{
+    const int size = 4096;
+    const int bin = int(freq * size);
+    const int outBin = (bin > size / 2) ? size - bin : bin;
+    Dec dec;
+    dec.setup(oversample);
+
+    std::complex<double> sum = 0;
+    float buffer[16];
+    int n = 0;
+    for (int i = 0; i < 256 + size; ++i) {
+        for (int j = 0; j < oversample; ++j) {
+            buffer[j] = float(std::sin(2 * AudioMath::Pi * bin * n++ / (double(size) * oversample)));
+        }
+        const float y = dec.process(buffer);
+        if (i >= 256) {
+            sum += double(y) * std::polar(1.0, -2 * AudioMath::Pi * outBin * (i - 256) / size);
+        }
+    }
+    return AudioMath::db(2 * std::abs(sum) / size);
+}
+
+/**
+ * Print a table of the pass band and the aliasing
+ * of the IIR and polyphase decimators.
+ */
+static void testAliasDecimators()
+{
+    for (int oversample = 4; oversample <= 16; oversample *= 4) {
+        printf("\ndecimator response, oversample = %d\n", oversample);
+        printf("in Hz    out Hz     IIR db   polyphase db\n");
+        for (double freq = .1; freq < 1; freq += .05) {
+            printf("%6.0f   %6.0f     %6.1f   %6.1f\n",
+                freq * sampleRate,
+                ((freq > .5) ? 1 - freq : freq) * sampleRate,
+                getDecimatorGainDb<IIRDecimator>(freq, oversample),
+                getDecimatorGainDb<HalfBandDecimator>(freq, oversample));
+        }
+    }
+}
+
 /*
 First try:
 desired freq = 844.180682, round 842.486572
@@ -509,4 +562,5 @@ void testVCOAlias()
        // testAliasFunOrig(f);
         testAliasFun(f);
     }
+    testAliasDecimators();
 }
\ No newline at end of file
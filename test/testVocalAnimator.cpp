@@ -5,6 +5,7 @@
 #include "VocalAnimator.h"
 #include "TestComposite.h"
 #include "VocalFilter.h"
+#include "FormantFilterBankSimd.h"
 #include "FormantTables2.h"
 
 using Animator = VocalAnimator<TestComposite>;
@@ -294,6 +295,195 @@ static void testVocalFilter()
     }
 }
 
+static float getLane(__m128 x, int lane)
+{
+    float buffer[4];
+    _mm_storeu_ps(buffer, x);
+    return buffer[lane];
+}
+
+/**
+ * Each lane of the bank should be exactly the same as
+ * summing the scalar filters.
+ */
+static void testFormantBank(StateVariableFilterParams<float>::Mode mode)
+{
+    const int numBands = 5;
+    FormantFilterBankSimd<numBands> bank;
+    bank.setMode(mode);
+
+    StateVariableFilterState<float> states[4][numBands];
+    StateVariableFilterParams<float> params[4][numBands];
+    float gains[4][numBands];
+    for (int band = 0; band < numBands; ++band) {
+        float fc[4], bw[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            fc[lane] = .001f + .013f * band + .007f * lane;
+            bw[lane] = .05f + .02f * band + .1f * lane;
+            gains[lane][band] = 1.f / (1 + band + lane);
+            params[lane][band].setMode(mode);
+            params[lane][band].setFreq(fc[lane]);
+            params[lane][band].setNormalizedBandwidth(bw[lane]);
+        }
+        bank.setFreq(band, _mm_loadu_ps(fc));
+        bank.setNormalizedBandwidth(band, _mm_loadu_ps(bw));
+        bank.setGain(band, _mm_setr_ps(gains[0][band], gains[1][band], gains[2][band], gains[3][band]));
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        float input[4];
+        for (int lane = 0; lane < 4; ++lane) {
+            input[lane] = (i % (20 + lane) < 10) ? 1.f : -1.f;
+        }
+        const __m128 output = bank.run(_mm_loadu_ps(input));
+        for (int lane = 0; lane < 4; ++lane) {
+            float expected = 0;
+            for (int band = 0; band < numBands; ++band) {
+                expected += gains[lane][band] *
+                    StateVariableFilter<float>::run(input[lane], states[lane][band], params[lane][band]);
+            }
+            assertEQ(getLane(output, lane), expected);
+        }
+    }
+}
+
+static void testFormantBank()
+{
+    testFormantBank(StateVariableFilterParams<float>::Mode::BandPass);
+    testFormantBank(StateVariableFilterParams<float>::Mode::LowPass);
+}
+
+/**
+ * Every voice of a poly module should sound exactly like
+ * a mono one with the same input and CV.
+ */
+template <class Comp>
+static void testPolyMatchesMono(int channels, int cvInput)
+{
+    auto input = [](int channel, int i) {
+        return (i % (30 + 7 * channel) < 15) ? 1.f : -1.f;
+    };
+    auto cv = [](int channel) {
+        return -2.f + .5f * channel;
+    };
+
+    Comp poly;
+    poly.setSampleRate(44100);
+    poly.init();
+    poly.outputs[Comp::AUDIO_OUTPUT].channels = 1;
+    poly.inputs[Comp::AUDIO_INPUT].channels = channels;
+    poly.inputs[cvInput].channels = channels;
+    for (int ch = 0; ch < channels; ++ch) {
+        poly.inputs[cvInput].setVoltage(cv(ch), ch);
+    }
+
+    std::vector<std::shared_ptr<Comp>> monos;
+    for (int ch = 0; ch < channels; ++ch) {
+        auto mono = std::make_shared<Comp>();
+        mono->setSampleRate(44100);
+        mono->init();
+        mono->outputs[Comp::AUDIO_OUTPUT].channels = 1;
+        mono->inputs[Comp::AUDIO_INPUT].channels = 1;
+        mono->inputs[cvInput].channels = 1;
+        mono->inputs[cvInput].setVoltage(cv(ch), 0);
+        monos.push_back(mono);
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+            poly.inputs[Comp::AUDIO_INPUT].setVoltage(input(ch, i), ch);
+            monos[ch]->inputs[Comp::AUDIO_INPUT].setVoltage(input(ch, i), 0);
+        }
+        poly.step();
+        for (int ch = 0; ch < channels; ++ch) {
+            monos[ch]->step();
+            assertEQ(poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(ch), monos[ch]->outputs[Comp::AUDIO_OUTPUT].getVoltage(0));
+        }
+    }
+    assertEQ(poly.getNumChannels(), channels);
+    assertEQ(poly.outputs[Comp::AUDIO_OUTPUT].getChannels(), channels);
+
+    // and the CV really did something
+    if (channels > 1) {
+        assertNE(poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(0), poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(1));
+    }
+}
+
+/**
+ * With mono CV, voices with the same input sound the same.
+ */
+template <class Comp>
+static void testMonoCV()
+{
+    const int channels = 7;
+    Comp poly;
+    poly.setSampleRate(44100);
+    poly.init();
+    poly.outputs[Comp::AUDIO_OUTPUT].channels = 1;
+    poly.inputs[Comp::AUDIO_INPUT].channels = channels;
+
+    for (int i = 0; i < 500; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+            poly.inputs[Comp::AUDIO_INPUT].setVoltage((i % 40 < 20) ? 1.f : -1.f, ch);
+        }
+        poly.step();
+        for (int ch = 1; ch < channels; ++ch) {
+            assertEQ(poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(ch), poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(0));
+        }
+    }
+    assertNE(poly.outputs[Comp::AUDIO_OUTPUT].getVoltage(0), 0);
+}
+
+/**
+ * VocalFilter only re-calculates the filters when the controls move,
+ * so make sure moving one gets through.
+ */
+static void testVocalFilterControlChange()
+{
+    using VF = VocalFilter<TestComposite>;
+    VF a, b;
+    for (VF* vf : {&a, &b}) {
+        vf->setSampleRate(44100);
+        vf->init();
+        vf->outputs[VF::AUDIO_OUTPUT].channels = 1;
+        vf->inputs[VF::AUDIO_INPUT].channels = 1;
+    }
+
+    bool different = false;
+    for (int i = 0; i < 200; ++i) {
+        if (i == 100) {
+            a.params[VF::FILTER_VOWEL_PARAM].value = 3;
+        }
+        for (VF* vf : {&a, &b}) {
+            vf->inputs[VF::AUDIO_INPUT].setVoltage((i % 40 < 20) ? 1.f : -1.f, 0);
+            vf->step();
+        }
+        const float va = a.outputs[VF::AUDIO_OUTPUT].getVoltage(0);
+        const float vb = b.outputs[VF::AUDIO_OUTPUT].getVoltage(0);
+        if (i < 100) {
+            assertEQ(va, vb);
+        } else {
+            different |= (va != vb);
+        }
+    }
+    assert(different);
+}
+
+static void testPoly()
+{
+    using VF = VocalFilter<TestComposite>;
+    testPolyMatchesMono<VF>(1, VF::FILTER_VOWEL_CV_INPUT);
+    testPolyMatchesMono<VF>(6, VF::FILTER_VOWEL_CV_INPUT);
+    testPolyMatchesMono<VF>(16, VF::FILTER_FC_CV_INPUT);
+    testMonoCV<VF>();
+    testVocalFilterControlChange();
+
+    testPolyMatchesMono<Animator>(1, Animator::FILTER_FC_CV_INPUT);
+    testPolyMatchesMono<Animator>(5, Animator::FILTER_FC_CV_INPUT);
+    testPolyMatchesMono<Animator>(16, Animator::FILTER_Q_CV_INPUT);
+    testMonoCV<Animator>();
+}
+
 static void testInputExtremes()
 {
     VocalAnimator<TestComposite> va;
@@ -363,6 +553,8 @@ void testVocalAnimator()
     testFormantTables2();
 
     testVocalFilter();
+    testFormantBank();
+    testPoly();
 #if defined(_DEBUG) && true
     printf("skipping extremes\n");
 #else